@@ -3,373 +3,31 @@
 
 #include "Geometry.hpp"
 
+#include "../XenonCooker/GeometrySource.hpp"
+
 #include "../XenonCore/Logging.hpp"
-#include "../XenonCore/CountingFence.hpp"
+#include "../XenonCore/JobGroup.hpp"
+#include "../XenonCore/Tracer.hpp"
 
-#define TINYGLTF_IMPLEMENTATION
-#define STB_IMAGE_IMPLEMENTATION
-#define STB_IMAGE_WRITE_IMPLEMENTATION
+// The glTF constants are used for the cooked samplers and images. tinygltf and stb_image are compiled with the cooker.
 #include <tiny_gltf.h>
-
-#include <optick.h>
-
-#include <latch>
-#include <fstream>
-
-constexpr std::array<const char*, 21> g_Attributes = {
-	"POSITION",
-	"NORMAL",
-	"TANGENT",
-	"COLOR_0",
-	"COLOR_1",
-	"COLOR_2",
-	"COLOR_3",
-	"COLOR_4",
-	"COLOR_5",
-	"COLOR_6",
-	"COLOR_7",
-	"TEXCOORD_0",
-	"TEXCOORD_1",
-	"TEXCOORD_2",
-	"TEXCOORD_3",
-	"TEXCOORD_4",
-	"TEXCOORD_5",
-	"TEXCOORD_6",
-	"TEXCOORD_7",
-	"JOINTS_0",
-	"WEIGHTS_0",
-};
-
-/**
- * Texture info type concept.
- */
-template<class Type>
-concept TextureInfo = (std::same_as<Type, tinygltf::TextureInfo> || std::same_as<Type, tinygltf::NormalTextureInfo> || std::same_as<Type, tinygltf::OcclusionTextureInfo>);
+#include <stb_image.h>
 
 namespace /* anonymous */
 {
-	/**
-	 * Check if the attribute exists in the primitive and if so, setup the vertex specification for that element.
-	 *
-	 * @param model The model to get the element information.
-	 * @param primitive The primitive containing the attribute information.
-	 * @param attribute The attribute name to check.
-	 * @param element The vertex element.
-	 * @param specification The specification to configure.
-	 * @return The size of the vertex buffer to store all the vertices.
-	 */
-	uint64_t ResolvePrimitive(
-		const tinygltf::Model& model,
-		const tinygltf::Primitive& primitive,
-		const std::string& attribute,
-		Xenon::Backend::InputElement element,
-		Xenon::Backend::VertexSpecification& specification)
-	{
-		OPTICK_EVENT();
-
-		if (!primitive.attributes.contains(attribute))
-			return 0;
-
-		const auto index = primitive.attributes.at(attribute);
-		const auto& accessor = model.accessors[index];
-		const auto& bufferView = model.bufferViews[accessor.bufferView];
-
-		// Setup the data type.
-		Xenon::Backend::AttributeDataType dataType = Xenon::Backend::AttributeDataType::Vec3;
-		switch (accessor.type)
-		{
-		case TINYGLTF_TYPE_VEC2:
-			dataType = Xenon::Backend::AttributeDataType::Vec2;
-			break;
-
-		case TINYGLTF_TYPE_VEC3:
-			dataType = Xenon::Backend::AttributeDataType::Vec3;
-			break;
-
-		case TINYGLTF_TYPE_VEC4:
-			dataType = Xenon::Backend::AttributeDataType::Vec4;
-			break;
-
-		case TINYGLTF_TYPE_MAT2:
-			dataType = Xenon::Backend::AttributeDataType::Mat2;
-			break;
-
-		case TINYGLTF_TYPE_MAT3:
-			dataType = Xenon::Backend::AttributeDataType::Mat3;
-			break;
-
-		case TINYGLTF_TYPE_MAT4:
-			dataType = Xenon::Backend::AttributeDataType::Mat4;
-			break;
-
-		case TINYGLTF_TYPE_SCALAR:
-			dataType = Xenon::Backend::AttributeDataType::Scalar;
-			break;
-
-		case TINYGLTF_TYPE_VECTOR:
-			dataType = Xenon::Backend::AttributeDataType::Vec3;
-			break;
-
-		case TINYGLTF_TYPE_MATRIX:
-			dataType = Xenon::Backend::AttributeDataType::Mat4;
-			break;
-
-		default:
-			XENON_LOG_ERROR("Invalid or unsupported vertex data type in the provided model file. Defaulting to vector 3.");
-			dataType = Xenon::Backend::AttributeDataType::Vec3;
-			break;
-		}
-
-		// Setup the component type.
-		switch (accessor.componentType)
-		{
-		case TINYGLTF_COMPONENT_TYPE_BYTE:
-			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Uint8);
-			break;
-
-		case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
-			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Int8);
-			break;
-
-		case TINYGLTF_COMPONENT_TYPE_SHORT:
-			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Int16);
-			break;
-
-		case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
-			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Uint16);
-			break;
-
-		case TINYGLTF_COMPONENT_TYPE_INT:
-			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Int32);
-			break;
-
-		case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
-			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Uint32);
-			break;
-
-		case TINYGLTF_COMPONENT_TYPE_FLOAT:
-			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Float);
-			break;
-
-		case TINYGLTF_COMPONENT_TYPE_DOUBLE:
-			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Double);
-			break;
-
-		default:
-			XENON_LOG_ERROR("Invalid or unsupported vertex element type in the provided model file.");
-			break;
-		}
-
-		return accessor.ByteStride(bufferView) * accessor.count;
-	}
-
-	/**
-	 * Attribute view structure.
-	 */
-	struct AttributeView final
-	{
-		using Iterator = std::vector<unsigned char>::const_iterator;
-
-		Iterator m_Begin;
-		Iterator m_End;
-
-		uint64_t m_Size = 0;
-		uint32_t m_Stride = 0;
-
-		Xenon::Backend::InputElement m_Element = Xenon::Backend::InputElement::VertexPosition;
-		Xenon::PrimitiveMode m_PrimitiveMode = Xenon::PrimitiveMode::Triangles;
-	};
-
-	/**
-	 * Get an attribute's buffer view.
-	 *
-	 * @param model The model in which the data are stored.
-	 * @param primitive The primitive to access.
-	 * @param element The vertex element to get the view of.
-	 * @return The tuple of iterators and sizes containing the begin and end iterators and the byte stride.
-	 */
-	decltype(auto) GetAttributeView(const tinygltf::Model& model, const tinygltf::Primitive& primitive, Xenon::Backend::InputElement element)
-	{
-		OPTICK_EVENT();
-
-		AttributeView view;
-		view.m_Element = element;
-
-		if (!primitive.attributes.contains(g_Attributes[Xenon::EnumToInt(element)]))
-			return view;
-
-		const auto& accessor = model.accessors[primitive.attributes.at(g_Attributes[Xenon::EnumToInt(element)])];
-		const auto& bufferView = model.bufferViews[accessor.bufferView];
-		const auto& buffer = model.buffers[bufferView.buffer];
-
-		view.m_Stride = accessor.ByteStride(bufferView);
-		view.m_Begin = buffer.data.begin() + accessor.byteOffset + bufferView.byteOffset;
-		view.m_End = view.m_Begin + (accessor.count * view.m_Stride);
-
-		view.m_Size = std::distance(view.m_Begin, view.m_End);
-
-		// Setup the vertex mode.
-		switch (primitive.mode)
-		{
-		case TINYGLTF_MODE_POINTS:
-			view.m_PrimitiveMode = Xenon::PrimitiveMode::Points;
-			break;
-
-		case TINYGLTF_MODE_LINE:
-			view.m_PrimitiveMode = Xenon::PrimitiveMode::Line;
-			break;
-
-		case TINYGLTF_MODE_LINE_LOOP:
-			view.m_PrimitiveMode = Xenon::PrimitiveMode::LineLoop;
-			break;
-
-		case TINYGLTF_MODE_LINE_STRIP:
-			view.m_PrimitiveMode = Xenon::PrimitiveMode::LineStrip;
-			break;
-
-		case TINYGLTF_MODE_TRIANGLES:
-			view.m_PrimitiveMode = Xenon::PrimitiveMode::Triangles;
-			break;
-
-		case TINYGLTF_MODE_TRIANGLE_STRIP:
-			view.m_PrimitiveMode = Xenon::PrimitiveMode::TriangleStrip;
-			break;
-
-		case TINYGLTF_MODE_TRIANGLE_FAN:
-			view.m_PrimitiveMode = Xenon::PrimitiveMode::TriangleFan;
-			break;
-
-		default:
-			XENON_LOG_ERROR("Invalid or unsupported vertex mode type in the provided model file. Defaulting to triangle.");
-			view.m_PrimitiveMode = Xenon::PrimitiveMode::Triangles;
-			break;
-		}
-
-		return view;
-	}
-
-	/**
-	 * Load a sub-mesh from a primitive.
-	 *
-	 * @param subMesh The sub-mesh to load the data to.
-	 * @param specification The vertex specification.
-	 * @param model The glTF model.
-	 * @param primitive The glTF primitive.
-	 * @param vertexBegin The vertex begin iterator to load the data to.
-	 * @param indexBegin The index begin iterator to load the data to.
-	 */
-	void LoadSubMesh(
-		Xenon::SubMesh& subMesh,
-		const Xenon::Backend::VertexSpecification& specification,
-		const tinygltf::Model& model,
-		const tinygltf::Primitive& primitive,
-		std::vector<unsigned char>::iterator vertexBegin,
-		std::vector<unsigned char>::iterator indexBegin)
-	{
-		OPTICK_EVENT();
-
-		// Setup the primitive mode.
-		switch (primitive.mode)
-		{
-		case TINYGLTF_MODE_POINTS:
-			subMesh.m_Mode = Xenon::PrimitiveMode::Points;
-			break;
-
-		case TINYGLTF_MODE_LINE:
-			subMesh.m_Mode = Xenon::PrimitiveMode::Line;
-			break;
-
-		case TINYGLTF_MODE_LINE_LOOP:
-			subMesh.m_Mode = Xenon::PrimitiveMode::LineLoop;
-			break;
-
-		case TINYGLTF_MODE_LINE_STRIP:
-			subMesh.m_Mode = Xenon::PrimitiveMode::LineStrip;
-			break;
-
-		case TINYGLTF_MODE_TRIANGLES:
-			subMesh.m_Mode = Xenon::PrimitiveMode::Triangles;
-			break;
-
-		case TINYGLTF_MODE_TRIANGLE_STRIP:
-			subMesh.m_Mode = Xenon::PrimitiveMode::TriangleStrip;
-			break;
-
-		case TINYGLTF_MODE_TRIANGLE_FAN:
-			subMesh.m_Mode = Xenon::PrimitiveMode::TriangleFan;
-			break;
-
-		default:
-			XENON_LOG_ERROR("Invalid or unsupported vertex mode type in the provided model file. Defaulting to triangle.");
-			subMesh.m_Mode = Xenon::PrimitiveMode::Triangles;
-			break;
-		}
-
-		uint64_t vertexStride = 0;
-		uint64_t vertexBufferSize = 0;
-
-		// Get the vertex information.
-		std::vector<AttributeView> attributes;
-		for (auto i = Xenon::EnumToInt(Xenon::Backend::InputElement::VertexPosition); i < Xenon::EnumToInt(Xenon::Backend::InputElement::VertexElementCount); i++)
-		{
-			if (specification.isAvailable(static_cast<Xenon::Backend::InputElement>(i)))
-			{
-				const auto& view = attributes.emplace_back(GetAttributeView(model, primitive, static_cast<Xenon::Backend::InputElement>(i)));
-				vertexStride += view.m_Stride;
-				vertexBufferSize += view.m_Size;
-			}
-		}
-
-		// Load the vertex data to the buffer.
-		subMesh.m_VertexCount = vertexBufferSize / vertexStride;
-		for (uint64_t i = 0; i < subMesh.m_VertexCount; i++)
-		{
-			for (auto& attribute : attributes)
-			{
-				if (attribute.m_Begin != attribute.m_End)
-				{
-					std::copy_n(attribute.m_Begin, attribute.m_Stride, vertexBegin);
-					attribute.m_Begin += attribute.m_Stride;
-				}
-
-				vertexBegin += attribute.m_Stride;
-			}
-		}
-
-		// Load the index buffer data.
-		if (primitive.indices >= 0)
-		{
-			const auto& accessor = model.accessors.at(primitive.indices);
-			const auto& bufferView = model.bufferViews.at(accessor.bufferView);
-			const auto& buffer = model.buffers.at(bufferView.buffer);
-
-			const auto stride = accessor.ByteStride(bufferView);
-			const auto start = accessor.byteOffset + bufferView.byteOffset;
-			const auto end = start + accessor.count * stride;
-
-			subMesh.m_IndexCount = accessor.count;
-			subMesh.m_IndexSize = static_cast<uint8_t>(stride);
-
-			if (subMesh.m_IndexOffset > 0)
-				subMesh.m_IndexOffset /= subMesh.m_IndexSize;
-
-			std::copy(buffer.data.begin() + start, buffer.data.begin() + end, indexBegin);
-		}
-	}
-
 	/**
 	 * Get the image specification.
 	 *
 	 * @param sampler The sampler.
 	 * @return The image sampler specification.
 	 */
-	XENON_NODISCARD Xenon::Backend::ImageSamplerSpecification GetImageSamplerSpecification(const tinygltf::Sampler& sampler) noexcept
+	XENON_NODISCARD Xenon::Backend::ImageSamplerSpecification GetImageSamplerSpecification(const Xenon::CookedSampler& sampler) noexcept
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		Xenon::Backend::ImageSamplerSpecification specification;
 
-		switch (sampler.minFilter)
+		switch (sampler.m_MinificationFilter)
 		{
 		case TINYGLTF_TEXTURE_FILTER_NEAREST:
 			specification.m_ImageMinificationFilter = Xenon::Backend::ImageFilter::Nearest;
@@ -393,7 +51,7 @@ namespace /* anonymous */
 			break;
 		}
 
-		switch (sampler.magFilter)
+		switch (sampler.m_MagnificationFilter)
 		{
 		case TINYGLTF_TEXTURE_FILTER_NEAREST:
 			specification.m_ImageMagificationFilter = Xenon::Backend::ImageFilter::Nearest;
@@ -425,22 +83,21 @@ namespace /* anonymous */
 	}
 
 	/**
-	 * Create a new texture.
+	 * Create a texture from a cooked texture.
+	 * If the texture does not reference an image or a sampler, the instance's default one is used.
 	 *
-	 * @tparam Type The texture info type.
-	 * @param geometry The geometry to get the images from.
-	 * @param model The model to get the images from.
-	 * @param info The texture info structure.
+	 * @param instance The instance reference.
+	 * @param geometry The geometry to get the images and samplers from.
+	 * @param texture The cooked texture.
 	 * @return The created texture structure.
 	 */
-	template<TextureInfo Type>
-	XENON_NODISCARD Xenon::Texture CreateTexture(Xenon::Instance& instance, const Xenon::Geometry& geometry, const tinygltf::Model& model, const Type& info)
+	XENON_NODISCARD Xenon::Texture CreateTexture(Xenon::Instance& instance, const Xenon::Geometry& geometry, const Xenon::CookedTexture& texture)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		Xenon::Texture xTexture = {};
 
-		if (info.index < 0)
+		if (texture.m_Image < 0 || static_cast<uint64_t>(texture.m_Image) >= geometry.getImageAndImageViews().size())
 		{
 			xTexture.m_pImage = instance.getDefaultImage();
 			xTexture.m_pImageView = instance.getDefaultImageView();
@@ -448,110 +105,18 @@ namespace /* anonymous */
 		}
 		else
 		{
-			const auto& texture = model.textures[info.index];
-
-			const auto& [pImage, pView] = geometry.getImageAndImageViews()[texture.source];
-			const auto& pSampler = geometry.getImageSamplers()[texture.sampler];
-
+			const auto& [pImage, pView] = geometry.getImageAndImageViews()[texture.m_Image];
 			xTexture.m_pImage = pImage.get();
 			xTexture.m_pImageView = pView.get();
-			xTexture.m_pImageSampler = pSampler.get();
-		}
 
-		return xTexture;
-	}
+			if (texture.m_Sampler < 0 || static_cast<uint64_t>(texture.m_Sampler) >= geometry.getImageSamplers().size())
+				xTexture.m_pImageSampler = instance.getDefaultImageSampler();
 
-	/**
-	 * Load a node from the model.
-	 *
-	 * @param instance The instance reference.
-	 * @param model The model to load from.
-	 * @param node The node to load.
-	 * @param geometry The mesh geometry.
-	 * @param vertices The vertex storage.
-	 * @param vertexItr The vertex storage iterator.
-	 * @param indices The index storage.
-	 * @param indexItr The index storage iterator.
-	 * @param synchronization The synchronization latch.
-	 */
-	void LoadNode(
-		Xenon::Instance& instance,
-		const tinygltf::Model& model,
-		const tinygltf::Node& node,
-		Xenon::Geometry& geometry,
-		std::vector<unsigned char>& vertices,
-		std::vector<unsigned char>::iterator& vertexItr,
-		std::vector<unsigned char>& indices,
-		std::vector<unsigned char>::iterator& indexItr,
-		std::latch& synchronization)
-	{
-		OPTICK_EVENT();
-
-		// If it's an invalid index, return.
-		if (node.mesh == -1)
-			return;
-
-		// Get the mesh and initialize everything.
-		const auto& gltfMesh = model.meshes[node.mesh];
-		auto& mesh = geometry.getMeshes().emplace_back();
-		mesh.m_Name = gltfMesh.name;
-		mesh.m_SubMeshes.reserve(gltfMesh.primitives.size());
-
-		// Load the sub-mesh information.
-		for (const auto& gltfPrimitive : gltfMesh.primitives)
-		{
-			// Create the primitive.
-			auto& subMesh = mesh.m_SubMeshes.emplace_back();
-			subMesh.m_VertexOffset = std::distance(vertices.begin(), vertexItr);
-			subMesh.m_IndexOffset = std::distance(indices.begin(), indexItr);
-
-			if (subMesh.m_VertexOffset > 0)
-				subMesh.m_VertexOffset /= geometry.getVertexSpecification().getSize();
-
-			// Setup the sub-mesh loader. This is done so VS won't fuck up the formatting smh...
-			const auto subMeshLoader = [&subMesh, &model, &geometry, &gltfPrimitive, vertexItr, indexItr, &synchronization]
-			{
-				OPTICK_EVENT_DYNAMIC("Loading Sub-Mesh Data");
-				LoadSubMesh(subMesh, geometry.getVertexSpecification(), model, gltfPrimitive, vertexItr, indexItr);
-				synchronization.count_down();
-			};
-
-			// Insert the job.
-			Xenon::XObject::GetJobSystem().insert(subMeshLoader);
-
-			// Get the next available vertex begin position.
-			for (auto i = Xenon::EnumToInt(Xenon::Backend::InputElement::VertexPosition); i < Xenon::EnumToInt(Xenon::Backend::InputElement::VertexElementCount); i++)
-			{
-				if (geometry.getVertexSpecification().isAvailable(static_cast<Xenon::Backend::InputElement>(i)) && gltfPrimitive.attributes.contains(g_Attributes[i]))
-				{
-					const auto& accessor = model.accessors[gltfPrimitive.attributes.at(g_Attributes[i])];
-					const auto& bufferView = model.bufferViews[accessor.bufferView];
-
-					vertexItr += accessor.ByteStride(bufferView) * accessor.count;
-				}
-			}
-
-			// Get the next available index begin position.
-			if (gltfPrimitive.indices >= 0)
-			{
-				const auto& accessor = model.accessors.at(gltfPrimitive.indices);
-				const auto& bufferView = model.bufferViews.at(accessor.bufferView);
-
-				indexItr += accessor.ByteStride(bufferView) * accessor.count;
-			}
-
-			// Setup the textures.
-			const auto& material = model.materials[gltfPrimitive.material];
-			subMesh.m_BaseColorTexture = CreateTexture(instance, geometry, model, material.pbrMetallicRoughness.baseColorTexture);
-			subMesh.m_RoughnessTexture = CreateTexture(instance, geometry, model, material.pbrMetallicRoughness.metallicRoughnessTexture);
-			subMesh.m_NormalTexture = CreateTexture(instance, geometry, model, material.normalTexture);
-			subMesh.m_OcclusionTexture = CreateTexture(instance, geometry, model, material.occlusionTexture);
-			subMesh.m_EmissiveTexture = CreateTexture(instance, geometry, model, material.emissiveTexture);
+			else
+				xTexture.m_pImageSampler = geometry.getImageSamplers()[texture.m_Sampler].get();
 		}
 
-		// // Load the children.
-		// for (const auto child : node.children)
-		// 	LoadNode(instance, model, model.nodes[child], geometry, vertices, vertexItr, indices, indexItr, synchronization);
+		return xTexture;
 	}
 
 	/**
@@ -601,153 +166,30 @@ namespace /* anonymous */
 
 namespace Xenon
 {
-	Xenon::Geometry Geometry::FromFile(Instance& instance, const std::filesystem::path& file)
+	Xenon::Geometry Geometry::FromFile(Instance& instance, const std::filesystem::path& file, bool optimize /*= false*/)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		Geometry geometry;
 
-		// Load the model data.
-		tinygltf::Model model;
-		std::string errorString;
-		std::string warningString;
-
-		// Try and load the model.
-		if (tinygltf::TinyGLTF loader; !loader.LoadASCIIFromFile(&model, &errorString, &warningString, file.string()))
-		{
-			// Show the error if there are any.
-			if (!errorString.empty())
-				XENON_LOG_ERROR("glTF loading error: {}", errorString);
-
-			// Show the warning if there are any.
-			if (!warningString.empty())
-				XENON_LOG_WARNING("glTF loading warning: {}", warningString);
-
-			return geometry;
-		}
-
-		// Show the warning if there are any.
-		if (!warningString.empty())
-			XENON_LOG_WARNING("glTF loading warning: {}", warningString);
-
-		// Resolve the vertex specification and other information.
-		uint64_t vertexBufferSize = 0;
-		uint64_t indexBufferSize = 0;
-
-		uint32_t workerSubmissions = 0;
-		for (const auto& mesh : model.meshes)
-		{
-			workerSubmissions += mesh.primitives.size();
-			for (const auto& primitive : mesh.primitives)
-			{
-				// Get the vertex information.
-				for (auto i = EnumToInt(Backend::InputElement::VertexPosition); i < EnumToInt(Backend::InputElement::VertexElementCount); i++)
-					vertexBufferSize += ResolvePrimitive(model, primitive, g_Attributes[i], static_cast<Backend::InputElement>(i), geometry.m_VertexSpecification);
-
-				// Get the index buffer size.
-				if (primitive.indices >= 0)
-				{
-					const auto& accessor = model.accessors.at(primitive.indices);
-					const auto& bufferView = model.bufferViews.at(accessor.bufferView);
-
-					indexBufferSize += accessor.count * accessor.ByteStride(bufferView);
-				}
-			}
-		}
-
-		// Check if we have data to create the vertex buffers.
-		if (vertexBufferSize == 0)
-		{
-			XENON_LOG_ERROR("The submitted model file '{}' does not have any vertex data to load!", file.string());
-			return geometry;
-		}
-
-		// Check if we have data to create the index buffers.
-		if (indexBufferSize == 0)
-		{
-			XENON_LOG_WARNING("The submitted model file '{}' does not have any index data to load!", file.string());
-		}
-
-		// Setup the image synchronization primitive.
-		auto imageSynchronization = CountingFence(model.images.size());
-
-		// Setup the images.
-		geometry.m_pImageAndImageViews.reserve(model.images.size());
-		for (const auto& image : model.images)
-		{
-			const auto imageLoader = [&instance, entry = &geometry.m_pImageAndImageViews.emplace_back(), &image, &imageSynchronization]
-			{
-				// Setup the image.
-				Xenon::Backend::ImageSpecification imageSpecification = {};
-				imageSpecification.m_Width = image.width;
-				imageSpecification.m_Height = image.height;
-				imageSpecification.m_Format = GetDataFormat(image.bits, image.component, image.pixel_type);
-				entry->first = instance.getFactory()->createImage(instance.getBackendDevice(), imageSpecification);
-
-				// Copy the image data to the image.
-				{
-					const auto copySize = entry->first->getWidth() * entry->first->getHeight() * image.component/* * (image.bits / 8)*/;
-					auto pStagingBuffer = instance.getFactory()->createBuffer(instance.getBackendDevice(), copySize, Xenon::Backend::BufferType::Staging);
-
-					pStagingBuffer->write(Xenon::ToBytes(image.image.data()), image.image.size());
-					entry->first->copyFrom(pStagingBuffer.get());
-				}
-
-				// Setup image view.
-				entry->second = instance.getFactory()->createImageView(instance.getBackendDevice(), entry->first.get(), {});
-
-				// Notify that we're done.
-				imageSynchronization.arrive();
-			};
-
-			XObject::GetJobSystem().insert(imageLoader);
-		}
-
-		// Setup the samplers.
-		geometry.m_pImageSamplers.reserve(model.samplers.size());
-		for (const auto& sampler : model.samplers)
-			geometry.m_pImageSamplers.emplace_back(instance.getFactory()->createImageSampler(instance.getBackendDevice(), GetImageSamplerSpecification(sampler)));
-
-		// Setup animations.
-		// for (const auto& animation : model.animations)
-		// {
-		// }
+		GeometrySource source;
+		if (source.load(file, optimize))
+			geometry.createResources(instance, source.getView());
 
-		// Wait till all the images are loaded before we proceed.
-		imageSynchronization.wait();
-
-		// Load the mesh information.
-		auto vertices = std::vector<unsigned char>(vertexBufferSize);
-		auto vertexItr = vertices.begin();
-
-		auto indices = std::vector<unsigned char>(indexBufferSize);
-		auto indexItr = indices.begin();
-
-		// Load the default scene.
-		geometry.m_Meshes.reserve(model.meshes.size());
-		auto synchronization = std::latch(workerSubmissions);
-
-		// Load the nodes.
-		for (const auto& node : model.nodes)
-			LoadNode(instance, model, node, geometry, vertices, vertexItr, indices, indexItr, synchronization);
-
-		// Wait till all the sub-meshes are loaded.
-		synchronization.wait();
+		return geometry;
+	}
 
-		// Load the vertex data and clear the buffer.
-		geometry.m_pVertexBuffer = instance.getFactory()->createBuffer(instance.getBackendDevice(), vertexBufferSize, Backend::BufferType::Vertex);
-		geometry.m_pVertexBuffer->write(ToBytes(vertices.data()), vertexBufferSize);
-		vertices.clear();
+	Xenon::Geometry Geometry::FromPackagedFile(Instance& instance, const std::filesystem::path& packageFile, const std::filesystem::path& file)
+	{
+		if (file.is_absolute())
+			return FromFile(instance, file);
 
-		// Load the index data and clear the buffer.
-		if (indexBufferSize > 0)
-		{
-			geometry.m_pIndexBuffer = instance.getFactory()->createBuffer(instance.getBackendDevice(), indexBufferSize, Backend::BufferType::Index);
-			geometry.m_pIndexBuffer->write(ToBytes(indices.data()), indexBufferSize);
-			indices.clear();
-		}
+		return FromFile(instance, packageFile.parent_path() / file);
+	}
 
-		return geometry;
+	bool Geometry::Cook(const std::filesystem::path& sourceFile, const std::filesystem::path& cookedFile, bool optimize /*= true*/)
+	{
+		return GeometrySource::Cook(sourceFile, cookedFile, optimize);
 	}
 
 	Xenon::Geometry Geometry::CreateQuad(Instance& instance)
@@ -828,4 +270,100 @@ namespace Xenon
 		STBI_FREE(pPixels);
 		return pImage;
 	}
+
+	void Geometry::createResources(Instance& instance, const CookedGeometryView& view)
+	{
+		XENON_TRACE_SCOPE();
+
+		m_VertexSpecification = view.m_VertexSpecification;
+
+		// Setup the job group to wait on the image loaders.
+		auto jobGroup = JobGroup();
+
+		// Setup the images.
+		m_pImageAndImageViews.reserve(view.m_Images.size());
+		for (uint64_t i = 0; i < view.m_Images.size(); i++)
+		{
+			const auto imageLoader = [&instance, entry = &m_pImageAndImageViews.emplace_back(), &image = view.m_Images[i], pixels = view.m_ImagePixels[i]]
+			{
+				// Setup the image.
+				Xenon::Backend::ImageSpecification imageSpecification = {};
+				imageSpecification.m_Width = image.m_Width;
+				imageSpecification.m_Height = image.m_Height;
+				imageSpecification.m_Format = GetDataFormat(image.m_Bits, image.m_Components, image.m_PixelType);
+				entry->first = instance.getFactory()->createImage(instance.getBackendDevice(), imageSpecification);
+
+				// Copy the image data to the image.
+				{
+					const auto copySize = entry->first->getWidth() * entry->first->getHeight() * image.m_Components/* * (image.m_Bits / 8)*/;
+					auto pStagingBuffer = instance.getFactory()->createBuffer(instance.getBackendDevice(), copySize, Xenon::Backend::BufferType::Staging);
+
+					pStagingBuffer->write(pixels.data(), copySize);
+					entry->first->copyFrom(pStagingBuffer.get());
+				}
+
+				// Setup image view.
+				entry->second = instance.getFactory()->createImageView(instance.getBackendDevice(), entry->first.get(), {});
+			};
+
+			// These are waited on below, so they must not be background jobs (see JobSystem::wait()).
+			XObject::GetJobSystem().insertDetached(jobGroup, imageLoader, JobPriority::Normal);
+		}
+
+		// Setup the samplers.
+		m_pImageSamplers.reserve(view.m_Samplers.size());
+		for (const auto& sampler : view.m_Samplers)
+			m_pImageSamplers.emplace_back(instance.getFactory()->createImageSampler(instance.getBackendDevice(), GetImageSamplerSpecification(sampler)));
+
+		// Setup animations.
+		// for (const auto& animation : model.animations)
+		// {
+		// }
+
+		// Wait till all the images are loaded before we proceed.
+		XObject::GetJobSystem().wait(jobGroup);
+
+		// Setup the meshes.
+		m_Meshes.reserve(view.m_Meshes.size());
+		for (const auto& cookedMesh : view.m_Meshes)
+		{
+			auto& mesh = m_Meshes.emplace_back();
+			mesh.m_Name = view.m_Names.substr(cookedMesh.m_NameOffset, cookedMesh.m_NameSize);
+			mesh.m_SubMeshes.reserve(cookedMesh.m_SubMeshCount);
+
+			for (const auto& cookedSubMesh : view.m_SubMeshes.subspan(cookedMesh.m_FirstSubMesh, cookedMesh.m_SubMeshCount))
+			{
+				auto& subMesh = mesh.m_SubMeshes.emplace_back();
+				subMesh.m_BaseColorTexture = CreateTexture(instance, *this, cookedSubMesh.m_BaseColorTexture);
+				subMesh.m_RoughnessTexture = CreateTexture(instance, *this, cookedSubMesh.m_RoughnessTexture);
+				subMesh.m_NormalTexture = CreateTexture(instance, *this, cookedSubMesh.m_NormalTexture);
+				subMesh.m_OcclusionTexture = CreateTexture(instance, *this, cookedSubMesh.m_OcclusionTexture);
+				subMesh.m_EmissiveTexture = CreateTexture(instance, *this, cookedSubMesh.m_EmissiveTexture);
+				subMesh.m_VertexOffset = cookedSubMesh.m_VertexOffset;
+				subMesh.m_VertexCount = cookedSubMesh.m_VertexCount;
+				subMesh.m_IndexOffset = cookedSubMesh.m_IndexOffset;
+				subMesh.m_IndexCount = cookedSubMesh.m_IndexCount;
+				subMesh.m_MeshletOffset = cookedSubMesh.m_MeshletOffset;
+				subMesh.m_MeshletCount = cookedSubMesh.m_MeshletCount;
+				subMesh.m_Mode = static_cast<PrimitiveMode>(cookedSubMesh.m_Mode);
+				subMesh.m_IndexSize = cookedSubMesh.m_IndexSize;
+			}
+		}
+
+		m_Meshlets.assign(view.m_Meshlets.begin(), view.m_Meshlets.end());
+
+		// Load the vertex data. The buffer copies the data to it's staging buffer, so the data are only copied once before the transfer.
+		if (!view.m_Vertices.empty())
+		{
+			m_pVertexBuffer = instance.getFactory()->createBuffer(instance.getBackendDevice(), view.m_Vertices.size(), Backend::BufferType::Vertex);
+			m_pVertexBuffer->write(view.m_Vertices.data(), view.m_Vertices.size());
+		}
+
+		// Load the index data.
+		if (!view.m_Indices.empty())
+		{
+			m_pIndexBuffer = instance.getFactory()->createBuffer(instance.getBackendDevice(), view.m_Indices.size(), Backend::BufferType::Index);
+			m_pIndexBuffer->write(view.m_Indices.data(), view.m_Indices.size());
+		}
+	}
 }
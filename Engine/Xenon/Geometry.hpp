@@ -5,26 +5,12 @@
 
 #include "Instance.hpp"
 #include "Material.hpp"
+#include "../XenonCooker/CookedGeometry.hpp"
 
 #include <filesystem>
 
 namespace Xenon
 {
-	/**
-	 * Primitive mode.
-	 * This defines what the primitive mode is for a single
-	 */
-	enum class PrimitiveMode : uint8_t
-	{
-		Points,
-		Line,
-		LineLoop,
-		LineStrip,
-		Triangles,
-		TriangleStrip,
-		TriangleFan
-	};
-
 	/**
 	 * Sub-mesh structure.
 	 * Sub-meshes are the building blocks of a mesh.
@@ -43,6 +29,11 @@ namespace Xenon
 		uint64_t m_IndexOffset = 0;
 		uint64_t m_IndexCount = 0;		// If this is set to 0, it will draw using the vertices.
 
+		// The sub-mesh's meshlets in the geometry's meshlets. Each meshlet's index range is relative to the sub-mesh's index offset.
+		// Only indexed triangle lists with three float positions have meshlets; the others have to be culled as a whole.
+		uint64_t m_MeshletOffset = 0;
+		uint64_t m_MeshletCount = 0;
+
 		PrimitiveMode m_Mode = PrimitiveMode::Triangles;
 		uint8_t m_IndexSize = 0;
 
@@ -54,6 +45,18 @@ namespace Xenon
 		 * @return False if the they're not equal.
 		 */
 		XENON_NODISCARD bool operator==(const SubMesh& other) const = default;
+
+		/**
+		 * Combine the sub-mesh to a hasher.
+		 * This skips the padding, so sub-meshes which compare equal always produce the same hash.
+		 *
+		 * @param hasher The hasher to combine with.
+		 */
+		void hashValue(Hasher& hasher) const
+		{
+			hasher.combine(m_BaseColorTexture, m_RoughnessTexture, m_NormalTexture, m_OcclusionTexture, m_EmissiveTexture);
+			hasher.combine(m_VertexOffset, m_VertexCount, m_IndexOffset, m_IndexCount, m_MeshletOffset, m_MeshletCount, m_Mode, m_IndexSize);
+		}
 	};
 
 	/**
@@ -86,12 +89,41 @@ namespace Xenon
 
 		/**
 		 * Load the meshes from a file and create the geometry class.
+		 * Text (.gltf) and binary (.glb) glTF files are supported, along with cooked geometry (.xgeo) files. Cooked files are mapped and
+		 * their data are copied straight to the GPU buffers and images without any parsing.
 		 *
 		 * @param instance The instance reference.
 		 * @param file The file path to load the data from.
+		 * @param optimize Whether to optimize the glTF triangle lists for the vertex cache, overdraw and vertex fetch, and to split them into
+		 * meshlets. This is slow for large meshes, so it's best done once with Cook(). Default is false.
+		 * @return The created geometry.
+		 */
+		XENON_NODISCARD static Geometry FromFile(Instance& instance, const std::filesystem::path& file, bool optimize = false);
+
+		/**
+		 * Load the meshes from a file referenced by a package and create the geometry class.
+		 * The asset packager stores the cooked geometry files relative to the package file, so a relative file is resolved against the
+		 * package's directory instead of the working directory.
+		 *
+		 * @param instance The instance reference.
+		 * @param packageFile The package file which references the file.
+		 * @param file The file path stored in the package.
 		 * @return The created geometry.
 		 */
-		XENON_NODISCARD static Geometry FromFile(Instance& instance, const std::filesystem::path& file);
+		XENON_NODISCARD static Geometry FromPackagedFile(Instance& instance, const std::filesystem::path& packageFile, const std::filesystem::path& file);
+
+		/**
+		 * Cook a glTF file to a cooked geometry file.
+		 * This is the same as GeometrySource::Cook(), which tools should use since it does not depend on the GPU backends.
+		 *
+		 * @param sourceFile The glTF file to cook.
+		 * @param cookedFile The cooked geometry file to write.
+		 * @param optimize Whether to optimize the triangle lists for the vertex cache, overdraw and vertex fetch, and to split them into
+		 * meshlets. Default is true.
+		 * @return True if the file was cooked.
+		 * @return False if the source file could not be loaded or if the cooked file could not be written.
+		 */
+		static bool Cook(const std::filesystem::path& sourceFile, const std::filesystem::path& cookedFile, bool optimize = true);
 
 		/**
 		 * Create a quad geometry.
@@ -159,6 +191,13 @@ namespace Xenon
 		 */
 		XENON_NODISCARD const std::vector<Mesh>& getMeshes() const { return m_Meshes; }
 
+		/**
+		 * Get the meshlets of all the sub-meshes.
+		 *
+		 * @return The meshlets.
+		 */
+		XENON_NODISCARD const std::vector<Meshlet>& getMeshlets() const noexcept { return m_Meshlets; }
+
 		/**
 		 * Get the image and it's image view objects.
 		 *
@@ -173,6 +212,15 @@ namespace Xenon
 		 */
 		XENON_NODISCARD const ImageSamplerContainer& getImageSamplers() const noexcept { return m_pImageSamplers; }
 
+	private:
+		/**
+		 * Create the buffers, images, samplers and meshes using the cooked data.
+		 *
+		 * @param instance The instance reference.
+		 * @param view The cooked geometry view.
+		 */
+		void createResources(Instance& instance, const CookedGeometryView& view);
+
 	private:
 		std::unique_ptr<Backend::Buffer> m_pIndexBuffer = nullptr;
 		std::unique_ptr<Backend::Buffer> m_pVertexBuffer = nullptr;
@@ -181,6 +229,7 @@ namespace Xenon
 		ImageSamplerContainer m_pImageSamplers;
 
 		std::vector<Mesh> m_Meshes;
+		std::vector<Meshlet> m_Meshlets;
 
 		Backend::VertexSpecification m_VertexSpecification;
 	};
@@ -196,7 +245,7 @@ namespace std
 	{
 		std::size_t operator()(const Xenon::SubMesh& subMesh) const
 		{
-			return Xenon::GenerateHash(Xenon::ToBytes(&subMesh), sizeof(Xenon::SubMesh));
+			return Xenon::Hasher().combine(subMesh).getHash();
 		}
 	};
 }
\ No newline at end of file
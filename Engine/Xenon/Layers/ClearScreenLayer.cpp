@@ -3,8 +3,7 @@
 
 #include "ClearScreenLayer.hpp"
 #include "../Renderer.hpp"
-
-#include <optick.h>
+#include "../../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -16,7 +15,7 @@ namespace Xenon
 
 	void ClearScreenLayer::onUpdate(Layer* pPreviousLayer, uint32_t imageIndex, uint32_t frameIndex)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		m_pCommandRecorder->begin();
 		m_pCommandRecorder->bind(m_pRasterizer.get(), { m_ClearColor });
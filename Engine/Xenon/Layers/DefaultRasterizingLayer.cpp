@@ -7,8 +7,8 @@
 #include "../DefaultCacheHandler.hpp"
 
 #include "../../XenonCore/Logging.hpp"
+#include "../../XenonCore/Tracer.hpp"
 
-#include <optick.h>
 #include <glm/vec4.hpp>
 
 namespace Xenon
@@ -20,7 +20,7 @@ namespace Xenon
 
 	void DefaultRasterizingLayer::onUpdate(Layer* pPreviousLayer, uint32_t imageIndex, uint32_t frameIndex)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		// Begin recording.
 		m_pCommandRecorder->begin();
@@ -41,7 +41,7 @@ namespace Xenon
 
 	std::unique_ptr<Xenon::Backend::Descriptor> DefaultRasterizingLayer::createPerGeometryDescriptor(Pipeline& pipeline, Group group)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		std::unique_ptr<Xenon::Backend::Descriptor> pDescriptor = pipeline.m_pPipeline->createDescriptor(Backend::DescriptorType::PerGeometry);
 		if (m_pScene->getRegistry().any_of<Components::Transform>(group))
@@ -52,7 +52,7 @@ namespace Xenon
 
 	void DefaultRasterizingLayer::setupMaterialDescriptor(Pipeline& pipeline, SubMesh& subMesh, const MaterialSpecification& specification) const
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		// Get if we've already crated a material descriptor for the sub-mesh.
 		if (pipeline.m_pMaterialDescriptors.contains(subMesh))
@@ -161,7 +161,7 @@ namespace Xenon
 
 	void DefaultRasterizingLayer::issueDrawCalls()
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		// Return without doing anything is a scene is not attached.
 		if (m_pScene == nullptr)
@@ -179,7 +179,7 @@ namespace Xenon
 			// Setup the material's pipeline if we need to.
 			if (!m_pPipelines.contains(material))
 			{
-				OPTICK_EVENT_DYNAMIC("Creating Pipeline For Material");
+				XENON_TRACE_SCOPE_DYNAMIC("Creating Pipeline For Material");
 
 				// Create the pipeline.
 				auto& pipeline = m_pPipelines[material];
@@ -222,7 +222,7 @@ namespace Xenon
 
 	void DefaultRasterizingLayer::geometryPass(Backend::Descriptor* pPerGeometryDescriptor, Geometry& geometry, Pipeline& pipeline)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		m_pCommandRecorder->bind(pipeline.m_pPipeline.get(), geometry.getVertexSpecification());
 		m_pCommandRecorder->bind(geometry.getVertexBuffer(), geometry.getVertexSpecification().getSize());
@@ -230,11 +230,11 @@ namespace Xenon
 		// Bind the sub-meshes.
 		for (const auto& mesh : geometry.getMeshes())
 		{
-			OPTICK_EVENT_DYNAMIC("Binding Mesh");
+			XENON_TRACE_SCOPE_DYNAMIC("Binding Mesh");
 
 			for (const auto& subMesh : mesh.m_SubMeshes)
 			{
-				OPTICK_EVENT_DYNAMIC("Issuing Draw Calls");
+				XENON_TRACE_SCOPE_DYNAMIC("Issuing Draw Calls");
 
 				// If the sub-mesh is occluded just skip.
 				if (m_pOcclusionLayer && m_pOcclusionLayer->getSamples(subMesh) == 0)
@@ -27,8 +27,8 @@ namespace Xenon
 		{
 			std::unique_ptr<Backend::RasterizingPipeline> m_pPipeline = nullptr;
 			std::unique_ptr<Backend::Descriptor> m_pSceneDescriptor = nullptr;
-			std::unordered_map<Group, std::unique_ptr<Backend::Descriptor>> m_pPerGeometryDescriptors;
-			std::unordered_map<SubMesh, std::unique_ptr<Backend::Descriptor>> m_pMaterialDescriptors;
+			FlatHashMap<Group, std::unique_ptr<Backend::Descriptor>> m_pPerGeometryDescriptors;
+			FlatHashMap<SubMesh, std::unique_ptr<Backend::Descriptor>> m_pMaterialDescriptors;
 		};
 
 	public:
@@ -111,7 +111,7 @@ namespace Xenon
 
 		std::unordered_map<std::thread::id, std::unique_ptr<Backend::CommandRecorder>> m_pThreadLocalCommandRecorder;
 
-		std::unordered_map<Material, Pipeline> m_pPipelines;
+		FlatHashMap<Material, Pipeline> m_pPipelines;
 
 		std::atomic_uint64_t m_DrawCount = 0;
 
@@ -3,8 +3,7 @@
 
 #include "DefaultRayTracingLayer.hpp"
 #include "../Renderer.hpp"
-
-#include <optick.h>
+#include "../../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -15,7 +14,7 @@ namespace Xenon
 
 	void DefaultRayTracingLayer::onUpdate(Layer* pPreviousLayer, uint32_t imageIndex, uint32_t frameIndex)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		m_pCommandRecorder->begin();
 
@@ -32,7 +31,7 @@ namespace Xenon
 
 	void DefaultRayTracingLayer::addDrawData(Geometry&& geometry, Backend::RayTracingPipeline* pPipeline)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		// Setup the acceleration structure geometry.
 		Backend::AccelerationStructureGeometry ASGeometry;
@@ -7,8 +7,7 @@
 #include "../DefaultCacheHandler.hpp"
 
 #include "../../XenonShaderBank/Diffusion/MipMapGenerator.comp.hpp"
-
-#include <optick.h>
+#include "../../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -43,7 +42,7 @@ namespace Xenon
 
 		void DiffusionLayer::onUpdate(Layer* pPreviousLayer, uint32_t imageIndex, uint32_t frameIndex)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pCommandRecorder->begin();
 
@@ -54,7 +53,7 @@ namespace Xenon
 
 		void DiffusionLayer::setSourceImage(Backend::Image* pImage)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			getInstance().getBackendDevice()->waitIdle();
 			m_pDiffusionPass->setSourceImage(pImage);
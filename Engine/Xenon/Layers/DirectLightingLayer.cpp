@@ -7,8 +7,7 @@
 #include "../DefaultCacheHandler.hpp"
 
 #include "../../XenonShaderBank/DirectLighting/DirectLighting.comp.hpp"
-
-#include <optick.h>
+#include "../../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -39,7 +38,7 @@ namespace Xenon
 
 		void DirectLightingLayer::onUpdate(Layer* pPreviousLayer, uint32_t imageIndex, uint32_t frameIndex)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Copy the data to the required buffers.
 			setupBuffers();
@@ -82,7 +81,7 @@ namespace Xenon
 
 		void DirectLightingLayer::setupBuffers()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			std::vector<Components::LightSource> lightSources;
 			for (const auto group : m_pScene->getRegistry().view<Components::LightSource>())
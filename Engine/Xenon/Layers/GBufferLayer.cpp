@@ -8,13 +8,12 @@
 
 #include "../../XenonShaderBank/GBuffer/GBuffer.vert.hpp"
 #include "../../XenonShaderBank/GBuffer/GBuffer.frag.hpp"
+#include "../../XenonCore/Tracer.hpp"
 
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/rotate_vector.hpp>
 
-#include <optick.h>
-
 constexpr auto g_PositiveXFace = glm::vec3(0.0f, 0.0f, 1.0f);
 constexpr auto g_NegativeXFace = glm::vec3(0.0f, 0.0f, -1.0f);
 // constexpr auto g_PositiveXFace = glm::vec3(0.0f, 0.0f, -1.0f);
@@ -92,7 +91,7 @@ namespace Xenon
 
 		void GBufferLayer::onPreUpdate()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Return if no scene is attached.
 			if (!m_pScene)
@@ -111,7 +110,7 @@ namespace Xenon
 
 		void GBufferLayer::onUpdate(Layer* pPreviousLayer, uint32_t imageIndex, uint32_t frameIndex)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Rotate the camera.
 			rotateCamera();
@@ -136,7 +135,7 @@ namespace Xenon
 
 		void GBufferLayer::setScene(Scene& scene)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pScene = &scene;
 			scene.setupDescriptor(m_pSceneDescriptor.get(), m_pPipeline.get());
@@ -144,7 +143,7 @@ namespace Xenon
 
 		void GBufferLayer::issueDrawCalls()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Iterate over the geometries and draw.
 			for (const auto& group : m_pScene->getRegistry().view<Geometry, Material>())
@@ -159,7 +158,7 @@ namespace Xenon
 				// Bind the sub-meshes.
 				for (const auto& mesh : geometry.getMeshes())
 				{
-					OPTICK_EVENT_DYNAMIC("Binding Mesh");
+					XENON_TRACE_SCOPE_DYNAMIC("Binding Mesh");
 
 					for (const auto& subMesh : mesh.m_SubMeshes)
 						performDraw(subMesh, geometry);
@@ -169,7 +168,7 @@ namespace Xenon
 
 		void GBufferLayer::performDraw(const SubMesh& subMesh, Geometry& geometry)
 		{
-			OPTICK_EVENT("Issuing Occlusion Pass Draw Calls");
+			XENON_TRACE_SCOPE("Issuing Occlusion Pass Draw Calls");
 
 			m_pCommandRecorder->bind(m_pPipeline.get(), m_pUserDefinedDescriptor.get(), m_pMaterialDescriptors[subMesh].get(), nullptr, m_pSceneDescriptor.get());
 
@@ -186,7 +185,7 @@ namespace Xenon
 
 		void GBufferLayer::createMaterial(SubMesh& subMesh)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Get the material if we already have one.
 			if (m_pMaterialDescriptors.contains(subMesh))
@@ -199,7 +198,7 @@ namespace Xenon
 
 		void GBufferLayer::rotateCamera()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Get the camera information.
 			const auto position = m_pScene->getCamera()->m_Position;
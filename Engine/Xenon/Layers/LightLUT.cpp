@@ -9,8 +9,7 @@
 
 #include "../../XenonShaderBank/LightLUT/LightLUT.vert.hpp"
 #include "../../XenonShaderBank/LightLUT/LightLUT.frag.hpp"
-
-#include <optick.h>
+#include "../../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -44,7 +43,7 @@ namespace Xenon
 
 		void LightLUT::onPreUpdate()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Get the light count.
 			uint32_t lightCount = 0;
@@ -75,7 +74,7 @@ namespace Xenon
 
 		void LightLUT::onUpdate(Layer* pPreviousLayer, uint32_t imageIndex, uint32_t frameIndex)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Begin recording.
 			m_pCommandRecorder->begin();
@@ -100,7 +99,7 @@ namespace Xenon
 
 		void LightLUT::setScene(Scene& scene)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pScene = &scene;
 			m_pScene->setupDescriptor(m_pSceneDescriptor.get(), m_pPipeline.get());
@@ -108,14 +107,14 @@ namespace Xenon
 
 		void LightLUT::setAttachment(DirectLightingLayer* pLayer)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pAttachment = pLayer;
 		}
 
 		void LightLUT::issueDrawCalls()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Iterate over the geometries and draw.
 			for (const auto& group : m_pScene->getRegistry().view<Geometry, Material>())
@@ -130,11 +129,11 @@ namespace Xenon
 				// Bind the sub-meshes.
 				for (const auto& mesh : geometry.getMeshes())
 				{
-					OPTICK_EVENT_DYNAMIC("Binding Mesh");
+					XENON_TRACE_SCOPE_DYNAMIC("Binding Mesh");
 
 					for (const auto& subMesh : mesh.m_SubMeshes)
 					{
-						OPTICK_EVENT_DYNAMIC("Issuing Occlusion Pass Draw Calls");
+						XENON_TRACE_SCOPE_DYNAMIC("Issuing Occlusion Pass Draw Calls");
 
 						m_pCommandRecorder->bind(geometry.getIndexBuffer(), static_cast<Backend::IndexBufferStride>(subMesh.m_IndexSize));
 						m_pCommandRecorder->bind(m_pPipeline.get(), m_pUserDefinedDescriptor.get(), nullptr, nullptr, m_pSceneDescriptor.get());
@@ -9,8 +9,7 @@
 #include "../../XenonCore/Logging.hpp"
 
 #include "../../XenonShaderBank/Occlusion/Occlusion.vert.hpp"
-
-#include <optick.h>
+#include "../../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -31,7 +30,7 @@ namespace Xenon
 
 	void OcclusionLayer::onPreUpdate()
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		// Get the query samples structure for the current command buffer.
 		auto& querySample = m_OcclusionQuerySamples[m_pCommandRecorder->getCurrentIndex()];
@@ -62,7 +61,7 @@ namespace Xenon
 
 	void OcclusionLayer::onUpdate(Layer* pPreviousLayer, uint32_t imageIndex, uint32_t frameIndex)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		// Begin recording.
 		m_pCommandRecorder->begin();
@@ -102,15 +101,17 @@ namespace Xenon
 
 	uint64_t OcclusionLayer::getSamples(const SubMesh& subMesh)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		auto lock = std::scoped_lock(m_Mutex);
-		return m_OcclusionQuerySamples[m_pCommandRecorder->getCurrentIndex()].m_SubMeshSamples[subMesh];
+		const auto& subMeshSamples = m_OcclusionQuerySamples[m_pCommandRecorder->getCurrentIndex()].m_SubMeshSamples;
+		const auto itr = subMeshSamples.find(subMesh);
+		return itr != subMeshSamples.end() ? itr->second : 0;
 	}
 
 	void OcclusionLayer::issueDrawCalls()
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		// Setup the occlusion scene descriptor if needed.
 		if (!m_pOcclusionSceneDescriptors.contains(m_pScene))
@@ -149,7 +150,7 @@ namespace Xenon
 			// Bind the sub-meshes.
 			for (const auto& mesh : geometry.getMeshes())
 			{
-				OPTICK_EVENT_DYNAMIC("Binding Mesh");
+				XENON_TRACE_SCOPE_DYNAMIC("Binding Mesh");
 
 				for (const auto& subMesh : mesh.m_SubMeshes)
 					performDraw(subMesh, geometry, pPerGeometryDescriptor, pOcclusionSceneDescriptor, querySample, index);
@@ -159,7 +160,7 @@ namespace Xenon
 
 	void OcclusionLayer::performDraw(const SubMesh& subMesh, Geometry& geometry, Backend::Descriptor* pPerGeometryDescriptor, Backend::Descriptor* pOcclusionSceneDescriptor, OcclusionQuerySamples& samples, uint32_t& index)
 	{
-		OPTICK_EVENT("Issuing Occlusion Pass Draw Calls");
+		XENON_TRACE_SCOPE("Issuing Occlusion Pass Draw Calls");
 
 		m_pCommandRecorder->bind(m_pOcclusionPipeline.get(), nullptr, nullptr, pPerGeometryDescriptor, pOcclusionSceneDescriptor);
 
@@ -184,7 +185,7 @@ namespace Xenon
 
 	std::unique_ptr<Xenon::Backend::Descriptor> OcclusionLayer::createPerGeometryDescriptor(Group group)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		// Create only if we need one of them. Else just don't...
 		// if (m_pScene->getRegistry().any_of<Components::Transform>(group))
@@ -9,6 +9,8 @@
 #include "../../XenonBackend/RasterizingPipeline.hpp"
 #include "../../XenonBackend/OcclusionQuery.hpp"
 
+#include "../../XenonCore/FlatHashMap.hpp"
+
 namespace Xenon
 {
 	/**
@@ -25,8 +27,8 @@ namespace Xenon
 		 */
 		struct OcclusionQuerySamples final
 		{
-			std::unordered_map<SubMesh, uint64_t> m_SubMeshSamples;
-			std::unordered_map<SubMesh, uint32_t> m_SubMeshIndexMap;
+			FlatHashMap<SubMesh, uint64_t> m_SubMeshSamples;
+			FlatHashMap<SubMesh, uint32_t> m_SubMeshIndexMap;
 
 			std::unique_ptr<Backend::OcclusionQuery> m_pOcclusionQuery = nullptr;
 
@@ -103,7 +105,7 @@ namespace Xenon
 
 		std::unordered_map<const Scene*, std::unique_ptr<Backend::Descriptor>> m_pOcclusionSceneDescriptors;
 
-		std::unordered_map<Group, std::unique_ptr<Backend::Descriptor>> m_pPerGeometryDescriptors;
+		FlatHashMap<Group, std::unique_ptr<Backend::Descriptor>> m_pPerGeometryDescriptors;
 
 		std::vector<OcclusionQuerySamples> m_OcclusionQuerySamples;
 	};
@@ -7,8 +7,8 @@
 #include "../DefaultCacheHandler.hpp"
 
 #include "../../XenonShaderBank/ShadowMap/ShadowMap.vert.hpp"
+#include "../../XenonCore/Tracer.hpp"
 
-#include <optick.h>
 #include <glm/gtc/matrix_transform.hpp>
 
 namespace Xenon
@@ -43,7 +43,7 @@ namespace Xenon
 
 		void ShadowMapLayer::onUpdate(Layer* pPreviousLayer, uint32_t imageIndex, uint32_t frameIndex)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Begin recording.
 			m_pCommandRecorder->begin();
@@ -64,7 +64,7 @@ namespace Xenon
 
 		Xenon::Texture ShadowMapLayer::getShadowTexture()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			Texture texture;
 			texture.m_pImage = getShadowImage();
@@ -76,7 +76,7 @@ namespace Xenon
 
 		void ShadowMapLayer::issueDrawCalls()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Return without doing anything is a scene is not attached.
 			if (m_pScene == nullptr)
@@ -118,7 +118,7 @@ namespace Xenon
 				// Bind the sub-meshes.
 				for (const auto& mesh : geometry.getMeshes())
 				{
-					OPTICK_EVENT_DYNAMIC("Binding Mesh");
+					XENON_TRACE_SCOPE_DYNAMIC("Binding Mesh");
 
 					for (const auto& subMesh : mesh.m_SubMeshes)
 						performDraw(subMesh, geometry, pPerGeometryDescriptor);
@@ -128,7 +128,7 @@ namespace Xenon
 
 		void ShadowMapLayer::performDraw(const SubMesh& subMesh, Geometry& geometry, Backend::Descriptor* pDescriptor)
 		{
-			OPTICK_EVENT("Issuing Draw Calls");
+			XENON_TRACE_SCOPE("Issuing Draw Calls");
 
 			m_pCommandRecorder->bind(m_pPipeline.get(), nullptr, nullptr, pDescriptor, m_LightCamera.m_pDescriptor.get());
 
@@ -145,7 +145,7 @@ namespace Xenon
 
 		Xenon::Experimental::ShadowMapLayer::ShadowCamera ShadowMapLayer::calculateShadowCamera(const Components::LightSource& lightSource) const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			ShadowCamera camera = {};
 			camera.m_View = glm::lookAt(lightSource.m_Position, lightSource.m_Position + lightSource.m_Direction, m_pScene->getCamera()->m_WorldUp);
@@ -156,7 +156,7 @@ namespace Xenon
 
 		std::unique_ptr<Xenon::Backend::Descriptor> ShadowMapLayer::createPerGeometryDescriptor(Group group)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			std::unique_ptr<Xenon::Backend::Descriptor> pDescriptor = m_pPipeline->createDescriptor(Backend::DescriptorType::PerGeometry);
 			if (m_pScene->getRegistry().any_of<Components::Transform>(group))
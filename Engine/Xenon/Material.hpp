@@ -28,6 +28,17 @@ namespace Xenon
 		 * @return False if the they're not equal.
 		 */
 		XENON_NODISCARD bool operator==(const Texture& other) const = default;
+
+		/**
+		 * Combine the texture to a hasher.
+		 * The texture only refers to runtime resources, so they are combined using their addresses.
+		 *
+		 * @param hasher The hasher to combine with.
+		 */
+		void hashValue(Hasher& hasher) const
+		{
+			hasher.combine(XENON_BIT_CAST(uintptr_t, m_pImage), XENON_BIT_CAST(uintptr_t, m_pImageView), XENON_BIT_CAST(uintptr_t, m_pImageSampler));
+		}
 	};
 
 	/**
@@ -65,6 +76,25 @@ namespace Xenon
 
 		MaterialPayload m_Payload;
 		MaterialPropertyType m_Type;
+
+		/**
+		 * Combine the material property to a hasher.
+		 * Note that the payloads are runtime resources, so they are combined using their addresses.
+		 *
+		 * @param hasher The hasher to combine with.
+		 */
+		void hashValue(Hasher& hasher) const
+		{
+			hasher.combine(m_Type, static_cast<uint64_t>(m_Payload.index()));
+			std::visit([&hasher](const auto& payload)
+				{
+					if constexpr (std::is_pointer_v<std::remove_cvref_t<decltype(payload)>>)
+						hasher.combine(XENON_BIT_CAST(uintptr_t, payload));
+
+					else
+						hasher.combine(payload);
+				}, m_Payload);
+		}
 	};
 
 	/**
@@ -77,6 +107,16 @@ namespace Xenon
 		Backend::RayTracingPipelineSpecification m_RayTracingPipelineSpecification;
 
 		std::vector<MaterialProperty> m_Properties;
+
+		/**
+		 * Combine the material specification to a hasher.
+		 *
+		 * @param hasher The hasher to combine with.
+		 */
+		void hashValue(Hasher& hasher) const
+		{
+			hasher.combine(m_RasterizingPipelineSpecification, m_RayTracingPipelineSpecification, m_Properties);
+		}
 	};
 
 	/**
@@ -220,8 +260,6 @@ namespace Xenon
 	template<>
 	XENON_NODISCARD inline uint64_t GenerateHashFor<MaterialSpecification>(const MaterialSpecification& specification, uint64_t seed) noexcept
 	{
-		const auto rpsHash = GenerateHashFor(specification.m_RasterizingPipelineSpecification, seed);
-		const auto rtpsHash = GenerateHashFor(specification.m_RayTracingPipelineSpecification, rpsHash);
-		return GenerateHash(ToBytes(specification.m_Properties.data()), specification.m_Properties.size() * sizeof(MaterialProperty), rtpsHash);
+		return Hasher(seed).combine(specification).getHash();
 	}
 }
\ No newline at end of file
@@ -2,8 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "MonoCamera.hpp"
+#include "../XenonCore/Tracer.hpp"
 
-#include <optick.h>
 #include <glm/gtc/matrix_transform.hpp>
 
 namespace Xenon
@@ -23,7 +23,7 @@ namespace Xenon
 
 	void MonoCamera::update()
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		glm::vec3 front = {};
 		front.x = cos(glm::radians(m_Yaw)) * cos(glm::radians(m_Pitch));
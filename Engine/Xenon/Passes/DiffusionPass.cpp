@@ -8,8 +8,7 @@
 #include "../DefaultCacheHandler.hpp"
 
 #include "../../XenonShaderBank/Diffusion/Shader.comp.hpp"
-
-#include <optick.h>
+#include "../../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -40,7 +39,7 @@ namespace Xenon
 
 		void DiffusionPass::onUpdate(Layer* pPreviousLayer, uint32_t imageIndex, uint32_t frameIndex, Backend::CommandRecorder* pCommandRecorder)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Copy the control block data.
 			m_pControlBlockBuffer->write(ToBytes(&m_ControlBlock), sizeof(ControlBlock));
@@ -52,7 +51,7 @@ namespace Xenon
 
 		void DiffusionPass::setSourceImage(Backend::Image* pImage)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pSourceImage = pImage;
 			m_pSourceImageView = getLayer().getInstance().getFactory()->createImageView(getLayer().getInstance().getBackendDevice(), pImage, {});
@@ -5,8 +5,7 @@
 #include "Renderer.hpp"
 
 #include "../XenonCore/Logging.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -18,7 +17,7 @@ namespace Xenon
 
 	Xenon::Backend::Image* RasterizingLayer::getColorAttachment()
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		const auto attachmentTypes = m_pRasterizer->getAttachmentTypes();
 
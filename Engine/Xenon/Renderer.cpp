@@ -3,8 +3,7 @@
 
 #include "Renderer.hpp"
 #include "../XenonCore/Logging.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -20,7 +19,7 @@ namespace Xenon
 
 	bool Renderer::update()
 	{
-		OPTICK_FRAME("Renderer Update");
+		XENON_TRACE_FRAME("Renderer Update");
 
 		// Return false if we need to close.
 		if (!m_IsOpen)
@@ -33,24 +32,26 @@ namespace Xenon
 		const auto frameIndex = m_pCommandRecorder->getCurrentIndex();
 		m_pCommandSubmitters[frameIndex]->wait();
 
+		// Reclaim the per-frame allocations.
+		GetFrameArena().reset();
+
 		// Prepare the swapchain for a new frame.
 		const auto imageIndex = m_pSwapChain->prepare();
 
 		// Bind the layers.
 		Layer* pPreviousLayer = nullptr;
-		m_CountingFence.reset(m_pLayers.size() + 1);
 		for (const auto& pLayer : m_pLayers)
 		{
 			pLayer->onPreUpdate();
-			GetJobSystem().insert([this, pLayer = pLayer.get(), pPreviousLayer, imageIndex, frameIndex] { updateLayer(pLayer, pPreviousLayer, imageIndex, frameIndex); });
+			GetJobSystem().insertDetached(m_JobGroup, [this, pLayer = pLayer.get(), pPreviousLayer, imageIndex, frameIndex] { updateLayer(pLayer, pPreviousLayer, imageIndex, frameIndex); }, JobPriority::Critical);
 			pPreviousLayer = pLayer.get();
 		}
 
 		// Copy the previous layer to the swapchain.
-		GetJobSystem().insert([this, pPreviousLayer] { copyToSwapchainAndSubmit(pPreviousLayer); });
+		GetJobSystem().insertDetached(m_JobGroup, [this, pPreviousLayer] { copyToSwapchainAndSubmit(pPreviousLayer); }, JobPriority::Critical);
 
 		// Wait till all the required jobs are done.
-		m_CountingFence.wait();
+		GetJobSystem().wait(m_JobGroup);
 
 		// Submit the commands to the GPU.
 		m_pCommandSubmitters[m_pCommandRecorder->getCurrentIndex()]->submit(m_pSubmitCommandRecorders, m_pSwapChain.get());
@@ -110,18 +111,15 @@ namespace Xenon
 
 	void Renderer::updateLayer(Layer* pLayer, Layer* pPreviousLayer, uint32_t imageIndex, uint32_t frameIndex)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		// Update the layer.
 		pLayer->onUpdate(pPreviousLayer, imageIndex, frameIndex);
-
-		// Notify that we're done.
-		m_CountingFence.arrive();
 	}
 
 	void Renderer::copyToSwapchainAndSubmit(Layer* pPreviousLayer)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		// Begin the command recorder.
 		m_pCommandRecorder->begin();
@@ -132,8 +130,5 @@ namespace Xenon
 
 		// End the command recorder.
 		m_pCommandRecorder->end();
-
-		// Notify that we're done.
-		m_CountingFence.arrive();
 	}
 }
\ No newline at end of file
@@ -5,7 +5,7 @@
 
 #include "Layer.hpp"
 
-#include "../XenonCore/CountingFence.hpp"
+#include "../XenonCore/JobGroup.hpp"
 
 #include "../XenonBackend/Camera.hpp"
 #include "../XenonBackend/CommandSubmitter.hpp"
@@ -159,7 +159,7 @@ namespace Xenon
 		void copyToSwapchainAndSubmit(Layer* pPreviousLayer);
 
 	private:
-		CountingFence m_CountingFence;
+		JobGroup m_JobGroup;
 
 		std::vector<std::unique_ptr<Layer>> m_pLayers;
 		std::vector<std::unique_ptr<Backend::CommandSubmitter>> m_pCommandSubmitters;
@@ -158,7 +158,7 @@ namespace Xenon
 
 	void Scene::setupLights()
 	{
-		std::vector<Components::LightSource> lightSources;
+		auto lightSources = std::pmr::vector<Components::LightSource>(&XObject::GetFrameArena());
 		for (const auto group : m_Registry.view<Components::LightSource>())
 			lightSources.emplace_back(m_Registry.get<Components::LightSource>(group));
 
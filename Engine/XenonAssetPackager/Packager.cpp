@@ -3,14 +3,32 @@
 
 #include "Packager.hpp"
 #include "../XenonCore/Common.hpp"
+#include "../XenonCooker/GeometrySource.hpp"
 
 #include <nlohmann/json.hpp>
 
 #include <iostream>
 #include <fstream>
+#include <string_view>
 
 using JsonDocument = nlohmann::json;
 
+namespace /* anonymous */
+{
+	/**
+	 * Check if an entry name can be used as a file name next to the output file.
+	 * Path separators, drive separators and ".." are rejected, so that the file can't be written outside of the output directory.
+	 *
+	 * @param name The entry name.
+	 * @return True if the name is a plain file name.
+	 * @return False if the name is empty or it could escape the output directory.
+	 */
+	bool IsSafeFileName(std::string_view name) noexcept
+	{
+		return !name.empty() && name != "." && name.find_first_of("/\\:") == std::string_view::npos && name.find("..") == std::string_view::npos;
+	}
+}
+
 namespace Xenon
 {
 	Packager::Packager(const std::filesystem::path& inputFile, const std::filesystem::path& outputFile)
@@ -40,8 +58,20 @@ namespace Xenon
 			const auto& jsonData = *itr;
 			const auto& key = itr.key();
 
+			// Check if we need to cook a geometry.
+			if (jsonData.is_object() && jsonData.contains("file") && jsonData.contains("type") && jsonData["type"] == "geometry")
+			{
+				const auto cookedFile = cookGeometry(std::string(jsonData["file"]), key);
+				if (cookedFile.empty())
+					return -3;
+
+				auto& object = loadedData[key];
+				object["type"] = jsonData["type"];
+				object["file"] = cookedFile.lexically_relative(m_OutputFile.parent_path()).generic_string();
+			}
+
 			// Check if we need to load anything.
-			if (jsonData.is_object() && jsonData.contains("file") && jsonData.contains("type"))
+			else if (jsonData.is_object() && jsonData.contains("file") && jsonData.contains("type"))
 			{
 				auto& object = loadedData[key];
 				object["type"] = jsonData["type"];
@@ -75,6 +105,30 @@ namespace Xenon
 		return 0;
 	}
 
+	std::filesystem::path Packager::cookGeometry(const std::filesystem::path& file, const std::string& name) const
+	{
+		// The entry name comes from the input file, so make sure that it's just a file name.
+		if (!IsSafeFileName(name))
+		{
+			std::cout << "The geometry entry name \"" << name << "\" can't be used as a file name! It must not contain path separators or \"..\"." << std::endl;
+			return {};
+		}
+
+		// The cooked file is placed next to the output file, so it can be mapped by the engine. The package refers to it relative to the
+		// output file (see Geometry::FromPackagedFile()), so the engine does not depend on the packager's working directory.
+		auto cookedFile = m_OutputFile.parent_path() / name;
+		cookedFile += CookedGeometryExtension;
+
+		if (!GeometrySource::Cook(file, cookedFile))
+		{
+			std::cout << "Failed to cook the geometry file: " << file << std::endl;
+			return {};
+		}
+
+		std::cout << "Cooked the geometry file " << file << " to " << cookedFile << std::endl;
+		return cookedFile;
+	}
+
 	std::vector<std::byte> Packager::loadFileData(const std::filesystem::path& file) const
 	{
 		std::vector<std::byte> bytes;
@@ -7,6 +7,7 @@
 
 #include <filesystem>
 #include <vector>
+#include <string>
 
 namespace Xenon
 {
@@ -15,6 +16,11 @@ namespace Xenon
 	 * This class reads all the information from the input JSON document and packs them all into CBOR format and saves them to the
 	 * output file.
 	 *
+	 * Entries of the "geometry" type are cooked to a cooked geometry file (named after the entry) next to the output file, and the
+	 * package only stores the cooked file's path, relative to the output file. Cooked files are mapped by the engine, so they are not
+	 * packed. Use Geometry::FromPackagedFile() to load them. The names of these entries must be plain file names, without any path
+	 * separators or "..".
+	 *
 	 * The input data format:
 	 * {
 	 *		"entry1": {
@@ -25,6 +31,10 @@ namespace Xenon
 	 *		"entry3": {
 	 *			"x": "something",
 	 *			"y": 200
+	 *		},
+	 *		"entry4": {
+	 *			"file": "Sponza.gltf",
+	 *			"type": "geometry"
 	 *		}
 	 * }
 	 *
@@ -38,6 +48,10 @@ namespace Xenon
 	 *		"entry3": {
 	 *			"x": "something",
 	 *			"y": 200
+	 *		},
+	 *		"entry4": {
+	 *			"file": "entry4.xgeo",
+	 *			"type": "geometry"
 	 *		}
 	 * }
 	 */
@@ -60,6 +74,15 @@ namespace Xenon
 		XENON_NODISCARD uint32_t package() const;
 
 	private:
+		/**
+		 * Cook a geometry file.
+		 *
+		 * @param file The glTF file to cook.
+		 * @param name The entry name. This is used as the cooked file's name.
+		 * @return The cooked file path. This is empty if the name is not a plain file name or if the geometry could not be cooked.
+		 */
+		XENON_NODISCARD std::filesystem::path cookGeometry(const std::filesystem::path& file, const std::string& name) const;
+
 		/**
 		 * Load the file data.
 		 *
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "../XenonCore/Common.hpp"
+#include "../XenonCore/Hasher.hpp"
 
 #include <vector>
 #include <array>
@@ -668,12 +669,24 @@ namespace Xenon
 			 */
 			XENON_NODISCARD bool isAvailable(InputElement element) const noexcept { return m_VertexElements & (1 << EnumToInt(element)); }
 
+			/**
+			 * Combine the vertex specification to a hasher.
+			 *
+			 * @param hasher The hasher to combine with.
+			 */
+			void hashValue(Hasher& hasher) const
+			{
+				hasher.combine(m_VertexElements, static_cast<uint64_t>(m_Elements.size()));
+				for (const auto& element : m_Elements)
+					hasher.combine(element.m_Element, element.m_Size, element.m_Offset, element.m_AttributeDataType, element.m_ComponentDataType);
+			}
+
 			/**
 			 * Generate hash for the vertex specification.
 			 *
 			 * @return The hash value.
 			 */
-			XENON_NODISCARD uint64_t generateHash() const { return GenerateHash(ToBytes(m_Elements.data()), sizeof(VertexElement) * m_Elements.size(), m_VertexElements); }
+			XENON_NODISCARD uint64_t generateHash() const { return Hasher().combine(*this).getHash(); }
 
 		private:
 			uint32_t m_VertexElements = 0;
@@ -216,6 +216,16 @@ namespace Xenon
 			ColorBlendOperator m_BlendOperator = ColorBlendOperator::Add;
 			ColorBlendOperator m_AlphaBlendOperator = ColorBlendOperator::Add;
 			ColorWriteMask m_ColorWriteMask = ColorWriteMask::R | ColorWriteMask::G | ColorWriteMask::B | ColorWriteMask::A;
+
+			/**
+			 * Combine the color blend attachment to a hasher.
+			 *
+			 * @param hasher The hasher to combine with.
+			 */
+			void hashValue(Hasher& hasher) const
+			{
+				hasher.combine(m_EnableBlend, m_SrcBlendFactor, m_DstBlendFactor, m_SrcAlphaBlendFactor, m_DstAlphaBlendFactor, m_BlendOperator, m_AlphaBlendOperator, m_ColorWriteMask);
+			}
 		};
 
 		/**
@@ -271,6 +281,32 @@ namespace Xenon
 			bool m_EnableColorBlendLogic : 1 = false;
 			bool m_EnableDepthTest : 1 = true;
 			bool m_EnableDepthWrite : 1 = true;
+
+			/**
+			 * Combine the rasterizing pipeline specification to a hasher.
+			 *
+			 * @param hasher The hasher to combine with.
+			 */
+			void hashValue(Hasher& hasher) const
+			{
+				hasher.combine(m_VertexShader, m_FragmentShader, m_ColorBlendAttachments, m_ColorBlendConstants);
+				hasher.combine(m_DepthBiasFactor, m_DepthConstantFactor, m_DepthSlopeFactor, m_RasterizerLineWidth, m_MinSampleShading, m_TessellationPatchControlPoints);
+				hasher.combine(m_PrimitiveTopology, m_CullMode, m_FrontFace, m_PolygonMode, m_ColorBlendLogic, m_DepthCompareLogic, m_DynamicStateFlags);
+
+				// Pack the flags since we cannot take the address of a bit field.
+				uint16_t flags = 0;
+				flags |= static_cast<uint16_t>(m_EnablePrimitiveRestart) << 0;
+				flags |= static_cast<uint16_t>(m_EnableDepthBias) << 1;
+				flags |= static_cast<uint16_t>(m_EnableDepthClamp) << 2;
+				flags |= static_cast<uint16_t>(m_EnableRasterizerDiscard) << 3;
+				flags |= static_cast<uint16_t>(m_EnableAlphaCoverage) << 4;
+				flags |= static_cast<uint16_t>(m_EnableAlphaToOne) << 5;
+				flags |= static_cast<uint16_t>(m_EnableSampleShading) << 6;
+				flags |= static_cast<uint16_t>(m_EnableColorBlendLogic) << 7;
+				flags |= static_cast<uint16_t>(m_EnableDepthTest) << 8;
+				flags |= static_cast<uint16_t>(m_EnableDepthWrite) << 9;
+				hasher.combine(flags);
+			}
 		};
 
 		/**
@@ -313,12 +349,6 @@ namespace Xenon
 	template<>
 	XENON_NODISCARD inline uint64_t GenerateHashFor<Backend::RasterizingPipelineSpecification>(const Backend::RasterizingPipelineSpecification& specification, uint64_t seed) noexcept
 	{
-		constexpr auto offset = sizeof(Backend::Shader) + sizeof(Backend::Shader) + sizeof(std::vector<Backend::ColorBlendAttachment>);
-		constexpr auto structSize = sizeof(Backend::RasterizingPipelineSpecification) - offset;
-
-		const auto vsHash = GenerateHashFor(specification.m_VertexShader, seed);
-		const auto fsHash = GenerateHashFor(specification.m_FragmentShader, vsHash);
-		const auto cbaHash = GenerateHash(ToBytes(specification.m_ColorBlendAttachments.data()), specification.m_ColorBlendAttachments.size(), fsHash);
-		return GenerateHash(ToBytes(&specification) + offset, structSize, cbaHash);
+		return Hasher(seed).combine(specification).getHash();
 	}
 }
\ No newline at end of file
@@ -31,6 +31,16 @@ namespace Xenon
 			Shader m_ClosestHitShader = {};
 			Shader m_MissShader = {};
 			Shader m_CallableShader = {};
+
+			/**
+			 * Combine the shader group to a hasher.
+			 *
+			 * @param hasher The hasher to combine with.
+			 */
+			void hashValue(Hasher& hasher) const
+			{
+				hasher.combine(m_RayGenShader, m_IntersectionShader, m_AnyHitShader, m_ClosestHitShader, m_MissShader, m_CallableShader);
+			}
 		};
 
 		/**
@@ -59,6 +69,16 @@ namespace Xenon
 			uint32_t m_MaxAttributeSize = 0;
 
 			uint32_t m_MaxRayRecursionDepth = 4;
+
+			/**
+			 * Combine the ray tracing pipeline specification to a hasher.
+			 *
+			 * @param hasher The hasher to combine with.
+			 */
+			void hashValue(Hasher& hasher) const
+			{
+				hasher.combine(m_ShaderGroups, m_MaxPayloadSize, m_MaxAttributeSize, m_MaxRayRecursionDepth);
+			}
 		};
 
 		/**
@@ -129,16 +149,11 @@ namespace Xenon
 	template<>
 	XENON_NODISCARD inline uint64_t GenerateHashFor<Backend::ShaderGroup>(const Backend::ShaderGroup& shaderGroup, uint64_t seed) noexcept
 	{
-		const auto rgsHash = GenerateHashFor(shaderGroup.m_RayGenShader, seed);
-		const auto iHash = GenerateHashFor(shaderGroup.m_IntersectionShader, rgsHash);
-		const auto ahHash = GenerateHashFor(shaderGroup.m_AnyHitShader, iHash);
-		const auto chHash = GenerateHashFor(shaderGroup.m_ClosestHitShader, ahHash);
-		const auto mHash = GenerateHashFor(shaderGroup.m_MissShader, chHash);
-		return GenerateHashFor(shaderGroup.m_CallableShader, mHash);
+		return Hasher(seed).combine(shaderGroup).getHash();
 	}
 
 	/**
-	 * Utility function to easily generate the hash for the rasterizing pipeline specification object.
+	 * Utility function to easily generate the hash for the ray tracing pipeline specification object.
 	 *
 	 * @param specification The rasterizing pipeline to generate the hash for.
 	 * @param seed The hash seed. Default is 0.
@@ -147,11 +162,6 @@ namespace Xenon
 	template<>
 	XENON_NODISCARD inline uint64_t GenerateHashFor<Backend::RayTracingPipelineSpecification>(const Backend::RayTracingPipelineSpecification& specification, uint64_t seed) noexcept
 	{
-		uint64_t shaderGroupHash = seed;
-		for (const auto& shaderGroup : specification.m_ShaderGroups)
-			shaderGroupHash = GenerateHashFor(shaderGroup, shaderGroupHash);
-
-		const std::array<uint32_t, 3> constants = { specification.m_MaxPayloadSize, specification.m_MaxAttributeSize, specification.m_MaxRayRecursionDepth };
-		return GenerateHash(ToBytes(constants.data()), constants.size() * sizeof(uint32_t), shaderGroupHash);
+		return Hasher(seed).combine(specification).getHash();
 	}
 }
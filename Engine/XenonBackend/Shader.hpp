@@ -148,6 +148,14 @@ namespace Xenon
 			 */
 			XENON_NODISCARD const std::vector<ShaderResource>& getResources() const noexcept { return m_Resources; }
 
+			/**
+			 * Combine the shader to a hasher.
+			 * The reflection data is not combined since it's derived from the sources.
+			 *
+			 * @param hasher The hasher to combine with.
+			 */
+			void hashValue(Hasher& hasher) const { hasher.combine(m_SPIRV, m_DXIL); }
+
 		private:
 			/**
 			 * Perform reflection over the binary source and get information about inputs, outputs and resources.
@@ -174,14 +182,6 @@ namespace Xenon
 	template<>
 	XENON_NODISCARD inline uint64_t GenerateHashFor<Backend::Shader>(const Backend::Shader& shader, uint64_t seed) noexcept
 	{
-		return GenerateHash(
-			ToBytes(shader.getSPIRV().getBinaryData()),
-			shader.getSPIRV().getBinarySizeInBytes(),
-			GenerateHash(
-				ToBytes(shader.getDXIL().getBinaryData()),
-				shader.getDXIL().getBinarySizeInBytes(),
-				seed
-			)
-		);
+		return Hasher(seed).combine(shader).getHash();
 	}
 }
\ No newline at end of file
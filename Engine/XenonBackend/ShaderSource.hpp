@@ -95,6 +95,13 @@ namespace Xenon
 			 */
 			XENON_NODISCARD bool isValid() const noexcept { return !m_Binary.empty(); }
 
+			/**
+			 * Combine the shader source to a hasher.
+			 *
+			 * @param hasher The hasher to combine with.
+			 */
+			void hashValue(Hasher& hasher) const { hasher.combine(m_Binary).combine(m_EntryPoint); }
+
 		private:
 			BinaryType m_Binary;
 			std::string m_EntryPoint;
@@ -111,6 +118,6 @@ namespace Xenon
 	template<>
 	XENON_NODISCARD inline uint64_t GenerateHashFor<Backend::ShaderSource>(const Backend::ShaderSource& source, uint64_t seed) noexcept
 	{
-		return GenerateHash(ToBytes(source.getBinaryData()), source.getBinarySizeInBytes(), seed);
+		return Hasher(seed).combine(source).getHash();
 	}
 }
\ No newline at end of file
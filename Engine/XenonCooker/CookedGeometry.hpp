@@ -0,0 +1,219 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "../XenonBackend/Core.hpp"
+#include "../XenonCore/MeshOptimizer.hpp"
+
+#include <array>
+#include <span>
+#include <string_view>
+
+namespace Xenon
+{
+	/**
+	 * The cooked geometry file magic ("XGEO").
+	 */
+	constexpr uint32_t CookedGeometryMagic = 0x4F454758;
+
+	/**
+	 * The current cooked geometry file version.
+	 * This must be incremented every time the layout of the file changes.
+	 */
+	constexpr uint32_t CookedGeometryVersion = 2;
+
+	/**
+	 * The alignment of each section in the cooked geometry file.
+	 */
+	constexpr uint64_t CookedGeometryAlignment = 64;
+
+	/**
+	 * The cooked geometry file extension.
+	 */
+	constexpr const char* CookedGeometryExtension = ".xgeo";
+
+	/**
+	 * Primitive mode.
+	 * This defines what the primitive mode is for a single
+	 */
+	enum class PrimitiveMode : uint8_t
+	{
+		Points,
+		Line,
+		LineLoop,
+		LineStrip,
+		Triangles,
+		TriangleStrip,
+		TriangleFan
+	};
+
+	/**
+	 * Cooked geometry section type enum.
+	 */
+	enum class CookedGeometrySectionType : uint8_t
+	{
+		VertexElements,		// CookedVertexElement array, in the order they appear in the vertex.
+		Meshes,				// CookedMesh array.
+		SubMeshes,			// CookedSubMesh array.
+		Names,				// Mesh name characters.
+		Samplers,			// CookedSampler array.
+		Images,				// CookedImage array.
+		ImageData,			// Image pixels.
+		Vertices,			// Interleaved vertex data.
+		Indices,			// Index data.
+		Meshlets,			// Meshlet array.
+
+		Count
+	};
+
+	/**
+	 * Cooked geometry section structure.
+	 */
+	struct CookedGeometrySection final
+	{
+		uint64_t m_Offset = 0;
+		uint64_t m_Size = 0;
+	};
+
+	/**
+	 * Cooked geometry header structure.
+	 * Cooked geometry files contain a geometry which was already resolved and interleaved, in the exact layout the runtime uses. The
+	 * file is made of this header followed by the sections. Each section begins at a 64 byte aligned offset so that the file can be
+	 * mapped and the data can be used in place.
+	 *
+	 * All values are stored in little endian, and the section offsets are relative to the beginning of the file.
+	 */
+	struct alignas(CookedGeometryAlignment) CookedGeometryHeader final
+	{
+		uint32_t m_Magic = CookedGeometryMagic;
+		uint32_t m_Version = CookedGeometryVersion;
+
+		// The hash of all the bytes after the header.
+		uint64_t m_Hash = 0;
+
+		std::array<CookedGeometrySection, EnumToInt(CookedGeometrySectionType::Count)> m_Sections = {};
+	};
+
+	/**
+	 * Cooked vertex element structure.
+	 * The vertex specification is rebuilt by adding the elements in order.
+	 */
+	struct CookedVertexElement final
+	{
+		uint8_t m_Element = 0;
+		uint8_t m_AttributeDataType = 0;
+		uint8_t m_ComponentDataType = 0;
+		uint8_t m_Padding = 0;
+	};
+
+	/**
+	 * Cooked mesh structure.
+	 */
+	struct CookedMesh final
+	{
+		// The name's offset and size in the names section.
+		uint64_t m_NameOffset = 0;
+		uint64_t m_NameSize = 0;
+
+		// The mesh's sub-meshes in the sub-meshes section.
+		uint64_t m_FirstSubMesh = 0;
+		uint64_t m_SubMeshCount = 0;
+	};
+
+	/**
+	 * Cooked texture structure.
+	 * This references an image and a sampler of the file. If either of them is -1, the instance's default one is used.
+	 */
+	struct CookedTexture final
+	{
+		int32_t m_Image = -1;
+		int32_t m_Sampler = -1;
+	};
+
+	/**
+	 * Cooked sub-mesh structure.
+	 */
+	struct CookedSubMesh final
+	{
+		CookedTexture m_BaseColorTexture = {};
+		CookedTexture m_RoughnessTexture = {};
+		CookedTexture m_NormalTexture = {};
+		CookedTexture m_OcclusionTexture = {};
+		CookedTexture m_EmissiveTexture = {};
+
+		uint64_t m_VertexOffset = 0;
+		uint64_t m_VertexCount = 0;
+
+		uint64_t m_IndexOffset = 0;
+		uint64_t m_IndexCount = 0;
+
+		// The sub-mesh's meshlets in the meshlets section.
+		uint64_t m_MeshletOffset = 0;
+		uint64_t m_MeshletCount = 0;
+
+		uint8_t m_Mode = 0;
+		uint8_t m_IndexSize = 0;
+		std::array<uint8_t, 6> m_Padding = {};
+	};
+
+	/**
+	 * Cooked sampler structure.
+	 * This stores the glTF sampler values.
+	 */
+	struct CookedSampler final
+	{
+		int32_t m_MinificationFilter = -1;
+		int32_t m_MagnificationFilter = -1;
+		int32_t m_AddressModeU = 0;
+		int32_t m_AddressModeV = 0;
+	};
+
+	/**
+	 * Cooked image structure.
+	 * The pixels are stored decoded, so they can be copied to the image without any processing.
+	 */
+	struct CookedImage final
+	{
+		// The pixels' offset and size in the image data section.
+		uint64_t m_DataOffset = 0;
+		uint64_t m_DataSize = 0;
+
+		uint32_t m_Width = 0;
+		uint32_t m_Height = 0;
+
+		int32_t m_Bits = 0;
+		int32_t m_Components = 0;
+		int32_t m_PixelType = 0;
+		int32_t m_Padding = 0;
+	};
+
+	/**
+	 * Cooked geometry view structure.
+	 * This points to the cooked data of a geometry, either in a mapped cooked file or in a freshly cooked model.
+	 */
+	struct CookedGeometryView final
+	{
+		Backend::VertexSpecification m_VertexSpecification;
+
+		std::span<const CookedMesh> m_Meshes;
+		std::string_view m_Names;
+		std::span<const CookedSubMesh> m_SubMeshes;
+
+		std::span<const CookedSampler> m_Samplers;
+		std::span<const CookedImage> m_Images;
+		std::vector<std::span<const std::byte>> m_ImagePixels;
+
+		std::span<const std::byte> m_Vertices;
+		std::span<const std::byte> m_Indices;
+
+		std::span<const Meshlet> m_Meshlets;
+	};
+
+	static_assert(sizeof(CookedGeometryHeader) == 192);
+	static_assert(sizeof(CookedVertexElement) == 4);
+	static_assert(sizeof(CookedMesh) == 32);
+	static_assert(sizeof(CookedSubMesh) == 96);
+	static_assert(sizeof(CookedSampler) == 16);
+	static_assert(sizeof(CookedImage) == 40);
+}
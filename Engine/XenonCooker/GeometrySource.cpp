@@ -0,0 +1,1437 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GeometrySource.hpp"
+
+#include "../XenonCore/Logging.hpp"
+#include "../XenonCore/JobGroup.hpp"
+#include "../XenonCore/Parallel.hpp"
+#include "../XenonCore/Tracer.hpp"
+#include "../XenonCore/Interleave.hpp"
+#include "../XenonCore/MeshOptimizer.hpp"
+#include "../XenonCore/SmallVector.hpp"
+#include "../XenonCore/XObject.hpp"
+
+// External images are decoded straight from their mapped files by LoadExternalImages(), instead of being read into a buffer first.
+#define TINYGLTF_NO_EXTERNAL_IMAGE
+#define TINYGLTF_IMPLEMENTATION
+#define STB_IMAGE_IMPLEMENTATION
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <tiny_gltf.h>
+
+#include <fstream>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+
+constexpr std::array<const char*, 21> g_Attributes = {
+	"POSITION",
+	"NORMAL",
+	"TANGENT",
+	"COLOR_0",
+	"COLOR_1",
+	"COLOR_2",
+	"COLOR_3",
+	"COLOR_4",
+	"COLOR_5",
+	"COLOR_6",
+	"COLOR_7",
+	"TEXCOORD_0",
+	"TEXCOORD_1",
+	"TEXCOORD_2",
+	"TEXCOORD_3",
+	"TEXCOORD_4",
+	"TEXCOORD_5",
+	"TEXCOORD_6",
+	"TEXCOORD_7",
+	"JOINTS_0",
+	"WEIGHTS_0",
+};
+
+/**
+ * Texture info type concept.
+ */
+template<class Type>
+concept TextureInfo = (std::same_as<Type, tinygltf::TextureInfo> || std::same_as<Type, tinygltf::NormalTextureInfo> || std::same_as<Type, tinygltf::OcclusionTextureInfo>);
+
+namespace /* anonymous */
+{
+	/**
+	 * Read a whole file for tinygltf.
+	 * This is used to load the external buffers, which tinygltf keeps in it's own vectors, so the bytes have to be copied once. The file
+	 * is mapped and copied straight into the output vector, instead of being streamed through a file stream.
+	 *
+	 * @param pOutput The output bytes.
+	 * @param pError The error string.
+	 * @param file The file to read.
+	 * @return True if the file was read.
+	 * @return False if the file could not be read.
+	 */
+	bool ReadMappedFile(std::vector<unsigned char>* pOutput, std::string* pError, const std::string& file, void*)
+	{
+		const auto mappedFile = Xenon::MappedFile(file);
+		if (!mappedFile.isValid() || mappedFile.getSize() == 0)
+		{
+			if (pError)
+				*pError += fmt::format("Failed to read the file '{}'!\n", file);
+
+			return false;
+		}
+
+		const auto pBegin = reinterpret_cast<const unsigned char*>(mappedFile.getData());
+		pOutput->assign(pBegin, pBegin + mappedFile.getSize());
+
+		return true;
+	}
+
+	/**
+	 * Decode the percent-encoded characters of a URI.
+	 *
+	 * @param uri The URI to decode.
+	 * @return The decoded URI.
+	 */
+	XENON_NODISCARD std::string DecodeUri(std::string_view uri)
+	{
+		const auto toDigit = [](char character) -> int
+		{
+			if (character >= '0' && character <= '9')
+				return character - '0';
+
+			if (character >= 'a' && character <= 'f')
+				return character - 'a' + 10;
+
+			if (character >= 'A' && character <= 'F')
+				return character - 'A' + 10;
+
+			return -1;
+		};
+
+		std::string decoded;
+		decoded.reserve(uri.size());
+
+		for (uint64_t i = 0; i < uri.size(); i++)
+		{
+			if (uri[i] == '%' && i + 2 < uri.size() && toDigit(uri[i + 1]) >= 0 && toDigit(uri[i + 2]) >= 0)
+			{
+				decoded += static_cast<char>(toDigit(uri[i + 1]) * 16 + toDigit(uri[i + 2]));
+				i += 2;
+			}
+			else
+			{
+				decoded += uri[i];
+			}
+		}
+
+		return decoded;
+	}
+
+	/**
+	 * Decode the external images of a model.
+	 * tinygltf is built without external image support, so these are left with just their URI. Each image file is mapped and decoded
+	 * from the mapping, so the encoded bytes are never copied.
+	 *
+	 * @param model The model to load the images of.
+	 * @param baseDirectory The directory the image URIs are relative to.
+	 */
+	void LoadExternalImages(tinygltf::Model& model, const std::filesystem::path& baseDirectory)
+	{
+		XENON_TRACE_SCOPE();
+
+		for (uint64_t i = 0; i < model.images.size(); i++)
+		{
+			auto& image = model.images[i];
+			if (!image.image.empty() || image.bufferView >= 0 || image.uri.empty() || image.uri.starts_with("data:"))
+				continue;
+
+			const auto file = baseDirectory / DecodeUri(image.uri);
+			const auto mappedFile = Xenon::MappedFile(file);
+			if (!mappedFile.isValid() || mappedFile.getSize() == 0)
+				continue;
+
+			// The decoder takes the size as an int.
+			if (mappedFile.getSize() > static_cast<uint64_t>(std::numeric_limits<int>::max()))
+			{
+				XENON_LOG_ERROR("The image file '{}' is too large to decode ({} bytes)!", file.string(), mappedFile.getSize());
+				continue;
+			}
+
+			std::string errorString;
+			std::string warningString;
+
+			const auto pBytes = reinterpret_cast<const unsigned char*>(mappedFile.getData());
+			if (!tinygltf::LoadImageData(&image, static_cast<int>(i), &errorString, &warningString, 0, 0, pBytes, static_cast<int>(mappedFile.getSize()), nullptr))
+				XENON_LOG_ERROR("Failed to decode the image file '{}'! {}", file.string(), errorString);
+
+			if (!warningString.empty())
+				XENON_LOG_WARNING("glTF loading warning: {}", warningString);
+		}
+	}
+
+	/**
+	 * Load a glTF model from a file.
+	 * Both text (.gltf) and binary (.glb) files are supported. The model file itself is mapped and parsed from memory, so it's never
+	 * copied into a temporary buffer. tinygltf takes the size as an unsigned int, so files of 4 GiB or more are rejected.
+	 *
+	 * @param model The model to load to.
+	 * @param mappedFile The mapped model file.
+	 * @param file The model file path. This is used to resolve the external buffers and images.
+	 * @return True if the model was loaded.
+	 * @return False if the model could not be loaded.
+	 */
+	bool LoadModel(tinygltf::Model& model, const Xenon::MappedFile& mappedFile, const std::filesystem::path& file)
+	{
+		XENON_TRACE_SCOPE();
+
+		if (mappedFile.getSize() > std::numeric_limits<unsigned int>::max())
+		{
+			XENON_LOG_ERROR("The model file '{}' is too large to load ({} bytes)! glTF files must be smaller than 4 GiB.", file.string(), mappedFile.getSize());
+			return false;
+		}
+
+		tinygltf::FsCallbacks callbacks = {};
+		callbacks.FileExists = &tinygltf::FileExists;
+		callbacks.ExpandFilePath = &tinygltf::ExpandFilePath;
+		callbacks.ReadWholeFile = &ReadMappedFile;
+		callbacks.WriteWholeFile = &tinygltf::WriteWholeFile;
+		callbacks.GetFileSizeInBytes = &tinygltf::GetFileSizeInBytes;
+
+		tinygltf::TinyGLTF loader;
+		loader.SetFsCallbacks(callbacks);
+
+		std::string errorString;
+		std::string warningString;
+
+		// Binary files start with the "glTF" magic, so we don't have to rely on the file extension.
+		const auto pBytes = reinterpret_cast<const unsigned char*>(mappedFile.getData());
+		const auto size = static_cast<unsigned int>(mappedFile.getSize());
+		const auto baseDirectory = file.parent_path();
+		const auto isBinary = size >= 4 && std::equal(pBytes, pBytes + 4, "glTF");
+
+		const auto result = isBinary ?
+			loader.LoadBinaryFromMemory(&model, &errorString, &warningString, pBytes, size, baseDirectory.string()) :
+			loader.LoadASCIIFromString(&model, &errorString, &warningString, reinterpret_cast<const char*>(pBytes), size, baseDirectory.string());
+
+		// Show the error if there are any.
+		if (!errorString.empty())
+			XENON_LOG_ERROR("glTF loading error: {}", errorString);
+
+		// Show the warning if there are any.
+		if (!warningString.empty())
+			XENON_LOG_WARNING("glTF loading warning: {}", warningString);
+
+		if (result)
+			LoadExternalImages(model, baseDirectory);
+
+		return result;
+	}
+
+	/**
+	 * Check if the attribute exists in the primitive and if so, setup the vertex specification for that element.
+	 *
+	 * @param model The model to get the element information.
+	 * @param primitive The primitive containing the attribute information.
+	 * @param attribute The attribute name to check.
+	 * @param element The vertex element.
+	 * @param specification The specification to configure.
+	 */
+	void ResolvePrimitive(
+		const tinygltf::Model& model,
+		const tinygltf::Primitive& primitive,
+		const std::string& attribute,
+		Xenon::Backend::InputElement element,
+		Xenon::Backend::VertexSpecification& specification)
+	{
+		XENON_TRACE_SCOPE();
+
+		if (!primitive.attributes.contains(attribute))
+			return;
+
+		const auto index = primitive.attributes.at(attribute);
+		const auto& accessor = model.accessors[index];
+
+		// Setup the data type.
+		Xenon::Backend::AttributeDataType dataType = Xenon::Backend::AttributeDataType::Vec3;
+		switch (accessor.type)
+		{
+		case TINYGLTF_TYPE_VEC2:
+			dataType = Xenon::Backend::AttributeDataType::Vec2;
+			break;
+
+		case TINYGLTF_TYPE_VEC3:
+			dataType = Xenon::Backend::AttributeDataType::Vec3;
+			break;
+
+		case TINYGLTF_TYPE_VEC4:
+			dataType = Xenon::Backend::AttributeDataType::Vec4;
+			break;
+
+		case TINYGLTF_TYPE_MAT2:
+			dataType = Xenon::Backend::AttributeDataType::Mat2;
+			break;
+
+		case TINYGLTF_TYPE_MAT3:
+			dataType = Xenon::Backend::AttributeDataType::Mat3;
+			break;
+
+		case TINYGLTF_TYPE_MAT4:
+			dataType = Xenon::Backend::AttributeDataType::Mat4;
+			break;
+
+		case TINYGLTF_TYPE_SCALAR:
+			dataType = Xenon::Backend::AttributeDataType::Scalar;
+			break;
+
+		case TINYGLTF_TYPE_VECTOR:
+			dataType = Xenon::Backend::AttributeDataType::Vec3;
+			break;
+
+		case TINYGLTF_TYPE_MATRIX:
+			dataType = Xenon::Backend::AttributeDataType::Mat4;
+			break;
+
+		default:
+			XENON_LOG_ERROR("Invalid or unsupported vertex data type in the provided model file. Defaulting to vector 3.");
+			dataType = Xenon::Backend::AttributeDataType::Vec3;
+			break;
+		}
+
+		// Setup the component type.
+		switch (accessor.componentType)
+		{
+		case TINYGLTF_COMPONENT_TYPE_BYTE:
+			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Uint8);
+			break;
+
+		case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Int8);
+			break;
+
+		case TINYGLTF_COMPONENT_TYPE_SHORT:
+			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Int16);
+			break;
+
+		case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Uint16);
+			break;
+
+		case TINYGLTF_COMPONENT_TYPE_INT:
+			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Int32);
+			break;
+
+		case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Uint32);
+			break;
+
+		case TINYGLTF_COMPONENT_TYPE_FLOAT:
+			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Float);
+			break;
+
+		case TINYGLTF_COMPONENT_TYPE_DOUBLE:
+			specification.addElement(element, dataType, Xenon::Backend::ComponentDataType::Double);
+			break;
+
+		default:
+			XENON_LOG_ERROR("Invalid or unsupported vertex element type in the provided model file.");
+			break;
+		}
+	}
+
+	/**
+	 * Get the number of vertices in a primitive.
+	 * All the attributes of a primitive have the same number of elements, so any of them can be used.
+	 *
+	 * @param model The model in which the data are stored.
+	 * @param primitive The primitive to access.
+	 * @return The vertex count.
+	 */
+	XENON_NODISCARD uint64_t GetVertexCount(const tinygltf::Model& model, const tinygltf::Primitive& primitive)
+	{
+		if (primitive.attributes.empty())
+			return 0;
+
+		return model.accessors[primitive.attributes.begin()->second].count;
+	}
+
+	/**
+	 * Get the size of a single element of an accessor.
+	 *
+	 * @param accessor The accessor.
+	 * @return The element size in bytes. This is 0 if the accessor's type is invalid.
+	 */
+	XENON_NODISCARD uint64_t GetElementSize(const tinygltf::Accessor& accessor)
+	{
+		const auto componentSize = tinygltf::GetComponentSizeInBytes(accessor.componentType);
+		const auto componentCount = tinygltf::GetNumComponentsInType(accessor.type);
+
+		if (componentSize <= 0 || componentCount <= 0)
+			return 0;
+
+		return static_cast<uint64_t>(componentSize) * componentCount;
+	}
+
+	/**
+	 * Get an attribute's source stream.
+	 * The attribute's bytes are copied as they are, so normalized integer attributes stay normalized. If the primitive does not have the
+	 * attribute, or if it's data is invalid, the stream does not have a source and the attribute is left zeroed.
+	 *
+	 * @param model The model in which the data are stored.
+	 * @param primitive The primitive to access.
+	 * @param specification The vertex specification.
+	 * @param element The vertex element to get the stream of.
+	 * @param vertexCount The number of vertices in the primitive.
+	 * @return The attribute stream.
+	 */
+	XENON_NODISCARD Xenon::InterleaveStream GetAttributeStream(
+		const tinygltf::Model& model,
+		const tinygltf::Primitive& primitive,
+		const Xenon::Backend::VertexSpecification& specification,
+		Xenon::Backend::InputElement element,
+		uint64_t vertexCount)
+	{
+		XENON_TRACE_SCOPE();
+
+		Xenon::InterleaveStream stream;
+		stream.m_DestinationOffset = specification.offsetOf(element);
+
+		const auto attribute = primitive.attributes.find(g_Attributes[Xenon::EnumToInt(element)]);
+		if (attribute == primitive.attributes.end())
+			return stream;
+
+		// Sparse accessors might not have a buffer view, in which case the values are zero unless they are replaced by the sparse values.
+		const auto& accessor = model.accessors[attribute->second];
+		if (accessor.bufferView < 0)
+			return stream;
+
+		const auto& bufferView = model.bufferViews[accessor.bufferView];
+		const auto& buffer = model.buffers[bufferView.buffer];
+
+		const auto elementSize = GetElementSize(accessor);
+		const auto stride = accessor.ByteStride(bufferView);
+		const auto offset = accessor.byteOffset + bufferView.byteOffset;
+
+		if (elementSize == 0 || stride <= 0 || accessor.count < vertexCount || (vertexCount > 0 && offset + (vertexCount - 1) * stride + elementSize > buffer.data.size()))
+		{
+			XENON_LOG_ERROR("The {} attribute of the provided model file is invalid! The attribute will be zeroed.", g_Attributes[Xenon::EnumToInt(element)]);
+			return stream;
+		}
+
+		// The component type of an element is set by the first primitive which has it, so it might not match the other primitives.
+		stream.m_pSource = Xenon::ToBytes(buffer.data.data()) + offset;
+		stream.m_SourceStride = stride;
+		stream.m_ElementSize = static_cast<uint32_t>(std::min<uint64_t>(elementSize, specification.getElementSize(element)));
+
+		return stream;
+	}
+
+	/**
+	 * Replace the values of a sparse attribute.
+	 *
+	 * @param model The model in which the data are stored.
+	 * @param primitive The primitive to access.
+	 * @param specification The vertex specification.
+	 * @param element The vertex element to update.
+	 * @param pVertices The interleaved vertices of the primitive.
+	 * @param vertexCount The number of vertices in the primitive.
+	 */
+	void ApplySparseAttribute(
+		const tinygltf::Model& model,
+		const tinygltf::Primitive& primitive,
+		const Xenon::Backend::VertexSpecification& specification,
+		Xenon::Backend::InputElement element,
+		std::byte* pVertices,
+		uint64_t vertexCount)
+	{
+		const auto attribute = primitive.attributes.find(g_Attributes[Xenon::EnumToInt(element)]);
+		if (attribute == primitive.attributes.end())
+			return;
+
+		const auto& accessor = model.accessors[attribute->second];
+		if (!accessor.sparse.isSparse)
+			return;
+
+		XENON_TRACE_SCOPE();
+
+		const auto& sparse = accessor.sparse;
+		const auto& indexView = model.bufferViews[sparse.indices.bufferView];
+		const auto& indexBuffer = model.buffers[indexView.buffer];
+		const auto& valueView = model.bufferViews[sparse.values.bufferView];
+		const auto& valueBuffer = model.buffers[valueView.buffer];
+
+		const auto count = static_cast<uint64_t>(sparse.count);
+		const auto indexSize = static_cast<uint64_t>(tinygltf::GetComponentSizeInBytes(sparse.indices.componentType));
+		const auto elementSize = GetElementSize(accessor);
+		const auto indexOffset = indexView.byteOffset + sparse.indices.byteOffset;
+		const auto valueOffset = valueView.byteOffset + sparse.values.byteOffset;
+
+		if (indexOffset + count * indexSize > indexBuffer.data.size() || valueOffset + count * elementSize > valueBuffer.data.size())
+		{
+			XENON_LOG_ERROR("The sparse {} attribute of the provided model file is out of bounds!", g_Attributes[Xenon::EnumToInt(element)]);
+			return;
+		}
+
+		const auto pIndices = indexBuffer.data.data() + indexOffset;
+		const auto pValues = valueBuffer.data.data() + valueOffset;
+
+		const auto vertexStride = specification.getSize();
+		const auto destinationOffset = specification.offsetOf(element);
+		const auto copySize = std::min<uint64_t>(elementSize, specification.getElementSize(element));
+
+		for (uint64_t i = 0; i < count; i++)
+		{
+			uint32_t index = 0;
+			switch (sparse.indices.componentType)
+			{
+			case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+				index = pIndices[i];
+				break;
+
+			case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+			{
+				uint16_t shortIndex = 0;
+				std::memcpy(&shortIndex, pIndices + i * sizeof(uint16_t), sizeof(uint16_t));
+				index = shortIndex;
+				break;
+			}
+
+			default:
+				std::memcpy(&index, pIndices + i * sizeof(uint32_t), sizeof(uint32_t));
+				break;
+			}
+
+			if (index < vertexCount)
+				std::memcpy(pVertices + index * vertexStride + destinationOffset, pValues + i * elementSize, copySize);
+		}
+	}
+
+	/**
+	 * Load a sub-mesh from a primitive.
+	 *
+	 * @param subMesh The sub-mesh to load the data to.
+	 * @param specification The vertex specification.
+	 * @param model The glTF model.
+	 * @param primitive The glTF primitive.
+	 * @param vertexBegin The vertex begin iterator to load the data to.
+	 * @param indexBegin The index begin iterator to load the data to.
+	 */
+	void LoadSubMesh(
+		Xenon::CookedSubMesh& subMesh,
+		const Xenon::Backend::VertexSpecification& specification,
+		const tinygltf::Model& model,
+		const tinygltf::Primitive& primitive,
+		std::vector<unsigned char>::iterator vertexBegin,
+		std::vector<unsigned char>::iterator indexBegin)
+	{
+		XENON_TRACE_SCOPE();
+
+		// Setup the primitive mode.
+		switch (primitive.mode)
+		{
+		case TINYGLTF_MODE_POINTS:
+			subMesh.m_Mode = Xenon::EnumToInt(Xenon::PrimitiveMode::Points);
+			break;
+
+		case TINYGLTF_MODE_LINE:
+			subMesh.m_Mode = Xenon::EnumToInt(Xenon::PrimitiveMode::Line);
+			break;
+
+		case TINYGLTF_MODE_LINE_LOOP:
+			subMesh.m_Mode = Xenon::EnumToInt(Xenon::PrimitiveMode::LineLoop);
+			break;
+
+		case TINYGLTF_MODE_LINE_STRIP:
+			subMesh.m_Mode = Xenon::EnumToInt(Xenon::PrimitiveMode::LineStrip);
+			break;
+
+		case TINYGLTF_MODE_TRIANGLES:
+			subMesh.m_Mode = Xenon::EnumToInt(Xenon::PrimitiveMode::Triangles);
+			break;
+
+		case TINYGLTF_MODE_TRIANGLE_STRIP:
+			subMesh.m_Mode = Xenon::EnumToInt(Xenon::PrimitiveMode::TriangleStrip);
+			break;
+
+		case TINYGLTF_MODE_TRIANGLE_FAN:
+			subMesh.m_Mode = Xenon::EnumToInt(Xenon::PrimitiveMode::TriangleFan);
+			break;
+
+		default:
+			XENON_LOG_ERROR("Invalid or unsupported vertex mode type in the provided model file. Defaulting to triangle.");
+			subMesh.m_Mode = Xenon::EnumToInt(Xenon::PrimitiveMode::Triangles);
+			break;
+		}
+
+		// Get the attribute streams. The attributes are placed in the vertex the way the specification says, which is not necessarily the
+		// order of the elements.
+		const auto vertexCount = GetVertexCount(model, primitive);
+		Xenon::SmallVector<Xenon::InterleaveStream, Xenon::EnumToInt(Xenon::Backend::InputElement::VertexElementCount)> streams;
+		for (auto i = Xenon::EnumToInt(Xenon::Backend::InputElement::VertexPosition); i < Xenon::EnumToInt(Xenon::Backend::InputElement::VertexElementCount); i++)
+		{
+			if (specification.isAvailable(static_cast<Xenon::Backend::InputElement>(i)))
+				streams.emplace_back(GetAttributeStream(model, primitive, specification, static_cast<Xenon::Backend::InputElement>(i), vertexCount));
+		}
+
+		// Load the vertex data to the buffer.
+		// The vertices are interleaved in cache sized blocks, and the blocks are interleaved in parallel.
+		subMesh.m_VertexCount = vertexCount;
+		if (vertexCount > 0)
+		{
+			const auto pVertices = Xenon::ToBytes(std::to_address(vertexBegin));
+			Xenon::ParallelInterleaveStreams(Xenon::XObject::GetJobSystem(), streams, pVertices, specification.getSize(), vertexCount);
+
+			for (auto i = Xenon::EnumToInt(Xenon::Backend::InputElement::VertexPosition); i < Xenon::EnumToInt(Xenon::Backend::InputElement::VertexElementCount); i++)
+			{
+				if (specification.isAvailable(static_cast<Xenon::Backend::InputElement>(i)))
+					ApplySparseAttribute(model, primitive, specification, static_cast<Xenon::Backend::InputElement>(i), pVertices, vertexCount);
+			}
+		}
+
+		// Load the index buffer data.
+		if (primitive.indices >= 0)
+		{
+			const auto& accessor = model.accessors.at(primitive.indices);
+			const auto& bufferView = model.bufferViews.at(accessor.bufferView);
+			const auto& buffer = model.buffers.at(bufferView.buffer);
+
+			const auto stride = accessor.ByteStride(bufferView);
+			const auto start = accessor.byteOffset + bufferView.byteOffset;
+			const auto end = start + accessor.count * stride;
+
+			subMesh.m_IndexCount = accessor.count;
+			subMesh.m_IndexSize = static_cast<uint8_t>(stride);
+
+			if (subMesh.m_IndexOffset > 0)
+				subMesh.m_IndexOffset /= subMesh.m_IndexSize;
+
+			std::copy(buffer.data.begin() + start, buffer.data.begin() + end, indexBegin);
+		}
+	}
+
+	/**
+	 * Get the cooked texture of a glTF texture.
+	 *
+	 * @tparam Type The texture info type.
+	 * @param model The model to get the textures from.
+	 * @param info The texture info structure.
+	 * @return The cooked texture.
+	 */
+	template<TextureInfo Type>
+	XENON_NODISCARD Xenon::CookedTexture GetCookedTexture(const tinygltf::Model& model, const Type& info) noexcept
+	{
+		Xenon::CookedTexture texture = {};
+
+		if (info.index >= 0)
+		{
+			const auto& gltfTexture = model.textures[info.index];
+			texture.m_Image = gltfTexture.source;
+			texture.m_Sampler = gltfTexture.sampler;
+		}
+
+		return texture;
+	}
+
+	/**
+	 * Get the number of bytes used by the indices of a primitive.
+	 *
+	 * @param model The model in which the data are stored.
+	 * @param primitive The primitive to access.
+	 * @return The index data size in bytes.
+	 */
+	XENON_NODISCARD uint64_t GetIndexDataSize(const tinygltf::Model& model, const tinygltf::Primitive& primitive)
+	{
+		if (primitive.indices < 0)
+			return 0;
+
+		const auto& accessor = model.accessors.at(primitive.indices);
+		const auto& bufferView = model.bufferViews.at(accessor.bufferView);
+
+		return accessor.count * accessor.ByteStride(bufferView);
+	}
+
+	/**
+	 * Align an offset to the cooked geometry alignment.
+	 *
+	 * @param offset The offset to align.
+	 * @return The aligned offset.
+	 */
+	XENON_NODISCARD constexpr uint64_t AlignCookedOffset(uint64_t offset) noexcept
+	{
+		return (offset + Xenon::CookedGeometryAlignment - 1) & ~(Xenon::CookedGeometryAlignment - 1);
+	}
+
+	/**
+	 * Mesh optimization statistics structure.
+	 */
+	struct OptimizationStatistics final
+	{
+		uint64_t m_TriangleCount = 0;
+
+		uint64_t m_TransformedVertexCountBefore = 0;
+		uint64_t m_TransformedVertexCountAfter = 0;
+
+		uint64_t m_VertexCountBefore = 0;
+		uint64_t m_VertexCountAfter = 0;
+	};
+
+	/**
+	 * Read indices of a given type to 32-bit indices.
+	 *
+	 * @tparam Type The index type.
+	 * @param pSource The source indices.
+	 * @param indices The indices to read to.
+	 */
+	template<class Type>
+	void ReadIndices(const std::byte* pSource, std::span<uint32_t> indices) noexcept
+	{
+		for (auto& index : indices)
+		{
+			Type value = 0;
+			std::memcpy(&value, pSource, sizeof(Type));
+			pSource += sizeof(Type);
+
+			index = value;
+		}
+	}
+
+	/**
+	 * Write 32-bit indices as indices of a given type.
+	 *
+	 * @tparam Type The index type.
+	 * @param pDestination The destination indices.
+	 * @param indices The indices to write.
+	 */
+	template<class Type>
+	void WriteIndices(std::byte* pDestination, std::span<const uint32_t> indices) noexcept
+	{
+		for (const auto index : indices)
+		{
+			const auto value = static_cast<Type>(index);
+			std::memcpy(pDestination, &value, sizeof(Type));
+			pDestination += sizeof(Type);
+		}
+	}
+
+	/**
+	 * Processed sub-mesh structure.
+	 * This contains what a sub-mesh's loader job produces in addition to the sub-mesh's data.
+	 */
+	struct ProcessedSubMesh final
+	{
+		std::vector<Xenon::Meshlet> m_Meshlets;
+		OptimizationStatistics m_Statistics;
+	};
+
+	/**
+	 * Process a loaded sub-mesh.
+	 * If requested, indexed triangle lists are optimized for the vertex cache, overdraw and vertex fetch, and are split into meshlets if
+	 * the positions are three floats. The sub-mesh's vertex count is updated, and the vertices after it are left unused.
+	 *
+	 * @param subMesh The sub-mesh to process.
+	 * @param specification The vertex specification.
+	 * @param vertexBegin The sub-mesh's vertex begin iterator.
+	 * @param indexBegin The sub-mesh's index begin iterator.
+	 * @param optimize Whether to optimize the sub-mesh and split it into meshlets.
+	 * @param processed The processed sub-mesh to set.
+	 */
+	void ProcessSubMesh(
+		Xenon::CookedSubMesh& subMesh,
+		const Xenon::Backend::VertexSpecification& specification,
+		std::vector<unsigned char>::iterator vertexBegin,
+		std::vector<unsigned char>::iterator indexBegin,
+		bool optimize,
+		ProcessedSubMesh& processed)
+	{
+		XENON_TRACE_SCOPE();
+
+		if (!optimize || subMesh.m_Mode != Xenon::EnumToInt(Xenon::PrimitiveMode::Triangles) || subMesh.m_IndexCount < 3 || subMesh.m_IndexCount % 3 != 0 || subMesh.m_VertexCount == 0)
+			return;
+
+		// Widen the indices.
+		const auto pIndices = Xenon::ToBytes(std::to_address(indexBegin));
+		std::vector<uint32_t> indices(subMesh.m_IndexCount);
+
+		switch (subMesh.m_IndexSize)
+		{
+		case sizeof(uint8_t):
+			ReadIndices<uint8_t>(pIndices, indices);
+			break;
+
+		case sizeof(uint16_t):
+			ReadIndices<uint16_t>(pIndices, indices);
+			break;
+
+		case sizeof(uint32_t):
+			ReadIndices<uint32_t>(pIndices, indices);
+			break;
+
+		default:
+			return;
+		}
+
+		if (std::ranges::any_of(indices, [vertexCount = subMesh.m_VertexCount](uint32_t index) { return index >= vertexCount; }))
+		{
+			XENON_LOG_WARNING("A sub-mesh has indices which are out of its vertex range! Skipping its optimization and meshlets.");
+			return;
+		}
+
+		// Overdraw and meshlet bounds need the positions to be three floats.
+		int64_t positionOffset = -1;
+		if (specification.isAvailable(Xenon::Backend::InputElement::VertexPosition) &&
+			specification.getElementAttributeDataType(Xenon::Backend::InputElement::VertexPosition) == Xenon::Backend::AttributeDataType::Vec3 &&
+			specification.getElementComponentDataType(Xenon::Backend::InputElement::VertexPosition) == Xenon::Backend::ComponentDataType::Float)
+			positionOffset = specification.offsetOf(Xenon::Backend::InputElement::VertexPosition);
+
+		const auto pVertices = Xenon::ToBytes(std::to_address(vertexBegin));
+		const auto vertexCountBefore = subMesh.m_VertexCount;
+		const auto before = Xenon::AnalyzeVertexCache(indices, vertexCountBefore);
+
+		// Optimize the mesh.
+		subMesh.m_VertexCount = Xenon::OptimizeMesh(pVertices, subMesh.m_VertexCount, specification.getSize(), indices, positionOffset);
+
+		// Split the mesh into meshlets. This groups the triangles differently, so the vertex fetch order is updated to match.
+		if (positionOffset >= 0)
+		{
+			Xenon::BuildMeshlets(processed.m_Meshlets, indices, pVertices + positionOffset, subMesh.m_VertexCount, specification.getSize());
+			subMesh.m_VertexCount = Xenon::OptimizeVertexFetch(pVertices, subMesh.m_VertexCount, specification.getSize(), indices);
+		}
+
+		// Write the indices back in their original size. The vertex count never grows, so they always fit.
+		switch (subMesh.m_IndexSize)
+		{
+		case sizeof(uint8_t):
+			WriteIndices<uint8_t>(pIndices, indices);
+			break;
+
+		case sizeof(uint16_t):
+			WriteIndices<uint16_t>(pIndices, indices);
+			break;
+
+		default:
+			WriteIndices<uint32_t>(pIndices, indices);
+			break;
+		}
+
+		auto& statistics = processed.m_Statistics;
+		statistics.m_TriangleCount = indices.size() / 3;
+		statistics.m_TransformedVertexCountBefore = before.m_TransformedVertexCount;
+		statistics.m_TransformedVertexCountAfter = Xenon::AnalyzeVertexCache(indices, subMesh.m_VertexCount).m_TransformedVertexCount;
+		statistics.m_VertexCountBefore = vertexCountBefore;
+		statistics.m_VertexCountAfter = subMesh.m_VertexCount;
+	}
+
+	/**
+	 * Model data structure.
+	 * This contains a glTF model's data in the cooked layout.
+	 */
+	struct ModelData final
+	{
+		Xenon::Backend::VertexSpecification m_VertexSpecification;
+
+		std::vector<Xenon::CookedMesh> m_Meshes;
+		std::string m_Names;
+		std::vector<Xenon::CookedSubMesh> m_SubMeshes;
+
+		std::vector<Xenon::CookedSampler> m_Samplers;
+		std::vector<Xenon::CookedImage> m_Images;
+
+		std::vector<unsigned char> m_Vertices;
+		std::vector<unsigned char> m_Indices;
+
+		std::vector<Xenon::Meshlet> m_Meshlets;
+	};
+
+	/**
+	 * Load a node from the model.
+	 *
+	 * @param model The model to load from.
+	 * @param node The node to load.
+	 * @param data The model data to load to. The sub-meshes must already be allocated.
+	 * @param subMeshIndex The index of the next sub-mesh to load.
+	 * @param vertexItr The vertex storage iterator.
+	 * @param indexItr The index storage iterator.
+	 * @param processedSubMeshes The processed sub-meshes, one per sub-mesh.
+	 * @param optimize Whether to optimize the sub-meshes and split them into meshlets.
+	 * @param jobGroup The job group to insert the sub-mesh loading jobs to.
+	 */
+	void LoadNode(
+		const tinygltf::Model& model,
+		const tinygltf::Node& node,
+		ModelData& data,
+		uint64_t& subMeshIndex,
+		std::vector<unsigned char>::iterator& vertexItr,
+		std::vector<unsigned char>::iterator& indexItr,
+		std::span<ProcessedSubMesh> processedSubMeshes,
+		bool optimize,
+		Xenon::JobGroup& jobGroup)
+	{
+		XENON_TRACE_SCOPE();
+
+		// If it's an invalid index, return.
+		if (node.mesh == -1)
+			return;
+
+		// Get the mesh and initialize everything.
+		const auto& gltfMesh = model.meshes[node.mesh];
+		auto& mesh = data.m_Meshes.emplace_back();
+		mesh.m_NameOffset = data.m_Names.size();
+		mesh.m_NameSize = gltfMesh.name.size();
+		mesh.m_FirstSubMesh = subMeshIndex;
+		mesh.m_SubMeshCount = gltfMesh.primitives.size();
+		data.m_Names += gltfMesh.name;
+
+		// Load the sub-mesh information.
+		const auto& specification = data.m_VertexSpecification;
+		for (const auto& gltfPrimitive : gltfMesh.primitives)
+		{
+			// Create the primitive.
+			auto& processedSubMesh = processedSubMeshes[subMeshIndex];
+			auto& subMesh = data.m_SubMeshes[subMeshIndex++];
+			subMesh.m_VertexOffset = std::distance(data.m_Vertices.begin(), vertexItr);
+			subMesh.m_IndexOffset = std::distance(data.m_Indices.begin(), indexItr);
+
+			if (subMesh.m_VertexOffset > 0)
+				subMesh.m_VertexOffset /= specification.getSize();
+
+			// Setup the sub-mesh loader. This is done so VS won't fuck up the formatting smh...
+			const auto subMeshLoader = [&subMesh, &model, &specification, &gltfPrimitive, vertexItr, indexItr, optimize, &processedSubMesh]
+			{
+				XENON_TRACE_SCOPE_DYNAMIC("Loading Sub-Mesh Data");
+				LoadSubMesh(subMesh, specification, model, gltfPrimitive, vertexItr, indexItr);
+
+				ProcessSubMesh(subMesh, specification, vertexItr, indexItr, optimize, processedSubMesh);
+			};
+
+			// Insert the job. The loader waits on these right away, so they must not be background jobs (see JobSystem::wait()).
+			Xenon::XObject::GetJobSystem().insertDetached(jobGroup, subMeshLoader, Xenon::JobPriority::Normal);
+
+			// Get the next available vertex and index begin positions.
+			vertexItr += GetVertexCount(model, gltfPrimitive) * specification.getSize();
+			indexItr += GetIndexDataSize(model, gltfPrimitive);
+
+			// Setup the textures.
+			if (gltfPrimitive.material >= 0)
+			{
+				const auto& material = model.materials[gltfPrimitive.material];
+				subMesh.m_BaseColorTexture = GetCookedTexture(model, material.pbrMetallicRoughness.baseColorTexture);
+				subMesh.m_RoughnessTexture = GetCookedTexture(model, material.pbrMetallicRoughness.metallicRoughnessTexture);
+				subMesh.m_NormalTexture = GetCookedTexture(model, material.normalTexture);
+				subMesh.m_OcclusionTexture = GetCookedTexture(model, material.occlusionTexture);
+				subMesh.m_EmissiveTexture = GetCookedTexture(model, material.emissiveTexture);
+			}
+		}
+
+		// // Load the children.
+		// for (const auto child : node.children)
+		// 	LoadNode(model, model.nodes[child], data, subMeshIndex, vertexItr, indexItr, processedSubMeshes, optimize, jobGroup);
+	}
+
+	/**
+	 * Load a glTF model's data to the cooked layout.
+	 *
+	 * @param model The model to load from.
+	 * @param data The model data to load to.
+	 * @param file The model file. This is used for logging.
+	 * @param optimize Whether to optimize the triangle lists for the vertex cache, overdraw and vertex fetch, and to split them into meshlets.
+	 * @return True if the data were loaded.
+	 * @return False if the model does not have any vertex data.
+	 */
+	bool LoadModelData(const tinygltf::Model& model, ModelData& data, const std::filesystem::path& file, bool optimize)
+	{
+		XENON_TRACE_SCOPE();
+
+		// Resolve the vertex specification.
+		for (const auto& mesh : model.meshes)
+		{
+			for (const auto& primitive : mesh.primitives)
+			{
+				for (auto i = Xenon::EnumToInt(Xenon::Backend::InputElement::VertexPosition); i < Xenon::EnumToInt(Xenon::Backend::InputElement::VertexElementCount); i++)
+					ResolvePrimitive(model, primitive, g_Attributes[i], static_cast<Xenon::Backend::InputElement>(i), data.m_VertexSpecification);
+			}
+		}
+
+		// Resolve the buffer sizes. Only the meshes used by the nodes are loaded, once per node.
+		uint64_t vertexCount = 0;
+		uint64_t indexBufferSize = 0;
+		uint64_t subMeshCount = 0;
+
+		for (const auto& node : model.nodes)
+		{
+			if (node.mesh == -1)
+				continue;
+
+			for (const auto& primitive : model.meshes[node.mesh].primitives)
+			{
+				vertexCount += GetVertexCount(model, primitive);
+				indexBufferSize += GetIndexDataSize(model, primitive);
+				subMeshCount++;
+			}
+		}
+
+		// Check if we have data to create the vertex buffers.
+		const uint64_t vertexBufferSize = vertexCount * data.m_VertexSpecification.getSize();
+		if (vertexBufferSize == 0)
+		{
+			XENON_LOG_ERROR("The submitted model file '{}' does not have any vertex data to load!", file.string());
+			return false;
+		}
+
+		// Check if we have data to create the index buffers.
+		if (indexBufferSize == 0)
+		{
+			XENON_LOG_WARNING("The submitted model file '{}' does not have any index data to load!", file.string());
+		}
+
+		// Setup the samplers.
+		data.m_Samplers.reserve(model.samplers.size());
+		for (const auto& sampler : model.samplers)
+		{
+			auto& cookedSampler = data.m_Samplers.emplace_back();
+			cookedSampler.m_MinificationFilter = sampler.minFilter;
+			cookedSampler.m_MagnificationFilter = sampler.magFilter;
+			cookedSampler.m_AddressModeU = sampler.wrapS;
+			cookedSampler.m_AddressModeV = sampler.wrapT;
+		}
+
+		// Setup the images. Each image's pixels are aligned in the image data section.
+		uint64_t imageDataOffset = 0;
+		data.m_Images.reserve(model.images.size());
+		for (const auto& image : model.images)
+		{
+			auto& cookedImage = data.m_Images.emplace_back();
+			cookedImage.m_DataOffset = imageDataOffset;
+			cookedImage.m_DataSize = image.image.size();
+			cookedImage.m_Width = image.width;
+			cookedImage.m_Height = image.height;
+			cookedImage.m_Bits = image.bits;
+			cookedImage.m_Components = image.component;
+			cookedImage.m_PixelType = image.pixel_type;
+
+			imageDataOffset = AlignCookedOffset(imageDataOffset + cookedImage.m_DataSize);
+		}
+
+		// Load the nodes.
+		data.m_Vertices.resize(vertexBufferSize);
+		data.m_Indices.resize(indexBufferSize);
+		data.m_SubMeshes.resize(subMeshCount);
+		data.m_Meshes.reserve(model.meshes.size());
+
+		auto jobGroup = Xenon::JobGroup();
+		auto vertexItr = data.m_Vertices.begin();
+		auto indexItr = data.m_Indices.begin();
+		uint64_t subMeshIndex = 0;
+
+		std::vector<ProcessedSubMesh> processedSubMeshes(subMeshCount);
+		for (const auto& node : model.nodes)
+			LoadNode(model, node, data, subMeshIndex, vertexItr, indexItr, processedSubMeshes, optimize, jobGroup);
+
+		// Wait till all the sub-meshes are loaded.
+		Xenon::XObject::GetJobSystem().wait(jobGroup);
+
+		// Gather the meshlets.
+		uint64_t meshletCount = 0;
+		for (const auto& processedSubMesh : processedSubMeshes)
+			meshletCount += processedSubMesh.m_Meshlets.size();
+
+		data.m_Meshlets.reserve(meshletCount);
+		for (uint64_t i = 0; i < subMeshCount; i++)
+		{
+			data.m_SubMeshes[i].m_MeshletOffset = data.m_Meshlets.size();
+			data.m_SubMeshes[i].m_MeshletCount = processedSubMeshes[i].m_Meshlets.size();
+			data.m_Meshlets.insert(data.m_Meshlets.end(), processedSubMeshes[i].m_Meshlets.begin(), processedSubMeshes[i].m_Meshlets.end());
+		}
+
+		if (optimize)
+		{
+			// Optimized sub-meshes may have fewer vertices, so close the gaps between them.
+			const auto vertexSize = data.m_VertexSpecification.getSize();
+			uint64_t vertexOffset = 0;
+			for (auto& subMesh : data.m_SubMeshes)
+			{
+				if (subMesh.m_VertexOffset != vertexOffset)
+					std::memmove(data.m_Vertices.data() + vertexOffset * vertexSize, data.m_Vertices.data() + subMesh.m_VertexOffset * vertexSize, subMesh.m_VertexCount * vertexSize);
+
+				subMesh.m_VertexOffset = vertexOffset;
+				vertexOffset += subMesh.m_VertexCount;
+			}
+
+			data.m_Vertices.resize(vertexOffset * vertexSize);
+
+			// Report the results.
+			OptimizationStatistics total;
+			for (const auto& [meshlets, statistics] : processedSubMeshes)
+			{
+				total.m_TriangleCount += statistics.m_TriangleCount;
+				total.m_TransformedVertexCountBefore += statistics.m_TransformedVertexCountBefore;
+				total.m_TransformedVertexCountAfter += statistics.m_TransformedVertexCountAfter;
+				total.m_VertexCountBefore += statistics.m_VertexCountBefore;
+				total.m_VertexCountAfter += statistics.m_VertexCountAfter;
+			}
+
+			if (total.m_TriangleCount > 0)
+			{
+				XENON_LOG_INFORMATION(
+					"Optimized the meshes of '{}': ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}, vertices {} -> {}.",
+					file.string(),
+					static_cast<float>(total.m_TransformedVertexCountBefore) / static_cast<float>(total.m_TriangleCount),
+					static_cast<float>(total.m_TransformedVertexCountAfter) / static_cast<float>(total.m_TriangleCount),
+					static_cast<float>(total.m_TransformedVertexCountBefore) / static_cast<float>(total.m_VertexCountBefore),
+					static_cast<float>(total.m_TransformedVertexCountAfter) / static_cast<float>(total.m_VertexCountAfter),
+					total.m_VertexCountBefore,
+					total.m_VertexCountAfter);
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Get the cooked view of a model's data.
+	 *
+	 * @param model The model which the data was loaded from. The image pixels are referenced from it.
+	 * @param data The model data.
+	 * @return The cooked geometry view.
+	 */
+	XENON_NODISCARD Xenon::CookedGeometryView GetCookedView(const tinygltf::Model& model, const ModelData& data)
+	{
+		Xenon::CookedGeometryView view;
+		view.m_VertexSpecification = data.m_VertexSpecification;
+		view.m_Meshes = data.m_Meshes;
+		view.m_Names = data.m_Names;
+		view.m_SubMeshes = data.m_SubMeshes;
+		view.m_Samplers = data.m_Samplers;
+		view.m_Images = data.m_Images;
+		view.m_Vertices = std::span<const std::byte>(Xenon::ToBytes(data.m_Vertices.data()), data.m_Vertices.size());
+		view.m_Indices = std::span<const std::byte>(Xenon::ToBytes(data.m_Indices.data()), data.m_Indices.size());
+		view.m_Meshlets = data.m_Meshlets;
+
+		view.m_ImagePixels.reserve(model.images.size());
+		for (const auto& image : model.images)
+			view.m_ImagePixels.emplace_back(Xenon::ToBytes(image.image.data()), image.image.size());
+
+		return view;
+	}
+
+	/**
+	 * Write a cooked geometry file.
+	 *
+	 * @param file The file to write to.
+	 * @param view The cooked geometry view to write.
+	 * @return True if the file was written.
+	 * @return False if the file could not be written.
+	 */
+	bool WriteCookedGeometry(const std::filesystem::path& file, const Xenon::CookedGeometryView& view)
+	{
+		XENON_TRACE_SCOPE();
+
+		// Get the vertex elements in the order they appear in the vertex.
+		std::vector<Xenon::CookedVertexElement> vertexElements;
+		for (auto i = Xenon::EnumToInt(Xenon::Backend::InputElement::VertexPosition); i < Xenon::EnumToInt(Xenon::Backend::InputElement::VertexElementCount); i++)
+		{
+			const auto element = static_cast<Xenon::Backend::InputElement>(i);
+			if (!view.m_VertexSpecification.isAvailable(element))
+				continue;
+
+			auto& vertexElement = vertexElements.emplace_back();
+			vertexElement.m_Element = i;
+			vertexElement.m_AttributeDataType = Xenon::EnumToInt(view.m_VertexSpecification.getElementAttributeDataType(element));
+			vertexElement.m_ComponentDataType = Xenon::EnumToInt(view.m_VertexSpecification.getElementComponentDataType(element));
+		}
+
+		std::ranges::sort(vertexElements, {}, [&view](const Xenon::CookedVertexElement& element) { return view.m_VertexSpecification.offsetOf(static_cast<Xenon::Backend::InputElement>(element.m_Element)); });
+
+		// Setup the section layout.
+		Xenon::CookedGeometryHeader header;
+		uint64_t fileSize = sizeof(Xenon::CookedGeometryHeader);
+		const auto addSection = [&header, &fileSize](Xenon::CookedGeometrySectionType type, uint64_t size)
+		{
+			header.m_Sections[Xenon::EnumToInt(type)] = Xenon::CookedGeometrySection{ .m_Offset = fileSize, .m_Size = size };
+			fileSize = AlignCookedOffset(fileSize + size);
+		};
+
+		uint64_t imageDataSize = 0;
+		for (const auto& image : view.m_Images)
+			imageDataSize = std::max(imageDataSize, image.m_DataOffset + image.m_DataSize);
+
+		addSection(Xenon::CookedGeometrySectionType::VertexElements, vertexElements.size() * sizeof(Xenon::CookedVertexElement));
+		addSection(Xenon::CookedGeometrySectionType::Meshes, view.m_Meshes.size_bytes());
+		addSection(Xenon::CookedGeometrySectionType::SubMeshes, view.m_SubMeshes.size_bytes());
+		addSection(Xenon::CookedGeometrySectionType::Names, view.m_Names.size());
+		addSection(Xenon::CookedGeometrySectionType::Samplers, view.m_Samplers.size_bytes());
+		addSection(Xenon::CookedGeometrySectionType::Images, view.m_Images.size_bytes());
+		addSection(Xenon::CookedGeometrySectionType::ImageData, imageDataSize);
+		addSection(Xenon::CookedGeometrySectionType::Vertices, view.m_Vertices.size());
+		addSection(Xenon::CookedGeometrySectionType::Indices, view.m_Indices.size());
+		addSection(Xenon::CookedGeometrySectionType::Meshlets, view.m_Meshlets.size_bytes());
+
+		// Copy everything to the file bytes. The padding is left zeroed so the hash is deterministic.
+		auto bytes = std::vector<std::byte>(fileSize);
+		const auto copySection = [&header, &bytes](Xenon::CookedGeometrySectionType type, const void* pData)
+		{
+			const auto& section = header.m_Sections[Xenon::EnumToInt(type)];
+			if (section.m_Size > 0)
+				std::memcpy(bytes.data() + section.m_Offset, pData, section.m_Size);
+		};
+
+		copySection(Xenon::CookedGeometrySectionType::VertexElements, vertexElements.data());
+		copySection(Xenon::CookedGeometrySectionType::Meshes, view.m_Meshes.data());
+		copySection(Xenon::CookedGeometrySectionType::SubMeshes, view.m_SubMeshes.data());
+		copySection(Xenon::CookedGeometrySectionType::Names, view.m_Names.data());
+		copySection(Xenon::CookedGeometrySectionType::Samplers, view.m_Samplers.data());
+		copySection(Xenon::CookedGeometrySectionType::Images, view.m_Images.data());
+		copySection(Xenon::CookedGeometrySectionType::Vertices, view.m_Vertices.data());
+		copySection(Xenon::CookedGeometrySectionType::Indices, view.m_Indices.data());
+		copySection(Xenon::CookedGeometrySectionType::Meshlets, view.m_Meshlets.data());
+
+		const auto imageDataOffset = header.m_Sections[Xenon::EnumToInt(Xenon::CookedGeometrySectionType::ImageData)].m_Offset;
+		for (uint64_t i = 0; i < view.m_Images.size(); i++)
+		{
+			if (!view.m_ImagePixels[i].empty())
+				std::memcpy(bytes.data() + imageDataOffset + view.m_Images[i].m_DataOffset, view.m_ImagePixels[i].data(), view.m_ImagePixels[i].size());
+		}
+
+		// Finally hash the sections and write the header.
+		header.m_Hash = Xenon::GenerateHash(bytes.data() + sizeof(Xenon::CookedGeometryHeader), fileSize - sizeof(Xenon::CookedGeometryHeader));
+		std::memcpy(bytes.data(), &header, sizeof(Xenon::CookedGeometryHeader));
+
+		std::ofstream outputFile(file, std::ios::out | std::ios::binary);
+		if (!outputFile.is_open())
+		{
+			XENON_LOG_ERROR("Failed to open the cooked geometry file '{}' to write!", file.string());
+			return false;
+		}
+
+		outputFile.write(XENON_BIT_CAST(const char*, bytes.data()), bytes.size());
+		outputFile.close();
+
+		return true;
+	}
+
+	/**
+	 * Check if a mapped file is a cooked geometry file.
+	 *
+	 * @param mappedFile The mapped file.
+	 * @return True if the file begins with the cooked geometry magic.
+	 * @return False if the file is not a cooked geometry file.
+	 */
+	XENON_NODISCARD bool IsCookedGeometry(const Xenon::MappedFile& mappedFile) noexcept
+	{
+		uint32_t magic = 0;
+		if (mappedFile.getSize() < sizeof(magic))
+			return false;
+
+		std::memcpy(&magic, mappedFile.getData(), sizeof(magic));
+		return magic == Xenon::CookedGeometryMagic;
+	}
+
+	/**
+	 * Get a section of a cooked geometry file.
+	 *
+	 * @tparam Type The element type of the section.
+	 * @param mappedFile The mapped file.
+	 * @param header The file header.
+	 * @param type The section type.
+	 * @param section The section to set.
+	 * @return True if the section is valid.
+	 * @return False if the section is out of the file bounds or is misaligned.
+	 */
+	template<class Type>
+	XENON_NODISCARD bool GetCookedSection(const Xenon::MappedFile& mappedFile, const Xenon::CookedGeometryHeader& header, Xenon::CookedGeometrySectionType type, std::span<const Type>& section) noexcept
+	{
+		const auto& [offset, size] = header.m_Sections[Xenon::EnumToInt(type)];
+		if (offset % Xenon::CookedGeometryAlignment != 0 || size % sizeof(Type) != 0 || offset > mappedFile.getSize() || size > mappedFile.getSize() - offset)
+			return false;
+
+		section = std::span<const Type>(Xenon::FromBytes<Type>(mappedFile.getData() + offset), size / sizeof(Type));
+		return true;
+	}
+
+	/**
+	 * Read a cooked geometry file.
+	 * The file is validated, and the view points straight to the mapped data.
+	 *
+	 * @param mappedFile The mapped cooked geometry file.
+	 * @param view The cooked geometry view to set.
+	 * @param file The cooked geometry file path. This is used for logging.
+	 * @return True if the file is valid.
+	 * @return False if the file is invalid.
+	 */
+	bool ReadCookedGeometry(const Xenon::MappedFile& mappedFile, Xenon::CookedGeometryView& view, const std::filesystem::path& file)
+	{
+		XENON_TRACE_SCOPE();
+
+		if (mappedFile.getSize() < sizeof(Xenon::CookedGeometryHeader))
+		{
+			XENON_LOG_ERROR("The cooked geometry file '{}' is truncated!", file.string());
+			return false;
+		}
+
+		const auto& header = *Xenon::FromBytes<Xenon::CookedGeometryHeader>(mappedFile.getData());
+		if (header.m_Version != Xenon::CookedGeometryVersion)
+		{
+			XENON_LOG_ERROR("The cooked geometry file '{}' has the version {}, but the expected version is {}! Please cook the file again.", file.string(), header.m_Version, Xenon::CookedGeometryVersion);
+			return false;
+		}
+
+		if (header.m_Hash != Xenon::GenerateHash(mappedFile.getData() + sizeof(Xenon::CookedGeometryHeader), mappedFile.getSize() - sizeof(Xenon::CookedGeometryHeader)))
+		{
+			XENON_LOG_ERROR("The cooked geometry file '{}' is corrupted!", file.string());
+			return false;
+		}
+
+		// Get the sections.
+		std::span<const Xenon::CookedVertexElement> vertexElements;
+		std::span<const char> names;
+		std::span<const std::byte> imageData;
+
+		const auto validSections =
+			GetCookedSection(mappedFile, header, Xenon::CookedGeometrySectionType::VertexElements, vertexElements) &&
+			GetCookedSection(mappedFile, header, Xenon::CookedGeometrySectionType::Meshes, view.m_Meshes) &&
+			GetCookedSection(mappedFile, header, Xenon::CookedGeometrySectionType::SubMeshes, view.m_SubMeshes) &&
+			GetCookedSection(mappedFile, header, Xenon::CookedGeometrySectionType::Names, names) &&
+			GetCookedSection(mappedFile, header, Xenon::CookedGeometrySectionType::Samplers, view.m_Samplers) &&
+			GetCookedSection(mappedFile, header, Xenon::CookedGeometrySectionType::Images, view.m_Images) &&
+			GetCookedSection(mappedFile, header, Xenon::CookedGeometrySectionType::ImageData, imageData) &&
+			GetCookedSection(mappedFile, header, Xenon::CookedGeometrySectionType::Vertices, view.m_Vertices) &&
+			GetCookedSection(mappedFile, header, Xenon::CookedGeometrySectionType::Indices, view.m_Indices) &&
+			GetCookedSection(mappedFile, header, Xenon::CookedGeometrySectionType::Meshlets, view.m_Meshlets);
+
+		if (!validSections)
+		{
+			XENON_LOG_ERROR("The cooked geometry file '{}' has invalid sections!", file.string());
+			return false;
+		}
+
+		view.m_Names = std::string_view(names.data(), names.size());
+
+		// Rebuild the vertex specification.
+		for (const auto& element : vertexElements)
+		{
+			if (element.m_Element >= Xenon::EnumToInt(Xenon::Backend::InputElement::VertexElementCount) ||
+				element.m_AttributeDataType > Xenon::EnumToInt(Xenon::Backend::AttributeDataType::Scalar) ||
+				element.m_ComponentDataType > Xenon::EnumToInt(Xenon::Backend::ComponentDataType::Double))
+			{
+				XENON_LOG_ERROR("The cooked geometry file '{}' has an invalid vertex element!", file.string());
+				return false;
+			}
+
+			view.m_VertexSpecification.addElement(
+				static_cast<Xenon::Backend::InputElement>(element.m_Element),
+				static_cast<Xenon::Backend::AttributeDataType>(element.m_AttributeDataType),
+				static_cast<Xenon::Backend::ComponentDataType>(element.m_ComponentDataType));
+		}
+
+		// Validate the references between the sections.
+		for (const auto& mesh : view.m_Meshes)
+		{
+			if (mesh.m_NameOffset > view.m_Names.size() || mesh.m_NameSize > view.m_Names.size() - mesh.m_NameOffset ||
+				mesh.m_FirstSubMesh > view.m_SubMeshes.size() || mesh.m_SubMeshCount > view.m_SubMeshes.size() - mesh.m_FirstSubMesh)
+			{
+				XENON_LOG_ERROR("The cooked geometry file '{}' has an invalid mesh!", file.string());
+				return false;
+			}
+		}
+
+		// The vertex offsets are in vertices, and the index offsets are in indices of the sub-mesh's index size.
+		const auto vertexSize = view.m_VertexSpecification.getSize();
+		const auto vertexCapacity = vertexSize == 0 ? 0 : view.m_Vertices.size() / vertexSize;
+
+		for (const auto& subMesh : view.m_SubMeshes)
+		{
+			const auto isValidIndexSize = subMesh.m_IndexSize == 1 || subMesh.m_IndexSize == 2 || subMesh.m_IndexSize == 4 || (subMesh.m_IndexSize == 0 && subMesh.m_IndexCount == 0);
+			const auto indexCapacity = subMesh.m_IndexSize == 0 ? 0 : view.m_Indices.size() / subMesh.m_IndexSize;
+
+			if (subMesh.m_VertexOffset > vertexCapacity || subMesh.m_VertexCount > vertexCapacity - subMesh.m_VertexOffset ||
+				!isValidIndexSize || (subMesh.m_IndexCount > 0 && (subMesh.m_IndexOffset > indexCapacity || subMesh.m_IndexCount > indexCapacity - subMesh.m_IndexOffset)) ||
+				subMesh.m_Mode > Xenon::EnumToInt(Xenon::PrimitiveMode::TriangleFan) ||
+				subMesh.m_MeshletOffset > view.m_Meshlets.size() || subMesh.m_MeshletCount > view.m_Meshlets.size() - subMesh.m_MeshletOffset ||
+				std::ranges::any_of(view.m_Meshlets.subspan(subMesh.m_MeshletOffset, subMesh.m_MeshletCount), [&subMesh](const Xenon::Meshlet& meshlet) { return meshlet.m_IndexOffset + static_cast<uint64_t>(meshlet.m_IndexCount) > subMesh.m_IndexCount; }))
+			{
+				XENON_LOG_ERROR("The cooked geometry file '{}' has an invalid sub-mesh!", file.string());
+				return false;
+			}
+		}
+
+		view.m_ImagePixels.reserve(view.m_Images.size());
+		for (const auto& image : view.m_Images)
+		{
+			// The pixels are copied to a staging buffer sized using the image's dimensions, so the size must match them exactly.
+			const auto pixelCount = static_cast<uint64_t>(image.m_Width) * image.m_Height;
+			const auto isValidFormat = (image.m_Bits == 8 || image.m_Bits == 16 || image.m_Bits == 32) && image.m_Components >= 1 && image.m_Components <= 4;
+
+			if (image.m_DataOffset > imageData.size() || image.m_DataSize > imageData.size() - image.m_DataOffset ||
+				!isValidFormat || pixelCount > image.m_DataSize || pixelCount * image.m_Components * (image.m_Bits / 8) != image.m_DataSize)
+			{
+				XENON_LOG_ERROR("The cooked geometry file '{}' has an invalid image!", file.string());
+				return false;
+			}
+
+			view.m_ImagePixels.emplace_back(imageData.subspan(image.m_DataOffset, image.m_DataSize));
+		}
+
+		return true;
+	}
+}
+
+namespace Xenon
+{
+	/**
+	 * Model source structure.
+	 * This keeps a loaded glTF model alive, since the cooked view points to it's data.
+	 */
+	struct GeometrySource::ModelSource final
+	{
+		tinygltf::Model m_Model;
+		ModelData m_Data;
+	};
+
+	GeometrySource::GeometrySource() = default;
+
+	GeometrySource::~GeometrySource() = default;
+
+	bool GeometrySource::load(const std::filesystem::path& file, bool optimize /*= false*/)
+	{
+		XENON_TRACE_SCOPE();
+
+		m_View = {};
+		m_pModelSource.reset();
+
+		m_MappedFile = MappedFile(file);
+		if (!m_MappedFile.isValid())
+			return false;
+
+		// Cooked files are used straight from the mapping.
+		if (IsCookedGeometry(m_MappedFile))
+			return ReadCookedGeometry(m_MappedFile, m_View, file);
+
+		// Try and load the model data.
+		auto pModelSource = std::make_unique<ModelSource>();
+		if (!LoadModel(pModelSource->m_Model, m_MappedFile, file) || !LoadModelData(pModelSource->m_Model, pModelSource->m_Data, file, optimize))
+			return false;
+
+		// The model has it's own copy of everything it needs, so the file can be unmapped.
+		m_MappedFile = MappedFile();
+		m_pModelSource = std::move(pModelSource);
+		m_View = GetCookedView(m_pModelSource->m_Model, m_pModelSource->m_Data);
+
+		return true;
+	}
+
+	bool GeometrySource::Cook(const std::filesystem::path& sourceFile, const std::filesystem::path& cookedFile, bool optimize /*= true*/)
+	{
+		XENON_TRACE_SCOPE();
+
+		const auto mappedFile = MappedFile(sourceFile);
+		if (!mappedFile.isValid())
+			return false;
+
+		// Try and load the model data.
+		tinygltf::Model model;
+		if (!LoadModel(model, mappedFile, sourceFile))
+			return false;
+
+		ModelData data;
+		if (!LoadModelData(model, data, sourceFile, optimize))
+			return false;
+
+		return WriteCookedGeometry(cookedFile, GetCookedView(model, data));
+	}
+}
@@ -0,0 +1,76 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "CookedGeometry.hpp"
+
+#include "../XenonCore/MappedFile.hpp"
+
+#include <filesystem>
+#include <memory>
+
+namespace Xenon
+{
+	/**
+	 * Geometry source class.
+	 * This loads a geometry file to the cooked layout without creating any GPU resources, so it can be used by tools like the asset
+	 * packager as well as the engine. Cooked geometry (.xgeo) files are mapped and used in place, and text (.gltf) and binary (.glb) glTF
+	 * files are loaded and converted in memory. Either way the view is valid for as long as the object is alive.
+	 */
+	class GeometrySource final
+	{
+		struct ModelSource;
+
+	public:
+		/**
+		 * Default constructor.
+		 */
+		GeometrySource();
+
+		/**
+		 * Destructor.
+		 */
+		~GeometrySource();
+
+		XENON_DISABLE_COPY(GeometrySource);
+
+		/**
+		 * Load a geometry file.
+		 *
+		 * @param file The file to load.
+		 * @param optimize Whether to optimize the glTF triangle lists for the vertex cache, overdraw and vertex fetch, and to split them into
+		 * meshlets. Cooked files are already optimized when they are cooked. Default is false.
+		 * @return True if the file was loaded.
+		 * @return False if the file could not be loaded, or if it's invalid.
+		 */
+		XENON_NODISCARD bool load(const std::filesystem::path& file, bool optimize = false);
+
+		/**
+		 * Get the cooked view of the loaded geometry.
+		 *
+		 * @return The cooked geometry view.
+		 */
+		XENON_NODISCARD const CookedGeometryView& getView() const noexcept { return m_View; }
+
+		/**
+		 * Cook a glTF file to a cooked geometry file.
+		 * The cooked file contains the resolved vertex specification, the interleaved vertex data, the index data, the sub-mesh table,
+		 * the meshlets and the decoded images, so loading it does not require any processing.
+		 *
+		 * @param sourceFile The glTF file to cook.
+		 * @param cookedFile The cooked geometry file to write.
+		 * @param optimize Whether to optimize the triangle lists for the vertex cache, overdraw and vertex fetch, and to split them into
+		 * meshlets. Default is true.
+		 * @return True if the file was cooked.
+		 * @return False if the source file could not be loaded or if the cooked file could not be written.
+		 */
+		static bool Cook(const std::filesystem::path& sourceFile, const std::filesystem::path& cookedFile, bool optimize = true);
+
+	private:
+		MappedFile m_MappedFile;
+		std::unique_ptr<ModelSource> m_pModelSource;
+
+		CookedGeometryView m_View;
+	};
+}
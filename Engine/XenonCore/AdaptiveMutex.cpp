@@ -0,0 +1,64 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "AdaptiveMutex.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+
+#endif
+
+namespace /* anonymous */
+{
+	/**
+	 * Tell the processor that we're spinning.
+	 * This reduces the power usage and lets the other hyper-thread on the same core make progress.
+	 */
+	void CpuRelax() noexcept
+	{
+#if defined(_M_X64) || defined(_M_IX86)
+		_mm_pause();
+
+#elif defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+		asm volatile("yield");
+
+#else
+		std::this_thread::yield();
+
+#endif
+	}
+}
+
+namespace Xenon
+{
+	void AdaptiveMutex::lockContended()
+	{
+		// Spin for a while, in case the owner is about to unlock.
+		const auto spinLimit = std::clamp(m_SpinCount.load(std::memory_order_relaxed) * 2, MinSpinCount, MaxSpinCount);
+		for (uint32_t i = 0; i < spinLimit; i++)
+		{
+			CpuRelax();
+
+			if (m_State.load(std::memory_order_relaxed) == State::Unlocked && try_lock())
+			{
+				// Move the spin count towards the number of spins it took to acquire the lock.
+				const auto spinCount = static_cast<int64_t>(m_SpinCount.load(std::memory_order_relaxed));
+				m_SpinCount.store(static_cast<uint32_t>(spinCount + (static_cast<int64_t>(i) - spinCount) / 8), std::memory_order_relaxed);
+				return;
+			}
+		}
+
+		// Spinning did not help, so reduce the spin count for the next time and park till the mutex is unlocked.
+		const auto spinCount = m_SpinCount.load(std::memory_order_relaxed);
+		m_SpinCount.store(spinCount - spinCount / 8, std::memory_order_relaxed);
+
+		while (m_State.exchange(State::LockedWithWaiters, std::memory_order_acquire) != State::Unlocked)
+			m_State.wait(State::LockedWithWaiters, std::memory_order_relaxed);
+	}
+}
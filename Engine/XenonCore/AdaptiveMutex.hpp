@@ -0,0 +1,92 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <atomic>
+
+namespace Xenon
+{
+	/**
+	 * Adaptive mutex class.
+	 * This is a mutex for very short critical sections. A thread which finds the mutex locked spins for a while before parking on the
+	 * lock word (futex on supported platforms), and the number of spins adapts to how long the previous acquisitions took to succeed.
+	 * An uncontended lock and unlock is a single atomic operation each.
+	 *
+	 * This satisfies the Lockable requirements, so it can be used with std::scoped_lock and as the mutex type of Mutex<Type, MutexType>.
+	 */
+	class AdaptiveMutex final
+	{
+		/**
+		 * Lock state enum.
+		 */
+		enum class State : uint32_t
+		{
+			Unlocked,
+			Locked,
+			LockedWithWaiters
+		};
+
+	public:
+		/**
+		 * The minimum number of times to spin before parking.
+		 */
+		static constexpr uint32_t MinSpinCount = 16;
+
+		/**
+		 * The maximum number of times to spin before parking.
+		 */
+		static constexpr uint32_t MaxSpinCount = 1024;
+
+		/**
+		 * Default constructor.
+		 */
+		AdaptiveMutex() = default;
+
+		XENON_DISABLE_COPY(AdaptiveMutex);
+		XENON_DISABLE_MOVE(AdaptiveMutex);
+
+		/**
+		 * Lock the mutex.
+		 */
+		void lock()
+		{
+			auto expected = State::Unlocked;
+			if (!m_State.compare_exchange_strong(expected, State::Locked, std::memory_order_acquire, std::memory_order_relaxed))
+				lockContended();
+		}
+
+		/**
+		 * Try and lock the mutex without waiting.
+		 *
+		 * @return True if the mutex was locked.
+		 * @return False if the mutex is already locked.
+		 */
+		XENON_NODISCARD bool try_lock() noexcept
+		{
+			auto expected = State::Unlocked;
+			return m_State.compare_exchange_strong(expected, State::Locked, std::memory_order_acquire, std::memory_order_relaxed);
+		}
+
+		/**
+		 * Unlock the mutex.
+		 */
+		void unlock() noexcept
+		{
+			if (m_State.exchange(State::Unlocked, std::memory_order_release) == State::LockedWithWaiters)
+				m_State.notify_one();
+		}
+
+	private:
+		/**
+		 * Lock the mutex when it's already locked by another thread.
+		 */
+		void lockContended();
+
+	private:
+		std::atomic<State> m_State = State::Unlocked;
+		std::atomic_uint32_t m_SpinCount = 64;
+	};
+}
@@ -0,0 +1,345 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "AsyncLogger.hpp"
+#include "Logging.hpp"
+#include "SPSCQueue.hpp"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <condition_variable>
+
+namespace /* anonymous */
+{
+	/**
+	 * Thread buffer structure.
+	 * This contains the log records of a single thread. Buffers are never destroyed, and the buffer of a thread which has exited is
+	 * handed over to the next thread which starts logging.
+	 */
+	struct ThreadBuffer final
+	{
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param capacity The number of records the buffer can hold.
+		 */
+		explicit ThreadBuffer(uint64_t capacity) : m_Queue(capacity) {}
+
+		Xenon::SPSCQueue<Xenon::LogRecord> m_Queue;
+
+		std::atomic_uint64_t m_DroppedCount = 0;
+		std::atomic_bool m_IsRetired = false;
+	};
+
+	/**
+	 * Logger state structure.
+	 * This is intentionally leaked so that threads can keep logging while the static objects are destroyed.
+	 */
+	struct LoggerState final
+	{
+		std::mutex m_Mutex;
+		std::vector<ThreadBuffer*> m_pBuffers;
+
+		// The worker isn't the only one which drains the buffers, a thread which logs while the logger stops does as well.
+		std::mutex m_DrainMutex;
+
+		std::condition_variable m_Condition;
+		std::jthread m_Worker;
+
+		std::vector<std::pair<Xenon::LogRecord, uint64_t>> m_Batch;
+		fmt::memory_buffer m_MessageBuffer;
+
+		Xenon::AsyncLoggerConfiguration m_Configuration;
+
+		std::atomic_uint64_t m_RequestedFlush = 0;
+		std::atomic_uint64_t m_CompletedFlush = 0;
+		std::atomic_uint64_t m_TotalDroppedCount = 0;
+		std::atomic_bool m_ShouldStop = false;
+	};
+
+	/**
+	 * Get the logger state.
+	 *
+	 * @return The state reference.
+	 */
+	LoggerState& GetState()
+	{
+		static auto pState = new LoggerState();
+		return *pState;
+	}
+
+	/**
+	 * Thread buffer handle structure.
+	 * This retires the thread's buffer when the thread exits.
+	 */
+	struct ThreadBufferHandle final
+	{
+		/**
+		 * Destructor.
+		 */
+		~ThreadBufferHandle()
+		{
+			if (m_pBuffer)
+				m_pBuffer->m_IsRetired.store(true, std::memory_order_release);
+		}
+
+		ThreadBuffer* m_pBuffer = nullptr;
+	};
+
+	thread_local ThreadBufferHandle g_ThreadBuffer;
+
+	/**
+	 * Get the calling thread's buffer.
+	 * A retired buffer is reused if one is available, else a new buffer is created.
+	 *
+	 * @return The buffer reference.
+	 */
+	ThreadBuffer& GetThreadBuffer()
+	{
+		if (g_ThreadBuffer.m_pBuffer)
+			return *g_ThreadBuffer.m_pBuffer;
+
+		auto& state = GetState();
+		auto lock = std::scoped_lock(state.m_Mutex);
+
+		for (const auto pBuffer : state.m_pBuffers)
+		{
+			if (pBuffer->m_IsRetired.load(std::memory_order_acquire))
+			{
+				pBuffer->m_IsRetired.store(false, std::memory_order_relaxed);
+				g_ThreadBuffer.m_pBuffer = pBuffer;
+				return *pBuffer;
+			}
+		}
+
+		g_ThreadBuffer.m_pBuffer = state.m_pBuffers.emplace_back(new ThreadBuffer(state.m_Configuration.m_ThreadBufferCapacity));
+		return *g_ThreadBuffer.m_pBuffer;
+	}
+
+	/**
+	 * Format a record and write it to the default logger.
+	 *
+	 * @param record The record to write.
+	 * @param buffer The buffer to format the message to.
+	 */
+	void WriteRecord(const Xenon::LogRecord& record, fmt::memory_buffer& buffer)
+	{
+		buffer.clear();
+
+		try
+		{
+			if (record.m_pFile)
+				fmt::format_to(fmt::appender(buffer), "[Trace \"{}\":{}] ", record.m_pFile, record.m_Line);
+
+			record.m_pFormat(record, buffer);
+		}
+		catch (const fmt::format_error& error)
+		{
+			buffer.clear();
+			fmt::format_to(fmt::appender(buffer), "Failed to format the log message \"{}\"! {}", record.m_Format, error.what());
+		}
+
+		spdlog::default_logger_raw()->log(record.m_Time, spdlog::source_loc(), record.m_Level, spdlog::string_view_t(buffer.data(), buffer.size()));
+	}
+
+	/**
+	 * Write all the pending records of every thread buffer.
+	 * The records are written in timestamp order, and the records of the same thread are kept in the order they were logged.
+	 *
+	 * @param state The logger state.
+	 * @return The number of records written.
+	 */
+	uint64_t Drain(LoggerState& state)
+	{
+		auto drainLock = std::scoped_lock(state.m_DrainMutex);
+		state.m_Batch.clear();
+
+		{
+			auto lock = std::scoped_lock(state.m_Mutex);
+			for (const auto pBuffer : state.m_pBuffers)
+			{
+				// Limit the number of records taken from a single buffer so that a busy thread can't keep the others waiting.
+				for (uint64_t i = 0; i < pBuffer->m_Queue.getCapacity(); i++)
+				{
+					auto record = pBuffer->m_Queue.tryPop();
+					if (!record)
+						break;
+
+					state.m_Batch.emplace_back(*record, state.m_Batch.size());
+				}
+
+				if (const auto dropped = pBuffer->m_DroppedCount.exchange(0, std::memory_order_relaxed); dropped > 0)
+					spdlog::warn("The async logger dropped {} log message(s) because a thread's log buffer was full!", dropped);
+			}
+		}
+
+		std::sort(state.m_Batch.begin(), state.m_Batch.end(), [](const auto& lhs, const auto& rhs)
+			{
+				return lhs.first.m_Time < rhs.first.m_Time || (lhs.first.m_Time == rhs.first.m_Time && lhs.second < rhs.second);
+			}
+		);
+
+		for (const auto& [record, order] : state.m_Batch)
+			WriteRecord(record, state.m_MessageBuffer);
+
+		return state.m_Batch.size();
+	}
+
+	/**
+	 * Background thread function.
+	 *
+	 * @param state The logger state.
+	 */
+	void Worker(LoggerState& state)
+	{
+		auto completedFlush = state.m_CompletedFlush.load(std::memory_order_relaxed);
+		while (true)
+		{
+			// Anything that was pushed before the flush was requested will be picked up by this drain.
+			const auto requestedFlush = state.m_RequestedFlush.load(std::memory_order_acquire);
+			const auto count = Drain(state);
+
+			if (requestedFlush != completedFlush)
+			{
+				spdlog::default_logger_raw()->flush();
+
+				completedFlush = requestedFlush;
+				state.m_CompletedFlush.store(completedFlush, std::memory_order_release);
+				state.m_CompletedFlush.notify_all();
+			}
+
+			if (count > 0)
+				continue;
+
+			if (state.m_ShouldStop.load(std::memory_order_acquire))
+				break;
+
+			auto lock = std::unique_lock(state.m_Mutex);
+			state.m_Condition.wait_for(lock, state.m_Configuration.m_FlushInterval, [&state, requestedFlush]
+				{
+					return state.m_ShouldStop.load(std::memory_order_relaxed) || state.m_RequestedFlush.load(std::memory_order_relaxed) != requestedFlush;
+				}
+			);
+		}
+	}
+}
+
+namespace Xenon
+{
+	void AsyncLogger::Start(const AsyncLoggerConfiguration& configuration /*= {}*/)
+	{
+		auto& state = GetState();
+		if (IsRunning())
+		{
+			XENON_LOG_WARNING("The async logger is already running!");
+			return;
+		}
+
+		{
+			auto lock = std::scoped_lock(state.m_Mutex);
+			state.m_Configuration = configuration;
+			state.m_ShouldStop.store(false, std::memory_order_relaxed);
+			state.m_Batch.reserve(configuration.m_ThreadBufferCapacity);
+		}
+
+		state.m_Worker = std::jthread(Worker, std::ref(state));
+		Detail::g_IsAsyncLoggerRunning.store(true, std::memory_order_release);
+	}
+
+	void AsyncLogger::Stop()
+	{
+		auto& state = GetState();
+		if (!Detail::g_IsAsyncLoggerRunning.exchange(false, std::memory_order_seq_cst))
+			return;
+
+		// Pairs with the fence in Submit(). Either the final drain sees a record, or the thread which pushed it sees that the logger stopped.
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		{
+			auto lock = std::scoped_lock(state.m_Mutex);
+			state.m_ShouldStop.store(true, std::memory_order_release);
+		}
+
+		state.m_Condition.notify_one();
+		state.m_Worker.join();
+
+		// Write anything that was pushed while the worker was shutting down and release the threads which are waiting on a flush.
+		Drain(state);
+		spdlog::default_logger_raw()->flush();
+
+		state.m_CompletedFlush.store(state.m_RequestedFlush.load(std::memory_order_acquire), std::memory_order_release);
+		state.m_CompletedFlush.notify_all();
+	}
+
+	void AsyncLogger::Flush()
+	{
+		auto& state = GetState();
+		if (!IsRunning())
+			return;
+
+		uint64_t requestedFlush = 0;
+
+		{
+			auto lock = std::scoped_lock(state.m_Mutex);
+			requestedFlush = state.m_RequestedFlush.fetch_add(1, std::memory_order_acq_rel) + 1;
+		}
+
+		state.m_Condition.notify_one();
+
+		// The worker might have stopped in the meantime, in which case Stop() writes everything.
+		auto completedFlush = state.m_CompletedFlush.load(std::memory_order_acquire);
+		while (completedFlush < requestedFlush && IsRunning())
+		{
+			state.m_CompletedFlush.wait(completedFlush, std::memory_order_acquire);
+			completedFlush = state.m_CompletedFlush.load(std::memory_order_acquire);
+		}
+	}
+
+	uint64_t AsyncLogger::GetDroppedCount() noexcept
+	{
+		return GetState().m_TotalDroppedCount.load(std::memory_order_relaxed);
+	}
+
+	void AsyncLogger::Submit(const LogRecord& record)
+	{
+		auto& state = GetState();
+		auto& buffer = GetThreadBuffer();
+
+		if (!buffer.m_Queue.tryPush(record))
+		{
+			if (state.m_Configuration.m_OverflowPolicy == LogOverflowPolicy::Drop && record.m_Level != spdlog::level::critical)
+			{
+				buffer.m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+				state.m_TotalDroppedCount.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			// Wait for the worker to make room. If it's stopped, write the record ourselves.
+			while (!buffer.m_Queue.tryPush(record))
+			{
+				if (!IsRunning())
+				{
+					auto message = fmt::memory_buffer();
+					WriteRecord(record, message);
+					return;
+				}
+
+				std::this_thread::yield();
+			}
+		}
+
+		// Stop() might have done it's final drain before the record was pushed, in which case nobody else will write it.
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (!Detail::g_IsAsyncLoggerRunning.load(std::memory_order_relaxed))
+		{
+			Drain(state);
+			spdlog::default_logger_raw()->flush();
+			return;
+		}
+
+		if (record.m_Level == spdlog::level::critical)
+			Flush();
+	}
+}
@@ -0,0 +1,360 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <chrono>
+#include <tuple>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace Xenon
+{
+	/**
+	 * Log overflow policy enum.
+	 * This specifies what happens when a thread's log buffer is full.
+	 */
+	enum class LogOverflowPolicy : uint8_t
+	{
+		Drop,	// Drop the message. The number of dropped messages is reported by the background thread.
+		Block	// Wait until the background thread makes room for the message.
+	};
+
+	/**
+	 * Async logger configuration structure.
+	 */
+	struct AsyncLoggerConfiguration final
+	{
+		// The number of messages each thread can have in flight before the overflow policy kicks in.
+		uint64_t m_ThreadBufferCapacity = 1024;
+
+		// How long the background thread sleeps when there's nothing to write.
+		std::chrono::milliseconds m_FlushInterval = std::chrono::milliseconds(1);
+
+		// What to do when a thread's buffer is full.
+		LogOverflowPolicy m_OverflowPolicy = LogOverflowPolicy::Drop;
+	};
+
+	/**
+	 * Log record class.
+	 * This contains a single message which is yet to be formatted. The format arguments are copied into the record's payload, and are
+	 * decoded and formatted by the background thread using the format function.
+	 */
+	class LogRecord final
+	{
+	public:
+		/**
+		 * The maximum size of the encoded format arguments.
+		 */
+		static constexpr uint64_t PayloadSize = 192;
+
+		/**
+		 * The alignment of the payload.
+		 */
+		static constexpr uint64_t PayloadAlignment = 16;
+
+		using FormatFunction = void(*)(const LogRecord&, fmt::memory_buffer&);
+
+	public:
+		FormatFunction m_pFormat = nullptr;
+		fmt::string_view m_Format;
+
+		const char* m_pFile = nullptr;
+		std::chrono::system_clock::time_point m_Time;
+
+		uint32_t m_Line = 0;
+		spdlog::level::level_enum m_Level = spdlog::level::info;
+
+		alignas(PayloadAlignment) std::byte m_Payload[PayloadSize];
+	};
+
+	namespace Detail
+	{
+		/**
+		 * Is log string concept.
+		 * These arguments are copied into the log record as characters and are formatted as a string view.
+		 */
+		template<class Type>
+		concept IsLogString = std::is_convertible_v<const Type&, std::string_view>;
+
+		/**
+		 * Is log value concept.
+		 * These arguments are copied into the log record using their bytes. Only scalars are copied, since a trivially copyable class can
+		 * still refer to memory (like a span or a string view of a buffer) which is gone by the time the background thread formats it.
+		 */
+		template<class Type>
+		concept IsLogValue = !IsLogString<Type> && (std::is_arithmetic_v<Type> || std::is_enum_v<Type> || std::is_pointer_v<Type>) && alignof(Type) <= LogRecord::PayloadAlignment;
+
+		/**
+		 * Is log encodable concept.
+		 */
+		template<class Type>
+		concept IsLogEncodable = IsLogString<Type> || IsLogValue<Type>;
+
+		/**
+		 * The type which is used to format a log argument after it's been decoded.
+		 */
+		template<class Type>
+		using LogDecodedType = std::conditional_t<IsLogString<Type>, std::string_view, Type>;
+
+		/**
+		 * Whether the async logger is running.
+		 */
+		inline std::atomic_bool g_IsAsyncLoggerRunning = false;
+
+		/**
+		 * The minimum level a message must have to be logged.
+		 */
+		inline std::atomic<spdlog::level::level_enum> g_AsyncLoggerLevel = spdlog::level::trace;
+
+		/**
+		 * Align an offset in the log record payload.
+		 *
+		 * @param offset The offset to align.
+		 * @param alignment The alignment.
+		 * @return The aligned offset.
+		 */
+		XENON_NODISCARD constexpr uint64_t AlignLogOffset(uint64_t offset, uint64_t alignment) noexcept
+		{
+			return (offset + alignment - 1) & ~(alignment - 1);
+		}
+
+		/**
+		 * Encode a log argument to the payload.
+		 *
+		 * @tparam Type The argument type.
+		 * @param pPayload The payload pointer.
+		 * @param offset The current payload offset. This is advanced past the encoded argument.
+		 * @param argument The argument to encode.
+		 * @return True if the argument fit in the payload.
+		 * @return False if the payload is full.
+		 */
+		template<class Type>
+		XENON_NODISCARD bool EncodeLogArgument(std::byte* pPayload, uint64_t& offset, const Type& argument) noexcept
+		{
+			if constexpr (IsLogString<Type>)
+			{
+				const auto string = std::string_view(argument);
+				const auto length = static_cast<uint32_t>(string.size());
+
+				const auto end = offset + sizeof(uint32_t) + string.size();
+				if (end > LogRecord::PayloadSize)
+					return false;
+
+				std::memcpy(pPayload + offset, &length, sizeof(uint32_t));
+				std::memcpy(pPayload + offset + sizeof(uint32_t), string.data(), string.size());
+				offset = end;
+			}
+			else
+			{
+				offset = AlignLogOffset(offset, alignof(Type));
+				if (offset + sizeof(Type) > LogRecord::PayloadSize)
+					return false;
+
+				std::memcpy(pPayload + offset, &argument, sizeof(Type));
+				offset += sizeof(Type);
+			}
+
+			return true;
+		}
+
+		/**
+		 * Decode a log argument from the payload.
+		 * The arguments must be decoded in the same order they were encoded.
+		 *
+		 * @tparam Type The argument type.
+		 * @param pPayload The payload pointer.
+		 * @param offset The current payload offset. This is advanced past the decoded argument.
+		 * @return The decoded argument.
+		 */
+		template<class Type>
+		XENON_NODISCARD LogDecodedType<Type> DecodeLogArgument(const std::byte* pPayload, uint64_t& offset) noexcept
+		{
+			if constexpr (IsLogString<Type>)
+			{
+				uint32_t length = 0;
+				std::memcpy(&length, pPayload + offset, sizeof(uint32_t));
+
+				const auto string = std::string_view(reinterpret_cast<const char*>(pPayload + offset + sizeof(uint32_t)), length);
+				offset += sizeof(uint32_t) + length;
+
+				return string;
+			}
+			else
+			{
+				offset = AlignLogOffset(offset, alignof(Type));
+
+				const auto pArgument = std::launder(reinterpret_cast<const Type*>(pPayload + offset));
+				offset += sizeof(Type);
+
+				return *pArgument;
+			}
+		}
+
+		/**
+		 * Format a log record.
+		 * This is stored in the record as the format function and is called by the background thread.
+		 *
+		 * @tparam Arguments The format argument types.
+		 * @param record The record to format.
+		 * @param buffer The buffer to format to.
+		 */
+		template<class... Arguments>
+		void FormatLogRecord(const LogRecord& record, fmt::memory_buffer& buffer)
+		{
+			// This is unused when there are no arguments.
+			XENON_MAYBE_UNUSED uint64_t offset = 0;
+
+			// The braced initializer makes sure that the arguments are decoded from left to right.
+			const std::tuple<LogDecodedType<Arguments>...> arguments{ DecodeLogArgument<Arguments>(record.m_Payload, offset)... };
+			std::apply([&record, &buffer](const auto&... values) { fmt::vformat_to(fmt::appender(buffer), record.m_Format, fmt::make_format_args(values...)); }, arguments);
+		}
+	}
+
+	/**
+	 * Async logger class.
+	 * This moves the cost of formatting and writing log messages off the calling thread. The caller only copies the format arguments into
+	 * a lock-free per-thread ring buffer, and a background thread formats the messages (in timestamp order) and writes them to the default
+	 * spdlog logger. Nothing is allocated on the calling thread once it's buffer is created.
+	 *
+	 * Strings are copied into the message, and any other argument must be an arithmetic, enum or pointer type. Messages with other
+	 * arguments, or which do not fit in a single log record, are formatted and written on the calling thread, which is also what happens
+	 * when the logger is not running. Fatal messages wait until they are written.
+	 *
+	 * All the XENON_LOG_* macros go through this class.
+	 */
+	class AsyncLogger final
+	{
+	public:
+		/**
+		 * Start the background thread.
+		 * Messages logged before this are written synchronously.
+		 *
+		 * @param configuration The logger configuration.
+		 */
+		static void Start(const AsyncLoggerConfiguration& configuration = {});
+
+		/**
+		 * Write all the pending messages and stop the background thread.
+		 * Messages logged after this are written synchronously.
+		 */
+		static void Stop();
+
+		/**
+		 * Wait till all the messages which were logged before calling this are written.
+		 */
+		static void Flush();
+
+		/**
+		 * Check if the background thread is running.
+		 *
+		 * @return True if the logger is running.
+		 * @return False if the logger is not running.
+		 */
+		XENON_NODISCARD static bool IsRunning() noexcept { return Detail::g_IsAsyncLoggerRunning.load(std::memory_order_relaxed); }
+
+		/**
+		 * Set the minimum level a message must have to be logged.
+		 * Messages below this level are discarded before any of their arguments are touched.
+		 *
+		 * @param level The level to set.
+		 */
+		static void SetLevel(spdlog::level::level_enum level) noexcept { Detail::g_AsyncLoggerLevel.store(level, std::memory_order_relaxed); }
+
+		/**
+		 * Get the minimum level a message must have to be logged.
+		 *
+		 * @return The log level.
+		 */
+		XENON_NODISCARD static spdlog::level::level_enum GetLevel() noexcept { return Detail::g_AsyncLoggerLevel.load(std::memory_order_relaxed); }
+
+		/**
+		 * Check if a message with a given level will be logged.
+		 *
+		 * @param level The message level.
+		 * @return True if the message will be logged.
+		 * @return False if the message will be discarded.
+		 */
+		XENON_NODISCARD static bool ShouldLog(spdlog::level::level_enum level) noexcept { return level >= GetLevel(); }
+
+		/**
+		 * Get the total number of messages which were dropped because a thread's buffer was full.
+		 *
+		 * @return The dropped message count.
+		 */
+		XENON_NODISCARD static uint64_t GetDroppedCount() noexcept;
+
+		/**
+		 * Log a message.
+		 *
+		 * @tparam Arguments The format argument types.
+		 * @param level The message level.
+		 * @param format The format string.
+		 * @param arguments The format arguments.
+		 */
+		template<class... Arguments>
+		static void Log(spdlog::level::level_enum level, fmt::format_string<Arguments...> format, Arguments&&... arguments)
+		{
+			LogAt(level, nullptr, 0, format, std::forward<Arguments>(arguments)...);
+		}
+
+		/**
+		 * Log a message with the source location.
+		 *
+		 * @tparam Arguments The format argument types.
+		 * @param level The message level.
+		 * @param pFile The source file name. This must be a string literal. If this is nullptr, the location is not printed.
+		 * @param line The source line.
+		 * @param format The format string.
+		 * @param arguments The format arguments.
+		 */
+		template<class... Arguments>
+		static void LogAt(spdlog::level::level_enum level, const char* pFile, uint32_t line, fmt::format_string<Arguments...> format, Arguments&&... arguments)
+		{
+			if (!ShouldLog(level))
+				return;
+
+			if constexpr ((Detail::IsLogEncodable<std::remove_cvref_t<Arguments>> && ...))
+			{
+				if (IsRunning())
+				{
+					LogRecord record;
+					record.m_pFormat = &Detail::FormatLogRecord<std::remove_cvref_t<Arguments>...>;
+					record.m_Format = fmt::string_view(format);
+					record.m_pFile = pFile;
+					record.m_Line = line;
+					record.m_Level = level;
+					record.m_Time = std::chrono::system_clock::now();
+
+					uint64_t offset = 0;
+					if ((Detail::EncodeLogArgument(record.m_Payload, offset, arguments) && ...))
+					{
+						Submit(record);
+						return;
+					}
+				}
+			}
+
+			if (pFile)
+				spdlog::log(level, "[Trace \"{}\":{}] {}", pFile, line, fmt::format(format, std::forward<Arguments>(arguments)...));
+
+			else
+				spdlog::log(level, format, std::forward<Arguments>(arguments)...);
+		}
+
+	private:
+		/**
+		 * Push a record to the calling thread's buffer.
+		 * If the logger was stopped while the record was being pushed, the pending records are written on the calling thread.
+		 *
+		 * @param record The record to push.
+		 */
+		static void Submit(const LogRecord& record);
+	};
+}
@@ -5,7 +5,8 @@
 
 #include "Common.hpp"
 
-#include <array>
+#include <vector>
+#include <limits>
 #include <execution>
 #include <algorithm>
 
@@ -13,113 +14,152 @@ namespace Xenon
 {
 	/**
 	 * Bit set class.
-	 * This stores information about individual bits in a more compact manner (bit for a bit).
+	 * This is a dynamically sized set of bits, which are stored in 64-bit words. Counting and scanning works on whole words (popcount and
+	 * count trailing zeros), and the bulk operations (AND, OR, XOR and AND-NOT) are written so that they can be vectorized.
+	 *
+	 * The bits past the size in the last word are always kept as 0.
 	 */
-	template<uint32_t Bits>
 	class BitSet final
 	{
 		/**
-		 * Bit field structure.
-		 * This contains 1 byte worth of 8 bits which can be accessed separately.
+		 * The number of bits in a single word.
 		 */
-		struct BitField final
+		static constexpr uint64_t WordBits = 64;
+
+	public:
+		/**
+		 * The position returned by the find functions if no set bit was found.
+		 */
+		static constexpr uint64_t InvalidPosition = std::numeric_limits<uint64_t>::max();
+
+		/**
+		 * Set bit iterator class.
+		 * This iterates over the positions of the set bits, in ascending order.
+		 */
+		class SetBitIterator final
 		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = uint64_t;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const uint64_t*;
+			using reference = uint64_t;
+
 			/**
-			 * Is equal to operator.
+			 * Default constructor.
+			 */
+			SetBitIterator() = default;
+
+			/**
+			 * Explicit constructor.
 			 *
-			 * @param other The other bit field.
-			 * @return true if this is equal to the other.
-			 * @return false if this is not equal to the other.
+			 * @param pBitSet The bit set pointer.
+			 * @param position The position of the current set bit.
 			 */
-			XENON_NODISCARD constexpr bool operator==(const BitField other) const { return m_Value == other.m_Value; }
+			explicit SetBitIterator(const BitSet* pBitSet, uint64_t position) noexcept : m_pBitSet(pBitSet), m_Position(position) {}
 
 			/**
-			 * Three-way comparison operator.
+			 * Get the position of the current set bit.
 			 *
-			 * @param other The other bit field to compare.
-			 * @return The return of the comparison.
+			 * @return The position.
 			 */
-			XENON_NODISCARD constexpr auto operator<=>(const BitField other) const { return m_Value <=> other.m_Value; }
+			XENON_NODISCARD uint64_t operator*() const noexcept { return m_Position; }
 
 			/**
-			 * Bitwise and operator.
+			 * Move to the next set bit.
 			 *
-			 * @param other The other bit field.
-			 * @return The bitwise AND value.
+			 * @return The iterator reference.
 			 */
-			XENON_NODISCARD constexpr std::byte operator&(const BitField other) const { return m_Value & other.m_Value; }
+			SetBitIterator& operator++() noexcept
+			{
+				m_Position = m_pBitSet->findNextSet(m_Position);
+				return *this;
+			}
 
-			union
+			/**
+			 * Move to the next set bit.
+			 *
+			 * @return The iterator before moving.
+			 */
+			SetBitIterator operator++(int) noexcept
 			{
-				struct
-				{
-					bool m_A : 1;
-					bool m_B : 1;
-					bool m_C : 1;
-					bool m_D : 1;
-					bool m_E : 1;
-					bool m_F : 1;
-					bool m_G : 1;
-					bool m_H : 1;
-				};
-
-				std::byte m_Value; // This variable is there to sum up the bits in the bit field and to easily compare and do other operations.
-			};
+				auto previous = *this;
+				++(*this);
+				return previous;
+			}
+
+			/**
+			 * Is equal to operator.
+			 *
+			 * @param other The other iterator.
+			 * @return True if both iterators point to the same position.
+			 * @return False if the iterators point to different positions.
+			 */
+			XENON_NODISCARD bool operator==(const SetBitIterator& other) const noexcept { return m_Position == other.m_Position; }
+
+		private:
+			const BitSet* m_pBitSet = nullptr;
+			uint64_t m_Position = InvalidPosition;
 		};
 
 		/**
-		 * Resolve the array size.
-		 *
-		 * @tparam size The user defined size.
-		 * @return constexpr uint64_t The array size to set.
+		 * Set bit range structure.
+		 * This can be used to iterate over the set bits using a range based for loop.
 		 */
-		template<uint64_t size>
-		XENON_NODISCARD static consteval uint64_t ResolveArraySize()
+		struct SetBitRange final
 		{
-			if constexpr (size % 8 == 0)
-				return size / 8;
-			else
-				return (size / 8) + 1;
-		}
+			XENON_NODISCARD SetBitIterator begin() const noexcept { return SetBitIterator(m_pBitSet, m_pBitSet->findFirstSet()); }
+			XENON_NODISCARD SetBitIterator end() const noexcept { return SetBitIterator(m_pBitSet, InvalidPosition); }
+
+			const BitSet* m_pBitSet = nullptr;
+		};
+
 	public:
 		/**
 		 * Default constructor.
 		 */
-		constexpr BitSet() = default;
+		BitSet() = default;
 
 		/**
-		 * Initialize the bitset with an integer value.
+		 * Explicit constructor.
 		 *
-		 * @tparam Integer The integer value.
-		 * @param value The value to initialize with.
+		 * @param size The number of bits.
+		 * @param value The value to initialize all the bits with. Default is false.
 		 */
-		template<class Integer>
-		constexpr explicit BitSet(Integer value)
+		explicit BitSet(uint64_t size, bool value = false) { resize(size, value); }
+
+		/**
+		 * Resize the bit set.
+		 *
+		 * @param size The new number of bits.
+		 * @param value The value to initialize the new bits with. Default is false.
+		 */
+		void resize(uint64_t size, bool value = false)
 		{
-			constexpr auto typeBitCount = sizeof(Integer) * 8;
+			const auto oldSize = m_Size;
+			m_Words.resize(GetWordCount(size), value ? ~uint64_t(0) : 0);
+			m_Size = size;
 
-			// Validate the size.
-			if constexpr (typeBitCount > Bits)
-				return;
+			// Set the new bits in the word which was previously the last.
+			if (value && size > oldSize && oldSize % WordBits != 0)
+				m_Words[oldSize / WordBits] |= ~uint64_t(0) << (oldSize % WordBits);
 
-			// Initialize the bit fields.
-			for (uint32_t i = 0; i < typeBitCount; i++)
-				toggle(i, value & (1 << i));
+			clearUnusedBits();
 		}
 
 		/**
-		 * Get the size of the internal byte array.
+		 * Get the number of bits.
 		 *
-		 * @return constexpr uint64_t The size.
+		 * @return The size.
 		 */
-		XENON_NODISCARD constexpr uint64_t getSize() const { return ResolveArraySize<Bits>(); }
+		XENON_NODISCARD uint64_t getSize() const noexcept { return m_Size; }
 
 		/**
-		 * Get the indexable capacity of the internal byte array.
+		 * Get the words which contain the bits.
 		 *
-		 * @return constexpr uint64_t The capacity.
+		 * @return The words.
 		 */
-		XENON_NODISCARD constexpr uint64_t getCapacity() const { return m_Bytes.size() * 8; }
+		XENON_NODISCARD const std::vector<uint64_t>& getWords() const noexcept { return m_Words; }
 
 		/**
 		 * Test a given position to check if the bit value is 1 or 0.
@@ -128,102 +168,231 @@ namespace Xenon
 		 * @return true if the bit is 1.
 		 * @return false if the bit is 0.
 		 */
-		XENON_NODISCARD constexpr bool test(const uint64_t pos) const
+		XENON_NODISCARD bool test(const uint64_t pos) const noexcept { return (m_Words[pos / WordBits] >> (pos % WordBits)) & 1; }
+
+		/**
+		 * Set the value of a bit.
+		 *
+		 * @param pos The bit position to toggle.
+		 * @param value The value to set.
+		 */
+		void toggle(const uint64_t pos, const bool value) noexcept
 		{
-			const auto field = m_Bytes[pos / 8];
-			switch (pos % 8)
-			{
-			case 1:
-				return field.m_B;
+			const auto mask = uint64_t(1) << (pos % WordBits);
+			auto& word = m_Words[pos / WordBits];
+			word = value ? word | mask : word & ~mask;
+		}
+
+		/**
+		 * Toggle a bit to true.
+		 *
+		 * @param pos The bit position to toggle.
+		 */
+		void toggleTrue(const uint64_t pos) noexcept { m_Words[pos / WordBits] |= uint64_t(1) << (pos % WordBits); }
+
+		/**
+		 * Toggle a bit to false.
+		 *
+		 * @param pos The bit position to toggle.
+		 */
+		void toggleFalse(const uint64_t pos) noexcept { m_Words[pos / WordBits] &= ~(uint64_t(1) << (pos % WordBits)); }
+
+		/**
+		 * Flip a bit.
+		 *
+		 * @param pos The bit position to flip.
+		 */
+		void flip(const uint64_t pos) noexcept { m_Words[pos / WordBits] ^= uint64_t(1) << (pos % WordBits); }
 
-			case 2:
-				return field.m_C;
+		/**
+		 * Set all the bits to a value.
+		 *
+		 * @param value The value to set.
+		 */
+		void fill(bool value) noexcept
+		{
+			std::fill(m_Words.begin(), m_Words.end(), value ? ~uint64_t(0) : 0);
+			clearUnusedBits();
+		}
 
-			case 3:
-				return field.m_D;
+		/**
+		 * Get the number of set bits.
+		 *
+		 * @return The bit count.
+		 */
+		XENON_NODISCARD uint64_t count() const noexcept
+		{
+			uint64_t bitCount = 0;
+			for (const auto word : m_Words)
+				bitCount += std::popcount(word);
+
+			return bitCount;
+		}
+
+		/**
+		 * Check if any of the bits are set.
+		 *
+		 * @return True if at least one bit is set.
+		 * @return False if no bits are set.
+		 */
+		XENON_NODISCARD bool any() const noexcept { return std::any_of(m_Words.begin(), m_Words.end(), [](const uint64_t word) { return word != 0; }); }
+
+		/**
+		 * Check if none of the bits are set.
+		 *
+		 * @return True if no bits are set.
+		 * @return False if at least one bit is set.
+		 */
+		XENON_NODISCARD bool none() const noexcept { return !any(); }
 
-			case 4:
-				return field.m_E;
+		/**
+		 * Check if all the bits are set.
+		 *
+		 * @return True if all the bits are set.
+		 * @return False if at least one bit is not set.
+		 */
+		XENON_NODISCARD bool all() const noexcept { return count() == m_Size; }
 
-			case 5:
-				return field.m_F;
+		/**
+		 * Find the first set bit.
+		 *
+		 * @return The position of the bit. This will be InvalidPosition if no bits are set.
+		 */
+		XENON_NODISCARD uint64_t findFirstSet() const noexcept { return findSetFrom(0); }
 
-			case 6:
-				return field.m_G;
+		/**
+		 * Find the first set bit after a given position.
+		 *
+		 * @param pos The position to search after.
+		 * @return The position of the bit. This will be InvalidPosition if no bits are set after the position.
+		 */
+		XENON_NODISCARD uint64_t findNextSet(uint64_t pos) const noexcept { return pos + 1 < m_Size ? findSetFrom(pos + 1) : InvalidPosition; }
 
-			case 7:
-				return field.m_H;
+		/**
+		 * Get a range which can be used to iterate over the positions of the set bits.
+		 *
+		 * @return The set bit range.
+		 */
+		XENON_NODISCARD SetBitRange getSetBits() const noexcept { return SetBitRange{ this }; }
 
-			default:
-				return field.m_A;
+		/**
+		 * Call a function with the position of every set bit, in ascending order.
+		 * This is faster than iterating using the set bit range since it does not have to search for each bit from the start of it's word.
+		 *
+		 * @tparam Function The function type.
+		 * @param function The function to call. It should accept the bit position (uint64_t).
+		 */
+		template<class Function>
+		void forEachSet(Function&& function) const
+		{
+			for (uint64_t i = 0; i < m_Words.size(); i++)
+			{
+				for (auto word = m_Words[i]; word != 0; word &= word - 1)
+					function(i * WordBits + std::countr_zero(word));
 			}
 		}
 
+	public:
 		/**
-		 * Toggle a bit to true.
+		 * Clear the bits which are set in another bit set (this = this & ~other).
+		 * Bits past the other bit set's size are treated as 0.
 		 *
-		 * @param pos The bit position to toggle.
-		 * @param value The value to set.
+		 * @param other The other bit set.
+		 * @return This bit set reference.
 		 */
-		constexpr void toggle(const uint64_t pos, const bool value)
+		BitSet& andNot(const BitSet& other) noexcept
 		{
-			const auto index = pos / 8;
-			switch (pos % 8)
-			{
-			case 1:
-				m_Bytes[index].m_B = value;
-				break;
+			const auto wordCount = std::min(m_Words.size(), other.m_Words.size());
+			std::transform(std::execution::unseq, m_Words.begin(), m_Words.begin() + wordCount, other.m_Words.begin(), m_Words.begin(), [](const uint64_t lhs, const uint64_t rhs) { return lhs & ~rhs; });
 
-			case 2:
-				m_Bytes[index].m_C = value;
-				break;
+			return *this;
+		}
 
-			case 3:
-				m_Bytes[index].m_D = value;
-				break;
+		/**
+		 * Bitwise AND assignment operator.
+		 * Bits past the other bit set's size are treated as 0.
+		 *
+		 * @param other The other bit set.
+		 * @return This bit set reference.
+		 */
+		BitSet& operator&=(const BitSet& other) noexcept
+		{
+			const auto wordCount = std::min(m_Words.size(), other.m_Words.size());
+			std::transform(std::execution::unseq, m_Words.begin(), m_Words.begin() + wordCount, other.m_Words.begin(), m_Words.begin(), std::bit_and<uint64_t>());
+			std::fill(m_Words.begin() + wordCount, m_Words.end(), 0);
 
-			case 4:
-				m_Bytes[index].m_E = value;
-				break;
+			return *this;
+		}
 
-			case 5:
-				m_Bytes[index].m_F = value;
-				break;
+		/**
+		 * Bitwise OR assignment operator.
+		 * Bits past this bit set's size are ignored.
+		 *
+		 * @param other The other bit set.
+		 * @return This bit set reference.
+		 */
+		BitSet& operator|=(const BitSet& other) noexcept
+		{
+			const auto wordCount = std::min(m_Words.size(), other.m_Words.size());
+			std::transform(std::execution::unseq, m_Words.begin(), m_Words.begin() + wordCount, other.m_Words.begin(), m_Words.begin(), std::bit_or<uint64_t>());
+			clearUnusedBits();
 
-			case 6:
-				m_Bytes[index].m_G = value;
-				break;
+			return *this;
+		}
 
-			case 7:
-				m_Bytes[index].m_H = value;
-				break;
+		/**
+		 * Bitwise XOR assignment operator.
+		 * Bits past this bit set's size are ignored.
+		 *
+		 * @param other The other bit set.
+		 * @return This bit set reference.
+		 */
+		BitSet& operator^=(const BitSet& other) noexcept
+		{
+			const auto wordCount = std::min(m_Words.size(), other.m_Words.size());
+			std::transform(std::execution::unseq, m_Words.begin(), m_Words.begin() + wordCount, other.m_Words.begin(), m_Words.begin(), std::bit_xor<uint64_t>());
+			clearUnusedBits();
 
-			default:
-				m_Bytes[index].m_A = value;
-				break;
-			}
+			return *this;
 		}
 
 		/**
-		 * Toggle a bit to true.
+		 * Bitwise AND operator.
 		 *
-		 * @param pos The bit position to toggle.
+		 * @param other The other bit set.
+		 * @return The resulting bit set.
 		 */
-		constexpr void toggleTrue(const uint64_t pos) { toggle(pos, true); }
+		XENON_NODISCARD BitSet operator&(const BitSet& other) const { return BitSet(*this) &= other; }
 
 		/**
-		 * Toggle a bit to false.
+		 * Bitwise OR operator.
 		 *
-		 * @param pos The bit position to toggle.
+		 * @param other The other bit set.
+		 * @return The resulting bit set.
 		 */
-		constexpr void toggleFalse(const uint64_t pos) { toggle(pos, false); }
+		XENON_NODISCARD BitSet operator|(const BitSet& other) const { return BitSet(*this) |= other; }
 
 		/**
-		 * Get the container that's actually holding the data.
+		 * Bitwise XOR operator.
 		 *
-		 * @return constexpr decltype(auto) The container.
+		 * @param other The other bit set.
+		 * @return The resulting bit set.
 		 */
-		XENON_NODISCARD constexpr decltype(auto) getContainer() const { return m_Bytes; }
+		XENON_NODISCARD BitSet operator^(const BitSet& other) const { return BitSet(*this) ^= other; }
+
+		/**
+		 * Bitwise NOT operator.
+		 *
+		 * @return The resulting bit set.
+		 */
+		XENON_NODISCARD BitSet operator~() const
+		{
+			auto result = *this;
+			std::transform(std::execution::unseq, result.m_Words.begin(), result.m_Words.end(), result.m_Words.begin(), std::bit_not<uint64_t>());
+			result.clearUnusedBits();
+
+			return result;
+		}
 
 		/**
 		 * Index a single bit using the position of it.
@@ -232,21 +401,62 @@ namespace Xenon
 		 * @return true if the bit value is 1.
 		 * @return false if the bit value is 0.
 		 */
-		XENON_NODISCARD constexpr bool operator[](const uint64_t pos) const { return test(pos); }
+		XENON_NODISCARD bool operator[](const uint64_t pos) const noexcept { return test(pos); }
 
 		/**
-		 * Not equal to operator.
+		 * Is equal to operator.
 		 *
 		 * @param other The other bit set.
-		 * @return true if this bit set is not equal to the other.
-		 * @return false if this bit set is equal to the other.
+		 * @return true if both bit sets have the same size and bits.
+		 * @return false if the bit sets are different.
+		 */
+		XENON_NODISCARD bool operator==(const BitSet& other) const noexcept = default;
+
+	private:
+		/**
+		 * Get the number of words required to store a number of bits.
+		 *
+		 * @param size The number of bits.
+		 * @return The word count.
+		 */
+		XENON_NODISCARD static constexpr uint64_t GetWordCount(uint64_t size) noexcept { return (size + WordBits - 1) / WordBits; }
+
+		/**
+		 * Find the first set bit starting from a given position.
+		 *
+		 * @param pos The position to start from (inclusive).
+		 * @return The position of the bit. This will be InvalidPosition if no bits are set from the position.
+		 */
+		XENON_NODISCARD uint64_t findSetFrom(uint64_t pos) const noexcept
+		{
+			auto index = pos / WordBits;
+			if (index >= m_Words.size())
+				return InvalidPosition;
+
+			// Mask out the bits before the position in the first word.
+			auto word = m_Words[index] & (~uint64_t(0) << (pos % WordBits));
+			while (word == 0)
+			{
+				if (++index == m_Words.size())
+					return InvalidPosition;
+
+				word = m_Words[index];
+			}
+
+			return index * WordBits + std::countr_zero(word);
+		}
+
+		/**
+		 * Clear the bits past the size in the last word.
 		 */
-		XENON_NODISCARD constexpr bool operator!=(const BitSet other) const
+		void clearUnusedBits() noexcept
 		{
-			return std::equal(std::execution::unseq, m_Bytes.begin(), m_Bytes.end(), other.m_Bytes.begin(), [](const auto lhs, const auto rhs) { return lhs != rhs; });
+			if (m_Size % WordBits != 0)
+				m_Words.back() &= ~(~uint64_t(0) << (m_Size % WordBits));
 		}
 
 	private:
-		std::array<BitField, ResolveArraySize<Bits>()> m_Bytes = {};
+		std::vector<uint64_t> m_Words;
+		uint64_t m_Size = 0;
 	};
-}
\ No newline at end of file
+}
@@ -41,6 +41,14 @@
 #define XENON_NODISCARD									[[nodiscard]]
 #define XENON_MAYBE_UNUSED								[[maybe_unused]]
 
+#ifdef _MSC_VER
+#	define XENON_NO_UNIQUE_ADDRESS						[[msvc::no_unique_address]]
+
+#else
+#	define XENON_NO_UNIQUE_ADDRESS						[[no_unique_address]]
+
+#endif
+
 namespace Xenon
 {
 	/**
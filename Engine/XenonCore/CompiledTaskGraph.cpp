@@ -0,0 +1,189 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CompiledTaskGraph.hpp"
+#include "Logging.hpp"
+
+#include <algorithm>
+
+namespace Xenon
+{
+	void CompiledTaskGraph::addDependency(TaskIndex parent, TaskIndex child)
+	{
+		if (parent >= m_Tasks.size() || child >= m_Tasks.size())
+		{
+			XENON_LOG_ERROR("Invalid task index provided to the compiled task graph!");
+			return;
+		}
+
+		m_Tasks[parent].m_Successors.emplace_back(child);
+		m_Tasks[child].m_DependencyCount++;
+		m_IsCompiled = false;
+	}
+
+	bool CompiledTaskGraph::compile()
+	{
+		// Make sure that we aren't replaying.
+		wait();
+
+		const auto taskCount = m_Tasks.size();
+
+		// Flatten the successor lists.
+		m_Successors.clear();
+		m_SuccessorOffsets.clear();
+		m_SuccessorOffsets.reserve(taskCount + 1);
+		for (const auto& task : m_Tasks)
+		{
+			m_SuccessorOffsets.emplace_back(static_cast<uint32_t>(m_Successors.size()));
+			m_Successors.insert(m_Successors.end(), task.m_Successors.begin(), task.m_Successors.end());
+		}
+
+		m_SuccessorOffsets.emplace_back(static_cast<uint32_t>(m_Successors.size()));
+
+		// Resolve the topological order (Kahn's algorithm) and the root tasks.
+		m_pPendingDependencies = std::make_unique<std::atomic_uint32_t[]>(taskCount);
+		m_Order.clear();
+		m_Order.reserve(taskCount);
+		m_Roots.clear();
+
+		for (TaskIndex i = 0; i < taskCount; i++)
+		{
+			m_pPendingDependencies[i].store(m_Tasks[i].m_DependencyCount, std::memory_order_relaxed);
+			if (m_Tasks[i].m_DependencyCount == 0)
+			{
+				m_Roots.emplace_back(i);
+				m_Order.emplace_back(i);
+			}
+		}
+
+		for (uint64_t i = 0; i < m_Order.size(); i++)
+		{
+			const auto index = m_Order[i];
+			for (auto j = m_SuccessorOffsets[index]; j < m_SuccessorOffsets[index + 1]; j++)
+			{
+				if (m_pPendingDependencies[m_Successors[j]].fetch_sub(1, std::memory_order_relaxed) == 1)
+					m_Order.emplace_back(m_Successors[j]);
+			}
+		}
+
+		if (m_Order.size() != taskCount)
+		{
+			XENON_LOG_ERROR("Failed to compile the task graph! The graph contains a cycle.");
+			m_IsCompiled = false;
+			return false;
+		}
+
+		// Allocate the timing data up front so that replaying does not allocate.
+		m_StartTimes.assign(taskCount, Clock::time_point());
+		m_EndTimes.assign(taskCount, Clock::time_point());
+		m_PathDurations.assign(taskCount, std::chrono::nanoseconds(0));
+		m_PathParents.assign(taskCount, InvalidTask);
+		m_CriticalPath.clear();
+		m_CriticalPath.reserve(taskCount);
+
+		m_IsCompiled = true;
+		return true;
+	}
+
+	void CompiledTaskGraph::replay()
+	{
+		if (!m_IsCompiled && !compile())
+			return;
+
+		// Reset the dependency counters.
+		for (TaskIndex i = 0; i < m_Tasks.size(); i++)
+			m_pPendingDependencies[i].store(m_Tasks[i].m_DependencyCount, std::memory_order_relaxed);
+
+		m_IsReplaying = true;
+		m_ReplayStart = Clock::now();
+
+		for (const auto root : m_Roots)
+			submit(root);
+	}
+
+	void CompiledTaskGraph::wait()
+	{
+		m_JobSystem.wait(m_JobGroup);
+
+		if (m_IsReplaying)
+		{
+			m_IsReplaying = false;
+			resolveTimings();
+		}
+	}
+
+	void CompiledTaskGraph::submit(TaskIndex index)
+	{
+		m_JobSystem.insertDetached(m_JobGroup, [this, index] { run(index); }, m_Priority);
+	}
+
+	void CompiledTaskGraph::run(TaskIndex index)
+	{
+		while (index != InvalidTask)
+		{
+			m_StartTimes[index] = Clock::now();
+			m_Tasks[index].m_Function();
+			m_EndTimes[index] = Clock::now();
+
+			// Release the successors. The first one which becomes ready is executed on this thread.
+			auto continuation = InvalidTask;
+			for (auto i = m_SuccessorOffsets[index]; i < m_SuccessorOffsets[index + 1]; i++)
+			{
+				const auto successor = m_Successors[i];
+				if (m_pPendingDependencies[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					if (continuation == InvalidTask)
+						continuation = successor;
+
+					else
+						submit(successor);
+				}
+			}
+
+			index = continuation;
+		}
+	}
+
+	void CompiledTaskGraph::resolveTimings()
+	{
+		// Walk the tasks in topological order, propagating the longest path duration to the successors.
+		auto criticalTask = InvalidTask;
+		auto criticalDuration = std::chrono::nanoseconds(0);
+		auto replayEnd = m_ReplayStart;
+
+		std::fill(m_PathDurations.begin(), m_PathDurations.end(), std::chrono::nanoseconds(0));
+		std::fill(m_PathParents.begin(), m_PathParents.end(), InvalidTask);
+
+		for (const auto index : m_Order)
+		{
+			const auto duration = m_PathDurations[index] + getTaskDuration(index);
+			if (criticalTask == InvalidTask || duration > criticalDuration)
+			{
+				criticalTask = index;
+				criticalDuration = duration;
+			}
+
+			for (auto i = m_SuccessorOffsets[index]; i < m_SuccessorOffsets[index + 1]; i++)
+			{
+				const auto successor = m_Successors[i];
+				if (duration > m_PathDurations[successor] || m_PathParents[successor] == InvalidTask)
+				{
+					m_PathDurations[successor] = duration;
+					m_PathParents[successor] = index;
+				}
+			}
+
+			replayEnd = std::max(replayEnd, m_EndTimes[index]);
+		}
+
+		// Walk back from the last task of the critical path.
+		m_CriticalPath.clear();
+		for (auto index = criticalTask; index != InvalidTask; index = m_PathParents[index])
+			m_CriticalPath.emplace_back(index);
+
+		std::reverse(m_CriticalPath.begin(), m_CriticalPath.end());
+
+		m_CriticalPathDuration = criticalDuration;
+		m_ReplayDuration = replayEnd - m_ReplayStart;
+	}
+}
@@ -0,0 +1,219 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "JobSystem.hpp"
+
+#include <chrono>
+#include <deque>
+#include <limits>
+
+namespace Xenon
+{
+	/**
+	 * Compiled task graph class.
+	 * Unlike the task graph, this graph is built once and is then compiled into flat arrays (topological order, dependency counters and
+	 * successor lists) so that it can be replayed any number of times (ie: once per frame) without any allocations or locks.
+	 *
+	 * Each replay also records the execution time of every task, which is used to resolve the critical path of the replay; the longest
+	 * chain of dependent tasks which bounds how fast the graph can execute regardless of the number of workers.
+	 */
+	class CompiledTaskGraph final
+	{
+	public:
+		using TaskIndex = uint32_t;
+		using Clock = std::chrono::steady_clock;
+
+		/**
+		 * The invalid task index.
+		 */
+		static constexpr TaskIndex InvalidTask = std::numeric_limits<TaskIndex>::max();
+
+	private:
+		/**
+		 * Task structure.
+		 * This contains the build-time information of a single task.
+		 */
+		struct Task final
+		{
+			Job m_Function;
+			std::vector<TaskIndex> m_Successors;
+			uint32_t m_DependencyCount = 0;
+		};
+
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param jobSystem The job system to use.
+		 * @param priority The priority of the tasks. Default is critical.
+		 */
+		explicit CompiledTaskGraph(JobSystem& jobSystem, JobPriority priority = JobPriority::Critical) : m_JobSystem(jobSystem), m_Priority(priority) {}
+
+		/**
+		 * Destructor.
+		 * This will wait till the current replay (if any) completes.
+		 */
+		~CompiledTaskGraph() { m_JobSystem.wait(m_JobGroup); }
+
+		XENON_DISABLE_COPY(CompiledTaskGraph);
+		XENON_DISABLE_MOVE(CompiledTaskGraph);
+
+		/**
+		 * Create a new task.
+		 * This will invalidate the compiled graph.
+		 *
+		 * @tparam Function The function type.
+		 * @param function The function to run as the task. This is invoked on every replay.
+		 * @param dependencies The tasks which must be completed before running this task. Default is none.
+		 * @return The task index.
+		 */
+		template<class Function>
+		TaskIndex create(Function&& function, const std::vector<TaskIndex>& dependencies = {})
+		{
+			const auto index = static_cast<TaskIndex>(m_Tasks.size());
+			m_Tasks.emplace_back().m_Function.set(std::forward<Function>(function));
+
+			for (const auto dependency : dependencies)
+				addDependency(dependency, index);
+
+			return index;
+		}
+
+		/**
+		 * Add a dependency between two tasks.
+		 * This will invalidate the compiled graph.
+		 *
+		 * @param parent The task which must be completed first.
+		 * @param child The task which depends on the parent.
+		 */
+		void addDependency(TaskIndex parent, TaskIndex child);
+
+		/**
+		 * Compile the graph.
+		 * This resolves the topological order and flattens the dependency information.
+		 *
+		 * @return True if the graph was compiled.
+		 * @return False if the graph contains a cycle.
+		 */
+		bool compile();
+
+		/**
+		 * Start replaying the graph.
+		 * The graph is compiled if it's not compiled already. Make sure that the previous replay has completed before calling this.
+		 */
+		void replay();
+
+		/**
+		 * Wait till the current replay completes.
+		 * The calling thread will execute pending jobs while waiting. The replay timings are resolved once the replay completes.
+		 */
+		void wait();
+
+		/**
+		 * Replay the graph and wait till it completes.
+		 */
+		void execute() { replay(); wait(); }
+
+		/**
+		 * Check if the graph is compiled.
+		 *
+		 * @return True if the graph is compiled.
+		 * @return False if the graph is not compiled.
+		 */
+		XENON_NODISCARD bool isCompiled() const noexcept { return m_IsCompiled; }
+
+		/**
+		 * Check if the current replay has completed.
+		 *
+		 * @return True if the replay has completed.
+		 * @return False if the replay has not completed.
+		 */
+		XENON_NODISCARD bool isComplete() const noexcept { return m_JobGroup.isComplete(); }
+
+		/**
+		 * Get the number of tasks in the graph.
+		 *
+		 * @return The task count.
+		 */
+		XENON_NODISCARD uint64_t getTaskCount() const noexcept { return m_Tasks.size(); }
+
+		/**
+		 * Get the wall time of the last replay.
+		 *
+		 * @return The duration.
+		 */
+		XENON_NODISCARD std::chrono::nanoseconds getReplayDuration() const noexcept { return m_ReplayDuration; }
+
+		/**
+		 * Get the total execution time of the tasks in the critical path of the last replay.
+		 *
+		 * @return The duration.
+		 */
+		XENON_NODISCARD std::chrono::nanoseconds getCriticalPathDuration() const noexcept { return m_CriticalPathDuration; }
+
+		/**
+		 * Get the tasks of the critical path of the last replay, in execution order.
+		 *
+		 * @return The task indexes.
+		 */
+		XENON_NODISCARD const std::vector<TaskIndex>& getCriticalPath() const noexcept { return m_CriticalPath; }
+
+		/**
+		 * Get the execution time of a single task in the last replay.
+		 *
+		 * @param index The task index.
+		 * @return The duration.
+		 */
+		XENON_NODISCARD std::chrono::nanoseconds getTaskDuration(TaskIndex index) const { return m_EndTimes[index] - m_StartTimes[index]; }
+
+	private:
+		/**
+		 * Insert a ready task to the job system.
+		 *
+		 * @param index The task index.
+		 */
+		void submit(TaskIndex index);
+
+		/**
+		 * Run a task and release it's successors.
+		 * The first successor which becomes ready is executed on the same thread and the rest are submitted to the job system.
+		 *
+		 * @param index The task index.
+		 */
+		void run(TaskIndex index);
+
+		/**
+		 * Resolve the replay duration and the critical path of the last replay.
+		 */
+		void resolveTimings();
+
+	private:
+		JobSystem& m_JobSystem;
+		JobGroup m_JobGroup;
+
+		std::deque<Task> m_Tasks;
+
+		std::vector<TaskIndex> m_Order;
+		std::vector<TaskIndex> m_Roots;
+		std::vector<TaskIndex> m_Successors;
+		std::vector<uint32_t> m_SuccessorOffsets;
+		std::unique_ptr<std::atomic_uint32_t[]> m_pPendingDependencies;
+
+		std::vector<Clock::time_point> m_StartTimes;
+		std::vector<Clock::time_point> m_EndTimes;
+		std::vector<std::chrono::nanoseconds> m_PathDurations;
+		std::vector<TaskIndex> m_PathParents;
+		std::vector<TaskIndex> m_CriticalPath;
+
+		Clock::time_point m_ReplayStart;
+		std::chrono::nanoseconds m_ReplayDuration = std::chrono::nanoseconds(0);
+		std::chrono::nanoseconds m_CriticalPathDuration = std::chrono::nanoseconds(0);
+
+		JobPriority m_Priority = JobPriority::Critical;
+
+		bool m_IsCompiled = false;
+		bool m_IsReplaying = false;
+	};
+}
@@ -2,53 +2,134 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "CountingFence.hpp"
+#include "JobSystem.hpp"
+#include "Tracer.hpp"
 
-#include <optick.h>
+#include <thread>
+
+namespace /* anonymous */
+{
+	/**
+	 * The number of times to check the counter before blocking when spinning.
+	 */
+	constexpr uint32_t g_SpinCount = 1024;
+}
 
 namespace Xenon
 {
 	void CountingFence::arrive(uint64_t decrement /*= 1*/)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
+
+		m_ActiveArrivals.fetch_add(1, std::memory_order_relaxed);
+
+		Awaitable* pWaiters = nullptr;
+		if (m_Counter.fetch_sub(decrement, std::memory_order_acq_rel) == decrement)
+		{
+			m_Counter.notify_all();
+			pWaiters = takeWaiters();
+		}
 
-		m_Counter -= decrement;
-		if (m_Counter == 0)
-			m_ConditionVariable.notify_all();
+		// This must be the last access to the fence.
+		m_ActiveArrivals.fetch_sub(1, std::memory_order_release);
+		ResumeWaiters(pWaiters);
 	}
 
-	void CountingFence::waitBlocking()
+	void CountingFence::waitBlocking() const
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
-		auto lock = std::unique_lock(m_Mutex);
-		m_ConditionVariable.wait(lock, [this] { return m_Counter == 0; });
+		for (auto value = m_Counter.load(); value > 0; value = m_Counter.load())
+			m_Counter.wait(value);
+
+		waitForArrivals();
 	}
 
 	void CountingFence::waitSpinning() const
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
+
+		for (uint32_t i = 0; i < g_SpinCount; i++)
+		{
+			if (m_Counter == 0)
+			{
+				waitForArrivals();
+				return;
+			}
+		}
 
-		while (m_Counter > 0);
+		waitBlocking();
 	}
 
-	void CountingFence::wait()
+	void CountingFence::wait() const
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		waitBlocking();
 	}
 
-	void CountingFence::wait() const
+	void CountingFence::wait(JobSystem& jobSystem) const
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
+
+		for (auto value = m_Counter.load(); value > 0; value = m_Counter.load())
+		{
+			if (!jobSystem.executeOne())
+				m_Counter.wait(value);
+		}
 
-		waitSpinning();
+		waitForArrivals();
 	}
 
 	void CountingFence::reset(uint64_t value)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		m_Counter = value;
+
+		if (value == 0)
+			ResumeWaiters(takeWaiters());
+	}
+
+	CountingFence::Awaitable* CountingFence::takeWaiters()
+	{
+		auto lock = std::scoped_lock(m_WaiterMutex);
+		return std::exchange(m_pWaiters, nullptr);
+	}
+
+	void CountingFence::waitForArrivals() const noexcept
+	{
+		while (m_ActiveArrivals.load(std::memory_order_acquire) > 0)
+			std::this_thread::yield();
+	}
+
+	void CountingFence::ResumeWaiters(Awaitable* pWaiter)
+	{
+		// Get the next waiter before resuming, since resuming the coroutine will destroy the awaitable.
+		while (pWaiter)
+		{
+			auto pNext = pWaiter->m_pNext;
+			pWaiter->m_Handle.resume();
+			pWaiter = pNext;
+		}
+	}
+
+	bool CountingFence::Awaitable::await_suspend(std::coroutine_handle<> handle)
+	{
+		{
+			auto lock = std::scoped_lock(m_Fence.m_WaiterMutex);
+
+			// The counter might have reached 0 after checking if we're ready.
+			if (m_Fence.m_Counter.load(std::memory_order_acquire) > 0)
+			{
+				m_Handle = handle;
+				m_pNext = std::exchange(m_Fence.m_pWaiters, this);
+				return true;
+			}
+		}
+
+		// The arriving thread takes the waiter lock, so wait for it outside the lock.
+		m_Fence.waitForArrivals();
+		return false;
 	}
-}
\ No newline at end of file
+}
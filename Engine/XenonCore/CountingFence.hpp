@@ -6,18 +6,38 @@
 #include "Common.hpp"
 
 #include <atomic>
+#include <coroutine>
 #include <mutex>
-#include <condition_variable>
 
 namespace Xenon
 {
+	class JobSystem;
+
 	/**
 	 * Counting fence class.
 	 * This class can be used to wait till multiple worker threads have finished execution. This works much like a std::latch but can be reused.
+	 * Blocking waits park the calling thread on the counter (futex on supported platforms) instead of spinning.
+	 * Coroutines can co_await the fence, in which case they are suspended without blocking the thread and are resumed by the thread
+	 * which brings the counter to 0.
 	 */
 	class CountingFence final
 	{
 	public:
+		/**
+		 * Awaitable structure.
+		 * This is created when a coroutine awaits the fence, and is linked to the fence's waiter list while the coroutine is suspended.
+		 */
+		struct Awaitable final
+		{
+			XENON_NODISCARD bool await_ready() const noexcept { return m_Fence.isComplete(); }
+			XENON_NODISCARD bool await_suspend(std::coroutine_handle<> handle);
+			void await_resume() const noexcept {}
+
+			const CountingFence& m_Fence;
+			std::coroutine_handle<> m_Handle = nullptr;
+			Awaitable* m_pNext = nullptr;
+		};
+
 		/**
 		 * Explicit constructor.
 		 *
@@ -25,6 +45,15 @@ namespace Xenon
 		 */
 		explicit CountingFence(uint64_t initialValue = 0) : m_Counter(initialValue) {}
 
+		/**
+		 * Destructor.
+		 * This waits till the threads which brought the counter to 0 are done notifying the fence.
+		 */
+		~CountingFence() { waitForArrivals(); }
+
+		XENON_DISABLE_COPY(CountingFence);
+		XENON_DISABLE_MOVE(CountingFence);
+
 		/**
 		 * Decrement the internal counter by a given value.
 		 *
@@ -38,30 +67,32 @@ namespace Xenon
 		 * @return True if the fence is complete (the counter is 0).
 		 * @return False if the fence is not complete (the counter is not 0).
 		 */
-		XENON_NODISCARD bool isComplete() const noexcept { return m_Counter == 0; }
+		XENON_NODISCARD bool isComplete() const noexcept { return m_Counter.load(std::memory_order_acquire) == 0 && m_ActiveArrivals.load(std::memory_order_acquire) == 0; }
 
 		/**
 		 * Wait till the counter has reached 0.
 		 * This will block the calling thread until the counter has reached 0.
 		 */
-		void waitBlocking();
+		void waitBlocking() const;
 
 		/**
 		 * Wait till the counter has reached 0.
-		 * This will use a spin-lock for this purpose.
+		 * This will spin for a short while before blocking the calling thread.
 		 */
 		void waitSpinning() const;
 
 		/**
 		 * Wait till the counter has reached 0.
 		 */
-		void wait();
+		void wait() const;
 
 		/**
 		 * Wait till the counter has reached 0.
-		 * This internally uses a spin lock and might not be safe!.
+		 * The calling thread will execute pending jobs from the job system while waiting, and will block if there's nothing to execute.
+		 *
+		 * @param jobSystem The job system to help.
 		 */
-		void wait() const;
+		void wait(JobSystem& jobSystem) const;
 
 		/**
 		 * Reset the counter.
@@ -77,9 +108,41 @@ namespace Xenon
 		 */
 		XENON_NODISCARD uint64_t getValue() const { return m_Counter; }
 
+		/**
+		 * Suspend the calling coroutine till the counter reaches 0.
+		 *
+		 * @return The awaitable.
+		 */
+		XENON_NODISCARD Awaitable operator co_await() const noexcept { return Awaitable{ *this }; }
+
+	private:
+		/**
+		 * Take the list of coroutines waiting on the fence.
+		 *
+		 * @return The first waiter in the list.
+		 */
+		XENON_NODISCARD Awaitable* takeWaiters();
+
+		/**
+		 * Wait till all the threads which are in arrive() have left it.
+		 * A waiter can see the counter reach 0 and destroy the fence while the thread which brought it to 0 is still notifying it,
+		 * so every wait should call this before returning.
+		 */
+		void waitForArrivals() const noexcept;
+
+		/**
+		 * Resume a list of coroutines which were waiting on the fence.
+		 * This does not touch the fence, since any of the coroutines can destroy it.
+		 *
+		 * @param pWaiter The first waiter in the list.
+		 */
+		static void ResumeWaiters(Awaitable* pWaiter);
+
 	private:
-		std::mutex m_Mutex;
-		std::condition_variable m_ConditionVariable;
 		std::atomic_uint64_t m_Counter;
+		std::atomic_uint32_t m_ActiveArrivals = 0;
+
+		mutable std::mutex m_WaiterMutex;
+		mutable Awaitable* m_pWaiters = nullptr;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,635 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+
+namespace Xenon
+{
+	namespace Detail
+	{
+		/**
+		 * Check if both the hasher and the key equal types support heterogeneous lookup.
+		 *
+		 * @tparam Hash The hasher type.
+		 * @tparam KeyEqual The key equal type.
+		 */
+		template<class Hash, class KeyEqual>
+		concept IsTransparentLookup = requires { typename Hash::is_transparent; typename KeyEqual::is_transparent; };
+	}
+
+	/**
+	 * Flat hash map class.
+	 * This is an open-addressing hash map which uses Robin Hood hashing with backward shift deletion. The entries are stored tightly
+	 * packed in a vector, and the bucket array only contains the index of each entry alongside it's probe distance and a part of it's
+	 * hash (the fingerprint). This means that a lookup usually touches a single cache line of buckets and compares the key only once,
+	 * and iterating over the map is as fast as iterating over a vector.
+	 *
+	 * Erasing an entry moves the last entry into it's place, so unlike std::unordered_map, references, pointers and iterators are
+	 * invalidated by insertions and erasures. Keys must not be modified through the iterators.
+	 *
+	 * The hash returned by the hasher is mixed before use, so identity hashes (like std::hash<uint64_t>) are fine. If both the hasher
+	 * and the key equal types define is_transparent, the lookup functions accept any type which can be hashed and compared with the key.
+	 *
+	 * @tparam Key The key type.
+	 * @tparam Value The value type.
+	 * @tparam Hash The hasher type. Default is std::hash<Key>.
+	 * @tparam KeyEqual The key equal type. Default is std::equal_to<Key>.
+	 */
+	template<class Key, class Value, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+	class FlatHashMap final
+	{
+		/**
+		 * Bucket structure.
+		 * The upper 24 bits of the distance and fingerprint contain the probe distance + 1 (so 0 means that the bucket is empty), and the
+		 * lower 8 bits contain the fingerprint.
+		 */
+		struct Bucket final
+		{
+			uint32_t m_DistanceAndFingerprint = 0;
+			uint32_t m_EntryIndex = 0;
+		};
+
+		/**
+		 * The value added to the distance and fingerprint to increase the probe distance by one.
+		 */
+		static constexpr uint32_t DistanceIncrement = 1 << 8;
+
+		/**
+		 * The mask used to get the fingerprint from a hash.
+		 */
+		static constexpr uint32_t FingerprintMask = DistanceIncrement - 1;
+
+		/**
+		 * The minimum number of buckets to allocate.
+		 */
+		static constexpr uint64_t MinBucketCount = 8;
+
+		/**
+		 * The maximum load factor as a fraction (MaxLoadNumerator / MaxLoadDenominator).
+		 */
+		static constexpr uint64_t MaxLoadNumerator = 4;
+		static constexpr uint64_t MaxLoadDenominator = 5;
+
+	public:
+		using key_type = Key;
+		using mapped_type = Value;
+		using value_type = std::pair<Key, Value>;
+		using size_type = typename std::vector<value_type>::size_type;
+		using difference_type = typename std::vector<value_type>::difference_type;
+		using hasher = Hash;
+		using key_equal = KeyEqual;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using iterator = typename std::vector<value_type>::iterator;
+		using const_iterator = typename std::vector<value_type>::const_iterator;
+
+	public:
+		/**
+		 * Default constructor.
+		 */
+		FlatHashMap() = default;
+
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param capacity The number of entries to reserve space for.
+		 */
+		explicit FlatHashMap(size_type capacity) { reserve(capacity); }
+
+		/**
+		 * Initializer list constructor.
+		 *
+		 * @param list The entries to insert.
+		 */
+		FlatHashMap(std::initializer_list<value_type> list)
+		{
+			reserve(list.size());
+			for (const auto& entry : list)
+				try_emplace(entry.first, entry.second);
+		}
+
+		/**
+		 * Find an entry using it's key.
+		 *
+		 * @param key The key to find.
+		 * @return The iterator to the entry. This will be end() if the key was not found.
+		 */
+		XENON_NODISCARD iterator find(const Key& key) { return m_Entries.begin() + findEntryIndex(key); }
+
+		/**
+		 * Find an entry using it's key.
+		 *
+		 * @param key The key to find.
+		 * @return The iterator to the entry. This will be end() if the key was not found.
+		 */
+		XENON_NODISCARD const_iterator find(const Key& key) const { return m_Entries.begin() + findEntryIndex(key); }
+
+		/**
+		 * Find an entry using a type which is comparable with the key.
+		 *
+		 * @tparam Other The other type.
+		 * @param key The key to find.
+		 * @return The iterator to the entry. This will be end() if the key was not found.
+		 */
+		template<class Other> requires Detail::IsTransparentLookup<Hash, KeyEqual>
+		XENON_NODISCARD iterator find(const Other& key) { return m_Entries.begin() + findEntryIndex(key); }
+
+		/**
+		 * Find an entry using a type which is comparable with the key.
+		 *
+		 * @tparam Other The other type.
+		 * @param key The key to find.
+		 * @return The iterator to the entry. This will be end() if the key was not found.
+		 */
+		template<class Other> requires Detail::IsTransparentLookup<Hash, KeyEqual>
+		XENON_NODISCARD const_iterator find(const Other& key) const { return m_Entries.begin() + findEntryIndex(key); }
+
+		/**
+		 * Check if the map contains a key.
+		 *
+		 * @param key The key to check.
+		 * @return True if the key is present.
+		 * @return False if the key is not present.
+		 */
+		XENON_NODISCARD bool contains(const Key& key) const { return findEntryIndex(key) != m_Entries.size(); }
+
+		/**
+		 * Check if the map contains a key using a type which is comparable with the key.
+		 *
+		 * @tparam Other The other type.
+		 * @param key The key to check.
+		 * @return True if the key is present.
+		 * @return False if the key is not present.
+		 */
+		template<class Other> requires Detail::IsTransparentLookup<Hash, KeyEqual>
+		XENON_NODISCARD bool contains(const Other& key) const { return findEntryIndex(key) != m_Entries.size(); }
+
+		/**
+		 * Get the value of a key.
+		 * This will throw std::out_of_range if the key is not present.
+		 *
+		 * @param key The key of the value.
+		 * @return The value reference.
+		 */
+		XENON_NODISCARD Value& at(const Key& key)
+		{
+			const auto index = findEntryIndex(key);
+			if (index == m_Entries.size())
+				throw std::out_of_range("The key is not present in the flat hash map!");
+
+			return m_Entries[index].second;
+		}
+
+		/**
+		 * Get the value of a key.
+		 * This will throw std::out_of_range if the key is not present.
+		 *
+		 * @param key The key of the value.
+		 * @return The value reference.
+		 */
+		XENON_NODISCARD const Value& at(const Key& key) const
+		{
+			const auto index = findEntryIndex(key);
+			if (index == m_Entries.size())
+				throw std::out_of_range("The key is not present in the flat hash map!");
+
+			return m_Entries[index].second;
+		}
+
+		/**
+		 * Insert a new entry using the key and the value arguments if the key is not already present.
+		 *
+		 * @tparam Arguments The value's argument types.
+		 * @param key The key to insert.
+		 * @param arguments The arguments used to construct the value.
+		 * @return The iterator to the entry and a boolean stating if the entry was inserted.
+		 */
+		template<class... Arguments>
+		std::pair<iterator, bool> try_emplace(const Key& key, Arguments&&... arguments)
+		{
+			return emplaceEntry(key, std::forward<Arguments>(arguments)...);
+		}
+
+		/**
+		 * Insert a new entry using the key and the value arguments if the key is not already present.
+		 *
+		 * @tparam Arguments The value's argument types.
+		 * @param key The key to insert.
+		 * @param arguments The arguments used to construct the value.
+		 * @return The iterator to the entry and a boolean stating if the entry was inserted.
+		 */
+		template<class... Arguments>
+		std::pair<iterator, bool> try_emplace(Key&& key, Arguments&&... arguments)
+		{
+			return emplaceEntry(std::move(key), std::forward<Arguments>(arguments)...);
+		}
+
+		/**
+		 * Insert a new entry if the key is not already present.
+		 *
+		 * @param entry The entry to insert.
+		 * @return The iterator to the entry and a boolean stating if the entry was inserted.
+		 */
+		std::pair<iterator, bool> insert(const value_type& entry) { return emplaceEntry(entry.first, entry.second); }
+
+		/**
+		 * Insert a new entry if the key is not already present.
+		 *
+		 * @param entry The entry to insert.
+		 * @return The iterator to the entry and a boolean stating if the entry was inserted.
+		 */
+		std::pair<iterator, bool> insert(value_type&& entry) { return emplaceEntry(std::move(entry.first), std::move(entry.second)); }
+
+		/**
+		 * Insert a new entry or assign the value to the existing entry.
+		 *
+		 * @tparam Type The value type.
+		 * @param key The key to insert.
+		 * @param value The value to set.
+		 * @return The iterator to the entry and a boolean stating if the entry was inserted.
+		 */
+		template<class Type>
+		std::pair<iterator, bool> insert_or_assign(const Key& key, Type&& value)
+		{
+			auto result = emplaceEntry(key, std::forward<Type>(value));
+			if (!result.second)
+				result.first->second = std::forward<Type>(value);
+
+			return result;
+		}
+
+		/**
+		 * Get the value of a key, and insert a default constructed one if the key is not present.
+		 *
+		 * @param key The key of the value.
+		 * @return The value reference.
+		 */
+		XENON_NODISCARD Value& operator[](const Key& key) { return emplaceEntry(key).first->second; }
+
+		/**
+		 * Get the value of a key, and insert a default constructed one if the key is not present.
+		 *
+		 * @param key The key of the value.
+		 * @return The value reference.
+		 */
+		XENON_NODISCARD Value& operator[](Key&& key) { return emplaceEntry(std::move(key)).first->second; }
+
+		/**
+		 * Erase an entry using it's key.
+		 *
+		 * @param key The key of the entry to erase.
+		 * @return The number of erased entries (0 or 1).
+		 */
+		size_type erase(const Key& key)
+		{
+			const auto bucketIndex = findBucketIndex(key);
+			if (bucketIndex == InvalidBucket)
+				return 0;
+
+			eraseBucket(bucketIndex);
+			return 1;
+		}
+
+		/**
+		 * Erase an entry using it's iterator.
+		 * Since the last entry is moved to the erased entry's position, the returned iterator points to the entry which replaced the erased one.
+		 *
+		 * @param position The position of the entry to erase.
+		 * @return The iterator to the next entry to visit.
+		 */
+		iterator erase(const_iterator position)
+		{
+			const auto entryIndex = static_cast<size_type>(position - m_Entries.cbegin());
+			eraseBucket(findBucketIndexOfEntry(entryIndex));
+
+			return m_Entries.begin() + entryIndex;
+		}
+
+		/**
+		 * Reserve space for a number of entries so that inserting them will not rehash the map.
+		 *
+		 * @param capacity The number of entries.
+		 */
+		void reserve(size_type capacity)
+		{
+			m_Entries.reserve(capacity);
+
+			auto bucketCount = std::max<uint64_t>(m_Buckets.size(), MinBucketCount);
+			while (capacity > GetMaxLoad(bucketCount))
+				bucketCount *= 2;
+
+			if (bucketCount != m_Buckets.size())
+				rehash(bucketCount);
+		}
+
+		/**
+		 * Clear all the entries.
+		 * This will keep the allocated memory.
+		 */
+		void clear()
+		{
+			m_Entries.clear();
+			std::fill(m_Buckets.begin(), m_Buckets.end(), Bucket());
+		}
+
+		/**
+		 * Get the number of entries in the map.
+		 *
+		 * @return The entry count.
+		 */
+		XENON_NODISCARD size_type size() const noexcept { return m_Entries.size(); }
+
+		/**
+		 * Check if the map is empty.
+		 *
+		 * @return True if there are no entries.
+		 * @return False if there are entries.
+		 */
+		XENON_NODISCARD bool empty() const noexcept { return m_Entries.empty(); }
+
+		/**
+		 * Get the number of buckets.
+		 *
+		 * @return The bucket count.
+		 */
+		XENON_NODISCARD size_type bucket_count() const noexcept { return m_Buckets.size(); }
+
+		/**
+		 * Get the begin iterator.
+		 *
+		 * @return The iterator.
+		 */
+		XENON_NODISCARD iterator begin() noexcept { return m_Entries.begin(); }
+
+		/**
+		 * Get the begin iterator.
+		 *
+		 * @return The iterator.
+		 */
+		XENON_NODISCARD const_iterator begin() const noexcept { return m_Entries.begin(); }
+
+		/**
+		 * Get the end iterator.
+		 *
+		 * @return The iterator.
+		 */
+		XENON_NODISCARD iterator end() noexcept { return m_Entries.end(); }
+
+		/**
+		 * Get the end iterator.
+		 *
+		 * @return The iterator.
+		 */
+		XENON_NODISCARD const_iterator end() const noexcept { return m_Entries.end(); }
+
+	private:
+		/**
+		 * The bucket index used to state that the key was not found.
+		 */
+		static constexpr uint64_t InvalidBucket = static_cast<uint64_t>(-1);
+
+		/**
+		 * Get the maximum number of entries which can be stored in a number of buckets.
+		 *
+		 * @param bucketCount The bucket count.
+		 * @return The maximum entry count.
+		 */
+		XENON_NODISCARD static constexpr uint64_t GetMaxLoad(uint64_t bucketCount) noexcept { return bucketCount * MaxLoadNumerator / MaxLoadDenominator; }
+
+		/**
+		 * Hash a key and mix the bits so that the lower and upper bits are well distributed.
+		 *
+		 * @tparam Type The key type.
+		 * @param key The key to hash.
+		 * @return The mixed hash.
+		 */
+		template<class Type>
+		XENON_NODISCARD uint64_t hashKey(const Type& key) const
+		{
+			auto hash = static_cast<uint64_t>(m_Hasher(key));
+			hash ^= hash >> 33;
+			hash *= 0xff51afd7ed558ccdull;
+			hash ^= hash >> 33;
+			hash *= 0xc4ceb9fe1a85ec53ull;
+			hash ^= hash >> 33;
+
+			return hash;
+		}
+
+		/**
+		 * Get the initial distance and fingerprint of a hash.
+		 *
+		 * @param hash The mixed hash.
+		 * @return The distance and fingerprint.
+		 */
+		XENON_NODISCARD static constexpr uint32_t GetDistanceAndFingerprint(uint64_t hash) noexcept { return DistanceIncrement | static_cast<uint32_t>(hash & FingerprintMask); }
+
+		/**
+		 * Get the home bucket index of a hash.
+		 *
+		 * @param hash The mixed hash.
+		 * @return The bucket index.
+		 */
+		XENON_NODISCARD uint64_t getHomeBucket(uint64_t hash) const noexcept { return (hash >> 8) & (m_Buckets.size() - 1); }
+
+		/**
+		 * Get the next bucket index in the probe sequence.
+		 *
+		 * @param index The current bucket index.
+		 * @return The next bucket index.
+		 */
+		XENON_NODISCARD uint64_t getNextBucket(uint64_t index) const noexcept { return (index + 1) & (m_Buckets.size() - 1); }
+
+		/**
+		 * Find the bucket index of a key.
+		 *
+		 * @tparam Type The key type.
+		 * @param key The key to find.
+		 * @return The bucket index. This will be InvalidBucket if the key was not found.
+		 */
+		template<class Type>
+		XENON_NODISCARD uint64_t findBucketIndex(const Type& key) const
+		{
+			if (m_Entries.empty())
+				return InvalidBucket;
+
+			const auto hash = hashKey(key);
+			auto distanceAndFingerprint = GetDistanceAndFingerprint(hash);
+			auto bucketIndex = getHomeBucket(hash);
+
+			// Robin Hood hashing guarantees that the key is not present once we find a bucket which is closer to it's home than us.
+			while (true)
+			{
+				const auto& bucket = m_Buckets[bucketIndex];
+				if (bucket.m_DistanceAndFingerprint == distanceAndFingerprint && m_KeyEqual(m_Entries[bucket.m_EntryIndex].first, key))
+					return bucketIndex;
+
+				if (bucket.m_DistanceAndFingerprint < distanceAndFingerprint)
+					return InvalidBucket;
+
+				distanceAndFingerprint += DistanceIncrement;
+				bucketIndex = getNextBucket(bucketIndex);
+			}
+		}
+
+		/**
+		 * Find the entry index of a key.
+		 *
+		 * @tparam Type The key type.
+		 * @param key The key to find.
+		 * @return The entry index. This will be the size of the map if the key was not found.
+		 */
+		template<class Type>
+		XENON_NODISCARD size_type findEntryIndex(const Type& key) const
+		{
+			const auto bucketIndex = findBucketIndex(key);
+			return bucketIndex == InvalidBucket ? m_Entries.size() : m_Buckets[bucketIndex].m_EntryIndex;
+		}
+
+		/**
+		 * Find the bucket which points to an entry.
+		 *
+		 * @param entryIndex The entry index.
+		 * @return The bucket index.
+		 */
+		XENON_NODISCARD uint64_t findBucketIndexOfEntry(size_type entryIndex) const
+		{
+			auto bucketIndex = getHomeBucket(hashKey(m_Entries[entryIndex].first));
+			while (m_Buckets[bucketIndex].m_EntryIndex != entryIndex)
+				bucketIndex = getNextBucket(bucketIndex);
+
+			return bucketIndex;
+		}
+
+		/**
+		 * Place a bucket in the bucket array, starting from a bucket index.
+		 * Buckets which are closer to their home are moved forward to make room (Robin Hood hashing).
+		 *
+		 * @param bucket The bucket to place.
+		 * @param bucketIndex The bucket index to start from.
+		 */
+		void placeBucket(Bucket bucket, uint64_t bucketIndex) noexcept
+		{
+			while (m_Buckets[bucketIndex].m_DistanceAndFingerprint != 0)
+			{
+				if (m_Buckets[bucketIndex].m_DistanceAndFingerprint < bucket.m_DistanceAndFingerprint)
+					std::swap(bucket, m_Buckets[bucketIndex]);
+
+				bucket.m_DistanceAndFingerprint += DistanceIncrement;
+				bucketIndex = getNextBucket(bucketIndex);
+			}
+
+			m_Buckets[bucketIndex] = bucket;
+		}
+
+		/**
+		 * Insert a new entry if the key is not already present.
+		 *
+		 * @tparam KeyType The key type.
+		 * @tparam Arguments The value's argument types.
+		 * @param key The key to insert.
+		 * @param arguments The arguments used to construct the value.
+		 * @return The iterator to the entry and a boolean stating if the entry was inserted.
+		 */
+		template<class KeyType, class... Arguments>
+		std::pair<iterator, bool> emplaceEntry(KeyType&& key, Arguments&&... arguments)
+		{
+			// Make sure that we have space for the new entry beforehand, so the probe position stays valid.
+			if (m_Entries.size() + 1 > GetMaxLoad(m_Buckets.size()))
+				rehash(std::max<uint64_t>(m_Buckets.size() * 2, MinBucketCount));
+
+			const auto hash = hashKey(key);
+			auto distanceAndFingerprint = GetDistanceAndFingerprint(hash);
+			auto bucketIndex = getHomeBucket(hash);
+
+			// Skip over the buckets which are further away from their home than us, checking if the key is already present.
+			while (distanceAndFingerprint <= m_Buckets[bucketIndex].m_DistanceAndFingerprint)
+			{
+				const auto& bucket = m_Buckets[bucketIndex];
+				if (bucket.m_DistanceAndFingerprint == distanceAndFingerprint && m_KeyEqual(m_Entries[bucket.m_EntryIndex].first, key))
+					return std::make_pair(m_Entries.begin() + bucket.m_EntryIndex, false);
+
+				distanceAndFingerprint += DistanceIncrement;
+				bucketIndex = getNextBucket(bucketIndex);
+			}
+
+			// Insert the entry and place it's bucket here.
+			const auto entryIndex = static_cast<uint32_t>(m_Entries.size());
+			m_Entries.emplace_back(std::piecewise_construct, std::forward_as_tuple(std::forward<KeyType>(key)), std::forward_as_tuple(std::forward<Arguments>(arguments)...));
+
+			Bucket bucket;
+			bucket.m_DistanceAndFingerprint = distanceAndFingerprint;
+			bucket.m_EntryIndex = entryIndex;
+			placeBucket(bucket, bucketIndex);
+
+			return std::make_pair(m_Entries.begin() + entryIndex, true);
+		}
+
+		/**
+		 * Erase the entry of a bucket.
+		 *
+		 * @param bucketIndex The bucket index.
+		 */
+		void eraseBucket(uint64_t bucketIndex)
+		{
+			const auto entryIndex = m_Buckets[bucketIndex].m_EntryIndex;
+
+			// Shift the following buckets back till we find one which is empty or is in it's home bucket.
+			auto nextIndex = getNextBucket(bucketIndex);
+			while (m_Buckets[nextIndex].m_DistanceAndFingerprint >= DistanceIncrement * 2)
+			{
+				m_Buckets[bucketIndex].m_DistanceAndFingerprint = m_Buckets[nextIndex].m_DistanceAndFingerprint - DistanceIncrement;
+				m_Buckets[bucketIndex].m_EntryIndex = m_Buckets[nextIndex].m_EntryIndex;
+
+				bucketIndex = nextIndex;
+				nextIndex = getNextBucket(nextIndex);
+			}
+
+			m_Buckets[bucketIndex] = Bucket();
+
+			// Move the last entry to the erased entry's position and update it's bucket.
+			const auto lastIndex = m_Entries.size() - 1;
+			if (entryIndex != lastIndex)
+			{
+				m_Buckets[findBucketIndexOfEntry(lastIndex)].m_EntryIndex = entryIndex;
+				m_Entries[entryIndex] = std::move(m_Entries[lastIndex]);
+			}
+
+			m_Entries.pop_back();
+		}
+
+		/**
+		 * Rebuild the bucket array with a new bucket count.
+		 *
+		 * @param bucketCount The new bucket count. This must be a power of two.
+		 */
+		void rehash(uint64_t bucketCount)
+		{
+			m_Buckets.assign(bucketCount, Bucket());
+
+			for (uint32_t i = 0; i < m_Entries.size(); i++)
+			{
+				const auto hash = hashKey(m_Entries[i].first);
+
+				Bucket bucket;
+				bucket.m_DistanceAndFingerprint = GetDistanceAndFingerprint(hash);
+				bucket.m_EntryIndex = i;
+				placeBucket(bucket, getHomeBucket(hash));
+			}
+		}
+
+	private:
+		std::vector<value_type> m_Entries;
+		std::vector<Bucket> m_Buckets;
+
+		XENON_NO_UNIQUE_ADDRESS Hash m_Hasher;
+		XENON_NO_UNIQUE_ADDRESS KeyEqual m_KeyEqual;
+	};
+}
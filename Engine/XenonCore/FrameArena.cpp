@@ -0,0 +1,147 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "FrameArena.hpp"
+#include "Tracer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace /* anonymous */
+{
+	/**
+	 * The identifier of the next arena.
+	 * This is used instead of the arena's address so that a new arena created at the address of a destroyed one is never mistaken for it.
+	 */
+	std::atomic_uint64_t g_NextArenaIdentifier = 1;
+
+	/**
+	 * The calling thread's most recently used sub-arena.
+	 */
+	thread_local uint64_t g_CachedArenaIdentifier = 0;
+	thread_local void* g_pCachedSubArena = nullptr;
+
+	/**
+	 * The size of the header in front of every allocation, which stores the region it was allocated from.
+	 */
+	constexpr uint64_t g_HeaderSize = sizeof(void*);
+
+	/**
+	 * Align an address up to a given alignment.
+	 *
+	 * @param address The address to align.
+	 * @param alignment The alignment. This must be a power of 2.
+	 * @return The aligned address.
+	 */
+	XENON_NODISCARD constexpr uintptr_t AlignUp(uintptr_t address, uint64_t alignment) noexcept
+	{
+		return (address + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+	}
+}
+
+namespace Xenon
+{
+	FrameArena::FrameArena(uint64_t blockSize /*= 256 * 1024*/)
+		: m_BlockSize(blockSize)
+		, m_Identifier(g_NextArenaIdentifier.fetch_add(1, std::memory_order_relaxed))
+	{
+	}
+
+	void* FrameArena::allocate(uint64_t size, uint64_t alignment /*= alignof(std::max_align_t)*/)
+	{
+		auto& subArena = getSubArena();
+
+		// Reclaim the frame's region if none of it's allocations are alive. Only this thread allocates from it, so the count can't go up
+		// from 0 while we're rewinding.
+		auto& region = subArena.m_Regions[getFrameIndex() % subArena.m_Regions.size()];
+		if (region.m_LiveAllocations.load(std::memory_order_acquire) == 0)
+		{
+			region.m_BlockIndex = 0;
+			region.m_Offset = 0;
+		}
+
+		// Try and allocate from the current block.
+		if (region.m_BlockIndex < region.m_Blocks.size())
+		{
+			const auto& block = region.m_Blocks[region.m_BlockIndex];
+			const auto begin = reinterpret_cast<uintptr_t>(block.m_pMemory.get());
+			const auto address = AlignUp(begin + region.m_Offset + g_HeaderSize, alignment);
+
+			if (address + size <= begin + block.m_Size)
+				return Commit(region, begin, address, size);
+		}
+
+		return allocateFromNextBlock(region, size, alignment);
+	}
+
+	void FrameArena::deallocate(void* pMemory) noexcept
+	{
+		if (pMemory == nullptr)
+			return;
+
+		Region* pRegion = nullptr;
+		std::memcpy(&pRegion, static_cast<std::byte*>(pMemory) - g_HeaderSize, sizeof(Region*));
+		pRegion->m_LiveAllocations.fetch_sub(1, std::memory_order_release);
+	}
+
+	FrameArena::SubArena& FrameArena::getSubArena()
+	{
+		if (g_CachedArenaIdentifier == m_Identifier)
+			return *static_cast<SubArena*>(g_pCachedSubArena);
+
+		const auto threadID = std::this_thread::get_id();
+		const auto lock = std::scoped_lock(m_Mutex);
+
+		// Find the sub-arena if the thread has allocated before, else create a new one.
+		auto itr = std::ranges::find_if(m_pSubArenas, [threadID](const auto& pSubArena) { return pSubArena->m_ThreadID == threadID; });
+		if (itr == m_pSubArenas.end())
+		{
+			auto& pSubArena = m_pSubArenas.emplace_back(std::make_unique<SubArena>());
+			pSubArena->m_ThreadID = threadID;
+
+			itr = std::prev(m_pSubArenas.end());
+		}
+
+		g_CachedArenaIdentifier = m_Identifier;
+		g_pCachedSubArena = itr->get();
+
+		return **itr;
+	}
+
+	void* FrameArena::allocateFromNextBlock(Region& region, uint64_t size, uint64_t alignment)
+	{
+		// Move through the existing blocks first, since they were allocated in an earlier frame.
+		for (region.m_BlockIndex = region.m_Blocks.empty() ? 0 : region.m_BlockIndex + 1; region.m_BlockIndex < region.m_Blocks.size(); region.m_BlockIndex++)
+		{
+			const auto& block = region.m_Blocks[region.m_BlockIndex];
+			const auto begin = reinterpret_cast<uintptr_t>(block.m_pMemory.get());
+			const auto address = AlignUp(begin + g_HeaderSize, alignment);
+
+			if (address + size <= begin + block.m_Size)
+				return Commit(region, begin, address, size);
+		}
+
+		// We need a new block. Oversized allocations get a block of their own.
+		XENON_TRACE_SCOPE();
+
+		const auto blockSize = std::max(m_BlockSize, size + alignment + g_HeaderSize);
+		auto& block = region.m_Blocks.emplace_back(std::make_unique<std::byte[]>(blockSize), blockSize);
+		m_ReservedSize.fetch_add(blockSize, std::memory_order_relaxed);
+
+		region.m_BlockIndex = region.m_Blocks.size() - 1;
+
+		const auto begin = reinterpret_cast<uintptr_t>(block.m_pMemory.get());
+		return Commit(region, begin, AlignUp(begin + g_HeaderSize, alignment), size);
+	}
+
+	void* FrameArena::Commit(Region& region, uintptr_t begin, uintptr_t address, uint64_t size) noexcept
+	{
+		const auto pRegion = &region;
+		std::memcpy(reinterpret_cast<std::byte*>(address - g_HeaderSize), &pRegion, sizeof(Region*));
+
+		region.m_Offset = address + size - begin;
+		region.m_LiveAllocations.fetch_add(1, std::memory_order_relaxed);
+
+		return reinterpret_cast<void*>(address);
+	}
+}
@@ -0,0 +1,185 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Xenon
+{
+	/**
+	 * Frame arena class.
+	 * This is a linear (bump) allocator for short lived, per-frame allocations. Every thread allocates from it's own sub-arena so that
+	 * allocations never need to be synchronized, and a deallocation only decrements a counter. The blocks are reused so that the steady
+	 * state does not touch the global heap.
+	 *
+	 * Each sub-arena has two regions which are used in alternate frames. A region is only rewound once every allocation made from it has
+	 * been deallocated, so an allocation which is held across frames is never handed out again, and tools which never reset the arena
+	 * don't grow it without bound as long as they deallocate. Every allocation must be deallocated (from any thread).
+	 *
+	 * The arena is a std::pmr::memory_resource, so it can be used by the polymorphic containers (ie: std::pmr::vector).
+	 */
+	class FrameArena final : public std::pmr::memory_resource
+	{
+		/**
+		 * Block structure.
+		 * This is a single contiguous chunk of memory owned by a region.
+		 */
+		struct Block final
+		{
+			std::unique_ptr<std::byte[]> m_pMemory;
+			uint64_t m_Size = 0;
+		};
+
+		/**
+		 * Region structure.
+		 * This contains the blocks of a sub-arena which are used in a single frame.
+		 */
+		struct Region final
+		{
+			std::vector<Block> m_Blocks;
+			uint64_t m_BlockIndex = 0;
+			uint64_t m_Offset = 0;
+
+			std::atomic_uint64_t m_LiveAllocations = 0;
+		};
+
+		/**
+		 * Sub-arena structure.
+		 * Each thread which allocates from the arena gets it's own sub-arena.
+		 */
+		struct SubArena final
+		{
+			std::array<Region, 2> m_Regions;
+			std::thread::id m_ThreadID;
+		};
+
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param blockSize The size of a single memory block in bytes. Default is 256 KiB.
+		 */
+		explicit FrameArena(uint64_t blockSize = 256 * 1024);
+
+		/**
+		 * Destructor.
+		 */
+		~FrameArena() override = default;
+
+		XENON_DISABLE_COPY(FrameArena);
+		XENON_DISABLE_MOVE(FrameArena);
+
+		/**
+		 * Allocate memory from the calling thread's sub-arena.
+		 *
+		 * @param size The size of the allocation in bytes.
+		 * @param alignment The alignment of the allocation. Default is the maximum fundamental alignment.
+		 * @return The allocated memory pointer.
+		 */
+		XENON_NODISCARD void* allocate(uint64_t size, uint64_t alignment = alignof(std::max_align_t));
+
+		/**
+		 * Deallocate memory which was allocated from the arena.
+		 * This can be called from any thread.
+		 *
+		 * @param pMemory The memory pointer returned by allocate().
+		 */
+		void deallocate(void* pMemory) noexcept;
+
+		/**
+		 * Reset the arena at a frame boundary.
+		 * Every sub-arena switches to the other region the next time it's thread allocates from it, so this does not need to synchronize
+		 * with the other threads.
+		 */
+		void reset() noexcept { m_FrameIndex.fetch_add(1, std::memory_order_release); }
+
+		/**
+		 * Get the current frame index.
+		 *
+		 * @return The frame index.
+		 */
+		XENON_NODISCARD uint64_t getFrameIndex() const noexcept { return m_FrameIndex.load(std::memory_order_acquire); }
+
+		/**
+		 * Get the total number of bytes reserved by all the sub-arenas.
+		 *
+		 * @return The reserved byte count.
+		 */
+		XENON_NODISCARD uint64_t getReservedSize() const noexcept { return m_ReservedSize.load(std::memory_order_relaxed); }
+
+	private:
+		/**
+		 * Allocate memory.
+		 *
+		 * @param bytes The number of bytes to allocate.
+		 * @param alignment The alignment of the allocation.
+		 * @return The allocated memory pointer.
+		 */
+		XENON_NODISCARD void* do_allocate(std::size_t bytes, std::size_t alignment) override { return allocate(bytes, alignment); }
+
+		/**
+		 * Deallocate memory.
+		 *
+		 * @param pMemory The memory pointer.
+		 */
+		void do_deallocate(void* pMemory, std::size_t, std::size_t) override { deallocate(pMemory); }
+
+		/**
+		 * Check if another memory resource is equal to this.
+		 *
+		 * @param other The other memory resource.
+		 * @return True if the other resource is this arena.
+		 * @return False if the other resource is not this arena.
+		 */
+		XENON_NODISCARD bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+		/**
+		 * Get the calling thread's sub-arena.
+		 * The sub-arena is created if this is the first time the thread is allocating from this arena.
+		 *
+		 * @return The sub-arena reference.
+		 */
+		XENON_NODISCARD SubArena& getSubArena();
+
+		/**
+		 * Allocate memory from a region by moving to the next block (or creating a new one).
+		 *
+		 * @param region The region to allocate from.
+		 * @param size The size of the allocation.
+		 * @param alignment The alignment of the allocation.
+		 * @return The allocated memory pointer.
+		 */
+		XENON_NODISCARD void* allocateFromNextBlock(Region& region, uint64_t size, uint64_t alignment);
+
+		/**
+		 * Hand out memory from a region's current block.
+		 * This stores the region in front of the allocation so that it can be found when deallocating.
+		 *
+		 * @param region The region to allocate from.
+		 * @param begin The beginning address of the region's current block.
+		 * @param address The allocation address.
+		 * @param size The size of the allocation.
+		 * @return The allocated memory pointer.
+		 */
+		XENON_NODISCARD static void* Commit(Region& region, uintptr_t begin, uintptr_t address, uint64_t size) noexcept;
+
+	private:
+		std::mutex m_Mutex;
+		std::vector<std::unique_ptr<SubArena>> m_pSubArenas;
+
+		std::atomic_uint64_t m_FrameIndex = 0;
+		std::atomic_uint64_t m_ReservedSize = 0;
+
+		const uint64_t m_BlockSize = 0;
+		const uint64_t m_Identifier = 0;
+	};
+}
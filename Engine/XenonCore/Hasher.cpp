@@ -0,0 +1,63 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Hasher.hpp"
+
+#define XXH_INLINE_ALL
+#include <xxhash.h>
+
+#include <cstring>
+
+namespace Xenon
+{
+	static_assert(sizeof(XXH3_state_t) <= 576, "The hasher's state storage is too small for the XXH3 state!");
+	static_assert(alignof(XXH3_state_t) <= 64, "The hasher's state storage is not aligned enough for the XXH3 state!");
+
+	Xenon::Hasher& Hasher::combineBytes(const std::byte* pBytes, uint64_t size) noexcept
+	{
+		if (!m_IsStreaming && m_BufferedSize + size > BufferSize)
+			beginStreaming();
+
+		if (m_IsStreaming)
+		{
+			XXH3_64bits_update(reinterpret_cast<XXH3_state_t*>(m_State), pBytes, size);
+		}
+		else if (size > 0)
+		{
+			std::memcpy(m_Buffer + m_BufferedSize, pBytes, size);
+			m_BufferedSize += size;
+		}
+
+		return *this;
+	}
+
+	uint64_t Hasher::getHash() const noexcept
+	{
+		if (m_IsStreaming)
+			return XXH3_64bits_digest(reinterpret_cast<const XXH3_state_t*>(m_State));
+
+		return XXH3_64bits_withSeed(m_Buffer, m_BufferedSize, m_Seed);
+	}
+
+	Xenon::Hash128 Hasher::getHash128() const noexcept
+	{
+		// The 64-bit and 128-bit variants share the same streaming state.
+		const auto hash = m_IsStreaming ? XXH3_128bits_digest(reinterpret_cast<const XXH3_state_t*>(m_State)) : XXH3_128bits_withSeed(m_Buffer, m_BufferedSize, m_Seed);
+
+		Hash128 result;
+		result.m_Low = hash.low64;
+		result.m_High = hash.high64;
+
+		return result;
+	}
+
+	void Hasher::beginStreaming() noexcept
+	{
+		auto pState = reinterpret_cast<XXH3_state_t*>(m_State);
+		XXH3_INITSTATE(pState);
+		XXH3_64bits_reset_withSeed(pState, m_Seed);
+		XXH3_64bits_update(pState, m_Buffer, m_BufferedSize);
+
+		m_IsStreaming = true;
+	}
+}
@@ -0,0 +1,226 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <array>
+#include <span>
+
+namespace Xenon
+{
+	class Hasher;
+
+	/**
+	 * Has hash value concept.
+	 * Types can opt into canonical hashing by providing a hashValue(Hasher&) const member function which combines each of it's fields
+	 * into the hasher. Unlike hashing the object's bytes, this skips padding and pointers to owned data, so the hash is stable across
+	 * runs and processes.
+	 */
+	template<class Type>
+	concept HasHashValue = requires(const Type & value, Hasher & hasher) { value.hashValue(hasher); };
+
+	/**
+	 * Is byte hashable concept.
+	 * These types can be hashed using their object representation since they do not contain any padding. Pointers are excluded since
+	 * an address changes from run to run, so a type which really wants to hash an address has to write it out in it's hashValue().
+	 * Note that pointers inside a class can't be detected, so classes with pointer members should provide hashValue() as well.
+	 */
+	template<class Type>
+	concept IsByteHashable = !std::is_pointer_v<Type> && !std::is_member_pointer_v<Type> &&
+		(std::is_arithmetic_v<Type> || std::is_enum_v<Type> || std::has_unique_object_representations_v<Type>);
+
+	/**
+	 * 128-bit hash structure.
+	 */
+	struct Hash128 final
+	{
+		XENON_NODISCARD bool operator==(const Hash128&) const = default;
+
+		uint64_t m_Low = 0;
+		uint64_t m_High = 0;
+	};
+
+	/**
+	 * Hasher class.
+	 * This is an incremental hasher which uses XXH3, and can produce both 64-bit and 128-bit hashes. Small inputs (which is what most
+	 * specifications are) are gathered in an internal buffer and hashed at once, and the streaming state is only used if the input grows
+	 * beyond that. Either way the result is the same as hashing all the combined bytes in one go.
+	 *
+	 * Note that floating point values are hashed using their bits, so 0.0f and -0.0f produce different hashes.
+	 */
+	class Hasher final
+	{
+		/**
+		 * The number of bytes which are buffered before switching to the streaming state.
+		 */
+		static constexpr uint64_t BufferSize = 256;
+
+		/**
+		 * The size of the XXH3 state in bytes. This is checked in the source file.
+		 */
+		static constexpr uint64_t StateSize = 576;
+
+		/**
+		 * The alignment of the XXH3 state.
+		 */
+		static constexpr uint64_t StateAlignment = 64;
+
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param seed The hash seed. Default is 0.
+		 */
+		explicit Hasher(uint64_t seed = 0) noexcept : m_Seed(seed) {}
+
+		/**
+		 * Combine a set of bytes to the hash.
+		 *
+		 * @param pBytes The bytes to combine.
+		 * @param size The number of bytes.
+		 * @return The hasher reference used to chain.
+		 */
+		Hasher& combineBytes(const std::byte* pBytes, uint64_t size) noexcept;
+
+		/**
+		 * Combine a value to the hash.
+		 * If the type provides hashValue(), that will be used. Else the value is hashed using it's bytes, which is only allowed if the
+		 * type does not contain any padding.
+		 *
+		 * @tparam Type The value type.
+		 * @param value The value to combine.
+		 * @return The hasher reference used to chain.
+		 */
+		template<class Type> requires (!std::is_convertible_v<const Type&, std::string_view>)
+		Hasher& combine(const Type& value) noexcept
+		{
+			if constexpr (HasHashValue<Type>)
+			{
+				value.hashValue(*this);
+				return *this;
+			}
+			else
+			{
+				static_assert(IsByteHashable<Type>, "The type is a pointer or contains padding! Provide a hashValue(Hasher&) const member function for it.");
+				return combineBytes(ToBytes(&value), sizeof(Type));
+			}
+		}
+
+		/**
+		 * Combine multiple values to the hash.
+		 *
+		 * @tparam First The first value type.
+		 * @tparam Second The second value type.
+		 * @tparam Rest The rest of the value types.
+		 * @param first The first value.
+		 * @param second The second value.
+		 * @param rest The rest of the values.
+		 * @return The hasher reference used to chain.
+		 */
+		template<class First, class Second, class... Rest>
+		Hasher& combine(const First& first, const Second& second, const Rest&... rest) noexcept
+		{
+			combine(first);
+			combine(second);
+			(combine(rest), ...);
+			return *this;
+		}
+
+		/**
+		 * Combine a string to the hash.
+		 * The size is combined as well so that different splits of the same characters produce different hashes.
+		 *
+		 * @param string The string to combine.
+		 * @return The hasher reference used to chain.
+		 */
+		Hasher& combine(std::string_view string) noexcept
+		{
+			combine(static_cast<uint64_t>(string.size()));
+			return combineBytes(ToBytes(string.data()), string.size());
+		}
+
+		/**
+		 * Combine a range of values to the hash.
+		 * The size is combined as well so that different splits of the same values produce different hashes.
+		 *
+		 * @tparam Type The value type.
+		 * @param values The values to combine.
+		 * @return The hasher reference used to chain.
+		 */
+		template<class Type>
+		Hasher& combine(std::span<const Type> values) noexcept
+		{
+			combine(static_cast<uint64_t>(values.size()));
+
+			if constexpr (!HasHashValue<Type> && IsByteHashable<Type>)
+			{
+				return combineBytes(ToBytes(values.data()), values.size_bytes());
+			}
+			else
+			{
+				for (const auto& value : values)
+					combine(value);
+
+				return *this;
+			}
+		}
+
+		/**
+		 * Combine a vector of values to the hash.
+		 *
+		 * @tparam Type The value type.
+		 * @param values The values to combine.
+		 * @return The hasher reference used to chain.
+		 */
+		template<class Type>
+		Hasher& combine(const std::vector<Type>& values) noexcept { return combine(std::span<const Type>(values)); }
+
+		/**
+		 * Combine an array of values to the hash.
+		 *
+		 * @tparam Type The value type.
+		 * @tparam Size The array size.
+		 * @param values The values to combine.
+		 * @return The hasher reference used to chain.
+		 */
+		template<class Type, std::size_t Size>
+		Hasher& combine(const std::array<Type, Size>& values) noexcept { return combine(std::span<const Type>(values)); }
+
+		/**
+		 * Get the 64-bit hash of all the combined data.
+		 * More data can be combined after this.
+		 *
+		 * @return The hash value.
+		 */
+		XENON_NODISCARD uint64_t getHash() const noexcept;
+
+		/**
+		 * Get the 128-bit hash of all the combined data.
+		 * More data can be combined after this.
+		 *
+		 * @return The hash value.
+		 */
+		XENON_NODISCARD Hash128 getHash128() const noexcept;
+
+	private:
+		/**
+		 * Initialize the streaming state and move the buffered bytes to it.
+		 * After this, all the combined bytes go directly to the streaming state.
+		 */
+		void beginStreaming() noexcept;
+
+	private:
+		alignas(StateAlignment) std::byte m_State[StateSize];
+		std::byte m_Buffer[BufferSize];
+
+		uint64_t m_Seed = 0;
+		uint64_t m_BufferedSize = 0;
+
+		bool m_IsStreaming = false;
+	};
+}
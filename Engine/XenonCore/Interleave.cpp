@@ -0,0 +1,121 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Interleave.hpp"
+
+#include <cstring>
+
+namespace /* anonymous */
+{
+	/**
+	 * Copy strided elements of a fixed size.
+	 * The size is a compile time constant, so each copy becomes one or two plain (SSE for 16 bytes) loads and stores instead of a
+	 * memcpy call.
+	 *
+	 * @tparam Size The element size in bytes.
+	 * @param pSource The first source element.
+	 * @param sourceStride The source stride.
+	 * @param pDestination The first destination element.
+	 * @param destinationStride The destination stride.
+	 * @param count The number of elements to copy.
+	 */
+	template<uint64_t Size>
+	void CopyStrided(const std::byte* pSource, uint64_t sourceStride, std::byte* pDestination, uint64_t destinationStride, uint64_t count) noexcept
+	{
+		uint64_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			std::memcpy(pDestination, pSource, Size);
+			std::memcpy(pDestination + destinationStride, pSource + sourceStride, Size);
+			std::memcpy(pDestination + destinationStride * 2, pSource + sourceStride * 2, Size);
+			std::memcpy(pDestination + destinationStride * 3, pSource + sourceStride * 3, Size);
+
+			pSource += sourceStride * 4;
+			pDestination += destinationStride * 4;
+		}
+
+		for (; i < count; i++)
+		{
+			std::memcpy(pDestination, pSource, Size);
+
+			pSource += sourceStride;
+			pDestination += destinationStride;
+		}
+	}
+
+	/**
+	 * Copy strided elements of any size.
+	 *
+	 * @param pSource The first source element.
+	 * @param sourceStride The source stride.
+	 * @param pDestination The first destination element.
+	 * @param destinationStride The destination stride.
+	 * @param size The element size in bytes.
+	 * @param count The number of elements to copy.
+	 */
+	void CopyStrided(const std::byte* pSource, uint64_t sourceStride, std::byte* pDestination, uint64_t destinationStride, uint64_t size, uint64_t count) noexcept
+	{
+		// If both sides are tightly packed, it's a single copy.
+		if (sourceStride == size && destinationStride == size)
+		{
+			std::memcpy(pDestination, pSource, size * count);
+			return;
+		}
+
+		switch (size)
+		{
+		case 1:
+			CopyStrided<1>(pSource, sourceStride, pDestination, destinationStride, count);
+			break;
+
+		case 2:
+			CopyStrided<2>(pSource, sourceStride, pDestination, destinationStride, count);
+			break;
+
+		case 4:
+			CopyStrided<4>(pSource, sourceStride, pDestination, destinationStride, count);
+			break;
+
+		case 8:
+			CopyStrided<8>(pSource, sourceStride, pDestination, destinationStride, count);
+			break;
+
+		case 12:
+			CopyStrided<12>(pSource, sourceStride, pDestination, destinationStride, count);
+			break;
+
+		case 16:
+			CopyStrided<16>(pSource, sourceStride, pDestination, destinationStride, count);
+			break;
+
+		default:
+			for (uint64_t i = 0; i < count; i++)
+				std::memcpy(pDestination + i * destinationStride, pSource + i * sourceStride, size);
+
+			break;
+		}
+	}
+}
+
+namespace Xenon
+{
+	void InterleaveStreams(std::span<const InterleaveStream> streams, std::byte* pDestination, uint64_t destinationStride, uint64_t first, uint64_t count) noexcept
+	{
+		const auto elementsPerBlock = std::max<uint64_t>(InterleaveBlockSize / destinationStride, 1);
+		const auto end = first + count;
+
+		for (auto blockBegin = first; blockBegin < end; blockBegin += elementsPerBlock)
+		{
+			const auto blockCount = std::min(elementsPerBlock, end - blockBegin);
+			const auto pBlock = pDestination + blockBegin * destinationStride;
+
+			for (const auto& stream : streams)
+			{
+				if (stream.m_pSource == nullptr || stream.m_ElementSize == 0)
+					continue;
+
+				CopyStrided(stream.m_pSource + blockBegin * stream.m_SourceStride, stream.m_SourceStride, pBlock + stream.m_DestinationOffset, destinationStride, stream.m_ElementSize, blockCount);
+			}
+		}
+	}
+}
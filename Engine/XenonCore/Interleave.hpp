@@ -0,0 +1,78 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Parallel.hpp"
+
+#include <span>
+
+namespace Xenon
+{
+	/**
+	 * Interleave stream structure.
+	 * This describes a single strided source stream (like a vertex attribute) and where it's elements go in the interleaved output.
+	 */
+	struct InterleaveStream final
+	{
+		// The first source element. If this is nullptr, the stream is skipped.
+		const std::byte* m_pSource = nullptr;
+
+		// The distance between two source elements in bytes.
+		uint64_t m_SourceStride = 0;
+
+		// The number of bytes to copy from each element.
+		uint32_t m_ElementSize = 0;
+
+		// The offset of the element in the output entry.
+		uint32_t m_DestinationOffset = 0;
+	};
+
+	/**
+	 * The number of output bytes an interleave block targets.
+	 * The output of a block stays in the cache while each stream is copied to it.
+	 */
+	constexpr uint64_t InterleaveBlockSize = 16 * 1024;
+
+	/**
+	 * Interleave a range of elements from multiple streams.
+	 * The output is processed in cache sized blocks, and each stream is copied to a block using a loop specialized for it's element size.
+	 * Output bytes which are not covered by any stream are left untouched.
+	 *
+	 * @param streams The source streams.
+	 * @param pDestination The first output entry (the entry of index 0).
+	 * @param destinationStride The size of a single output entry in bytes.
+	 * @param first The index of the first element to interleave.
+	 * @param count The number of elements to interleave.
+	 */
+	void InterleaveStreams(std::span<const InterleaveStream> streams, std::byte* pDestination, uint64_t destinationStride, uint64_t first, uint64_t count) noexcept;
+
+	/**
+	 * Interleave elements from multiple streams using the job system.
+	 * The elements are split into ranges of whole blocks, and each range is interleaved by a single job.
+	 *
+	 * @param jobSystem The job system to use.
+	 * @param streams The source streams.
+	 * @param pDestination The first output entry.
+	 * @param destinationStride The size of a single output entry in bytes.
+	 * @param count The number of elements to interleave.
+	 * @param priority The priority of the jobs. Default is normal.
+	 */
+	inline void ParallelInterleaveStreams(JobSystem& jobSystem, std::span<const InterleaveStream> streams, std::byte* pDestination, uint64_t destinationStride, uint64_t count, JobPriority priority = JobPriority::Normal)
+	{
+		if (destinationStride == 0)
+			return;
+
+		// A job handles at least a few blocks so that the job overhead does not show up.
+		const auto elementsPerBlock = std::max<uint64_t>(InterleaveBlockSize / destinationStride, 1);
+		const auto elementsPerJob = elementsPerBlock * 4;
+		const auto jobCount = (count + elementsPerJob - 1) / elementsPerJob;
+
+		ParallelFor(jobSystem, 0, jobCount, [streams, pDestination, destinationStride, count, elementsPerJob](uint64_t job)
+			{
+				const auto first = job * elementsPerJob;
+				InterleaveStreams(streams, pDestination, destinationStride, first, std::min(elementsPerJob, count - first));
+			}
+		, 1, priority);
+	}
+}
@@ -0,0 +1,172 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+#include "JobSystemStatistics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Xenon
+{
+	class JobGroup;
+
+	/**
+	 * Job priority enum.
+	 * Workers always drain the higher priority lanes before looking at the lower priority ones.
+	 */
+	enum class JobPriority : uint8_t
+	{
+		// Jobs which the current frame waits on (ie: layer updates).
+		Critical,
+
+		// General purpose jobs.
+		Normal,
+
+		// Long running jobs like asset loading and streaming. The number of workers that can run these at once is limited.
+		Background,
+
+		Count
+	};
+
+	/**
+	 * Job class.
+	 * This is a fixed-size, type-erased callable which stores the callable object inside it's own inline storage. Unlike std::function,
+	 * the callable only needs to be move constructible, which means that move-only objects (like std::promise) can be captured.
+	 * Callables which are too large to fit in the inline storage are stored on the heap as a fallback.
+	 *
+	 * Job objects are owned and recycled by the job system, so they are neither copyable nor movable.
+	 */
+	class Job final
+	{
+		friend class JobSystem;
+
+		/**
+		 * Operations structure.
+		 * This contains the type-erased functions to invoke and destroy the stored callable.
+		 */
+		struct Operations final
+		{
+			void(*m_Invoke)(std::byte*);
+			void(*m_Destroy)(std::byte*);
+		};
+
+	public:
+		/**
+		 * The inline storage size in bytes.
+		 * This is chosen so that the whole job object fits in two cache lines (unless the job statistics are enabled).
+		 */
+		static constexpr uint64_t StorageSize = 96;
+
+		/**
+		 * Check if a callable type can be stored inline.
+		 *
+		 * @tparam Type The callable type.
+		 */
+		template<class Type>
+		static constexpr bool IsInline = sizeof(Type) <= StorageSize && alignof(Type) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<Type>;
+
+	public:
+		/**
+		 * Default constructor.
+		 */
+		Job() = default;
+
+		/**
+		 * Destructor.
+		 */
+		~Job() { reset(); }
+
+		XENON_DISABLE_COPY(Job);
+		XENON_DISABLE_MOVE(Job);
+
+		/**
+		 * Set the callable to the job.
+		 * This will destroy the previously stored callable if there was one.
+		 *
+		 * @tparam Function The callable type.
+		 * @param function The callable to store.
+		 */
+		template<class Function>
+		void set(Function&& function)
+		{
+			using Type = std::decay_t<Function>;
+
+			reset();
+			if constexpr (IsInline<Type>)
+			{
+				new (m_Storage) Type(std::forward<Function>(function));
+				m_pOperations = &InlineOperations<Type>;
+			}
+			else
+			{
+				new (m_Storage) Type*(new Type(std::forward<Function>(function)));
+				m_pOperations = &HeapOperations<Type>;
+			}
+		}
+
+		/**
+		 * Destroy the stored callable.
+		 */
+		void reset()
+		{
+			if (m_pOperations)
+			{
+				m_pOperations->m_Destroy(m_Storage);
+				m_pOperations = nullptr;
+			}
+		}
+
+		/**
+		 * Check if the job contains a callable.
+		 *
+		 * @return True if the job has a callable.
+		 * @return False if the job is empty.
+		 */
+		XENON_NODISCARD bool isValid() const noexcept { return m_pOperations != nullptr; }
+
+		/**
+		 * Invoke the stored callable.
+		 */
+		void operator()() { m_pOperations->m_Invoke(m_Storage); }
+
+	private:
+		/**
+		 * Operations for a callable that's stored inline.
+		 *
+		 * @tparam Type The callable type.
+		 */
+		template<class Type>
+		static constexpr Operations InlineOperations = {
+			[](std::byte* pStorage) { (*std::launder(reinterpret_cast<Type*>(pStorage)))(); },
+			[](std::byte* pStorage) { std::launder(reinterpret_cast<Type*>(pStorage))->~Type(); }
+		};
+
+		/**
+		 * Operations for a callable that's stored on the heap.
+		 *
+		 * @tparam Type The callable type.
+		 */
+		template<class Type>
+		static constexpr Operations HeapOperations = {
+			[](std::byte* pStorage) { (**std::launder(reinterpret_cast<Type**>(pStorage)))(); },
+			[](std::byte* pStorage) { delete *std::launder(reinterpret_cast<Type**>(pStorage)); }
+		};
+
+	private:
+		alignas(std::max_align_t) std::byte m_Storage[StorageSize];
+
+		const Operations* m_pOperations = nullptr;
+		JobGroup* m_pGroup = nullptr;
+		Job* m_pNext = nullptr;
+
+		JobPriority m_Priority = JobPriority::Normal;
+
+		XENON_JOB_STATISTICS(std::chrono::steady_clock::time_point m_SubmitTime;)
+	};
+}
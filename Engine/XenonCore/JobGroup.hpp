@@ -0,0 +1,87 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace Xenon
+{
+	/**
+	 * Job group class.
+	 * A job group counts the number of jobs which were inserted with it and have not completed yet. This way a set of related
+	 * jobs (ie: the jobs of a single frame) can be waited on without waiting for every other job in the job system.
+	 *
+	 * A group can be reused as soon as it's complete.
+	 */
+	class JobGroup final
+	{
+		friend class JobSystem;
+
+	public:
+		/**
+		 * Default constructor.
+		 */
+		JobGroup() = default;
+
+		/**
+		 * Destructor.
+		 * This waits till the threads which completed the last jobs are done notifying the group.
+		 */
+		~JobGroup()
+		{
+			while (m_ActiveArrivals.load(std::memory_order_acquire) > 0)
+				std::this_thread::yield();
+		}
+
+		XENON_DISABLE_COPY(JobGroup);
+		XENON_DISABLE_MOVE(JobGroup);
+
+		/**
+		 * Check if all the jobs in the group have completed.
+		 *
+		 * @return True if the group is complete.
+		 * @return False if the group is not complete.
+		 */
+		XENON_NODISCARD bool isComplete() const noexcept { return m_PendingJobs.load(std::memory_order_acquire) == 0 && m_ActiveArrivals.load(std::memory_order_acquire) == 0; }
+
+		/**
+		 * Get the number of jobs which are yet to complete.
+		 *
+		 * @return The pending job count.
+		 */
+		XENON_NODISCARD uint64_t getPendingCount() const noexcept { return m_PendingJobs.load(std::memory_order_relaxed); }
+
+	private:
+		/**
+		 * Notify the group that a new job was inserted.
+		 */
+		void enter() noexcept { m_PendingJobs.fetch_add(1, std::memory_order_relaxed); }
+
+		/**
+		 * Notify the group that a job has completed.
+		 * This will wake up the threads waiting on the group if it's the last job.
+		 *
+		 * A waiter can see the pending count reach 0 and destroy the group while the last job's thread is still notifying it, so
+		 * the arrival is counted separately and the group is not destroyed till every arrival has left.
+		 */
+		void arrive() noexcept
+		{
+			m_ActiveArrivals.fetch_add(1, std::memory_order_relaxed);
+
+			if (m_PendingJobs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				m_PendingJobs.notify_all();
+
+			// This must be the last access to the group.
+			m_ActiveArrivals.fetch_sub(1, std::memory_order_release);
+		}
+
+	private:
+		std::atomic_uint64_t m_PendingJobs = 0;
+		std::atomic_uint32_t m_ActiveArrivals = 0;
+	};
+}
@@ -3,28 +3,195 @@
 
 #include "JobSystem.hpp"
 #include "Logging.hpp"
+#include "Tracer.hpp"
 
-#include <optick.h>
+#include <algorithm>
+#include <limits>
 
-#include <latch>
+#ifdef XENON_PLATFORM_LINUX
+#	include <filesystem>
+#	include <fstream>
+#	include <map>
+#	include <sstream>
+
+#	include <pthread.h>
+#	include <sched.h>
+
+#endif
+
+namespace /* anonymous */
+{
+	thread_local const Xenon::JobSystem* g_pCurrentJobSystem = nullptr;
+	thread_local const Xenon::JobSystem* g_pCurrentIOJobSystem = nullptr;
+	thread_local uint32_t g_CurrentWorkerIndex = 0;
+	thread_local uint64_t g_HelperRandomState = 0x9E3779B97F4A7C15;
+	thread_local uint32_t g_BackgroundDepth = 0;
+
+	/**
+	 * Generate the next pseudo random number using xorshift.
+	 *
+	 * @param state The random state.
+	 * @return The random number.
+	 */
+	XENON_NODISCARD constexpr uint64_t NextRandom(uint64_t& state) noexcept
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+
+	/**
+	 * Resolve the number of compute workers to create.
+	 *
+	 * @param workerCount The requested worker count. If this is 0, the count is resolved using the hardware concurrency.
+	 * @return The worker count. This is at least 1.
+	 */
+	XENON_NODISCARD uint32_t ResolveWorkerCount(uint32_t workerCount) noexcept
+	{
+		// We leave one here for the parent thread. Note that the hardware concurrency could be 0 if it's not computable.
+		if (workerCount == 0)
+			workerCount = std::thread::hardware_concurrency() - 1;
+
+		// Without a worker, nothing runs unless someone waits, so we need at least one.
+		return workerCount == 0 || workerCount == std::numeric_limits<uint32_t>::max() ? 1 : workerCount;
+	}
+
+#ifdef XENON_PLATFORM_LINUX
+	/**
+	 * Logical processor structure.
+	 */
+	struct LogicalProcessor final
+	{
+		uint32_t m_Index = 0;
+		uint32_t m_NumaNode = 0;
+		uint32_t m_Capacity = 0;
+	};
+
+	/**
+	 * Parse a Linux processor list (ie: "0-3,8-11").
+	 *
+	 * @param list The processor list string.
+	 * @return The processor indexes.
+	 */
+	XENON_NODISCARD std::vector<uint32_t> ParseProcessorList(const std::string& list)
+	{
+		std::vector<uint32_t> processors;
+
+		auto stream = std::istringstream(list);
+		for (std::string range; std::getline(stream, range, ',');)
+		{
+			uint32_t first = 0;
+			uint32_t last = 0;
+
+			const auto separator = range.find('-');
+			if (std::sscanf(range.c_str(), "%u", &first) != 1)
+				continue;
+
+			if (separator == std::string::npos || std::sscanf(range.c_str() + separator + 1, "%u", &last) != 1)
+				last = first;
+
+			for (auto i = first; i <= last; i++)
+				processors.emplace_back(i);
+		}
+
+		return processors;
+	}
+
+	/**
+	 * Get the logical processors the process is allowed to run on, along with their NUMA nodes and capacities.
+	 * The capacity is only available on systems with asymmetric cores (ie: big.LITTLE), and is 0 otherwise.
+	 *
+	 * @return The logical processors.
+	 */
+	XENON_NODISCARD std::vector<LogicalProcessor> GetLogicalProcessors()
+	{
+		std::vector<LogicalProcessor> processors;
+
+		// Get the processors we're allowed to run on. Containers usually restrict this.
+		cpu_set_t processorSet;
+		CPU_ZERO(&processorSet);
+		if (sched_getaffinity(0, sizeof(processorSet), &processorSet) != 0)
+			return processors;
+
+		for (uint32_t i = 0; i < CPU_SETSIZE; i++)
+		{
+			if (CPU_ISSET(i, &processorSet))
+				processors.emplace_back(i);
+		}
+
+		// Resolve the NUMA node of each processor.
+		std::error_code errorCode;
+		for (const auto& entry : std::filesystem::directory_iterator("/sys/devices/system/node", errorCode))
+		{
+			const auto name = entry.path().filename().string();
+
+			uint32_t node = 0;
+			if (!name.starts_with("node") || std::sscanf(name.c_str() + 4, "%u", &node) != 1)
+				continue;
+
+			std::string list;
+			std::getline(std::ifstream(entry.path() / "cpulist"), list);
+
+			for (const auto index : ParseProcessorList(list))
+			{
+				const auto itr = std::ranges::find(processors, index, &LogicalProcessor::m_Index);
+				if (itr != processors.end())
+					itr->m_NumaNode = node;
+			}
+		}
+
+		// Get the processor capacities.
+		for (auto& processor : processors)
+			std::ifstream(fmt::format("/sys/devices/system/cpu/cpu{}/cpu_capacity", processor.m_Index)) >> processor.m_Capacity;
+
+		return processors;
+	}
+
+	/**
+	 * Restrict the calling thread to a set of logical processors.
+	 *
+	 * @param processors The processor indexes.
+	 */
+	void SetThreadAffinity(const std::vector<uint32_t>& processors)
+	{
+		cpu_set_t processorSet;
+		CPU_ZERO(&processorSet);
+		for (const auto index : processors)
+			CPU_SET(index, &processorSet);
+
+		if (pthread_setaffinity_np(pthread_self(), sizeof(processorSet), &processorSet) != 0)
+			XENON_LOG_WARNING("Failed to set the affinity of a job system worker!");
+	}
+
+#endif
+}
 
 namespace Xenon
 {
 	JobSystem::JobSystem(uint32_t threadCount)
-		: m_WorkerState(threadCount, false)
 	{
-		auto latch = std::latch(threadCount);
+		m_Configuration.m_WorkerCount = threadCount;
+		m_Configuration.m_IOWorkerCount = 0;
 
-		m_Workers.reserve(threadCount);
-		for (uint32_t i = 0; i < threadCount; i++)
-			m_Workers.emplace_back([this, &latch, i] { latch.count_down(); worker(i); });
+		start(threadCount);
+	}
 
-		// Wait till all the workers have started.
-		latch.wait();
+	JobSystem::JobSystem(const JobSystemConfiguration& configuration)
+		: m_Configuration(configuration)
+	{
+		m_Configuration.m_WorkerCount = ResolveWorkerCount(configuration.m_WorkerCount);
+
+		start(m_Configuration.m_WorkerCount);
+		startIO(m_Configuration.m_IOWorkerCount);
 	}
 
 	JobSystem::~JobSystem()
 	{
+		// The I/O jobs might insert more jobs, so they are finished while the workers are still alive.
+		stopIO();
+
+		// Whatever that was inserted after the workers were closed gets destroyed along with the job blocks.
 		clear();
 	}
 
@@ -38,106 +205,686 @@ namespace Xenon
 		m_ShouldRun = true;
 		m_ShouldFinishJobs = true;
 
-		m_WorkerState.resize(threadCount, false);
-		m_Workers.reserve(threadCount);
+		m_Configuration.m_WorkerCount = threadCount;
+		start(threadCount);
+	}
 
-		for (uint32_t i = 0; i < threadCount; i++)
-			m_Workers.emplace_back([this, i] { worker(i); });
+	uint32_t JobSystem::getBackgroundWorkerLimit() const noexcept
+	{
+		if (const auto limit = m_BackgroundWorkerLimit.load(std::memory_order_relaxed); limit > 0)
+			return limit;
+
+		return std::max<uint32_t>(static_cast<uint32_t>(m_pWorkers.size() / 2), 1);
+	}
+
+	JobSystemStatistics JobSystem::getStatistics() const
+	{
+		JobSystemStatistics statistics;
+		statistics.m_Workers.reserve(m_pWorkers.size());
+
+		for (const auto& pWorker : m_pWorkers)
+			statistics.m_Workers.emplace_back(pWorker->m_Counters.getStatistics());
+
+		statistics.m_Helpers = m_HelperCounters.getStatistics();
+		statistics.m_IOWorkers = m_IOCounters.getStatistics();
+		statistics.m_InjectionQueueHighWaterMark = m_InjectionQueueHighWaterMark.load(std::memory_order_relaxed);
+
+		return statistics;
+	}
+
+	void JobSystem::resetStatistics()
+	{
+		for (const auto& pWorker : m_pWorkers)
+			pWorker->m_Counters.reset();
+
+		m_HelperCounters.reset();
+		m_IOCounters.reset();
+		m_InjectionQueueHighWaterMark.store(0, std::memory_order_relaxed);
 	}
 
 	void JobSystem::wait()
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
+
+		while (true)
+		{
+			const auto pendingJobs = m_PendingJobs.load();
+			if (pendingJobs == 0)
+				break;
 
-		while (!isComplete());
+			// Help the workers, and if there's nothing to help with, sleep till something completes.
+			if (!executeOne())
+				m_PendingJobs.wait(pendingJobs);
+		}
+	}
+
+	void JobSystem::wait(const JobGroup& group)
+	{
+		XENON_TRACE_SCOPE();
+
+		while (true)
+		{
+			const auto pendingJobs = group.m_PendingJobs.load(std::memory_order_acquire);
+			if (pendingJobs == 0)
+				break;
+
+			// Help the workers, and if there's nothing to help with, sleep till the group completes.
+			if (!executeOne())
+				group.m_PendingJobs.wait(pendingJobs, std::memory_order_acquire);
+		}
 	}
 
 	void JobSystem::waitFor(std::chrono::nanoseconds timeout)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		const auto targetTimeStamp = std::chrono::high_resolution_clock::now() + timeout;
-		while (!isComplete() && targetTimeStamp > std::chrono::high_resolution_clock::now());
+		while (!isComplete() && targetTimeStamp > std::chrono::high_resolution_clock::now())
+		{
+			if (!executeOne())
+				std::this_thread::yield();
+		}
+	}
+
+	bool JobSystem::executeOne()
+	{
+		if (const auto pJob = acquire(true))
+		{
+			execute(pJob);
+			return true;
+		}
+
+		return false;
 	}
 
 	void JobSystem::clear()
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		m_ShouldRun = false;
-		m_ConditionVariable.notify_all();
-		m_Workers.clear();
-		m_WorkerState.clear();
+
+		{
+			const auto lock = std::scoped_lock(m_SleepMutex);
+			m_ConditionVariable.notify_all();
+		}
+
+		// Join all the workers before touching their queues.
+		for (const auto& pWorker : m_pWorkers)
+		{
+			if (pWorker->m_Thread.joinable())
+				pWorker->m_Thread.join();
+		}
+
+		// Move the jobs that were not executed to the injection queue so the next set of workers can pick them up.
+		{
+			const auto lock = std::scoped_lock(m_InjectionMutex);
+			for (const auto& pWorker : m_pWorkers)
+			{
+				for (auto& queue : pWorker->m_Queues)
+				{
+					while (const auto pJob = queue.pop())
+						pushInjected(pJob.value());
+				}
+			}
+		}
+
+		// Return the cached free jobs to the shared pool.
+		{
+			const auto lock = std::scoped_lock(m_JobPoolMutex);
+			for (const auto& pWorker : m_pWorkers)
+			{
+				while (const auto pJob = pWorker->m_pFreeJobs)
+				{
+					pWorker->m_pFreeJobs = pJob->m_pNext;
+					pJob->m_pNext = m_pFreeJobs;
+					m_pFreeJobs = pJob;
+				}
+			}
+		}
+
+		m_pWorkers.clear();
 	}
 
-	bool JobSystem::isComplete()
+	void JobSystem::start(uint32_t threadCount)
 	{
-		const auto lock = std::scoped_lock(m_JobMutex);
+		// Create all the workers first, since the threads will access each other's queues.
+		m_pWorkers.reserve(threadCount);
+		for (uint32_t i = 0; i < threadCount; i++)
+			m_pWorkers.emplace_back(std::make_unique<Worker>())->m_RandomState = (i + 1) * 0x9E3779B97F4A7C15;
 
-		// If the entries are not empty, return false.
-		if (!m_JobEntries.empty())
-			return false;
+		assignProcessors();
 
-		// Else if at least one state is running, return false.
-		for (const auto state : m_WorkerState)
+		auto latch = std::latch(threadCount);
+		for (uint32_t i = 0; i < threadCount; i++)
+			m_pWorkers[i]->m_Thread = std::jthread([this, &latch, i] { worker(i, latch); });
+
+		// Wait till all the workers have started, so that their setup does not happen while the first jobs are executed.
+		latch.wait();
+	}
+
+	void JobSystem::startIO(uint32_t threadCount)
+	{
+		m_ShouldRunIO = true;
+
+		m_IOWorkers.reserve(threadCount);
+		for (uint32_t i = 0; i < threadCount; i++)
+			m_IOWorkers.emplace_back([this, i] { ioWorker(i); });
+	}
+
+	void JobSystem::stopIO()
+	{
+		XENON_TRACE_SCOPE();
+
+		{
+			const auto lock = std::scoped_lock(m_IOMutex);
+			m_ShouldRunIO = false;
+		}
+
+		m_IOConditionVariable.notify_all();
+
+		for (auto& thread : m_IOWorkers)
 		{
-			if (state)
-				return false;
+			if (thread.joinable())
+				thread.join();
 		}
 
-		// Else we're truly complete.
-		return true;
+		m_IOWorkers.clear();
 	}
 
-	void JobSystem::worker(uint32_t index)
+	void JobSystem::assignProcessors()
 	{
-		const auto threadTitle = fmt::format("Worker thread ({}) number ({})", fmt::ptr(this), index);
-		OPTICK_THREAD(threadTitle.c_str());
+		if (!m_Configuration.m_PinWorkers && !m_Configuration.m_GroupByNumaNode)
+			return;
+
+#ifdef XENON_PLATFORM_LINUX
+		auto processors = GetLogicalProcessors();
+		if (processors.empty())
+			return;
+
+		// Prefer the high capacity (performance) processors.
+		std::ranges::stable_sort(processors, std::ranges::greater(), &LogicalProcessor::m_Capacity);
+
+		// If we don't need to group, just pin the workers to the processors one after the other.
+		if (!m_Configuration.m_GroupByNumaNode)
+		{
+			for (uint64_t i = 0; i < m_pWorkers.size(); i++)
+			{
+				const auto& processor = processors[i % processors.size()];
+				m_pWorkers[i]->m_Processors = { processor.m_Index };
+				m_pWorkers[i]->m_NumaNode = processor.m_NumaNode;
+			}
+
+			return;
+		}
+
+		// Else distribute the workers over the nodes. The workers are either pinned to a single processor in the node, or to the whole node.
+		std::map<uint32_t, std::vector<uint32_t>> nodeProcessors;
+		for (const auto& processor : processors)
+			nodeProcessors[processor.m_NumaNode].emplace_back(processor.m_Index);
+
+		const auto nodeCount = nodeProcessors.size();
+		for (uint64_t i = 0; i < m_pWorkers.size(); i++)
+		{
+			const auto& [node, indexes] = *std::next(nodeProcessors.begin(), i % nodeCount);
+			m_pWorkers[i]->m_NumaNode = node;
+
+			if (m_Configuration.m_PinWorkers)
+				m_pWorkers[i]->m_Processors = { indexes[(i / nodeCount) % indexes.size()] };
+
+			else
+				m_pWorkers[i]->m_Processors = indexes;
+		}
+
+#else
+		XENON_LOG_WARNING("Job system worker pinning and NUMA grouping are only supported on Linux!");
+
+#endif
+	}
+
+	void JobSystem::submit(Job* pJob)
+	{
+		m_PendingJobs++;
+		m_QueuedJobs[EnumToInt(pJob->m_Priority)]++;
+		XENON_JOB_STATISTICS(pJob->m_SubmitTime = std::chrono::steady_clock::now());
+
+		// If we're on a worker thread, push it to the worker's local queue.
+		if (g_pCurrentJobSystem == this)
+		{
+			auto& worker = *m_pWorkers[g_CurrentWorkerIndex];
+			auto& queue = worker.m_Queues[EnumToInt(pJob->m_Priority)];
+
+			queue.push(pJob);
+			XENON_JOB_STATISTICS(worker.m_Counters.recordQueueDepth(queue.size()));
+		}
+
+		// Else push it to the injection queue.
+		else
+		{
+			const auto lock = std::scoped_lock(m_InjectionMutex);
+			pushInjected(pJob);
+		}
+
+		// Wake up a worker if someone's sleeping.
+		wakeWorker();
+	}
+
+	void JobSystem::submitIO(Job* pJob)
+	{
+		m_PendingJobs++;
+		XENON_JOB_STATISTICS(pJob->m_SubmitTime = std::chrono::steady_clock::now());
+
+		{
+			const auto lock = std::scoped_lock(m_IOMutex);
+
+			pJob->m_pNext = nullptr;
+			if (m_pIOTail)
+				m_pIOTail->m_pNext = pJob;
+
+			else
+				m_pIOHead = pJob;
+
+			m_pIOTail = pJob;
+		}
+
+		m_IOConditionVariable.notify_one();
+	}
+
+	Job* JobSystem::allocateJob()
+	{
+		// If we're on a worker thread, try and get one from the worker's cache.
+		if (g_pCurrentJobSystem == this)
+		{
+			auto& worker = *m_pWorkers[g_CurrentWorkerIndex];
+
+			// Refill the cache from the shared pool if it's empty.
+			if (worker.m_pFreeJobs == nullptr)
+			{
+				const auto lock = std::scoped_lock(m_JobPoolMutex);
+				if (m_pFreeJobs == nullptr)
+					allocateJobBlock();
+
+				for (uint32_t i = 0; i < JobBlockSize && m_pFreeJobs; i++)
+				{
+					const auto pJob = m_pFreeJobs;
+					m_pFreeJobs = pJob->m_pNext;
+
+					pJob->m_pNext = worker.m_pFreeJobs;
+					worker.m_pFreeJobs = pJob;
+					worker.m_FreeJobCount++;
+				}
+			}
+
+			const auto pJob = worker.m_pFreeJobs;
+			worker.m_pFreeJobs = pJob->m_pNext;
+			worker.m_FreeJobCount--;
+
+			return pJob;
+		}
+
+		// Else get one from the shared pool.
+		const auto lock = std::scoped_lock(m_JobPoolMutex);
+		if (m_pFreeJobs == nullptr)
+			allocateJobBlock();
+
+		const auto pJob = m_pFreeJobs;
+		m_pFreeJobs = pJob->m_pNext;
+
+		return pJob;
+	}
+
+	void JobSystem::releaseJob(Job* pJob)
+	{
+		pJob->reset();
+		pJob->m_pGroup = nullptr;
+
+		// If we're on a worker thread, cache it in the worker.
+		if (g_pCurrentJobSystem == this)
+		{
+			auto& worker = *m_pWorkers[g_CurrentWorkerIndex];
+			pJob->m_pNext = worker.m_pFreeJobs;
+			worker.m_pFreeJobs = pJob;
+
+			// Return half of the cache to the shared pool if it's getting too large.
+			if (++worker.m_FreeJobCount > MaxCachedJobs)
+			{
+				const auto lock = std::scoped_lock(m_JobPoolMutex);
+				while (worker.m_FreeJobCount > MaxCachedJobs / 2)
+				{
+					const auto pFreeJob = worker.m_pFreeJobs;
+					worker.m_pFreeJobs = pFreeJob->m_pNext;
+					worker.m_FreeJobCount--;
+
+					pFreeJob->m_pNext = m_pFreeJobs;
+					m_pFreeJobs = pFreeJob;
+				}
+			}
+		}
+
+		// Else return it to the shared pool.
+		else
+		{
+			const auto lock = std::scoped_lock(m_JobPoolMutex);
+			pJob->m_pNext = m_pFreeJobs;
+			m_pFreeJobs = pJob;
+		}
+	}
+
+	void JobSystem::allocateJobBlock()
+	{
+		XENON_TRACE_SCOPE();
+
+		const auto& pBlock = m_pJobBlocks.emplace_back(std::make_unique<Job[]>(JobBlockSize));
+		for (uint32_t i = 0; i < JobBlockSize; i++)
+		{
+			pBlock[i].m_pNext = m_pFreeJobs;
+			m_pFreeJobs = &pBlock[i];
+		}
+	}
 
-		auto locker = std::unique_lock(m_JobMutex);
+	Job* JobSystem::acquire(bool isWaiting)
+	{
+		const auto isWorker = g_pCurrentJobSystem == this;
 
-		do
+		// Go through the lanes from the highest priority to the lowest.
+		for (uint8_t lane = 0; lane < LaneCount; lane++)
 		{
-			// Wait till we get notified, or if the job entries have jobs to execute, or if we can end the thread.
-			m_ConditionVariable.wait(locker, [this] { return !m_JobEntries.empty() || m_ShouldRun == false; });
+			const auto isBackgroundLane = lane == EnumToInt(JobPriority::Background);
+
+			// Waiting threads should not get stuck with a long running background job, unless they're already running one or there's no
+			// one else to run them.
+			if (isBackgroundLane && isWaiting && g_BackgroundDepth == 0 && !m_pWorkers.empty())
+				continue;
+
+			// Background jobs need a free slot, unless we're already running one on this thread.
+			const auto needsSlot = isBackgroundLane && g_BackgroundDepth == 0;
+			if (needsSlot && !reserveBackgroundSlot())
+				continue;
+
+			if (const auto pJob = acquireFrom(lane, isWorker))
+				return pJob;
+
+			if (needsSlot)
+				releaseBackgroundSlot();
+		}
+
+		return nullptr;
+	}
 
-			// If we have jobs, execute one.
-			if (!m_JobEntries.empty())
-				execute(locker, index);
-		} while (m_ShouldRun);
+	Job* JobSystem::acquireFrom(uint8_t lane, bool isWorker)
+	{
+		// Skip the lane if there's nothing in it.
+		if (m_QueuedJobs[lane] <= 0)
+			return nullptr;
 
+		// Try and get one from the local queue if we're a worker.
+		if (isWorker)
+		{
+			if (const auto pJob = m_pWorkers[g_CurrentWorkerIndex]->m_Queues[lane].pop())
+			{
+				m_QueuedJobs[lane]--;
+				return pJob.value();
+			}
+		}
 
-		// Finish up the remaining jobs if needed and there are some left.
-		if (m_ShouldFinishJobs)
+		// Else try the injection queue.
+		if (const auto pJob = popInjected(lane))
 		{
-			while (!m_JobEntries.empty())
-				execute(locker, index);
+			m_QueuedJobs[lane]--;
+			return pJob;
 		}
+
+		// Finally try and steal one.
+		const auto pJob = isWorker ?
+			steal(lane, m_pWorkers[g_CurrentWorkerIndex]->m_RandomState, g_CurrentWorkerIndex) :
+			steal(lane, g_HelperRandomState, std::numeric_limits<uint32_t>::max());
+
+		if (pJob)
+			m_QueuedJobs[lane]--;
+
+		return pJob;
+	}
+
+	Job* JobSystem::popInjected(uint8_t lane)
+	{
+		// Skip the lock if there's nothing to take.
+		if (m_InjectedJobs[lane] == 0)
+			return nullptr;
+
+		const auto lock = std::scoped_lock(m_InjectionMutex);
+		const auto pJob = m_pInjectionHeads[lane];
+		if (pJob == nullptr)
+			return nullptr;
+
+		m_pInjectionHeads[lane] = pJob->m_pNext;
+		if (m_pInjectionHeads[lane] == nullptr)
+			m_pInjectionTails[lane] = nullptr;
+
+		pJob->m_pNext = nullptr;
+		m_InjectedJobs[lane]--;
+
+		return pJob;
 	}
 
-	void JobSystem::execute(std::unique_lock<std::mutex>& lock, uint32_t index)
+	void JobSystem::pushInjected(Job* pJob)
 	{
-		OPTICK_EVENT();
+		const auto lane = EnumToInt(pJob->m_Priority);
 
-		m_WorkerState[index] = true;
+		pJob->m_pNext = nullptr;
+		if (m_pInjectionTails[lane])
+			m_pInjectionTails[lane]->m_pNext = pJob;
 
-		// Get the next job entry and pop it from the list.
-		const auto jobEntry = m_JobEntries.front();
-		m_JobEntries.pop_front();
+		else
+			m_pInjectionHeads[lane] = pJob;
 
-		// Unlock the locker.
-		if (lock) lock.unlock();
+		m_pInjectionTails[lane] = pJob;
+		m_InjectedJobs[lane]++;
+
+		// The injection mutex is locked, so no one else can update the high water mark.
+		XENON_JOB_STATISTICS(if (m_InjectedJobs[lane] > m_InjectionQueueHighWaterMark.load(std::memory_order_relaxed)) m_InjectionQueueHighWaterMark.store(m_InjectedJobs[lane], std::memory_order_relaxed));
+	}
+
+	Job* JobSystem::steal(uint8_t lane, uint64_t& randomState, uint32_t index)
+	{
+		const auto workerCount = static_cast<uint32_t>(m_pWorkers.size());
+		if (workerCount == 0)
+			return nullptr;
+
+		const auto start = static_cast<uint32_t>(NextRandom(randomState) % workerCount);
+
+		// When the workers are grouped, the first pass only looks at the workers in the thief's node, and the second pass looks at the rest.
+		const auto isGrouped = m_Configuration.m_GroupByNumaNode && index < workerCount;
+		const auto node = isGrouped ? m_pWorkers[index]->m_NumaNode : 0;
+
+		for (uint32_t pass = isGrouped ? 0 : 1; pass < 2; pass++)
+		{
+			for (uint32_t i = 0; i < workerCount; i++)
+			{
+				const auto victim = (start + i) % workerCount;
+				if (victim == index || (isGrouped && (m_pWorkers[victim]->m_NumaNode == node) != (pass == 0)))
+					continue;
+
+				if (const auto pJob = m_pWorkers[victim]->m_Queues[lane].steal())
+				{
+					XENON_JOB_STATISTICS(getCounters().recordSteal(true));
+					return pJob.value();
+				}
+			}
+		}
+
+		XENON_JOB_STATISTICS(getCounters().recordSteal(false));
+		return nullptr;
+	}
+
+	bool JobSystem::hasExecutableJobs() const noexcept
+	{
+		if (m_QueuedJobs[EnumToInt(JobPriority::Critical)] > 0 || m_QueuedJobs[EnumToInt(JobPriority::Normal)] > 0)
+			return true;
+
+		return m_QueuedJobs[EnumToInt(JobPriority::Background)] > 0 && m_RunningBackgroundJobs < getBackgroundWorkerLimit();
+	}
+
+	bool JobSystem::reserveBackgroundSlot() noexcept
+	{
+		// Don't hold anything back if we're closing down.
+		if (m_RunningBackgroundJobs++ < getBackgroundWorkerLimit() || !m_ShouldRun)
+			return true;
+
+		m_RunningBackgroundJobs--;
+		return false;
+	}
+
+	void JobSystem::releaseBackgroundSlot()
+	{
+		m_RunningBackgroundJobs--;
+
+		// Let someone else pick up the waiting background jobs.
+		if (m_QueuedJobs[EnumToInt(JobPriority::Background)] > 0)
+			wakeWorker();
+	}
+
+	JobWorkerCounters& JobSystem::getCounters() noexcept
+	{
+		if (g_pCurrentJobSystem == this)
+			return m_pWorkers[g_CurrentWorkerIndex]->m_Counters;
+
+		if (g_pCurrentIOJobSystem == this)
+			return m_IOCounters;
+
+		return m_HelperCounters;
+	}
+
+	void JobSystem::wakeWorker()
+	{
+		if (m_SleepingWorkers > 0)
+		{
+			const auto lock = std::scoped_lock(m_SleepMutex);
+			m_ConditionVariable.notify_one();
+		}
+	}
+
+	void JobSystem::worker(uint32_t index, std::latch& latch)
+	{
+		const auto threadTitle = fmt::format("Worker thread ({}) number ({})", fmt::ptr(this), index);
+		XENON_TRACE_THREAD(threadTitle.c_str());
+
+		g_pCurrentJobSystem = this;
+		g_CurrentWorkerIndex = index;
+
+#ifdef XENON_PLATFORM_LINUX
+		if (!m_pWorkers[index]->m_Processors.empty())
+			SetThreadAffinity(m_pWorkers[index]->m_Processors);
+
+#endif
+
+		latch.count_down();
+
+		while (m_ShouldRun || m_ShouldFinishJobs)
+		{
+			// Execute a job if we have one.
+			if (const auto pJob = acquire(false))
+			{
+				execute(pJob);
+				continue;
+			}
+
+			// If we're closing down and there's nothing else to do, we can end the thread.
+			if (!m_ShouldRun)
+				break;
+
+			// Wait till we get notified that there are jobs to execute, or if we can end the thread.
+			auto lock = std::unique_lock(m_SleepMutex);
+			m_SleepingWorkers++;
+			XENON_JOB_STATISTICS(const auto sleepStart = std::chrono::steady_clock::now());
+			m_ConditionVariable.wait(lock, [this] { return hasExecutableJobs() || m_ShouldRun == false; });
+			XENON_JOB_STATISTICS(m_pWorkers[index]->m_Counters.recordIdle(std::chrono::steady_clock::now() - sleepStart));
+			m_SleepingWorkers--;
+		}
+
+		g_pCurrentJobSystem = nullptr;
+	}
+
+	void JobSystem::ioWorker(uint32_t index)
+	{
+		const auto threadTitle = fmt::format("I/O worker thread ({}) number ({})", fmt::ptr(this), index);
+		XENON_TRACE_THREAD(threadTitle.c_str());
+
+		g_pCurrentIOJobSystem = this;
+
+		while (true)
+		{
+			Job* pJob = nullptr;
+
+			// Wait till we get a job, or till we're asked to close down.
+			{
+				auto lock = std::unique_lock(m_IOMutex);
+				XENON_JOB_STATISTICS(const auto sleepStart = std::chrono::steady_clock::now());
+				m_IOConditionVariable.wait(lock, [this] { return m_pIOHead != nullptr || !m_ShouldRunIO; });
+				XENON_JOB_STATISTICS(m_IOCounters.recordIdle(std::chrono::steady_clock::now() - sleepStart));
+
+				// The pending jobs are finished before closing down.
+				if (m_pIOHead == nullptr)
+					break;
+
+				pJob = m_pIOHead;
+				m_pIOHead = pJob->m_pNext;
+				if (m_pIOHead == nullptr)
+					m_pIOTail = nullptr;
+			}
+
+			pJob->m_pNext = nullptr;
+			execute(pJob);
+		}
+
+		g_pCurrentIOJobSystem = nullptr;
+	}
+
+	void JobSystem::execute(Job* pJob)
+	{
+		XENON_TRACE_SCOPE();
+
+		// Background jobs which were not started from another background job own a background slot.
+		const auto isBackground = pJob->m_Priority == JobPriority::Background;
+		const auto ownsSlot = isBackground && g_BackgroundDepth == 0;
 
 		// Execute the job.
 		{
-			OPTICK_EVENT_DYNAMIC("Executing Job");
+			XENON_TRACE_SCOPE_DYNAMIC("Executing Job");
 
-			jobEntry();
-			m_WorkerState[index] = false;
+			XENON_JOB_STATISTICS(const auto startTime = std::chrono::steady_clock::now());
+
+			if (isBackground) g_BackgroundDepth++;
+
+			// Jobs also run inside helping waits, so an exception must not unwind into an unrelated waiter or skip the bookkeeping below.
+			try
+			{
+				(*pJob)();
+			}
+			catch (const std::exception& e)
+			{
+				XENON_LOG_ERROR("A job threw an exception: {}", e.what());
+			}
+			catch (...)
+			{
+				XENON_LOG_ERROR("A job threw an unknown exception!");
+			}
+
+			if (isBackground) g_BackgroundDepth--;
+
+			XENON_JOB_STATISTICS(getCounters().recordExecution(std::chrono::steady_clock::now() - startTime, startTime - pJob->m_SubmitTime));
 		}
 
-		// Lock it back again.
-		OPTICK_EVENT_DYNAMIC("Locking Mutex");
-		lock.lock();
+		// Release the job before notifying the group, so that everything captured by the job is destroyed by the time the waiters wake up.
+		const auto pGroup = pJob->m_pGroup;
+		releaseJob(pJob);
+
+		if (ownsSlot)
+			releaseBackgroundSlot();
+
+		if (pGroup)
+			pGroup->arrive();
+
+		// Wake up the threads waiting on the whole system if this was the last job.
+		if (--m_PendingJobs == 0)
+			m_PendingJobs.notify_all();
 	}
-}
\ No newline at end of file
+}
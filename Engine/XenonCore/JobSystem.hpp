@@ -3,32 +3,124 @@
 
 #pragma once
 
-#include "Common.hpp"
+#include "Job.hpp"
+#include "JobGroup.hpp"
+#include "JobSystemStatistics.hpp"
+#include "ObjectPool.hpp"
+#include "WorkStealingQueue.hpp"
 
+#include <array>
+#include <coroutine>
 #include <thread>
-#include <functional>
 #include <condition_variable>
-#include <list>
 #include <mutex>
 #include <future>
+#include <latch>
 #include <cstdint>
 
 namespace Xenon
 {
+	/**
+	 * Job system configuration structure.
+	 */
+	struct JobSystemConfiguration final
+	{
+		// The number of compute workers. If this is 0, one worker per logical processor (minus one for the main thread) is created.
+		// There will always be at least one compute worker.
+		uint32_t m_WorkerCount = 0;
+
+		// The number of workers which execute blocking I/O jobs. If this is 0, I/O jobs are executed as background jobs.
+		uint32_t m_IOWorkerCount = 2;
+
+		// Pin each compute worker to a single logical processor. Currently only supported on Linux.
+		bool m_PinWorkers = false;
+
+		// Distribute the compute workers over the NUMA nodes, keep each worker on it's node and prefer stealing from the workers
+		// in the same node. Currently only supported on Linux.
+		bool m_GroupByNumaNode = false;
+	};
+
 	/**
 	 * Job system class.
 	 * This contains multiple threads, which simultaneously executes a job which is been given to the system.
+	 *
+	 * Each worker owns a lock-free work stealing queue. Jobs inserted from a worker thread are pushed to that worker's queue,
+	 * and jobs inserted from any other thread are pushed to a global injection queue. When a worker runs out of local work it
+	 * checks the injection queue, and then tries to steal from the other workers starting from a random victim.
+	 *
+	 * Jobs are stored in pooled job objects which are recycled after execution, so that inserting a job does not touch the heap
+	 * once the pool has warmed up (as long as the callable fits in the job's inline storage).
+	 *
+	 * Every queue is split into priority lanes, and the higher priority lanes are always drained first. The number of workers
+	 * which can run background jobs at once is limited, so that long running jobs can't starve the frame critical ones.
+	 *
+	 * Blocking I/O (like reading files) should be inserted as I/O jobs, which are executed by a small, separate pool of threads so
+	 * that the compute workers never sit idle waiting on the disk.
 	 */
 	class JobSystem final
 	{
+		static constexpr uint8_t LaneCount = EnumToInt(JobPriority::Count);
+
+		/**
+		 * The number of jobs allocated at once when the job pool runs dry.
+		 */
+		static constexpr uint32_t JobBlockSize = 64;
+
+		/**
+		 * The maximum number of free jobs a worker can cache before returning some to the shared pool.
+		 */
+		static constexpr uint64_t MaxCachedJobs = JobBlockSize * 4;
+
+		/**
+		 * Worker structure.
+		 * This contains all the information owned by a single worker thread.
+		 */
+		struct alignas(64) Worker final
+		{
+			std::array<WorkStealingQueue<Job*>, LaneCount> m_Queues;
+			std::jthread m_Thread;
+
+			std::vector<uint32_t> m_Processors;
+
+			Job* m_pFreeJobs = nullptr;
+			uint64_t m_FreeJobCount = 0;
+
+			JobWorkerCounters m_Counters;
+
+			uint64_t m_RandomState = 0;
+			uint32_t m_NumaNode = 0;
+		};
+
 	public:
+		/**
+		 * Schedule awaitable structure.
+		 * Awaiting this suspends the awaiting coroutine and resumes it on a job system worker.
+		 */
+		struct ScheduleAwaitable final
+		{
+			XENON_NODISCARD bool await_ready() const noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> handle) { m_JobSystem.insertDetached([handle] { handle.resume(); }, m_Priority); }
+			void await_resume() const noexcept {}
+
+			JobSystem& m_JobSystem;
+			JobPriority m_Priority = JobPriority::Normal;
+		};
+
 		/**
 		 * Explicit constructor.
+		 * This does not create any I/O workers or pin the workers.
 		 *
-		 * @param theradCount The number of worker threads needed.
+		 * @param theradCount The number of worker threads needed. If this is 0, the jobs are executed by the threads waiting on them.
 		 */
 		explicit JobSystem(uint32_t threadCount);
 
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param configuration The job system configuration.
+		 */
+		explicit JobSystem(const JobSystemConfiguration& configuration);
+
 		/**
 		 * Destructor.
 		 */
@@ -38,49 +130,104 @@ namespace Xenon
 		 * Insert a new job to the job system.
 		 * Note that a job might start right after inserting it.
 		 *
-		 * @tparam Job The job type.
-		 * @param job The job to insert.
+		 * @tparam Function The job function type.
+		 * @param function The job function to insert.
+		 * @param priority The job priority. Default is normal.
 		 * @return The job's return future.
 		 */
-		template<class Job>
-		decltype(auto) insert(Job&& job)
-		{
-			using ReturnType = std::invoke_result_t<Job>;
+		template<class Function>
+		decltype(auto) insert(Function&& function, JobPriority priority = JobPriority::Normal) { return insertWithFuture(nullptr, priority, false, std::forward<Function>(function)); }
 
-			// Create the promise and get the future.
-			auto pPromise = new std::promise<ReturnType>();
-			auto future = pPromise->get_future();
+		/**
+		 * Insert a new job to the job system as a part of a job group.
+		 * Note that a job might start right after inserting it.
+		 *
+		 * @tparam Function The job function type.
+		 * @param group The job group to insert the job to.
+		 * @param function The job function to insert.
+		 * @param priority The job priority. Default is normal.
+		 * @return The job's return future.
+		 */
+		template<class Function>
+		decltype(auto) insert(JobGroup& group, Function&& function, JobPriority priority = JobPriority::Normal) { return insertWithFuture(&group, priority, false, std::forward<Function>(function)); }
 
-			// Setup the job function.
-			const auto jobFunction = [pPromise, job = std::move(job)]
-			{
-				try
-				{
-					if constexpr (std::is_void_v<ReturnType>)
-					{
-						job();
-						pPromise->set_value();
-					}
-					else
-					{
-						pPromise->set_value(job());
-					}
+		/**
+		 * Insert a new job to the job system without creating a future.
+		 * Use this when the result of the job is not needed, since it does not need to allocate a promise.
+		 * Note that a job might start right after inserting it.
+		 *
+		 * @tparam Function The job function type.
+		 * @param function The job function to insert.
+		 * @param priority The job priority. Default is normal.
+		 */
+		template<class Function>
+		void insertDetached(Function&& function, JobPriority priority = JobPriority::Normal) { emplace(nullptr, priority, std::forward<Function>(function)); }
 
-					delete pPromise;
-				}
-				catch (std::exception_ptr ptr)
-				{
-					pPromise->set_exception(ptr);
-				}
-			};
+		/**
+		 * Insert a new job to the job system as a part of a job group without creating a future.
+		 * Use this when the result of the job is not needed, since it does not need to allocate a promise.
+		 * Note that a job might start right after inserting it.
+		 *
+		 * @tparam Function The job function type.
+		 * @param group The job group to insert the job to.
+		 * @param function The job function to insert.
+		 * @param priority The job priority. Default is normal.
+		 */
+		template<class Function>
+		void insertDetached(JobGroup& group, Function&& function, JobPriority priority = JobPriority::Normal) { emplace(&group, priority, std::forward<Function>(function)); }
 
-			// Insert the job to the system.
-			const auto lock = std::scoped_lock(m_JobMutex);
-			const auto jobStatus = m_JobEntries.emplace_back(std::move(jobFunction));
+		/**
+		 * Insert a new blocking I/O job to the job system.
+		 * I/O jobs are executed by the I/O workers, or as background jobs if there aren't any I/O workers.
+		 *
+		 * @tparam Function The job function type.
+		 * @param function The job function to insert.
+		 * @return The job's return future.
+		 */
+		template<class Function>
+		decltype(auto) insertIO(Function&& function) { return insertWithFuture(nullptr, JobPriority::Background, true, std::forward<Function>(function)); }
 
-			m_ConditionVariable.notify_one();
-			return future;
-		}
+		/**
+		 * Insert a new blocking I/O job to the job system as a part of a job group.
+		 * I/O jobs are executed by the I/O workers, or as background jobs if there aren't any I/O workers.
+		 *
+		 * @tparam Function The job function type.
+		 * @param group The job group to insert the job to.
+		 * @param function The job function to insert.
+		 * @return The job's return future.
+		 */
+		template<class Function>
+		decltype(auto) insertIO(JobGroup& group, Function&& function) { return insertWithFuture(&group, JobPriority::Background, true, std::forward<Function>(function)); }
+
+		/**
+		 * Insert a new blocking I/O job to the job system without creating a future.
+		 * I/O jobs are executed by the I/O workers, or as background jobs if there aren't any I/O workers.
+		 *
+		 * @tparam Function The job function type.
+		 * @param function The job function to insert.
+		 */
+		template<class Function>
+		void insertIODetached(Function&& function) { emplaceIO(nullptr, std::forward<Function>(function)); }
+
+		/**
+		 * Insert a new blocking I/O job to the job system as a part of a job group without creating a future.
+		 * I/O jobs are executed by the I/O workers, or as background jobs if there aren't any I/O workers.
+		 *
+		 * @tparam Function The job function type.
+		 * @param group The job group to insert the job to.
+		 * @param function The job function to insert.
+		 */
+		template<class Function>
+		void insertIODetached(JobGroup& group, Function&& function) { emplaceIO(&group, std::forward<Function>(function)); }
+
+		/**
+		 * Schedule the calling coroutine on the job system.
+		 * Use it as co_await jobSystem.schedule(); to continue the rest of the coroutine as a job.
+		 *
+		 * @param priority The priority of the job which resumes the coroutine. Default is normal.
+		 * @return The awaitable.
+		 */
+		XENON_NODISCARD ScheduleAwaitable schedule(JobPriority priority = JobPriority::Normal) noexcept { return ScheduleAwaitable{ *this, priority }; }
 
 		/**
 		 * Update the thread count.
@@ -90,18 +237,61 @@ namespace Xenon
 		 */
 		void setThreadCount(uint32_t threadCount);
 
+		/**
+		 * Set the maximum number of threads which can execute background jobs at the same time.
+		 * Background jobs inserted from within a background job run under the parent's slot, and does not count towards this limit.
+		 *
+		 * @param limit The worker limit. If this is 0, half of the worker count (at least 1) is used.
+		 */
+		void setBackgroundWorkerLimit(uint32_t limit) noexcept { m_BackgroundWorkerLimit = limit; }
+
+		/**
+		 * Get the maximum number of threads which can execute background jobs at the same time.
+		 *
+		 * @return The worker limit.
+		 */
+		XENON_NODISCARD uint32_t getBackgroundWorkerLimit() const noexcept;
+
 		/**
 		 * Wait till all the submitted jobs are completed.
+		 * The calling thread will execute pending jobs while waiting, and will sleep if there's nothing to execute. See wait(const JobGroup&)
+		 * for the jobs a waiting thread helps with.
 		 */
 		void wait();
 
+		/**
+		 * Wait till all the jobs in a job group are completed.
+		 * This will not wait for the jobs which are not a part of the group.
+		 * The calling thread will execute pending jobs while waiting, and will sleep if there's nothing to execute.
+		 *
+		 * The same rule applies to every waiting thread, whether it's a worker or not: it helps with critical and normal jobs, but never
+		 * picks up a background job, since one could keep it busy long after the group completes. The exceptions are a thread which is
+		 * already running a background job (it's already off the critical path), and a system without workers (nothing else would run
+		 * them). This means that jobs which are waited on from inside another job should not be background jobs, unless the waiting job
+		 * is a background job itself; otherwise they only progress on the workers which aren't waiting.
+		 *
+		 * @param group The job group to wait on.
+		 */
+		void wait(const JobGroup& group);
+
 		/**
 		 * Wait for a timeout nanoseconds till the submitted jobs are completed.
+		 * The calling thread will execute pending jobs while waiting, following the same rule as wait(const JobGroup&).
 		 *
 		 * @param timeout The timeout time to wait in nanoseconds.
 		 */
 		void waitFor(std::chrono::nanoseconds timeout);
 
+		/**
+		 * Execute a single pending job on the calling thread.
+		 * This can be used to help the workers while waiting for something to complete, so it follows the same rule as
+		 * wait(const JobGroup&) when picking the job.
+		 *
+		 * @return True if a job was executed.
+		 * @return False if there were no jobs to execute.
+		 */
+		bool executeOne();
+
 		/**
 		 * Clear the job system.
 		 * This will close all the workers and complete everything that has been issued.
@@ -114,39 +304,353 @@ namespace Xenon
 		 * @return True if the jobs have been completed.
 		 * @return False if the jobs have not been completed.
 		 */
-		XENON_NODISCARD bool isComplete();
+		XENON_NODISCARD bool isComplete() const noexcept { return m_PendingJobs == 0; }
+
+		/**
+		 * Check if all the jobs in a job group have been completed.
+		 *
+		 * @param group The job group to check.
+		 * @return True if the jobs have been completed.
+		 * @return False if the jobs have not been completed.
+		 */
+		XENON_NODISCARD bool isComplete(const JobGroup& group) const noexcept { return group.isComplete(); }
 
 		/**
 		 * Get the number of threads used by the system.
 		 *
 		 * @return The thread count.
 		 */
-		XENON_NODISCARD uint64_t getThreadCount() const noexcept { return m_Workers.size(); }
+		XENON_NODISCARD uint64_t getThreadCount() const noexcept { return m_pWorkers.size(); }
+
+		/**
+		 * Get the number of I/O worker threads.
+		 *
+		 * @return The thread count.
+		 */
+		XENON_NODISCARD uint64_t getIOThreadCount() const noexcept { return m_IOWorkers.size(); }
+
+		/**
+		 * Get the configuration used by the job system.
+		 * The worker count contains the resolved number of workers.
+		 *
+		 * @return The configuration.
+		 */
+		XENON_NODISCARD const JobSystemConfiguration& getConfiguration() const noexcept { return m_Configuration; }
+
+		/**
+		 * Get a snapshot of the runtime statistics.
+		 * The statistics are only collected if XENON_ENABLE_JOB_STATISTICS is defined, and are all 0 otherwise.
+		 *
+		 * @return The statistics.
+		 */
+		XENON_NODISCARD JobSystemStatistics getStatistics() const;
+
+		/**
+		 * Reset all the runtime statistics to 0.
+		 */
+		void resetStatistics();
 
 	private:
+		/**
+		 * Insert a new job which sets the result to a future.
+		 *
+		 * @tparam Function The job function type.
+		 * @param pGroup The job group pointer. This can be nullptr if the job is not a part of a group.
+		 * @param priority The job priority.
+		 * @param isIO Whether the job is a blocking I/O job.
+		 * @param function The job function to insert.
+		 * @return The job's return future.
+		 */
+		template<class Function>
+		decltype(auto) insertWithFuture(JobGroup* pGroup, JobPriority priority, bool isIO, Function&& function)
+		{
+			using ReturnType = std::invoke_result_t<Function>;
+
+			// Create the promise and get the future. The shared state is allocated from a pool.
+			auto promise = std::promise<ReturnType>(std::allocator_arg, ObjectPoolAllocator<ReturnType>());
+			auto future = promise.get_future();
+
+			// Setup the job function.
+			auto job = [promise = std::move(promise), function = std::forward<Function>(function)]() mutable
+				{
+					try
+					{
+						if constexpr (std::is_void_v<ReturnType>)
+						{
+							function();
+							promise.set_value();
+						}
+						else
+						{
+							promise.set_value(function());
+						}
+					}
+					catch (...)
+					{
+						promise.set_exception(std::current_exception());
+					}
+				};
+
+			// Insert it.
+			if (isIO)
+				emplaceIO(pGroup, std::move(job));
+
+			else
+				emplace(pGroup, priority, std::move(job));
+
+			return future;
+		}
+
+		/**
+		 * Setup a pooled job with the job function and submit it.
+		 *
+		 * @tparam Function The job function type.
+		 * @param pGroup The job group pointer. This can be nullptr if the job is not a part of a group.
+		 * @param priority The job priority.
+		 * @param function The job function to insert.
+		 */
+		template<class Function>
+		void emplace(JobGroup* pGroup, JobPriority priority, Function&& function)
+		{
+			auto pJob = allocateJob();
+			pJob->set(std::forward<Function>(function));
+			pJob->m_pGroup = pGroup;
+			pJob->m_Priority = priority;
+
+			if (pGroup)
+				pGroup->enter();
+
+			submit(pJob);
+		}
+
+		/**
+		 * Setup a pooled job with the job function and submit it to the I/O workers.
+		 * If there are no I/O workers, it's submitted as a background job.
+		 *
+		 * @tparam Function The job function type.
+		 * @param pGroup The job group pointer. This can be nullptr if the job is not a part of a group.
+		 * @param function The job function to insert.
+		 */
+		template<class Function>
+		void emplaceIO(JobGroup* pGroup, Function&& function)
+		{
+			if (m_IOWorkers.empty())
+			{
+				emplace(pGroup, JobPriority::Background, std::forward<Function>(function));
+				return;
+			}
+
+			auto pJob = allocateJob();
+			pJob->set(std::forward<Function>(function));
+			pJob->m_pGroup = pGroup;
+			pJob->m_Priority = JobPriority::Normal;
+
+			if (pGroup)
+				pGroup->enter();
+
+			submitIO(pJob);
+		}
+
+		/**
+		 * Create and start the worker threads.
+		 *
+		 * @param threadCount The number of threads to start.
+		 */
+		void start(uint32_t threadCount);
+
+		/**
+		 * Create and start the I/O worker threads.
+		 *
+		 * @param threadCount The number of threads to start.
+		 */
+		void startIO(uint32_t threadCount);
+
+		/**
+		 * Finish the pending I/O jobs and stop the I/O worker threads.
+		 */
+		void stopIO();
+
+		/**
+		 * Resolve the logical processors each worker is allowed to run on, and the NUMA node of each worker.
+		 * The processor lists are left empty if the workers should not be pinned.
+		 */
+		void assignProcessors();
+
+		/**
+		 * Submit a job to the system.
+		 * If the calling thread is a worker of this system, the job is pushed to it's local queue. Else it's pushed to the injection queue.
+		 *
+		 * @param pJob The job pointer.
+		 */
+		void submit(Job* pJob);
+
+		/**
+		 * Submit a job to the I/O queue.
+		 *
+		 * @param pJob The job pointer.
+		 */
+		void submitIO(Job* pJob);
+
+		/**
+		 * Get a free job from the job pool.
+		 * Worker threads get it from their own cache, and the other threads get it from the shared pool.
+		 *
+		 * @return The job pointer.
+		 */
+		XENON_NODISCARD Job* allocateJob();
+
+		/**
+		 * Return a job to the job pool.
+		 * This will destroy the stored callable.
+		 *
+		 * @param pJob The job pointer.
+		 */
+		void releaseJob(Job* pJob);
+
+		/**
+		 * Allocate a new block of jobs and add them to the shared pool.
+		 * Make sure that the job pool mutex is locked before calling this.
+		 */
+		void allocateJobBlock();
+
+		/**
+		 * Acquire the next job to execute on the calling thread.
+		 * This will look in the local queue (if the calling thread is a worker), then in the injection queue and finally try to steal from the workers.
+		 *
+		 * @param isWaiting Whether the calling thread is helping out while waiting. Waiting threads skip the background lane (see
+		 * wait(const JobGroup&)).
+		 * @return The job pointer. This will be nullptr if no jobs were found.
+		 */
+		XENON_NODISCARD Job* acquire(bool isWaiting);
+
+		/**
+		 * Acquire the next job from a single priority lane.
+		 *
+		 * @param lane The lane index.
+		 * @param isWorker Whether the calling thread is a worker of this system.
+		 * @return The job pointer. This will be nullptr if no jobs were found.
+		 */
+		XENON_NODISCARD Job* acquireFrom(uint8_t lane, bool isWorker);
+
+		/**
+		 * Try and pop a job from the injection queue.
+		 *
+		 * @param lane The lane index.
+		 * @return The job pointer. This will be nullptr if the queue is empty.
+		 */
+		XENON_NODISCARD Job* popInjected(uint8_t lane);
+
+		/**
+		 * Push a job to the back of it's injection queue lane.
+		 * Make sure that the injection mutex is locked before calling this.
+		 *
+		 * @param pJob The job pointer.
+		 */
+		void pushInjected(Job* pJob);
+
+		/**
+		 * Try and steal a job from another worker, starting from a random victim.
+		 *
+		 * @param lane The lane index.
+		 * @param randomState The thief's random state.
+		 * @param index The thief's worker index. This is skipped when selecting the victim.
+		 * @return The job pointer. This will be nullptr if nothing could be stolen.
+		 */
+		XENON_NODISCARD Job* steal(uint8_t lane, uint64_t& randomState, uint32_t index);
+
+		/**
+		 * Check if there are jobs which a worker is allowed to execute right now.
+		 *
+		 * @return True if a worker should wake up.
+		 * @return False if there's nothing a worker can execute.
+		 */
+		XENON_NODISCARD bool hasExecutableJobs() const noexcept;
+
+		/**
+		 * Try and reserve a slot to execute a background job.
+		 *
+		 * @return True if the slot was reserved.
+		 * @return False if the background worker limit has been reached.
+		 */
+		XENON_NODISCARD bool reserveBackgroundSlot() noexcept;
+
+		/**
+		 * Release a reserved background slot.
+		 * This will wake up a worker if there are background jobs waiting for a slot.
+		 */
+		void releaseBackgroundSlot();
+
+		/**
+		 * Get the statistics counters of the calling thread.
+		 * Threads which are not a part of the job system share the helper counters.
+		 *
+		 * @return The counters.
+		 */
+		XENON_NODISCARD JobWorkerCounters& getCounters() noexcept;
+
+		/**
+		 * Wake up a single sleeping worker if there's one.
+		 */
+		void wakeWorker();
+
 		/**
 		 * This function is the worker function which is run on a separate thread.
 		 *
 		 * @param index The thread index.
+		 * @param latch The latch to count down once the worker is ready to execute jobs.
 		 */
-		void worker(uint32_t index);
+		void worker(uint32_t index, std::latch& latch);
 
 		/**
-		 * This function will execute a single job in the worker thread.
+		 * This function is the I/O worker function which is run on a separate thread.
 		 *
-		 * @param lock The lock to lock and unlock when executing.
-		 * @param index The thread index.
+		 * @param index The I/O thread index.
+		 */
+		void ioWorker(uint32_t index);
+
+		/**
+		 * This function will execute a single job and return it to the job pool.
+		 *
+		 * @param pJob The job to execute.
 		 */
-		void execute(std::unique_lock<std::mutex>& lock, uint32_t index);
+		void execute(Job* pJob);
 
 	private:
-		std::mutex m_JobMutex;
-		std::atomic_bool m_ShouldRun = true;
-		std::atomic_bool m_ShouldFinishJobs = true;
+		JobSystemConfiguration m_Configuration;
+
+		std::vector<std::unique_ptr<Worker>> m_pWorkers;
+		std::vector<std::jthread> m_IOWorkers;
+
+		std::mutex m_JobPoolMutex;
+		std::vector<std::unique_ptr<Job[]>> m_pJobBlocks;
+		Job* m_pFreeJobs = nullptr;
+
+		std::mutex m_InjectionMutex;
+		std::array<Job*, LaneCount> m_pInjectionHeads = {};
+		std::array<Job*, LaneCount> m_pInjectionTails = {};
+		std::array<std::atomic_uint64_t, LaneCount> m_InjectedJobs = {};
+
+		std::mutex m_SleepMutex;
 		std::condition_variable m_ConditionVariable;
+		std::atomic_uint32_t m_SleepingWorkers = 0;
+
+		std::mutex m_IOMutex;
+		std::condition_variable m_IOConditionVariable;
+		Job* m_pIOHead = nullptr;
+		Job* m_pIOTail = nullptr;
+		bool m_ShouldRunIO = true;
+
+		std::array<std::atomic_int64_t, LaneCount> m_QueuedJobs = {};
+		std::atomic_uint64_t m_PendingJobs = 0;
+
+		JobWorkerCounters m_HelperCounters;
+		JobWorkerCounters m_IOCounters;
+		std::atomic_uint64_t m_InjectionQueueHighWaterMark = 0;
 
-		std::list<std::function<void()>> m_JobEntries;
-		std::vector<std::jthread> m_Workers;
-		std::vector<bool> m_WorkerState;
+		std::atomic_uint32_t m_RunningBackgroundJobs = 0;
+		std::atomic_uint32_t m_BackgroundWorkerLimit = 0;
+
+		std::atomic_bool m_ShouldRun = true;
+		std::atomic_bool m_ShouldFinishJobs = true;
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,211 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+// The job system statistics are only collected if XENON_ENABLE_JOB_STATISTICS is defined.
+#ifdef XENON_ENABLE_JOB_STATISTICS
+#	define XENON_JOB_STATISTICS(...)							__VA_ARGS__
+
+#else
+#	define XENON_JOB_STATISTICS(...)
+
+#endif
+
+namespace Xenon
+{
+	/**
+	 * Job worker statistics structure.
+	 * This contains the statistics of a single thread (or a set of threads) which executes jobs.
+	 */
+	struct JobWorkerStatistics final
+	{
+		/**
+		 * Get the average time a job had to wait from being inserted till it started executing.
+		 *
+		 * @return The average latency.
+		 */
+		XENON_NODISCARD std::chrono::nanoseconds getAverageLatency() const noexcept { return m_ExecutedJobs > 0 ? m_TotalLatency / static_cast<int64_t>(m_ExecutedJobs) : std::chrono::nanoseconds(0); }
+
+		/**
+		 * Get the fraction of time spent executing jobs, out of the time spent executing and sleeping.
+		 *
+		 * @return The utilization in the range [0, 1].
+		 */
+		XENON_NODISCARD float getUtilization() const noexcept
+		{
+			const auto total = m_BusyTime + m_IdleTime;
+			return total.count() > 0 ? static_cast<float>(m_BusyTime.count()) / static_cast<float>(total.count()) : 0.0f;
+		}
+
+		/**
+		 * Accumulate another set of statistics to this.
+		 *
+		 * @param other The other statistics.
+		 * @return This object reference.
+		 */
+		JobWorkerStatistics& operator+=(const JobWorkerStatistics& other) noexcept
+		{
+			m_ExecutedJobs += other.m_ExecutedJobs;
+			m_StealAttempts += other.m_StealAttempts;
+			m_SuccessfulSteals += other.m_SuccessfulSteals;
+			m_QueueDepthHighWaterMark = std::max(m_QueueDepthHighWaterMark, other.m_QueueDepthHighWaterMark);
+
+			m_BusyTime += other.m_BusyTime;
+			m_IdleTime += other.m_IdleTime;
+			m_TotalLatency += other.m_TotalLatency;
+
+			return *this;
+		}
+
+		uint64_t m_ExecutedJobs = 0;
+		uint64_t m_StealAttempts = 0;
+		uint64_t m_SuccessfulSteals = 0;
+		uint64_t m_QueueDepthHighWaterMark = 0;
+
+		std::chrono::nanoseconds m_BusyTime = std::chrono::nanoseconds(0);
+		std::chrono::nanoseconds m_IdleTime = std::chrono::nanoseconds(0);
+		std::chrono::nanoseconds m_TotalLatency = std::chrono::nanoseconds(0);
+	};
+
+	/**
+	 * Job system statistics structure.
+	 * This is a snapshot of the statistics of all the threads in a job system.
+	 */
+	struct JobSystemStatistics final
+	{
+		/**
+		 * Get the accumulated statistics of all the threads.
+		 *
+		 * @return The total statistics.
+		 */
+		XENON_NODISCARD JobWorkerStatistics getTotal() const noexcept
+		{
+			auto total = m_Helpers;
+			total += m_IOWorkers;
+
+			for (const auto& worker : m_Workers)
+				total += worker;
+
+			return total;
+		}
+
+		std::vector<JobWorkerStatistics> m_Workers;
+
+		// The threads which execute jobs while waiting on the job system.
+		JobWorkerStatistics m_Helpers;
+
+		// All the I/O worker threads.
+		JobWorkerStatistics m_IOWorkers;
+
+		// The highest number of jobs waiting in a single lane of the injection queue.
+		uint64_t m_InjectionQueueHighWaterMark = 0;
+	};
+
+	/**
+	 * Job worker counters class.
+	 * This contains the live counters of a thread (or a set of threads) which executes jobs. All the counters use relaxed atomics
+	 * since they are only used for reporting.
+	 */
+	class JobWorkerCounters final
+	{
+	public:
+		/**
+		 * Default constructor.
+		 */
+		JobWorkerCounters() = default;
+
+		/**
+		 * Record a job execution.
+		 *
+		 * @param busyTime The time it took to execute the job.
+		 * @param latency The time the job waited before it started executing.
+		 */
+		void recordExecution(std::chrono::nanoseconds busyTime, std::chrono::nanoseconds latency) noexcept
+		{
+			m_ExecutedJobs.fetch_add(1, std::memory_order_relaxed);
+			m_BusyTime.fetch_add(busyTime.count(), std::memory_order_relaxed);
+			m_TotalLatency.fetch_add(latency.count(), std::memory_order_relaxed);
+		}
+
+		/**
+		 * Record the time spent sleeping.
+		 *
+		 * @param idleTime The idle time.
+		 */
+		void recordIdle(std::chrono::nanoseconds idleTime) noexcept { m_IdleTime.fetch_add(idleTime.count(), std::memory_order_relaxed); }
+
+		/**
+		 * Record a steal attempt.
+		 *
+		 * @param succeeded Whether a job was stolen.
+		 */
+		void recordSteal(bool succeeded) noexcept
+		{
+			m_StealAttempts.fetch_add(1, std::memory_order_relaxed);
+			if (succeeded)
+				m_SuccessfulSteals.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		/**
+		 * Record the depth of a queue after pushing to it.
+		 *
+		 * @param depth The queue depth.
+		 */
+		void recordQueueDepth(uint64_t depth) noexcept
+		{
+			if (depth > m_QueueDepthHighWaterMark.load(std::memory_order_relaxed))
+				m_QueueDepthHighWaterMark.store(depth, std::memory_order_relaxed);
+		}
+
+		/**
+		 * Get a snapshot of the counters.
+		 *
+		 * @return The statistics.
+		 */
+		XENON_NODISCARD JobWorkerStatistics getStatistics() const noexcept
+		{
+			JobWorkerStatistics statistics;
+			statistics.m_ExecutedJobs = m_ExecutedJobs.load(std::memory_order_relaxed);
+			statistics.m_StealAttempts = m_StealAttempts.load(std::memory_order_relaxed);
+			statistics.m_SuccessfulSteals = m_SuccessfulSteals.load(std::memory_order_relaxed);
+			statistics.m_QueueDepthHighWaterMark = m_QueueDepthHighWaterMark.load(std::memory_order_relaxed);
+			statistics.m_BusyTime = std::chrono::nanoseconds(m_BusyTime.load(std::memory_order_relaxed));
+			statistics.m_IdleTime = std::chrono::nanoseconds(m_IdleTime.load(std::memory_order_relaxed));
+			statistics.m_TotalLatency = std::chrono::nanoseconds(m_TotalLatency.load(std::memory_order_relaxed));
+
+			return statistics;
+		}
+
+		/**
+		 * Reset all the counters to 0.
+		 */
+		void reset() noexcept
+		{
+			m_ExecutedJobs.store(0, std::memory_order_relaxed);
+			m_StealAttempts.store(0, std::memory_order_relaxed);
+			m_SuccessfulSteals.store(0, std::memory_order_relaxed);
+			m_QueueDepthHighWaterMark.store(0, std::memory_order_relaxed);
+			m_BusyTime.store(0, std::memory_order_relaxed);
+			m_IdleTime.store(0, std::memory_order_relaxed);
+			m_TotalLatency.store(0, std::memory_order_relaxed);
+		}
+
+	private:
+		std::atomic_uint64_t m_ExecutedJobs = 0;
+		std::atomic_uint64_t m_StealAttempts = 0;
+		std::atomic_uint64_t m_SuccessfulSteals = 0;
+		std::atomic_uint64_t m_QueueDepthHighWaterMark = 0;
+
+		std::atomic_int64_t m_BusyTime = 0;
+		std::atomic_int64_t m_IdleTime = 0;
+		std::atomic_int64_t m_TotalLatency = 0;
+	};
+}
@@ -0,0 +1,105 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "LockStatistics.hpp"
+
+#include <algorithm>
+
+namespace /* anonymous */
+{
+	/**
+	 * Get the registry mutex.
+	 * This is a function local static so that locks which are created during static initialization can register safely.
+	 *
+	 * @return The mutex reference.
+	 */
+	std::mutex& GetRegistryMutex()
+	{
+		static std::mutex mutex;
+		return mutex;
+	}
+
+	/**
+	 * The head of the list of live lock counters.
+	 */
+	Xenon::LockCounters* g_pFirstLockCounters = nullptr;
+}
+
+namespace Xenon
+{
+	LockCounters::LockCounters()
+	{
+		const auto lock = std::scoped_lock(GetRegistryMutex());
+
+		m_pNext = g_pFirstLockCounters;
+		if (m_pNext)
+			m_pNext->m_pPrevious = this;
+
+		g_pFirstLockCounters = this;
+	}
+
+	LockCounters::~LockCounters()
+	{
+		const auto lock = std::scoped_lock(GetRegistryMutex());
+
+		if (m_pPrevious)
+			m_pPrevious->m_pNext = m_pNext;
+
+		else
+			g_pFirstLockCounters = m_pNext;
+
+		if (m_pNext)
+			m_pNext->m_pPrevious = m_pPrevious;
+	}
+
+	void LockCounters::setName(std::string_view name)
+	{
+		const auto lock = std::scoped_lock(m_NameMutex);
+		m_Name = name;
+	}
+
+	std::string LockCounters::getName() const
+	{
+		const auto lock = std::scoped_lock(m_NameMutex);
+		return m_Name;
+	}
+
+	Xenon::LockStatistics LockCounters::getStatistics() const
+	{
+		LockStatistics statistics;
+		statistics.m_Name = getName();
+		statistics.m_Acquisitions = m_Acquisitions.load(std::memory_order_relaxed);
+		statistics.m_ContendedAcquisitions = m_ContendedAcquisitions.load(std::memory_order_relaxed);
+		statistics.m_WaitTime = std::chrono::nanoseconds(m_WaitTime.load(std::memory_order_relaxed));
+
+		return statistics;
+	}
+
+	void LockCounters::reset() noexcept
+	{
+		m_Acquisitions.store(0, std::memory_order_relaxed);
+		m_ContendedAcquisitions.store(0, std::memory_order_relaxed);
+		m_WaitTime.store(0, std::memory_order_relaxed);
+	}
+
+	std::vector<Xenon::LockStatistics> LockCounters::GetAllStatistics()
+	{
+		std::vector<LockStatistics> statistics;
+
+		{
+			const auto lock = std::scoped_lock(GetRegistryMutex());
+			for (auto pCounters = g_pFirstLockCounters; pCounters; pCounters = pCounters->m_pNext)
+				statistics.emplace_back(pCounters->getStatistics());
+		}
+
+		std::ranges::sort(statistics, [](const LockStatistics& lhs, const LockStatistics& rhs) { return lhs.m_WaitTime > rhs.m_WaitTime; });
+		return statistics;
+	}
+
+	void LockCounters::ResetAll()
+	{
+		const auto lock = std::scoped_lock(GetRegistryMutex());
+		for (auto pCounters = g_pFirstLockCounters; pCounters; pCounters = pCounters->m_pNext)
+			pCounters->reset();
+	}
+}
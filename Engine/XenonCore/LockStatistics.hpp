@@ -0,0 +1,187 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+// The lock statistics are only collected if XENON_ENABLE_LOCK_STATISTICS is defined.
+#ifdef XENON_ENABLE_LOCK_STATISTICS
+#	define XENON_LOCK_STATISTICS(...)							__VA_ARGS__
+
+#else
+#	define XENON_LOCK_STATISTICS(...)
+
+#endif
+
+namespace Xenon
+{
+	/**
+	 * Lock statistics structure.
+	 * This is a snapshot of the statistics of a single lock.
+	 */
+	struct LockStatistics final
+	{
+		/**
+		 * Get the fraction of acquisitions which had to wait for another thread.
+		 *
+		 * @return The contention rate in the range [0, 1].
+		 */
+		XENON_NODISCARD float getContentionRate() const noexcept { return m_Acquisitions > 0 ? static_cast<float>(m_ContendedAcquisitions) / static_cast<float>(m_Acquisitions) : 0.0f; }
+
+		std::string m_Name;
+
+		uint64_t m_Acquisitions = 0;
+		uint64_t m_ContendedAcquisitions = 0;
+
+		std::chrono::nanoseconds m_WaitTime = std::chrono::nanoseconds(0);
+	};
+
+	/**
+	 * Lock counters class.
+	 * This contains the live counters of a single lock. All the counters are registered globally when created so that they can be
+	 * reported using GetAllStatistics(). The counters use relaxed atomics since they are only used for reporting.
+	 */
+	class LockCounters final
+	{
+	public:
+		/**
+		 * Default constructor.
+		 */
+		LockCounters();
+
+		/**
+		 * Destructor.
+		 */
+		~LockCounters();
+
+		XENON_DISABLE_COPY(LockCounters);
+		XENON_DISABLE_MOVE(LockCounters);
+
+		/**
+		 * Set the name of the lock, which is used when reporting.
+		 *
+		 * @param name The name to set.
+		 */
+		void setName(std::string_view name);
+
+		/**
+		 * Get the name of the lock.
+		 *
+		 * @return The name.
+		 */
+		XENON_NODISCARD std::string getName() const;
+
+		/**
+		 * Lock a mutex exclusively and record the acquisition.
+		 *
+		 * @tparam MutexType The mutex type.
+		 * @param mutex The mutex to lock.
+		 * @return The unique lock.
+		 */
+		template<class MutexType>
+		XENON_NODISCARD std::unique_lock<MutexType> lock(MutexType& mutex)
+		{
+			auto lock = std::unique_lock(mutex, std::try_to_lock);
+			if (lock.owns_lock())
+			{
+				recordAcquisition();
+			}
+			else
+			{
+				const auto start = std::chrono::steady_clock::now();
+				lock.lock();
+				recordContendedAcquisition(std::chrono::steady_clock::now() - start);
+			}
+
+			return lock;
+		}
+
+		/**
+		 * Lock a mutex in shared mode and record the acquisition.
+		 *
+		 * @tparam MutexType The mutex type.
+		 * @param mutex The mutex to lock.
+		 * @return The shared lock.
+		 */
+		template<class MutexType>
+		XENON_NODISCARD std::shared_lock<MutexType> lockShared(MutexType& mutex)
+		{
+			auto lock = std::shared_lock(mutex, std::try_to_lock);
+			if (lock.owns_lock())
+			{
+				recordAcquisition();
+			}
+			else
+			{
+				const auto start = std::chrono::steady_clock::now();
+				lock.lock();
+				recordContendedAcquisition(std::chrono::steady_clock::now() - start);
+			}
+
+			return lock;
+		}
+
+		/**
+		 * Get a snapshot of the counters.
+		 *
+		 * @return The statistics.
+		 */
+		XENON_NODISCARD LockStatistics getStatistics() const;
+
+		/**
+		 * Reset all the counters to 0.
+		 */
+		void reset() noexcept;
+
+	public:
+		/**
+		 * Get the statistics of all the live locks.
+		 * The locks are sorted by the total wait time, the most expensive one first.
+		 *
+		 * @return The statistics.
+		 */
+		XENON_NODISCARD static std::vector<LockStatistics> GetAllStatistics();
+
+		/**
+		 * Reset the counters of all the live locks.
+		 */
+		static void ResetAll();
+
+	private:
+		/**
+		 * Record an acquisition which did not have to wait.
+		 */
+		void recordAcquisition() noexcept { m_Acquisitions.fetch_add(1, std::memory_order_relaxed); }
+
+		/**
+		 * Record an acquisition which had to wait for another thread.
+		 *
+		 * @param waitTime The time spent waiting.
+		 */
+		void recordContendedAcquisition(std::chrono::nanoseconds waitTime) noexcept
+		{
+			m_Acquisitions.fetch_add(1, std::memory_order_relaxed);
+			m_ContendedAcquisitions.fetch_add(1, std::memory_order_relaxed);
+			m_WaitTime.fetch_add(waitTime.count(), std::memory_order_relaxed);
+		}
+
+	private:
+		mutable std::mutex m_NameMutex;
+		std::string m_Name = "Unnamed";
+
+		std::atomic_uint64_t m_Acquisitions = 0;
+		std::atomic_uint64_t m_ContendedAcquisitions = 0;
+		std::atomic_int64_t m_WaitTime = 0;
+
+		LockCounters* m_pPrevious = nullptr;
+		LockCounters* m_pNext = nullptr;
+	};
+}
@@ -4,8 +4,7 @@
 #pragma once
 
 #include "Features.hpp"
-
-#include <spdlog/spdlog.h>
+#include "AsyncLogger.hpp"
 
 #ifdef XENON_FEATURE_SOURCE_LOCATION
 #include <source_location>
@@ -35,24 +34,25 @@ namespace Xenon
 	/**
 	 * Log a trace to the console.
 	 *
-	 * @tparam Message The message type.
+	 * @tparam Arguments The format argument types.
 	 * @param location The source location.
-	 * @param message The message to log.
+	 * @param format The format string.
+	 * @param arguments The format arguments.
 	 */
-	template<class Message>
-	void TraceLog(std::source_location&& location, Message&& message)
+	template<class... Arguments>
+	void TraceLog(std::source_location&& location, fmt::format_string<Arguments...> format, Arguments&&... arguments)
 	{
-		spdlog::info("[Trace \"{}\":{}] {}", location.file_name(), location.line(), std::move(message));
+		AsyncLogger::LogAt(spdlog::level::info, location.file_name(), location.line(), format, std::forward<Arguments>(arguments)...);
 	}
 
 #endif
 }
 
 #ifdef XENON_FEATURE_SOURCE_LOCATION
-#	define XENON_TRACE_FUNCTION(...)	::Xenon::TraceLog(std::source_location::current(), fmt::format(__VA_ARGS__))
+#	define XENON_TRACE_FUNCTION(...)	::Xenon::TraceLog(std::source_location::current(), __VA_ARGS__)
 
 #else
-#	define XENON_TRACE_FUNCTION(...)	::spdlog::info("[Trace \"{}\":{}] {}", __FILE__, __LINE__, fmt::format(__VA_ARGS__))
+#	define XENON_TRACE_FUNCTION(...)	::Xenon::AsyncLogger::LogAt(::spdlog::level::info, __FILE__, __LINE__, __VA_ARGS__)
 
 #endif // XENONE_FEATURE_SOURCE_LOCATION
 
@@ -69,16 +69,16 @@ namespace Xenon
  */
 #ifdef XENON_LOG_LEVEL
 #	if XENON_LOG_LEVEL > 0
-#		define XENON_LOG_FATAL(...)								::spdlog::critical(__VA_ARGS__)
+#		define XENON_LOG_FATAL(...)								::Xenon::AsyncLogger::Log(::spdlog::level::critical, __VA_ARGS__)
 
 #		if XENON_LOG_LEVEL > 1
-#			define XENON_LOG_ERROR(...)							::spdlog::error(__VA_ARGS__)
+#			define XENON_LOG_ERROR(...)							::Xenon::AsyncLogger::Log(::spdlog::level::err, __VA_ARGS__)
 
 #			if XENON_LOG_LEVEL > 2
-#				define XENON_LOG_WARNING(...)					::spdlog::warn(__VA_ARGS__)
+#				define XENON_LOG_WARNING(...)					::Xenon::AsyncLogger::Log(::spdlog::level::warn, __VA_ARGS__)
 
 #				if XENON_LOG_LEVEL > 3
-#					define XENON_LOG_INFORMATION(...)			::spdlog::info(__VA_ARGS__)
+#					define XENON_LOG_INFORMATION(...)			::Xenon::AsyncLogger::Log(::spdlog::level::info, __VA_ARGS__)
 
 #					if XENON_LOG_LEVEL > 4
 #						define XENON_LOG_TRACE(...)				XENON_TRACE_FUNCTION(__VA_ARGS__)
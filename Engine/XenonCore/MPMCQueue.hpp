@@ -0,0 +1,307 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <cstdint>
+
+namespace Xenon
+{
+	/**
+	 * Multiple producer multiple consumer queue class.
+	 * This is a bounded, lock-free ring buffer which any number of threads can push to and pop from. Each slot has a sequence number
+	 * which tells whether the slot is ready to be written to or read from for a given position (Dmitry Vyukov's bounded queue), so the
+	 * producers and consumers only contend on their own index.
+	 *
+	 * The blocking functions claim a position up front and park the calling thread on the slot's sequence number until the slot is
+	 * ready, instead of spinning. Each slot counts the threads parked on it, so that publishing a slot only pays for the notify when
+	 * someone is parked on it.
+	 *
+	 * @tparam Type The stored type.
+	 */
+	template<class Type>
+	class MPMCQueue final
+	{
+		/**
+		 * Slot structure.
+		 * Each slot is kept in it's own cache line so that neighbouring producers and consumers do not contend.
+		 */
+		struct alignas(64) Slot final
+		{
+			std::atomic_uint64_t m_Sequence = 0;
+			std::atomic_uint32_t m_WaiterCount = 0;
+			alignas(Type) std::byte m_Storage[sizeof(Type)];
+		};
+
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param capacity The minimum capacity of the queue. This is rounded up to the next power of 2.
+		 */
+		explicit MPMCQueue(uint64_t capacity)
+			: m_pSlots(std::make_unique<Slot[]>(std::bit_ceil(std::max<uint64_t>(capacity, 2))))
+			, m_Mask(std::bit_ceil(std::max<uint64_t>(capacity, 2)) - 1)
+		{
+			for (uint64_t i = 0; i <= m_Mask; i++)
+				m_pSlots[i].m_Sequence.store(i, std::memory_order_relaxed);
+		}
+
+		/**
+		 * Destructor.
+		 */
+		~MPMCQueue()
+		{
+			while (tryPop().has_value());
+		}
+
+		XENON_DISABLE_COPY(MPMCQueue);
+		XENON_DISABLE_MOVE(MPMCQueue);
+
+		/**
+		 * Try and construct a new entry at the end of the queue.
+		 *
+		 * @tparam Arguments The constructor argument types.
+		 * @param arguments The constructor arguments.
+		 * @return True if the entry was pushed.
+		 * @return False if the queue is full.
+		 */
+		template<class... Arguments>
+		XENON_NODISCARD bool tryEmplace(Arguments&&... arguments)
+		{
+			auto tail = m_Tail.load(std::memory_order_relaxed);
+			while (true)
+			{
+				auto& slot = m_pSlots[tail & m_Mask];
+				const auto sequence = slot.m_Sequence.load(std::memory_order_acquire);
+
+				// The slot is free for this position, try and claim it.
+				if (sequence == tail)
+				{
+					if (m_Tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+					{
+						construct(slot, tail, std::forward<Arguments>(arguments)...);
+						return true;
+					}
+				}
+
+				// The slot still has the entry from the previous lap, so the queue is full.
+				else if (sequence < tail)
+				{
+					return false;
+				}
+
+				// Someone else claimed the position.
+				else
+				{
+					tail = m_Tail.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/**
+		 * Try and push a new entry to the end of the queue.
+		 *
+		 * @param entry The entry to push.
+		 * @return True if the entry was pushed.
+		 * @return False if the queue is full.
+		 */
+		XENON_NODISCARD bool tryPush(Type&& entry) { return tryEmplace(std::move(entry)); }
+
+		/**
+		 * Try and push a new entry to the end of the queue.
+		 *
+		 * @param entry The entry to push.
+		 * @return True if the entry was pushed.
+		 * @return False if the queue is full.
+		 */
+		XENON_NODISCARD bool tryPush(const Type& entry) { return tryEmplace(entry); }
+
+		/**
+		 * Construct a new entry at the end of the queue.
+		 * This will block the calling thread until the claimed slot is free.
+		 *
+		 * @tparam Arguments The constructor argument types.
+		 * @param arguments The constructor arguments.
+		 */
+		template<class... Arguments>
+		void emplace(Arguments&&... arguments)
+		{
+			const auto tail = m_Tail.fetch_add(1, std::memory_order_relaxed);
+			auto& slot = m_pSlots[tail & m_Mask];
+
+			for (auto sequence = slot.m_Sequence.load(std::memory_order_acquire); sequence != tail; sequence = slot.m_Sequence.load(std::memory_order_acquire))
+				wait(slot, sequence);
+
+			construct(slot, tail, std::forward<Arguments>(arguments)...);
+		}
+
+		/**
+		 * Push a new entry to the end of the queue.
+		 * This will block the calling thread until the claimed slot is free.
+		 *
+		 * @param entry The entry to push.
+		 */
+		void push(Type&& entry) { emplace(std::move(entry)); }
+
+		/**
+		 * Push a new entry to the end of the queue.
+		 * This will block the calling thread until the claimed slot is free.
+		 *
+		 * @param entry The entry to push.
+		 */
+		void push(const Type& entry) { emplace(entry); }
+
+		/**
+		 * Try and pop the entry at the front of the queue.
+		 *
+		 * @return The entry if the queue was not empty.
+		 */
+		XENON_NODISCARD std::optional<Type> tryPop()
+		{
+			auto head = m_Head.load(std::memory_order_relaxed);
+			while (true)
+			{
+				auto& slot = m_pSlots[head & m_Mask];
+				const auto sequence = slot.m_Sequence.load(std::memory_order_acquire);
+
+				// The slot contains the entry for this position, try and claim it.
+				if (sequence == head + 1)
+				{
+					if (m_Head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed))
+						return take(slot, head);
+				}
+
+				// The entry has not been written yet, so the queue is empty.
+				else if (sequence < head + 1)
+				{
+					return std::nullopt;
+				}
+
+				// Someone else claimed the position.
+				else
+				{
+					head = m_Head.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/**
+		 * Pop the entry at the front of the queue.
+		 * This will block the calling thread until the claimed slot has an entry.
+		 *
+		 * @return The entry.
+		 */
+		XENON_NODISCARD Type pop()
+		{
+			const auto head = m_Head.fetch_add(1, std::memory_order_relaxed);
+			auto& slot = m_pSlots[head & m_Mask];
+
+			for (auto sequence = slot.m_Sequence.load(std::memory_order_acquire); sequence != head + 1; sequence = slot.m_Sequence.load(std::memory_order_acquire))
+				wait(slot, sequence);
+
+			return take(slot, head);
+		}
+
+		/**
+		 * Get the approximate number of entries in the queue.
+		 * Note that the result might be outdated by the time it's used. Blocked consumers count as negative entries, so the result is
+		 * clamped to 0.
+		 *
+		 * @return The entry count.
+		 */
+		XENON_NODISCARD uint64_t getSize() const noexcept
+		{
+			const auto head = m_Head.load(std::memory_order_relaxed);
+			const auto tail = m_Tail.load(std::memory_order_relaxed);
+			return tail > head ? tail - head : 0;
+		}
+
+		/**
+		 * Get the capacity of the queue.
+		 *
+		 * @return The capacity.
+		 */
+		XENON_NODISCARD uint64_t getCapacity() const noexcept { return m_Mask + 1; }
+
+	private:
+		/**
+		 * Construct an entry in a claimed slot and publish it to the consumers.
+		 *
+		 * @tparam Arguments The constructor argument types.
+		 * @param slot The slot to construct in.
+		 * @param tail The claimed position.
+		 * @param arguments The constructor arguments.
+		 */
+		template<class... Arguments>
+		void construct(Slot& slot, uint64_t tail, Arguments&&... arguments)
+		{
+			new(slot.m_Storage) Type(std::forward<Arguments>(arguments)...);
+			publish(slot, tail + 1);
+		}
+
+		/**
+		 * Move the entry out of a claimed slot and release the slot to the producer of the next lap.
+		 *
+		 * @param slot The slot to take from.
+		 * @param head The claimed position.
+		 * @return The entry.
+		 */
+		XENON_NODISCARD Type take(Slot& slot, uint64_t head)
+		{
+			auto pEntry = std::launder(reinterpret_cast<Type*>(slot.m_Storage));
+			auto entry = std::move(*pEntry);
+			pEntry->~Type();
+
+			publish(slot, head + m_Mask + 1);
+
+			return entry;
+		}
+
+		/**
+		 * Park the calling thread until a slot's sequence number changes from a value.
+		 * The thread is counted as waiting on the slot before the sequence number is checked (both sequentially consistent), so that the
+		 * thread which updates it either sees the count and notifies, or this sees the new sequence number and does not wait.
+		 *
+		 * @param slot The slot to wait on.
+		 * @param sequence The sequence number to wait for the slot to change from.
+		 */
+		static void wait(Slot& slot, uint64_t sequence)
+		{
+			slot.m_WaiterCount.fetch_add(1, std::memory_order_seq_cst);
+
+			if (slot.m_Sequence.load(std::memory_order_seq_cst) == sequence)
+				slot.m_Sequence.wait(sequence, std::memory_order_acquire);
+
+			slot.m_WaiterCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		/**
+		 * Update a slot's sequence number and wake up the threads waiting on it, if any thread is waiting.
+		 * The slot is not updated again until the thread which claimed it's new position takes it, so a parked thread which takes a while
+		 * to wake up does not cause more than a notify or two.
+		 *
+		 * @param slot The slot to update.
+		 * @param sequence The new sequence number.
+		 */
+		static void publish(Slot& slot, uint64_t sequence)
+		{
+			slot.m_Sequence.store(sequence, std::memory_order_seq_cst);
+
+			if (slot.m_WaiterCount.load(std::memory_order_seq_cst) > 0)
+				slot.m_Sequence.notify_all();
+		}
+
+	private:
+		std::unique_ptr<Slot[]> m_pSlots;
+		const uint64_t m_Mask;
+
+		alignas(64) std::atomic_uint64_t m_Head = 0;
+		alignas(64) std::atomic_uint64_t m_Tail = 0;
+	};
+}
@@ -0,0 +1,162 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "MappedFile.hpp"
+#include "Logging.hpp"
+
+#include <utility>
+
+#ifdef XENON_PLATFORM_WINDOWS
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+
+#endif
+
+#define NOMINMAX
+
+#include <Windows.h>
+
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#endif
+
+namespace Xenon
+{
+	MappedFile::MappedFile(const std::filesystem::path& file)
+	{
+#ifdef XENON_PLATFORM_WINDOWS
+		const auto fileHandle = CreateFileW(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			XENON_LOG_ERROR("Failed to open the file {} to map!", file.string());
+			return;
+		}
+
+		LARGE_INTEGER fileSize = {};
+		if (!GetFileSizeEx(fileHandle, &fileSize))
+		{
+			XENON_LOG_ERROR("Failed to get the size of the file {}!", file.string());
+			CloseHandle(fileHandle);
+			return;
+		}
+
+		// Empty files can't be mapped, but they are still valid files.
+		if (fileSize.QuadPart == 0)
+		{
+			CloseHandle(fileHandle);
+			m_IsValid = true;
+			return;
+		}
+
+		// The view keeps the mapping alive, so the handles can be closed right away.
+		const auto mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(fileHandle);
+
+		if (mappingHandle == nullptr)
+		{
+			XENON_LOG_ERROR("Failed to create the file mapping for the file {}!", file.string());
+			return;
+		}
+
+		const auto pView = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mappingHandle);
+
+		if (pView == nullptr)
+		{
+			XENON_LOG_ERROR("Failed to map the file {}!", file.string());
+			return;
+		}
+
+		m_pData = static_cast<const std::byte*>(pView);
+		m_Size = static_cast<uint64_t>(fileSize.QuadPart);
+
+#else
+		const auto fileDescriptor = open(file.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fileDescriptor == -1)
+		{
+			XENON_LOG_ERROR("Failed to open the file {} to map!", file.string());
+			return;
+		}
+
+		struct stat fileStatus = {};
+		if (fstat(fileDescriptor, &fileStatus) == -1)
+		{
+			XENON_LOG_ERROR("Failed to get the size of the file {}!", file.string());
+			close(fileDescriptor);
+			return;
+		}
+
+		// Empty files can't be mapped, but they are still valid files.
+		if (fileStatus.st_size == 0)
+		{
+			close(fileDescriptor);
+			m_IsValid = true;
+			return;
+		}
+
+		// The mapping stays valid after the file is closed.
+		const auto pView = mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+		close(fileDescriptor);
+
+		if (pView == MAP_FAILED)
+		{
+			XENON_LOG_ERROR("Failed to map the file {}!", file.string());
+			return;
+		}
+
+		m_pData = static_cast<const std::byte*>(pView);
+		m_Size = static_cast<uint64_t>(fileStatus.st_size);
+
+#endif
+
+		m_IsValid = true;
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept
+		: m_pData(std::exchange(other.m_pData, nullptr))
+		, m_Size(std::exchange(other.m_Size, 0))
+		, m_IsValid(std::exchange(other.m_IsValid, false))
+	{
+	}
+
+	MappedFile::~MappedFile()
+	{
+		unmap();
+	}
+
+	Xenon::MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			unmap();
+
+			m_pData = std::exchange(other.m_pData, nullptr);
+			m_Size = std::exchange(other.m_Size, 0);
+			m_IsValid = std::exchange(other.m_IsValid, false);
+		}
+
+		return *this;
+	}
+
+	void MappedFile::unmap() noexcept
+	{
+		if (m_pData)
+		{
+#ifdef XENON_PLATFORM_WINDOWS
+			UnmapViewOfFile(m_pData);
+
+#else
+			munmap(const_cast<std::byte*>(m_pData), m_Size);
+
+#endif
+		}
+
+		m_pData = nullptr;
+		m_Size = 0;
+		m_IsValid = false;
+	}
+}
@@ -0,0 +1,98 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <span>
+#include <filesystem>
+
+namespace Xenon
+{
+	/**
+	 * Mapped file class.
+	 * This maps a whole file to memory for reading. The operating system pages the contents in as they are accessed, so large files can be
+	 * read without allocating a buffer and copying the whole file into it.
+	 */
+	class MappedFile final
+	{
+	public:
+		/**
+		 * Default constructor.
+		 */
+		MappedFile() = default;
+
+		/**
+		 * Explicit constructor.
+		 * If the file could not be mapped, an error is logged and the object will be invalid.
+		 *
+		 * @param file The file to map.
+		 */
+		explicit MappedFile(const std::filesystem::path& file);
+
+		/**
+		 * Move constructor.
+		 *
+		 * @param other The other mapped file.
+		 */
+		MappedFile(MappedFile&& other) noexcept;
+
+		/**
+		 * Destructor.
+		 */
+		~MappedFile();
+
+		XENON_DISABLE_COPY(MappedFile);
+
+		/**
+		 * Check if the file was mapped successfully.
+		 * Note that an empty file is valid, but it's data pointer will be nullptr.
+		 *
+		 * @return True if the file is mapped.
+		 * @return False if the file is not mapped.
+		 */
+		XENON_NODISCARD bool isValid() const noexcept { return m_IsValid; }
+
+		/**
+		 * Get the mapped data.
+		 *
+		 * @return The data pointer.
+		 */
+		XENON_NODISCARD const std::byte* getData() const noexcept { return m_pData; }
+
+		/**
+		 * Get the size of the mapped file.
+		 *
+		 * @return The size in bytes.
+		 */
+		XENON_NODISCARD uint64_t getSize() const noexcept { return m_Size; }
+
+		/**
+		 * Get the mapped bytes.
+		 *
+		 * @return The bytes.
+		 */
+		XENON_NODISCARD std::span<const std::byte> getBytes() const noexcept { return std::span<const std::byte>(m_pData, m_Size); }
+
+		/**
+		 * Move assignment operator.
+		 *
+		 * @param other The other mapped file.
+		 * @return The mapped file reference.
+		 */
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+	private:
+		/**
+		 * Unmap the file if it's mapped.
+		 */
+		void unmap() noexcept;
+
+	private:
+		const std::byte* m_pData = nullptr;
+		uint64_t m_Size = 0;
+
+		bool m_IsValid = false;
+	};
+}
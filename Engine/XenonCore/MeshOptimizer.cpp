@@ -0,0 +1,842 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "MeshOptimizer.hpp"
+#include "FlatHashMap.hpp"
+
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+#include <string_view>
+
+namespace /* anonymous */
+{
+	/**
+	 * The size of the cache used to score the vertices.
+	 */
+	constexpr uint32_t ScoringCacheSize = 32;
+
+	/**
+	 * The maximum valence with a precomputed score. Vertices with a larger valence use the last score.
+	 */
+	constexpr uint32_t ScoringMaxValence = 32;
+
+	/**
+	 * Invalid index value.
+	 */
+	constexpr uint32_t InvalidIndex = ~0u;
+
+	/**
+	 * Vertex score table structure.
+	 * The scores only depend on the cache position and the remaining valence, so they are precomputed once.
+	 */
+	struct VertexScoreTable final
+	{
+		/**
+		 * Default constructor.
+		 */
+		VertexScoreTable()
+		{
+			constexpr float cacheDecayPower = 1.5f;
+			constexpr float lastTriangleScore = 0.75f;
+			constexpr float valenceBoostScale = 2.0f;
+			constexpr float valenceBoostPower = 0.5f;
+
+			// The vertices of the last triangle get a fixed score, so that the next triangle does not depend on the order in which they
+			// were added.
+			for (uint32_t i = 0; i < ScoringCacheSize; i++)
+			{
+				if (i < 3)
+					m_CacheScores[i] = lastTriangleScore;
+
+				else
+					m_CacheScores[i] = std::pow(1.0f - static_cast<float>(i - 3) / static_cast<float>(ScoringCacheSize - 3), cacheDecayPower);
+			}
+
+			// Vertices with only a few triangles left are boosted, so that lone triangles do not get left behind.
+			m_ValenceScores[0] = 0.0f;
+			for (uint32_t i = 1; i <= ScoringMaxValence; i++)
+				m_ValenceScores[i] = valenceBoostScale * std::pow(static_cast<float>(i), -valenceBoostPower);
+		}
+
+		/**
+		 * Get the score of a vertex.
+		 *
+		 * @param cachePosition The position of the vertex in the cache. This is -1 if the vertex is not in the cache.
+		 * @param valence The number of triangles which are not yet emitted using the vertex.
+		 * @return The vertex score.
+		 */
+		XENON_NODISCARD float getScore(int32_t cachePosition, uint32_t valence) const noexcept
+		{
+			// Vertices without any triangles left do not contribute to any triangle's score.
+			if (valence == 0)
+				return 0.0f;
+
+			const auto cacheScore = cachePosition < 0 ? 0.0f : m_CacheScores[cachePosition];
+			return cacheScore + m_ValenceScores[std::min(valence, ScoringMaxValence)];
+		}
+
+		float m_CacheScores[ScoringCacheSize] = {};
+		float m_ValenceScores[ScoringMaxValence + 1] = {};
+	};
+
+	/**
+	 * Triangle adjacency structure.
+	 * This stores the triangles which use each vertex, and supports removing the triangles which are already processed.
+	 */
+	struct TriangleAdjacency final
+	{
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param indices The triangle list indices.
+		 * @param vertexCount The number of vertices.
+		 */
+		explicit TriangleAdjacency(std::span<const uint32_t> indices, uint64_t vertexCount) : m_Offsets(vertexCount + 1, 0), m_Valences(vertexCount, 0), m_Triangles(indices.size())
+		{
+			for (const auto index : indices)
+				m_Valences[index]++;
+
+			std::inclusive_scan(m_Valences.begin(), m_Valences.end(), m_Offsets.begin() + 1);
+
+			std::vector<uint32_t> fill(m_Offsets.begin(), m_Offsets.end() - 1);
+			for (uint64_t i = 0; i < indices.size(); i++)
+				m_Triangles[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+		}
+
+		/**
+		 * Get the triangles which use a vertex and are not removed.
+		 *
+		 * @param vertex The vertex index.
+		 * @return The triangles.
+		 */
+		XENON_NODISCARD std::span<const uint32_t> getTriangles(uint32_t vertex) const noexcept
+		{
+			return std::span<const uint32_t>(m_Triangles.data() + m_Offsets[vertex], m_Valences[vertex]);
+		}
+
+		/**
+		 * Remove a triangle from the adjacency of it's vertices.
+		 *
+		 * @param triangle The triangle index.
+		 * @param vertices The vertices of the triangle.
+		 */
+		void remove(uint32_t triangle, const uint32_t(&vertices)[3]) noexcept
+		{
+			for (const auto vertex : vertices)
+			{
+				const auto begin = m_Triangles.begin() + m_Offsets[vertex];
+				const auto end = begin + m_Valences[vertex];
+				const auto itr = std::find(begin, end, triangle);
+
+				// Degenerate triangles reference the same vertex more than once, so it might already be removed.
+				if (itr != end)
+				{
+					std::iter_swap(itr, end - 1);
+					m_Valences[vertex]--;
+				}
+			}
+		}
+
+		std::vector<uint32_t> m_Offsets;
+		std::vector<uint32_t> m_Valences;
+		std::vector<uint32_t> m_Triangles;
+	};
+
+	/**
+	 * Vector 3 structure.
+	 */
+	struct Vector3 final
+	{
+		float x = 0.0f;
+		float y = 0.0f;
+		float z = 0.0f;
+
+		XENON_NODISCARD Vector3 operator+(const Vector3& other) const noexcept { return Vector3{ x + other.x, y + other.y, z + other.z }; }
+		XENON_NODISCARD Vector3 operator-(const Vector3& other) const noexcept { return Vector3{ x - other.x, y - other.y, z - other.z }; }
+		XENON_NODISCARD Vector3 operator*(float scale) const noexcept { return Vector3{ x * scale, y * scale, z * scale }; }
+	};
+
+	/**
+	 * Get the cross product of two vectors.
+	 *
+	 * @param lhs The left hand side argument.
+	 * @param rhs The right hand side argument.
+	 * @return The cross product.
+	 */
+	XENON_NODISCARD Vector3 Cross(const Vector3& lhs, const Vector3& rhs) noexcept
+	{
+		return Vector3{ lhs.y * rhs.z - lhs.z * rhs.y, lhs.z * rhs.x - lhs.x * rhs.z, lhs.x * rhs.y - lhs.y * rhs.x };
+	}
+
+	/**
+	 * Get the dot product of two vectors.
+	 *
+	 * @param lhs The left hand side argument.
+	 * @param rhs The right hand side argument.
+	 * @return The dot product.
+	 */
+	XENON_NODISCARD float Dot(const Vector3& lhs, const Vector3& rhs) noexcept
+	{
+		return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+	}
+
+	/**
+	 * Read a vertex position.
+	 *
+	 * @param pPositions The first position.
+	 * @param vertexStride The distance between two positions in bytes.
+	 * @param index The vertex index.
+	 * @return The position.
+	 */
+	XENON_NODISCARD Vector3 ReadPosition(const std::byte* pPositions, uint64_t vertexStride, uint32_t index) noexcept
+	{
+		Vector3 position;
+		std::memcpy(&position, pPositions + index * vertexStride, sizeof(Vector3));
+
+		return position;
+	}
+
+	/**
+	 * FIFO vertex cache structure.
+	 * A vertex is in the cache if less than cache size vertices were added after it.
+	 */
+	struct VertexCache final
+	{
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param vertexCount The number of vertices.
+		 * @param cacheSize The cache size.
+		 */
+		explicit VertexCache(uint64_t vertexCount, uint32_t cacheSize) : m_Timestamps(vertexCount, 0), m_Timestamp(cacheSize + 1), m_CacheSize(cacheSize) {}
+
+		/**
+		 * Access a vertex.
+		 *
+		 * @param index The vertex index.
+		 * @return True if the vertex had to be transformed.
+		 * @return False if the vertex was in the cache.
+		 */
+		bool access(uint32_t index) noexcept
+		{
+			if (m_Timestamp - m_Timestamps[index] > m_CacheSize)
+			{
+				m_Timestamps[index] = m_Timestamp++;
+				return true;
+			}
+
+			return false;
+		}
+
+		/**
+		 * Evict all the vertices from the cache.
+		 */
+		void flush() noexcept { m_Timestamp += m_CacheSize + 1; }
+
+		std::vector<uint64_t> m_Timestamps;
+		uint64_t m_Timestamp = 0;
+		uint32_t m_CacheSize = 0;
+	};
+
+	/**
+	 * Get the vertex cache clusters of a triangle list.
+	 * Hard boundaries are placed where the cache is cold (all the vertices of a triangle miss), and soft boundaries are placed inside
+	 * the hard clusters where the cluster's miss ratio is good enough to start over with a cold cache.
+	 *
+	 * @param indices The triangle list indices.
+	 * @param vertexCount The number of vertices.
+	 * @param threshold The allowed vertex cache degradation.
+	 * @return The first triangle of each cluster.
+	 */
+	XENON_NODISCARD std::vector<uint64_t> GetClusters(std::span<const uint32_t> indices, uint64_t vertexCount, float threshold)
+	{
+		const auto triangleCount = indices.size() / 3;
+
+		// Get the hard boundaries.
+		std::vector<uint64_t> hardClusters;
+		auto cache = VertexCache(vertexCount, Xenon::VertexCacheSize);
+		for (uint64_t i = 0; i < triangleCount; i++)
+		{
+			const auto misses = cache.access(indices[i * 3]) + cache.access(indices[i * 3 + 1]) + cache.access(indices[i * 3 + 2]);
+			if (misses == 3)
+				hardClusters.emplace_back(i);
+		}
+
+		if (hardClusters.empty() || hardClusters.front() != 0)
+			hardClusters.insert(hardClusters.begin(), 0);
+
+		// Split the hard clusters.
+		std::vector<uint64_t> clusters;
+		for (uint64_t i = 0; i < hardClusters.size(); i++)
+		{
+			const auto begin = hardClusters[i];
+			const auto end = i + 1 < hardClusters.size() ? hardClusters[i + 1] : triangleCount;
+
+			// Get the cluster's miss ratio when it's rendered with a cold cache.
+			uint64_t clusterMisses = 0;
+			cache.flush();
+			for (auto triangle = begin; triangle < end; triangle++)
+				clusterMisses += cache.access(indices[triangle * 3]) + cache.access(indices[triangle * 3 + 1]) + cache.access(indices[triangle * 3 + 2]);
+
+			const auto clusterThreshold = threshold * static_cast<float>(clusterMisses) / static_cast<float>(end - begin);
+
+			// Start a new cluster every time the current one is good enough.
+			auto clusterBegin = begin;
+			uint64_t misses = 0;
+			cache.flush();
+			for (auto triangle = begin; triangle < end; triangle++)
+			{
+				misses += cache.access(indices[triangle * 3]) + cache.access(indices[triangle * 3 + 1]) + cache.access(indices[triangle * 3 + 2]);
+				if (static_cast<float>(misses) / static_cast<float>(triangle - clusterBegin + 1) <= clusterThreshold)
+				{
+					clusters.emplace_back(clusterBegin);
+					clusterBegin = triangle + 1;
+					misses = 0;
+					cache.flush();
+				}
+			}
+
+			if (clusterBegin < end)
+				clusters.emplace_back(clusterBegin);
+		}
+
+		return clusters;
+	}
+
+	/**
+	 * Compute the bounds of a meshlet.
+	 *
+	 * @param meshlet The meshlet to set the bounds of.
+	 * @param indices The meshlet's indices.
+	 * @param pPositions The first vertex position.
+	 * @param vertexStride The distance between two positions in bytes.
+	 */
+	void ComputeMeshletBounds(Xenon::Meshlet& meshlet, std::span<const uint32_t> indices, const std::byte* pPositions, uint64_t vertexStride) noexcept
+	{
+		// Get the bounding box.
+		auto minimum = ReadPosition(pPositions, vertexStride, indices.front());
+		auto maximum = minimum;
+
+		for (const auto index : indices)
+		{
+			const auto position = ReadPosition(pPositions, vertexStride, index);
+			minimum = Vector3{ std::min(minimum.x, position.x), std::min(minimum.y, position.y), std::min(minimum.z, position.z) };
+			maximum = Vector3{ std::max(maximum.x, position.x), std::max(maximum.y, position.y), std::max(maximum.z, position.z) };
+		}
+
+		// The bounding sphere is centered on the bounding box.
+		const auto center = (minimum + maximum) * 0.5f;
+		float radiusSquared = 0.0f;
+		for (const auto index : indices)
+		{
+			const auto offset = ReadPosition(pPositions, vertexStride, index) - center;
+			radiusSquared = std::max(radiusSquared, Dot(offset, offset));
+		}
+
+		meshlet.m_Center = { center.x, center.y, center.z };
+		meshlet.m_Radius = std::sqrt(radiusSquared);
+		meshlet.m_Minimum = { minimum.x, minimum.y, minimum.z };
+		meshlet.m_Maximum = { maximum.x, maximum.y, maximum.z };
+
+		// The cone axis is the average of the triangle normals. Degenerate triangles don't have a facing, so they are skipped.
+		const auto triangleCount = indices.size() / 3;
+		std::vector<Vector3> normals;
+		normals.reserve(triangleCount);
+
+		Vector3 axis;
+		for (uint64_t i = 0; i < triangleCount; i++)
+		{
+			const auto p0 = ReadPosition(pPositions, vertexStride, indices[i * 3]);
+			const auto normal = Cross(ReadPosition(pPositions, vertexStride, indices[i * 3 + 1]) - p0, ReadPosition(pPositions, vertexStride, indices[i * 3 + 2]) - p0);
+			const auto length = std::sqrt(Dot(normal, normal));
+
+			if (length > 0.0f)
+			{
+				normals.emplace_back(normal * (1.0f / length));
+				axis = axis + normals.back();
+			}
+		}
+
+		meshlet.m_ConeApex = meshlet.m_Center;
+		meshlet.m_ConeCutoff = 1.0f;
+
+		const auto axisLength = std::sqrt(Dot(axis, axis));
+		if (axisLength == 0.0f)
+			return;
+
+		axis = axis * (1.0f / axisLength);
+		meshlet.m_ConeAxis = { axis.x, axis.y, axis.z };
+
+		// The cone's spread is the widest angle between the axis and a normal. Cones which are (almost) wider than a hemisphere can't
+		// cull anything, so they are left disabled.
+		float minimumDot = 1.0f;
+		for (const auto& normal : normals)
+			minimumDot = std::min(minimumDot, Dot(normal, axis));
+
+		if (minimumDot <= 0.1f)
+			return;
+
+		// The apex is moved back along the axis until it's behind all the triangle planes, so the test is conservative for the whole
+		// meshlet and not just for it's center.
+		float apexDistance = 0.0f;
+		for (uint64_t i = 0, j = 0; i < triangleCount; i++)
+		{
+			const auto p0 = ReadPosition(pPositions, vertexStride, indices[i * 3]);
+			const auto normal = Cross(ReadPosition(pPositions, vertexStride, indices[i * 3 + 1]) - p0, ReadPosition(pPositions, vertexStride, indices[i * 3 + 2]) - p0);
+			if (Dot(normal, normal) == 0.0f)
+				continue;
+
+			const auto& unitNormal = normals[j++];
+			apexDistance = std::max(apexDistance, Dot(center - p0, unitNormal) / Dot(axis, unitNormal));
+		}
+
+		const auto apex = center - axis * apexDistance;
+		meshlet.m_ConeApex = { apex.x, apex.y, apex.z };
+		meshlet.m_ConeCutoff = std::sqrt(1.0f - minimumDot * minimumDot);
+	}
+}
+
+namespace Xenon
+{
+	VertexCacheStatistics AnalyzeVertexCache(std::span<const uint32_t> indices, uint64_t vertexCount, uint32_t cacheSize /*= VertexCacheSize*/)
+	{
+		VertexCacheStatistics statistics;
+		if (indices.size() < 3)
+			return statistics;
+
+		auto cache = VertexCache(vertexCount, cacheSize);
+		std::vector<bool> referenced(vertexCount);
+		uint64_t referencedCount = 0;
+
+		for (const auto index : indices)
+		{
+			statistics.m_TransformedVertexCount += cache.access(index);
+
+			if (!referenced[index])
+			{
+				referenced[index] = true;
+				referencedCount++;
+			}
+		}
+
+		statistics.m_ACMR = static_cast<float>(statistics.m_TransformedVertexCount) / static_cast<float>(indices.size() / 3);
+		statistics.m_ATVR = static_cast<float>(statistics.m_TransformedVertexCount) / static_cast<float>(referencedCount);
+
+		return statistics;
+	}
+
+	uint64_t GenerateVertexRemap(std::span<uint32_t> remap, const std::byte* pVertices, uint64_t vertexCount, uint64_t vertexStride)
+	{
+		// The vertex bytes are used as the key, so identical vertices end up in the same entry.
+		auto uniqueVertices = FlatHashMap<std::string_view, uint32_t>(vertexCount);
+		uint32_t uniqueCount = 0;
+
+		for (uint64_t i = 0; i < vertexCount; i++)
+		{
+			const auto vertex = std::string_view(XENON_BIT_CAST(const char*, pVertices + i * vertexStride), vertexStride);
+			const auto [itr, inserted] = uniqueVertices.try_emplace(vertex, uniqueCount);
+			if (inserted)
+				uniqueCount++;
+
+			remap[i] = itr->second;
+		}
+
+		return uniqueCount;
+	}
+
+	void RemapVertices(std::byte* pDestination, const std::byte* pVertices, uint64_t vertexStride, std::span<const uint32_t> remap) noexcept
+	{
+		for (uint64_t i = 0; i < remap.size(); i++)
+		{
+			if (remap[i] != InvalidIndex)
+				std::memcpy(pDestination + remap[i] * vertexStride, pVertices + i * vertexStride, vertexStride);
+		}
+	}
+
+	void RemapIndices(std::span<uint32_t> indices, std::span<const uint32_t> remap) noexcept
+	{
+		for (auto& index : indices)
+			index = remap[index];
+	}
+
+	void OptimizeVertexCache(std::span<uint32_t> indices, uint64_t vertexCount)
+	{
+		static const auto scoreTable = VertexScoreTable();
+
+		const auto triangleCount = indices.size() / 3;
+		if (triangleCount < 2)
+			return;
+
+		auto adjacency = TriangleAdjacency(indices, vertexCount);
+
+		// Compute the initial scores.
+		std::vector<int32_t> cachePositions(vertexCount, -1);
+		std::vector<float> vertexScores(vertexCount);
+		for (uint64_t i = 0; i < vertexCount; i++)
+			vertexScores[i] = scoreTable.getScore(-1, adjacency.m_Valences[i]);
+
+		std::vector<float> triangleScores(triangleCount);
+		for (uint64_t i = 0; i < triangleCount; i++)
+			triangleScores[i] = vertexScores[indices[i * 3]] + vertexScores[indices[i * 3 + 1]] + vertexScores[indices[i * 3 + 2]];
+
+		std::vector<bool> emitted(triangleCount, false);
+		std::vector<uint32_t> output;
+		output.reserve(indices.size());
+
+		// The cache has room for the vertices of the new triangle, which push the others out.
+		uint32_t cache[ScoringCacheSize + 3] = {};
+		uint32_t newCache[ScoringCacheSize + 3] = {};
+		uint32_t cacheCount = 0;
+
+		auto bestTriangle = static_cast<uint32_t>(std::max_element(triangleScores.begin(), triangleScores.end()) - triangleScores.begin());
+		uint64_t inputCursor = 0;
+
+		while (output.size() < indices.size())
+		{
+			// If there are no candidates in the cache, continue with the next triangle in the input order.
+			if (bestTriangle == InvalidIndex)
+			{
+				while (emitted[inputCursor])
+					inputCursor++;
+
+				bestTriangle = static_cast<uint32_t>(inputCursor);
+			}
+
+			// Emit the triangle.
+			const uint32_t triangle[3] = { indices[bestTriangle * 3], indices[bestTriangle * 3 + 1], indices[bestTriangle * 3 + 2] };
+			output.insert(output.end(), std::begin(triangle), std::end(triangle));
+			emitted[bestTriangle] = true;
+
+			// Remove the triangle from the adjacency of it's vertices.
+			adjacency.remove(bestTriangle, triangle);
+
+			// Add the triangle's vertices to the front of the cache.
+			uint32_t newCacheCount = 0;
+			for (const auto vertex : triangle)
+			{
+				if (std::find(newCache, newCache + newCacheCount, vertex) == newCache + newCacheCount)
+					newCache[newCacheCount++] = vertex;
+			}
+
+			for (uint32_t i = 0; i < cacheCount; i++)
+			{
+				const auto vertex = cache[i];
+				if (std::find(newCache, newCache + newCacheCount, vertex) == newCache + newCacheCount)
+					newCache[newCacheCount++] = vertex;
+			}
+
+			// Update the scores of the vertices which moved in the cache, including the ones that got pushed out.
+			bestTriangle = InvalidIndex;
+			float bestScore = -1.0f;
+
+			for (uint32_t i = 0; i < newCacheCount; i++)
+			{
+				const auto vertex = newCache[i];
+				const auto position = i < ScoringCacheSize ? static_cast<int32_t>(i) : -1;
+				cachePositions[vertex] = position;
+
+				const auto score = scoreTable.getScore(position, adjacency.m_Valences[vertex]);
+				const auto difference = score - vertexScores[vertex];
+				vertexScores[vertex] = score;
+
+				for (const auto adjacent : adjacency.getTriangles(vertex))
+				{
+					triangleScores[adjacent] += difference;
+
+					if (position >= 0 && triangleScores[adjacent] > bestScore)
+					{
+						bestScore = triangleScores[adjacent];
+						bestTriangle = adjacent;
+					}
+				}
+			}
+
+			cacheCount = std::min(newCacheCount, ScoringCacheSize);
+			std::copy_n(newCache, cacheCount, cache);
+		}
+
+		std::copy(output.begin(), output.end(), indices.begin());
+	}
+
+	void OptimizeOverdraw(std::span<uint32_t> indices, const std::byte* pPositions, uint64_t vertexCount, uint64_t vertexStride, float threshold /*= 1.05f*/)
+	{
+		const auto triangleCount = indices.size() / 3;
+		if (triangleCount < 2)
+			return;
+
+		const auto clusters = GetClusters(indices, vertexCount, threshold);
+		if (clusters.size() < 2)
+			return;
+
+		// Get the mesh centroid.
+		Vector3 meshCentroid;
+		for (uint64_t i = 0; i < vertexCount; i++)
+			meshCentroid = meshCentroid + ReadPosition(pPositions, vertexStride, static_cast<uint32_t>(i));
+
+		meshCentroid = meshCentroid * (1.0f / static_cast<float>(vertexCount));
+
+		// Clusters which face away from the mesh centroid are likely to occlude the others, so they get drawn first.
+		std::vector<float> sortKeys(clusters.size());
+		for (uint64_t i = 0; i < clusters.size(); i++)
+		{
+			const auto begin = clusters[i];
+			const auto end = i + 1 < clusters.size() ? clusters[i + 1] : triangleCount;
+
+			Vector3 centroid;
+			Vector3 normal;
+			float area = 0.0f;
+
+			for (auto triangle = begin; triangle < end; triangle++)
+			{
+				const auto p0 = ReadPosition(pPositions, vertexStride, indices[triangle * 3]);
+				const auto p1 = ReadPosition(pPositions, vertexStride, indices[triangle * 3 + 1]);
+				const auto p2 = ReadPosition(pPositions, vertexStride, indices[triangle * 3 + 2]);
+
+				const auto triangleNormal = Cross(p1 - p0, p2 - p0);
+				const auto triangleArea = std::sqrt(Dot(triangleNormal, triangleNormal));
+
+				centroid = centroid + (p0 + p1 + p2) * (triangleArea / 3.0f);
+				normal = normal + triangleNormal;
+				area += triangleArea;
+			}
+
+			const auto normalLength = std::sqrt(Dot(normal, normal));
+			if (area > 0.0f && normalLength > 0.0f)
+				sortKeys[i] = Dot(centroid * (1.0f / area) - meshCentroid, normal * (1.0f / normalLength));
+		}
+
+		std::vector<uint64_t> order(clusters.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(order.begin(), order.end(), [&sortKeys](uint64_t lhs, uint64_t rhs) { return sortKeys[lhs] > sortKeys[rhs]; });
+
+		// Write the clusters in the sorted order.
+		std::vector<uint32_t> output;
+		output.reserve(indices.size());
+
+		for (const auto cluster : order)
+		{
+			const auto begin = clusters[cluster];
+			const auto end = cluster + 1 < clusters.size() ? clusters[cluster + 1] : triangleCount;
+
+			output.insert(output.end(), indices.begin() + begin * 3, indices.begin() + end * 3);
+		}
+
+		std::copy(output.begin(), output.end(), indices.begin());
+	}
+
+	uint64_t OptimizeVertexFetch(std::byte* pVertices, uint64_t vertexCount, uint64_t vertexStride, std::span<uint32_t> indices)
+	{
+		// Number the vertices in the order they are first used.
+		std::vector<uint32_t> remap(vertexCount, InvalidIndex);
+		uint32_t nextVertex = 0;
+
+		for (auto& index : indices)
+		{
+			if (remap[index] == InvalidIndex)
+				remap[index] = nextVertex++;
+
+			index = remap[index];
+		}
+
+		auto vertices = std::vector<std::byte>(nextVertex * vertexStride);
+		RemapVertices(vertices.data(), pVertices, vertexStride, remap);
+		std::copy(vertices.begin(), vertices.end(), pVertices);
+
+		return nextVertex;
+	}
+
+	uint64_t OptimizeMesh(std::byte* pVertices, uint64_t vertexCount, uint64_t vertexStride, std::span<uint32_t> indices, int64_t positionOffset)
+	{
+		// Skip meshes which are not valid triangle lists.
+		if (indices.size() % 3 != 0 || vertexCount > InvalidIndex || std::ranges::any_of(indices, [vertexCount](uint32_t index) { return index >= vertexCount; }))
+			return vertexCount;
+
+		// Weld the identical vertices.
+		std::vector<uint32_t> remap(vertexCount);
+		const auto uniqueCount = GenerateVertexRemap(remap, pVertices, vertexCount, vertexStride);
+		if (uniqueCount < vertexCount)
+		{
+			auto vertices = std::vector<std::byte>(uniqueCount * vertexStride);
+			RemapVertices(vertices.data(), pVertices, vertexStride, remap);
+			std::copy(vertices.begin(), vertices.end(), pVertices);
+
+			RemapIndices(indices, remap);
+			vertexCount = uniqueCount;
+		}
+
+		// Reorder the triangles and then the vertices.
+		OptimizeVertexCache(indices, vertexCount);
+
+		if (positionOffset >= 0)
+			OptimizeOverdraw(indices, pVertices + positionOffset, vertexCount, vertexStride);
+
+		return OptimizeVertexFetch(pVertices, vertexCount, vertexStride, indices);
+	}
+
+	uint64_t BuildMeshlets(
+		std::vector<Meshlet>& meshlets,
+		std::span<uint32_t> indices,
+		const std::byte* pPositions,
+		uint64_t vertexCount,
+		uint64_t vertexStride,
+		uint32_t maxVertices /*= MaxMeshletVertices*/,
+		uint32_t maxTriangles /*= MaxMeshletTriangles*/)
+	{
+		const auto triangleCount = indices.size() / 3;
+		if (triangleCount == 0)
+			return 0;
+
+		const auto firstMeshlet = meshlets.size();
+		auto adjacency = TriangleAdjacency(indices, vertexCount);
+
+		std::vector<Vector3> centroids(triangleCount);
+		for (uint64_t i = 0; i < triangleCount; i++)
+		{
+			const auto p0 = ReadPosition(pPositions, vertexStride, indices[i * 3]);
+			const auto p1 = ReadPosition(pPositions, vertexStride, indices[i * 3 + 1]);
+			const auto p2 = ReadPosition(pPositions, vertexStride, indices[i * 3 + 2]);
+			centroids[i] = (p0 + p1 + p2) * (1.0f / 3.0f);
+		}
+
+		// Each vertex is tagged with the last meshlet it was added to, so checking if a vertex is in the current meshlet is a lookup.
+		std::vector<uint32_t> vertexMeshlets(vertexCount, InvalidIndex);
+		std::vector<uint32_t> localVertices(vertexCount, 0);
+		std::vector<uint32_t> meshletVertices;
+		meshletVertices.reserve(maxVertices);
+
+		std::vector<uint32_t> localIndices;
+		localIndices.reserve(maxTriangles * 3);
+
+		std::vector<bool> emitted(triangleCount, false);
+		std::vector<uint32_t> output;
+		output.reserve(indices.size());
+
+		auto meshletIndex = static_cast<uint32_t>(0);
+		uint64_t meshletBegin = 0;
+		uint64_t inputCursor = 0;
+		Vector3 meshletCentroid;
+
+		const auto getNewVertexCount = [&indices, &vertexMeshlets, &meshletIndex](uint64_t triangle)
+		{
+			const auto a = indices[triangle * 3];
+			const auto b = indices[triangle * 3 + 1];
+			const auto c = indices[triangle * 3 + 2];
+
+			return static_cast<uint32_t>(vertexMeshlets[a] != meshletIndex) +
+				static_cast<uint32_t>(vertexMeshlets[b] != meshletIndex && b != a) +
+				static_cast<uint32_t>(vertexMeshlets[c] != meshletIndex && c != a && c != b);
+		};
+
+		const auto finishMeshlet = [&]
+		{
+			// The triangles were added in the order that keeps the meshlet compact, so reorder them for the vertex cache using the
+			// meshlet's local vertices.
+			localIndices.clear();
+			for (auto i = meshletBegin; i < output.size(); i++)
+				localIndices.emplace_back(localVertices[output[i]]);
+
+			OptimizeVertexCache(localIndices, meshletVertices.size());
+			for (uint64_t i = 0; i < localIndices.size(); i++)
+				output[meshletBegin + i] = meshletVertices[localIndices[i]];
+
+			auto& meshlet = meshlets.emplace_back();
+			meshlet.m_IndexOffset = static_cast<uint32_t>(meshletBegin);
+			meshlet.m_IndexCount = static_cast<uint32_t>(output.size() - meshletBegin);
+			meshlet.m_VertexCount = static_cast<uint32_t>(meshletVertices.size());
+			ComputeMeshletBounds(meshlet, std::span<const uint32_t>(output).subspan(meshletBegin), pPositions, vertexStride);
+
+			meshletBegin = output.size();
+			meshletVertices.clear();
+			meshletCentroid = Vector3();
+			meshletIndex++;
+		};
+
+		while (output.size() < indices.size())
+		{
+			// Find the adjacent triangle which adds the fewest vertices, and then the one closest to the meshlet.
+			auto bestTriangle = InvalidIndex;
+			uint32_t bestNewVertexCount = 4;
+			float bestDistance = std::numeric_limits<float>::max();
+
+			for (const auto vertex : meshletVertices)
+			{
+				for (const auto triangle : adjacency.getTriangles(vertex))
+				{
+					const auto newVertexCount = getNewVertexCount(triangle);
+					if (meshletVertices.size() + newVertexCount > maxVertices || newVertexCount > bestNewVertexCount)
+						continue;
+
+					const auto offset = centroids[triangle] - meshletCentroid;
+					const auto distance = Dot(offset, offset);
+					if (newVertexCount < bestNewVertexCount || distance < bestDistance)
+					{
+						bestTriangle = triangle;
+						bestNewVertexCount = newVertexCount;
+						bestDistance = distance;
+					}
+				}
+			}
+
+			if (bestTriangle == InvalidIndex)
+			{
+				// Start a new meshlet if the current one can't grow anymore.
+				if (!meshletVertices.empty())
+				{
+					finishMeshlet();
+					continue;
+				}
+
+				// Else continue with the next triangle in the input order.
+				while (emitted[inputCursor])
+					inputCursor++;
+
+				bestTriangle = static_cast<uint32_t>(inputCursor);
+			}
+
+			// Add the triangle to the meshlet.
+			const uint32_t triangle[3] = { indices[bestTriangle * 3], indices[bestTriangle * 3 + 1], indices[bestTriangle * 3 + 2] };
+			output.insert(output.end(), std::begin(triangle), std::end(triangle));
+			emitted[bestTriangle] = true;
+			adjacency.remove(bestTriangle, triangle);
+
+			for (const auto vertex : triangle)
+			{
+				if (vertexMeshlets[vertex] != meshletIndex)
+				{
+					vertexMeshlets[vertex] = meshletIndex;
+					localVertices[vertex] = static_cast<uint32_t>(meshletVertices.size());
+					meshletVertices.emplace_back(vertex);
+				}
+			}
+
+			const auto meshletTriangleCount = (output.size() - meshletBegin) / 3;
+			meshletCentroid = meshletCentroid + (centroids[bestTriangle] - meshletCentroid) * (1.0f / static_cast<float>(meshletTriangleCount));
+
+			if (meshletTriangleCount == maxTriangles)
+				finishMeshlet();
+		}
+
+		if (!meshletVertices.empty())
+			finishMeshlet();
+
+		std::copy(output.begin(), output.end(), indices.begin());
+		return meshlets.size() - firstMeshlet;
+	}
+
+	bool IsMeshletBackFacing(const Meshlet& meshlet, const std::array<float, 3>& cameraPosition) noexcept
+	{
+		if (meshlet.m_ConeCutoff >= 1.0f)
+			return false;
+
+		const auto direction = Vector3{ meshlet.m_ConeApex[0] - cameraPosition[0], meshlet.m_ConeApex[1] - cameraPosition[1], meshlet.m_ConeApex[2] - cameraPosition[2] };
+		const auto axis = Vector3{ meshlet.m_ConeAxis[0], meshlet.m_ConeAxis[1], meshlet.m_ConeAxis[2] };
+
+		// Compare without normalizing the direction: dot(direction, axis) >= cutoff * |direction|.
+		const auto projection = Dot(direction, axis);
+		return projection >= 0.0f && projection * projection >= meshlet.m_ConeCutoff * meshlet.m_ConeCutoff * Dot(direction, direction);
+	}
+}
@@ -0,0 +1,202 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <span>
+#include <array>
+#include <vector>
+
+namespace Xenon
+{
+	/**
+	 * The FIFO cache size used to analyze and to cluster triangle lists.
+	 * Most GPUs behave like a FIFO cache of around this size for post-transform vertices.
+	 */
+	constexpr uint32_t VertexCacheSize = 16;
+
+	/**
+	 * The maximum number of vertices in a meshlet.
+	 */
+	constexpr uint32_t MaxMeshletVertices = 64;
+
+	/**
+	 * The maximum number of triangles in a meshlet.
+	 * Together with the vertex limit, this keeps a meshlet's vertices and primitive indices within a single mesh shader work group's
+	 * output budget.
+	 */
+	constexpr uint32_t MaxMeshletTriangles = 124;
+
+	/**
+	 * Vertex cache statistics structure.
+	 */
+	struct VertexCacheStatistics final
+	{
+		// The number of vertex shader invocations.
+		uint64_t m_TransformedVertexCount = 0;
+
+		// The average cache miss ratio; the number of transformed vertices per triangle. This is between 0.5 (best) and 3 (worst).
+		float m_ACMR = 0.0f;
+
+		// The average transformed vertex ratio; the number of transformed vertices per vertex. This is 1 at best.
+		float m_ATVR = 0.0f;
+	};
+
+	/**
+	 * Meshlet structure.
+	 * A meshlet is a small cluster of connected triangles of a triangle list, with the bounds needed to cull it. The triangles of a
+	 * meshlet are stored contiguously in the index buffer, so a meshlet which is not culled can be drawn as an index range.
+	 *
+	 * All the values are in the mesh's local space. The structure is made of 16 byte rows, so a meshlet array can be uploaded to a GPU
+	 * buffer as is.
+	 */
+	struct Meshlet final
+	{
+		// The bounding sphere.
+		std::array<float, 3> m_Center = {};
+		float m_Radius = 0.0f;
+
+		// The axis aligned bounding box, along with the meshlet's first index relative to the first index of it's sub-mesh.
+		std::array<float, 3> m_Minimum = {};
+		uint32_t m_IndexOffset = 0;
+
+		std::array<float, 3> m_Maximum = {};
+		uint32_t m_IndexCount = 0;
+
+		// The normal cone. All the triangles face away from a camera for which dot(normalize(apex - camera), axis) >= cutoff.
+		// The cutoff is 1 if the triangles face too many directions for the cone to be useful.
+		std::array<float, 3> m_ConeApex = {};
+		float m_ConeCutoff = 1.0f;
+
+		std::array<float, 3> m_ConeAxis = {};
+		uint32_t m_VertexCount = 0;
+	};
+
+	static_assert(sizeof(Meshlet) == 80);
+
+	/**
+	 * Simulate a FIFO vertex cache to analyze a triangle list.
+	 *
+	 * @param indices The triangle list indices.
+	 * @param vertexCount The number of vertices referenced by the indices.
+	 * @param cacheSize The size of the simulated cache. Default is VertexCacheSize.
+	 * @return The vertex cache statistics.
+	 */
+	XENON_NODISCARD VertexCacheStatistics AnalyzeVertexCache(std::span<const uint32_t> indices, uint64_t vertexCount, uint32_t cacheSize = VertexCacheSize);
+
+	/**
+	 * Generate a remap table which welds vertices with identical bytes.
+	 * Each vertex is mapped to the index of the first identical vertex in the output, and the output vertices are numbered in the order
+	 * they first appear in the vertex data.
+	 *
+	 * @param remap The remap table to fill. This must have an entry per vertex.
+	 * @param pVertices The vertex data.
+	 * @param vertexCount The number of vertices.
+	 * @param vertexStride The size of a single vertex in bytes.
+	 * @return The number of unique vertices.
+	 */
+	uint64_t GenerateVertexRemap(std::span<uint32_t> remap, const std::byte* pVertices, uint64_t vertexCount, uint64_t vertexStride);
+
+	/**
+	 * Remap the vertices using a remap table.
+	 *
+	 * @param pDestination The destination vertices. This must be large enough to hold the remapped vertices, and must not overlap the source.
+	 * @param pVertices The source vertices.
+	 * @param vertexStride The size of a single vertex in bytes.
+	 * @param remap The remap table with an entry per source vertex.
+	 */
+	void RemapVertices(std::byte* pDestination, const std::byte* pVertices, uint64_t vertexStride, std::span<const uint32_t> remap) noexcept;
+
+	/**
+	 * Remap the indices using a remap table.
+	 *
+	 * @param indices The indices to remap.
+	 * @param remap The remap table.
+	 */
+	void RemapIndices(std::span<uint32_t> indices, std::span<const uint32_t> remap) noexcept;
+
+	/**
+	 * Reorder the triangles of a triangle list to improve the post-transform vertex cache hit rate.
+	 * This uses Tom Forsyth's linear-speed vertex cache optimization, which greedily emits the triangle with the best score. The score
+	 * favors vertices which are in the cache and vertices with only a few triangles left.
+	 *
+	 * @param indices The triangle list indices to reorder.
+	 * @param vertexCount The number of vertices referenced by the indices.
+	 */
+	void OptimizeVertexCache(std::span<uint32_t> indices, uint64_t vertexCount);
+
+	/**
+	 * Reorder the triangle clusters of a triangle list to reduce overdraw.
+	 * The triangle list is split into clusters at the points where the vertex cache is cold, and the clusters are sorted so that the
+	 * clusters facing out of the mesh are drawn first (Sander et al. 2007). The indices should be optimized for the vertex cache first.
+	 *
+	 * @param indices The triangle list indices to reorder.
+	 * @param pPositions The first vertex position. Positions are three floats.
+	 * @param vertexCount The number of vertices.
+	 * @param vertexStride The distance between two positions in bytes.
+	 * @param threshold How much the vertex cache efficiency can degrade to get smaller clusters. Default is 1.05 (5%).
+	 */
+	void OptimizeOverdraw(std::span<uint32_t> indices, const std::byte* pPositions, uint64_t vertexCount, uint64_t vertexStride, float threshold = 1.05f);
+
+	/**
+	 * Reorder the vertices in the order they are used by the indices, to improve the vertex fetch locality.
+	 * The indices are remapped to the new vertex order, and vertices which are not referenced by any index are removed.
+	 *
+	 * @param pVertices The vertices to reorder.
+	 * @param vertexCount The number of vertices.
+	 * @param vertexStride The size of a single vertex in bytes.
+	 * @param indices The indices to remap.
+	 * @return The number of vertices after the reorder.
+	 */
+	uint64_t OptimizeVertexFetch(std::byte* pVertices, uint64_t vertexCount, uint64_t vertexStride, std::span<uint32_t> indices);
+
+	/**
+	 * Run all the optimizations on a triangle list mesh.
+	 * The vertices are welded first, and then the triangles are reordered for the vertex cache and overdraw, and finally the vertices
+	 * are reordered for the vertex fetch.
+	 *
+	 * @param pVertices The interleaved vertices.
+	 * @param vertexCount The number of vertices.
+	 * @param vertexStride The size of a single vertex in bytes.
+	 * @param indices The triangle list indices.
+	 * @param positionOffset The offset of the position (three floats) in a vertex. If this is negative, overdraw is not optimized.
+	 * @return The number of vertices after the optimization. The vertices after this count are left untouched.
+	 */
+	uint64_t OptimizeMesh(std::byte* pVertices, uint64_t vertexCount, uint64_t vertexStride, std::span<uint32_t> indices, int64_t positionOffset);
+
+	/**
+	 * Split a triangle list into meshlets.
+	 * Meshlets are grown greedily from the triangles adjacent to the meshlet's vertices, preferring the triangles which add the fewest
+	 * vertices and then the ones closest to the meshlet. A new meshlet is started when no adjacent triangle fits in the limits. The
+	 * indices are reordered so that each meshlet's triangles are contiguous.
+	 *
+	 * @param meshlets The vector to append the meshlets to.
+	 * @param indices The triangle list indices to split and reorder.
+	 * @param pPositions The first vertex position. Positions are three floats.
+	 * @param vertexCount The number of vertices.
+	 * @param vertexStride The distance between two positions in bytes.
+	 * @param maxVertices The maximum number of vertices in a meshlet. Default is MaxMeshletVertices.
+	 * @param maxTriangles The maximum number of triangles in a meshlet. Default is MaxMeshletTriangles.
+	 * @return The number of meshlets appended.
+	 */
+	uint64_t BuildMeshlets(
+		std::vector<Meshlet>& meshlets,
+		std::span<uint32_t> indices,
+		const std::byte* pPositions,
+		uint64_t vertexCount,
+		uint64_t vertexStride,
+		uint32_t maxVertices = MaxMeshletVertices,
+		uint32_t maxTriangles = MaxMeshletTriangles);
+
+	/**
+	 * Check if all the triangles of a meshlet face away from a camera.
+	 *
+	 * @param meshlet The meshlet to check.
+	 * @param cameraPosition The camera position in the mesh's local space.
+	 * @return True if the meshlet can be culled.
+	 * @return False if any of the triangles may face the camera.
+	 */
+	XENON_NODISCARD bool IsMeshletBackFacing(const Meshlet& meshlet, const std::array<float, 3>& cameraPosition) noexcept;
+}
@@ -3,12 +3,16 @@
 
 #pragma once
 
+#include "LockStatistics.hpp"
+
 #include <mutex>
 
 namespace Xenon
 {
 	/**
 	 * Mutex class.
+	 * If XENON_ENABLE_LOCK_STATISTICS is defined, every lock acquisition is recorded so that contended mutexes can be found using
+	 * LockCounters::GetAllStatistics().
 	 *
 	 * @tparam Type The data type to synchronize.
 	 * @tparam MutexType The mutex type to use. Default is std::mutex.
@@ -45,6 +49,8 @@ namespace Xenon
 		{
 			auto lock = std::scoped_lock(m_Mutex);
 			m_Data = other.m_Data;
+
+			XENON_LOCK_STATISTICS(m_Counters.setName(other.m_Counters.getName()));
 		}
 
 		/**
@@ -56,6 +62,19 @@ namespace Xenon
 		{
 			auto lock = std::scoped_lock(m_Mutex);
 			m_Data = std::move(other.m_Data);
+
+			XENON_LOCK_STATISTICS(m_Counters.setName(other.m_Counters.getName()));
+		}
+
+		/**
+		 * Set the name of the mutex.
+		 * This is used to report the lock statistics, and does nothing if they are disabled.
+		 *
+		 * @param name The name to set.
+		 */
+		void setName(XENON_MAYBE_UNUSED std::string_view name)
+		{
+			XENON_LOCK_STATISTICS(m_Counters.setName(name));
 		}
 
 		/**
@@ -65,7 +84,7 @@ namespace Xenon
 		 */
 		void set(const Type& data)
 		{
-			auto lock = std::scoped_lock(m_Mutex);
+			const auto lock = acquire();
 			m_Data = data;
 		}
 
@@ -76,7 +95,7 @@ namespace Xenon
 		 */
 		void set(Type&& data)
 		{
-			auto lock = std::scoped_lock(m_Mutex);
+			const auto lock = acquire();
 			m_Data = std::move(data);
 		}
 
@@ -93,7 +112,7 @@ namespace Xenon
 		template<class Function, class... Arguments>
 		decltype(auto) access(Function&& function, Arguments&&... arguments)
 		{
-			auto lock = std::scoped_lock(m_Mutex);
+			const auto lock = acquire();
 			return function(m_Data, std::forward<Arguments>(arguments)...);
 		}
 
@@ -104,7 +123,7 @@ namespace Xenon
 		 */
 		[[nodiscard]] Type get()
 		{
-			auto lock = std::scoped_lock(m_Mutex);
+			const auto lock = acquire();
 			return m_Data;
 		}
 
@@ -162,7 +181,7 @@ namespace Xenon
 		 */
 		Type& operator=(const Type& data)
 		{
-			auto lock = std::scoped_lock(m_Mutex);
+			const auto lock = acquire();
 			m_Data = data;
 			return m_Data;
 		}
@@ -175,13 +194,33 @@ namespace Xenon
 		 */
 		Type& operator=(Type&& data)
 		{
-			auto lock = std::scoped_lock(m_Mutex);
+			const auto lock = acquire();
 			m_Data = std::move(data);
 			return m_Data;
 		}
 
+	private:
+		/**
+		 * Lock the mutex.
+		 * This records the acquisition if the lock statistics are enabled.
+		 *
+		 * @return The lock.
+		 */
+		[[nodiscard]] std::unique_lock<MutexType> acquire()
+		{
+#ifdef XENON_ENABLE_LOCK_STATISTICS
+			return m_Counters.lock(m_Mutex);
+
+#else
+			return std::unique_lock(m_Mutex);
+
+#endif
+		}
+
 	private:
 		Type m_Data;
 		MutexType m_Mutex;
+
+		XENON_LOCK_STATISTICS(LockCounters m_Counters;)
 	};
 }
\ No newline at end of file
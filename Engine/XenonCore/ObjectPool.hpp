@@ -0,0 +1,512 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace Xenon
+{
+	namespace Detail
+	{
+		/**
+		 * Object pool cache entry structure.
+		 * This maps an object pool to the calling thread's cache in that pool.
+		 */
+		struct ObjectPoolCacheEntry final
+		{
+			uint64_t m_Identifier = 0;
+			void* m_pCache = nullptr;
+		};
+
+		/**
+		 * The identifier of the next object pool.
+		 * This is used instead of the pool's address so that a new pool created at the address of a destroyed one is never mistaken for it.
+		 */
+		inline std::atomic_uint64_t g_NextObjectPoolIdentifier = 1;
+
+		/**
+		 * The calling thread's most recently used object pool caches.
+		 * This is a small direct mapped table indexed by the pool identifier, so that a thread can use a few pools without having to
+		 * look up it's cache every time.
+		 */
+		inline thread_local std::array<ObjectPoolCacheEntry, 8> g_ObjectPoolCacheEntries = {};
+	}
+
+	/**
+	 * Object pool class.
+	 * This is a thread-safe allocator for fixed size objects. Every thread allocates from and frees to it's own cache, which is refilled
+	 * from (and spilled to) a lock-free global free list in batches. Memory is allocated in blocks which grow geometrically, and is only
+	 * returned to the system when the pool is destroyed.
+	 *
+	 * Note that all the objects must be destroyed before the pool is destroyed.
+	 *
+	 * @tparam Type The object type.
+	 */
+	template<class Type>
+	class ObjectPool final
+	{
+		/**
+		 * Slot structure.
+		 * This contains the storage of a single object and it's free list link.
+		 */
+		struct Slot final
+		{
+			alignas(Type) std::byte m_Storage[sizeof(Type)];
+			std::atomic_uint32_t m_Next = 0;
+			uint32_t m_Index = 0;
+		};
+
+		/**
+		 * Cache structure.
+		 * Each thread which uses the pool gets it's own cache, which is only ever accessed by that thread.
+		 */
+		struct Cache final
+		{
+			uint32_t m_Head = 0;
+			uint32_t m_Count = 0;
+			std::thread::id m_ThreadID;
+		};
+
+		/**
+		 * The number of slots in the first block. Every other block is twice the size of the one before it.
+		 */
+		static constexpr uint64_t FirstBlockSize = 64;
+
+		/**
+		 * The maximum number of blocks. This keeps all the slot indexes (plus one) within 32 bits.
+		 */
+		static constexpr uint64_t MaxBlockCount = 26;
+
+		/**
+		 * The mask of the slot index (plus one) in the free list head. The upper 32 bits contain the ABA tag.
+		 */
+		static constexpr uint64_t IndexMask = 0xffffffff;
+
+	public:
+		/**
+		 * The number of objects moved between a thread's cache and the global free list at once.
+		 */
+		static constexpr uint32_t TransferCount = 32;
+
+		/**
+		 * The maximum number of free objects a thread can cache before returning some to the global free list.
+		 */
+		static constexpr uint32_t MaxCachedObjects = TransferCount * 2;
+
+		/**
+		 * Default constructor.
+		 */
+		ObjectPool() : m_Identifier(Detail::g_NextObjectPoolIdentifier.fetch_add(1, std::memory_order_relaxed)) {}
+
+		/**
+		 * Destructor.
+		 */
+		~ObjectPool()
+		{
+			for (const auto& pBlock : m_pBlocks)
+				delete[] pBlock.load(std::memory_order_relaxed);
+		}
+
+		XENON_DISABLE_COPY(ObjectPool);
+		XENON_DISABLE_MOVE(ObjectPool);
+
+		/**
+		 * Allocate uninitialized memory for a single object.
+		 *
+		 * @return The memory pointer.
+		 */
+		XENON_NODISCARD void* allocate()
+		{
+			auto& cache = getCache();
+			if (cache.m_Head == 0)
+				refill(cache);
+
+			const auto pSlot = getSlot(cache.m_Head - 1);
+			cache.m_Head = pSlot->m_Next.load(std::memory_order_relaxed);
+			cache.m_Count--;
+
+			return pSlot->m_Storage;
+		}
+
+		/**
+		 * Deallocate memory which was allocated by this pool.
+		 *
+		 * @param pMemory The memory pointer.
+		 */
+		void deallocate(void* pMemory)
+		{
+			auto& cache = getCache();
+
+			// The storage is the first member of the slot, so the pointers are interchangeable.
+			const auto pSlot = reinterpret_cast<Slot*>(pMemory);
+			pSlot->m_Next.store(cache.m_Head, std::memory_order_relaxed);
+			cache.m_Head = pSlot->m_Index + 1;
+
+			// Return a batch to the global free list if the cache is getting too large.
+			if (++cache.m_Count > MaxCachedObjects)
+			{
+				auto pLast = pSlot;
+				for (uint32_t i = 1; i < TransferCount; i++)
+					pLast = getSlot(pLast->m_Next.load(std::memory_order_relaxed) - 1);
+
+				cache.m_Head = pLast->m_Next.load(std::memory_order_relaxed);
+				cache.m_Count -= TransferCount;
+				push(pSlot, pLast);
+			}
+		}
+
+		/**
+		 * Create a new object.
+		 *
+		 * @tparam Arguments The constructor argument types.
+		 * @param arguments The constructor arguments.
+		 * @return The object pointer.
+		 */
+		template<class... Arguments>
+		XENON_NODISCARD Type* create(Arguments&&... arguments)
+		{
+			const auto pMemory = allocate();
+
+			try
+			{
+				return new(pMemory) Type(std::forward<Arguments>(arguments)...);
+			}
+			catch (...)
+			{
+				deallocate(pMemory);
+				throw;
+			}
+		}
+
+		/**
+		 * Destroy an object which was created by this pool.
+		 *
+		 * @param pObject The object pointer. This can be nullptr.
+		 */
+		void destroy(Type* pObject)
+		{
+			if (pObject == nullptr)
+				return;
+
+			pObject->~Type();
+			deallocate(pObject);
+		}
+
+		/**
+		 * Create a new object which is owned by a unique pointer.
+		 * The object is returned to this pool when the unique pointer is destroyed.
+		 *
+		 * @tparam Arguments The constructor argument types.
+		 * @param arguments The constructor arguments.
+		 * @return The unique pointer.
+		 */
+		template<class... Arguments>
+		XENON_NODISCARD auto makeUnique(Arguments&&... arguments);
+
+		/**
+		 * Get the total number of objects the pool can hold without allocating a new block.
+		 *
+		 * @return The capacity.
+		 */
+		XENON_NODISCARD uint64_t getCapacity() const noexcept { return FirstBlockSize * ((uint64_t(1) << m_BlockCount.load(std::memory_order_relaxed)) - 1); }
+
+	public:
+		/**
+		 * Get the global pool of this type.
+		 * The global pool is never destroyed, so that objects released while the program is shutting down (ie: by the destructor of a
+		 * static object) still have a pool to return to.
+		 *
+		 * @return The pool reference.
+		 */
+		XENON_NODISCARD static ObjectPool& GetGlobal()
+		{
+			static auto pPool = new ObjectPool();
+			return *pPool;
+		}
+
+	private:
+		/**
+		 * Get a slot using it's index.
+		 *
+		 * @param index The slot index.
+		 * @return The slot pointer.
+		 */
+		XENON_NODISCARD Slot* getSlot(uint64_t index) const noexcept
+		{
+			const auto block = std::bit_width(index / FirstBlockSize + 1) - 1;
+			const auto blockBegin = FirstBlockSize * ((uint64_t(1) << block) - 1);
+			return m_pBlocks[block].load(std::memory_order_acquire) + (index - blockBegin);
+		}
+
+		/**
+		 * Get the calling thread's cache.
+		 * The cache is created if this is the first time the thread is using this pool.
+		 *
+		 * @return The cache reference.
+		 */
+		XENON_NODISCARD Cache& getCache()
+		{
+			auto& entry = Detail::g_ObjectPoolCacheEntries[m_Identifier % Detail::g_ObjectPoolCacheEntries.size()];
+			if (entry.m_Identifier == m_Identifier)
+				return *static_cast<Cache*>(entry.m_pCache);
+
+			const auto threadID = std::this_thread::get_id();
+			const auto lock = std::scoped_lock(m_Mutex);
+
+			// Find the cache if the thread has used the pool before, else create a new one.
+			auto pCache = static_cast<Cache*>(nullptr);
+			for (const auto& pThreadCache : m_pCaches)
+			{
+				if (pThreadCache->m_ThreadID == threadID)
+				{
+					pCache = pThreadCache.get();
+					break;
+				}
+			}
+
+			if (pCache == nullptr)
+			{
+				pCache = m_pCaches.emplace_back(std::make_unique<Cache>()).get();
+				pCache->m_ThreadID = threadID;
+			}
+
+			entry.m_Identifier = m_Identifier;
+			entry.m_pCache = pCache;
+
+			return *pCache;
+		}
+
+		/**
+		 * Refill an empty cache from the global free list.
+		 * A new block is allocated if the global free list is empty.
+		 *
+		 * @param cache The cache to refill.
+		 */
+		void refill(Cache& cache)
+		{
+			while (cache.m_Count < TransferCount)
+			{
+				const auto pSlot = pop();
+				if (pSlot == nullptr)
+				{
+					// Someone else might have moved some objects to the list, so we only allocate if we have nothing at all.
+					if (cache.m_Count == 0)
+						allocateBlock();
+
+					else
+						break;
+				}
+				else
+				{
+					pSlot->m_Next.store(cache.m_Head, std::memory_order_relaxed);
+					cache.m_Head = pSlot->m_Index + 1;
+					cache.m_Count++;
+				}
+			}
+		}
+
+		/**
+		 * Allocate a new block and push all of it's slots to the global free list.
+		 */
+		void allocateBlock()
+		{
+			const auto lock = std::scoped_lock(m_Mutex);
+
+			const auto block = m_BlockCount.load(std::memory_order_relaxed);
+			if (block == MaxBlockCount)
+				throw std::bad_alloc();
+
+			const auto blockSize = FirstBlockSize << block;
+			const auto blockBegin = FirstBlockSize * ((uint64_t(1) << block) - 1);
+			const auto pBlock = new Slot[blockSize];
+
+			for (uint64_t i = 0; i < blockSize; i++)
+			{
+				pBlock[i].m_Index = static_cast<uint32_t>(blockBegin + i);
+				pBlock[i].m_Next.store(static_cast<uint32_t>(blockBegin + i + 2), std::memory_order_relaxed);
+			}
+
+			m_pBlocks[block].store(pBlock, std::memory_order_release);
+			m_BlockCount.store(block + 1, std::memory_order_relaxed);
+
+			push(pBlock, pBlock + blockSize - 1);
+		}
+
+		/**
+		 * Push a linked chain of slots to the global free list.
+		 *
+		 * @param pFirst The first slot of the chain.
+		 * @param pLast The last slot of the chain.
+		 */
+		void push(Slot* pFirst, Slot* pLast) noexcept
+		{
+			auto head = m_FreeHead.load(std::memory_order_relaxed);
+			auto newHead = uint64_t(0);
+
+			do
+			{
+				pLast->m_Next.store(static_cast<uint32_t>(head & IndexMask), std::memory_order_relaxed);
+				newHead = (((head >> 32) + 1) << 32) | (pFirst->m_Index + 1);
+			} while (!m_FreeHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		/**
+		 * Pop a single slot from the global free list.
+		 * The upper half of the head is a tag which is incremented on every change, so that a slot which was popped and pushed back
+		 * in between does not corrupt the list (the ABA problem).
+		 *
+		 * @return The slot pointer. This will be nullptr if the list is empty.
+		 */
+		XENON_NODISCARD Slot* pop() noexcept
+		{
+			auto head = m_FreeHead.load(std::memory_order_acquire);
+			while ((head & IndexMask) != 0)
+			{
+				const auto pSlot = getSlot((head & IndexMask) - 1);
+				const auto newHead = (((head >> 32) + 1) << 32) | pSlot->m_Next.load(std::memory_order_relaxed);
+
+				if (m_FreeHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire))
+					return pSlot;
+			}
+
+			return nullptr;
+		}
+
+	private:
+		std::array<std::atomic<Slot*>, MaxBlockCount> m_pBlocks = {};
+		std::atomic_uint64_t m_FreeHead = 0;
+
+		std::mutex m_Mutex;
+		std::vector<std::unique_ptr<Cache>> m_pCaches;
+		std::atomic_uint64_t m_BlockCount = 0;
+
+		const uint64_t m_Identifier = 0;
+	};
+
+	/**
+	 * Object pool deleter class.
+	 * This can be used with std::unique_ptr to return the object to it's pool instead of deleting it.
+	 *
+	 * @tparam Type The object type.
+	 */
+	template<class Type>
+	class ObjectPoolDeleter final
+	{
+	public:
+		/**
+		 * Default constructor.
+		 * This will use the global pool of the type.
+		 */
+		ObjectPoolDeleter() noexcept : m_pPool(&ObjectPool<Type>::GetGlobal()) {}
+
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param pool The pool which created the object.
+		 */
+		explicit ObjectPoolDeleter(ObjectPool<Type>& pool) noexcept : m_pPool(&pool) {}
+
+		/**
+		 * Destroy the object.
+		 *
+		 * @param pObject The object pointer.
+		 */
+		void operator()(Type* pObject) const { m_pPool->destroy(pObject); }
+
+	private:
+		ObjectPool<Type>* m_pPool = nullptr;
+	};
+
+	/**
+	 * Unique pointer type which returns the object to it's pool.
+	 *
+	 * @tparam Type The object type.
+	 */
+	template<class Type>
+	using PooledPointer = std::unique_ptr<Type, ObjectPoolDeleter<Type>>;
+
+	template<class Type>
+	template<class... Arguments>
+	auto ObjectPool<Type>::makeUnique(Arguments&&... arguments)
+	{
+		return PooledPointer<Type>(create(std::forward<Arguments>(arguments)...), ObjectPoolDeleter<Type>(*this));
+	}
+
+	/**
+	 * Object pool allocator class.
+	 * This is a standard allocator which allocates single objects from the global pool of the type. Allocator aware types which allocate
+	 * their internal state this way (like std::allocate_shared and std::promise) can use this to pool those allocations. Arrays are
+	 * allocated using the default allocator.
+	 *
+	 * Note that this class is not final since the standard library might derive from allocators to make use of the empty base optimization.
+	 *
+	 * @tparam Type The value type.
+	 */
+	template<class Type>
+	class ObjectPoolAllocator
+	{
+	public:
+		using value_type = Type;
+
+		/**
+		 * Default constructor.
+		 */
+		ObjectPoolAllocator() = default;
+
+		/**
+		 * Converting constructor.
+		 *
+		 * @tparam Other The other value type.
+		 */
+		template<class Other>
+		ObjectPoolAllocator(const ObjectPoolAllocator<Other>&) noexcept {}
+
+		/**
+		 * Allocate memory.
+		 *
+		 * @param count The number of objects to allocate.
+		 * @return The memory pointer.
+		 */
+		XENON_NODISCARD Type* allocate(std::size_t count)
+		{
+			if (count == 1)
+				return static_cast<Type*>(ObjectPool<Type>::GetGlobal().allocate());
+
+			return std::allocator<Type>().allocate(count);
+		}
+
+		/**
+		 * Deallocate memory.
+		 *
+		 * @param pMemory The memory pointer.
+		 * @param count The number of objects which were allocated.
+		 */
+		void deallocate(Type* pMemory, std::size_t count)
+		{
+			if (count == 1)
+				ObjectPool<Type>::GetGlobal().deallocate(pMemory);
+
+			else
+				std::allocator<Type>().deallocate(pMemory, count);
+		}
+
+		/**
+		 * Check if the allocator is equal to another.
+		 * All the allocators share the same global pools, so they are always equal.
+		 *
+		 * @tparam Other The other value type.
+		 * @return True.
+		 */
+		template<class Other>
+		XENON_NODISCARD bool operator==(const ObjectPoolAllocator<Other>&) const noexcept { return true; }
+	};
+}
@@ -0,0 +1,362 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "JobSystem.hpp"
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <iterator>
+#include <vector>
+
+namespace Xenon
+{
+	/**
+	 * The smallest number of elements a single job handles when the grain size is resolved automatically.
+	 */
+	constexpr uint64_t MinimumParallelGrainSize = 1024;
+
+	namespace Detail
+	{
+		/**
+		 * Parallel exception class.
+		 * This stores the first exception thrown by the chunks of a parallel operation so that it can be rethrown on the calling thread
+		 * once all the chunks have completed, instead of escaping a worker thread.
+		 */
+		class ParallelException final
+		{
+		public:
+			/**
+			 * Store the current exception if an exception was not stored before.
+			 * This must be called from within a catch block.
+			 */
+			void capture() noexcept
+			{
+				if (!m_HasException.test_and_set(std::memory_order_acq_rel))
+					m_pException = std::current_exception();
+			}
+
+			/**
+			 * Check if a chunk has thrown.
+			 * This can be used to skip the remaining chunks.
+			 *
+			 * @return True if an exception was captured.
+			 * @return False if no exception was captured.
+			 */
+			XENON_NODISCARD bool hasException() const noexcept { return m_HasException.test(std::memory_order_relaxed); }
+
+			/**
+			 * Rethrow the captured exception if there is one.
+			 * This must be called after the chunks have been waited on.
+			 */
+			void rethrow() const
+			{
+				if (m_pException)
+					std::rethrow_exception(m_pException);
+			}
+
+		private:
+			std::atomic_flag m_HasException;
+			std::exception_ptr m_pException = nullptr;
+		};
+
+		/**
+		 * Find how many elements of the first range are among the first elements of the merged output.
+		 * This is used to split a merge into independent parts (the merge path). Equal elements are taken from the first range first,
+		 * like std::merge.
+		 *
+		 * @tparam Iterator The random access iterator type.
+		 * @tparam Compare The comparison function type.
+		 * @param diagonal The number of output elements.
+		 * @param first The first range's begin.
+		 * @param firstCount The number of elements in the first range.
+		 * @param second The second range's begin.
+		 * @param secondCount The number of elements in the second range.
+		 * @param compare The comparison function.
+		 * @return The number of elements taken from the first range.
+		 */
+		template<std::random_access_iterator Iterator, class Compare>
+		XENON_NODISCARD uint64_t FindMergeSplit(uint64_t diagonal, Iterator first, uint64_t firstCount, Iterator second, uint64_t secondCount, Compare& compare)
+		{
+			auto low = diagonal > secondCount ? diagonal - secondCount : 0;
+			auto high = std::min(diagonal, firstCount);
+
+			while (low < high)
+			{
+				const auto firstIndex = low + (high - low) / 2;
+				const auto secondIndex = diagonal - firstIndex;
+
+				if (secondIndex > 0 && firstIndex < firstCount && !compare(second[secondIndex - 1], first[firstIndex]))
+					low = firstIndex + 1;
+
+				else
+					high = firstIndex;
+			}
+
+			return low;
+		}
+	}
+
+	/**
+	 * Resolve the grain size (the number of elements per job) of a parallel operation.
+	 * If a grain size is not provided, the range is split so that each thread gets a few chunks to balance the load.
+	 *
+	 * @param jobSystem The job system which executes the operation.
+	 * @param count The number of elements in the range.
+	 * @param grainSize The user provided grain size. If this is 0, the grain size is resolved automatically.
+	 * @return The grain size.
+	 */
+	XENON_NODISCARD inline uint64_t ResolveGrainSize(const JobSystem& jobSystem, uint64_t count, uint64_t grainSize) noexcept
+	{
+		if (grainSize > 0)
+			return grainSize;
+
+		const auto chunkCount = (jobSystem.getThreadCount() + 1) * 4;
+		return std::max((count + chunkCount - 1) / chunkCount, MinimumParallelGrainSize);
+	}
+
+	/**
+	 * Run a function for each index in a range using the job system.
+	 * The range is split into chunks and each chunk is executed as a single job. The calling thread executes the first chunk and helps
+	 * out with the rest while waiting. If the range fits in a single chunk (or if the system does not have any workers) the whole
+	 * range is executed inline.
+	 *
+	 * If the function throws, the chunks which have not started are skipped and the first exception is rethrown on the calling thread
+	 * once all the running chunks have completed.
+	 *
+	 * @tparam Function The function type. The function should take a single uint64_t index.
+	 * @param jobSystem The job system to use.
+	 * @param begin The first index.
+	 * @param end The index past the last index.
+	 * @param function The function to run.
+	 * @param grainSize The number of indexes executed by a single job. Default is 0 (resolve automatically).
+	 * @param priority The priority of the jobs. Default is normal.
+	 */
+	template<class Function>
+	void ParallelFor(JobSystem& jobSystem, uint64_t begin, uint64_t end, Function&& function, uint64_t grainSize = 0, JobPriority priority = JobPriority::Normal)
+	{
+		if (begin >= end)
+			return;
+
+		const auto count = end - begin;
+		grainSize = ResolveGrainSize(jobSystem, count, grainSize);
+
+		// Execute inline if there's no point in splitting the work.
+		if (count <= grainSize || jobSystem.getThreadCount() == 0)
+		{
+			for (auto i = begin; i < end; i++)
+				function(i);
+
+			return;
+		}
+
+		// Execute a single chunk. Exceptions must not escape the job, since it would end the worker thread.
+		Detail::ParallelException exception;
+		const auto executeChunk = [&function, &exception](uint64_t chunkBegin, uint64_t chunkEnd)
+			{
+				if (exception.hasException())
+					return;
+
+				try
+				{
+					for (auto i = chunkBegin; i < chunkEnd; i++)
+						function(i);
+				}
+				catch (...)
+				{
+					exception.capture();
+				}
+			};
+
+		// Insert all the chunks except the first one, which gets executed on this thread.
+		JobGroup group;
+		for (auto chunkBegin = begin + grainSize; chunkBegin < end; chunkBegin += grainSize)
+			jobSystem.insertDetached(group, [&executeChunk, chunkBegin, chunkEnd = std::min(chunkBegin + grainSize, end)] { executeChunk(chunkBegin, chunkEnd); }, priority);
+
+		// The jobs reference the function and the group, so we must wait for them before rethrowing.
+		executeChunk(begin, begin + grainSize);
+		jobSystem.wait(group);
+
+		exception.rethrow();
+	}
+
+	/**
+	 * Reduce a range of indexes to a single value using the job system.
+	 * Each chunk is reduced on it's own and the chunk results are then reduced in order on the calling thread.
+	 *
+	 * @tparam Type The value type.
+	 * @tparam Transform The transform function type. The function should take a single uint64_t index and return the value of that index.
+	 * @tparam Reduce The reduce function type. The function should take two values and return the combined value.
+	 * @param jobSystem The job system to use.
+	 * @param begin The first index.
+	 * @param end The index past the last index.
+	 * @param identity The identity value of the reduction.
+	 * @param transform The transform function.
+	 * @param reduce The reduce function. This should be associative.
+	 * @param grainSize The number of indexes reduced by a single job. Default is 0 (resolve automatically).
+	 * @param priority The priority of the jobs. Default is normal.
+	 * @return The reduced value.
+	 */
+	template<class Type, class Transform, class Reduce>
+	XENON_NODISCARD Type ParallelReduce(JobSystem& jobSystem, uint64_t begin, uint64_t end, Type identity, Transform&& transform, Reduce&& reduce, uint64_t grainSize = 0, JobPriority priority = JobPriority::Normal)
+	{
+		if (begin >= end)
+			return identity;
+
+		const auto count = end - begin;
+		grainSize = ResolveGrainSize(jobSystem, count, grainSize);
+
+		// Reduce a single chunk.
+		const auto reduceChunk = [&identity, &transform, &reduce](uint64_t chunkBegin, uint64_t chunkEnd)
+		{
+			Type value = identity;
+			for (auto i = chunkBegin; i < chunkEnd; i++)
+				value = reduce(std::move(value), transform(i));
+
+			return value;
+		};
+
+		// Execute inline if there's no point in splitting the work.
+		if (count <= grainSize || jobSystem.getThreadCount() == 0)
+			return reduceChunk(begin, end);
+
+		// Reduce all the chunks in parallel.
+		const auto chunkCount = (count + grainSize - 1) / grainSize;
+		std::vector<Type> chunkValues(chunkCount, identity);
+
+		ParallelFor(jobSystem, 0, chunkCount, [begin, end, grainSize, &chunkValues, &reduceChunk](uint64_t chunk)
+			{
+				const auto chunkBegin = begin + chunk * grainSize;
+				chunkValues[chunk] = reduceChunk(chunkBegin, std::min(chunkBegin + grainSize, end));
+			}
+		, 1, priority);
+
+		// Finally reduce the chunk values.
+		Type value = std::move(identity);
+		for (auto& chunkValue : chunkValues)
+			value = reduce(std::move(value), std::move(chunkValue));
+
+		return value;
+	}
+
+	/**
+	 * Sort a range of random access iterators using the job system.
+	 * This is a parallel merge sort; the range is split into chunks which are sorted in parallel and are then merged pairwise until a
+	 * single sorted range remains. Every merge is split into independent parts using the merge path, so the last few merges (which only
+	 * have one or two pairs to merge) still use all the workers. The merges ping-pong between the range and a scratch buffer, so the
+	 * value type must be default constructible and movable. Note that the sort is not stable.
+	 *
+	 * @tparam Iterator The random access iterator type.
+	 * @tparam Compare The comparison function type.
+	 * @param jobSystem The job system to use.
+	 * @param first The first iterator.
+	 * @param last The last iterator.
+	 * @param compare The comparison function. Default is std::less.
+	 * @param grainSize The number of elements sorted or merged by a single job. Default is 0 (resolve automatically).
+	 * @param priority The priority of the jobs. Default is normal.
+	 */
+	template<std::random_access_iterator Iterator, class Compare = std::less<>>
+	void ParallelSort(JobSystem& jobSystem, Iterator first, Iterator last, Compare compare = Compare(), uint64_t grainSize = 0, JobPriority priority = JobPriority::Normal)
+	{
+		const auto count = static_cast<uint64_t>(std::distance(first, last));
+		grainSize = ResolveGrainSize(jobSystem, count, grainSize);
+
+		// Execute inline if there's no point in splitting the work.
+		if (count <= grainSize || jobSystem.getThreadCount() == 0)
+		{
+			std::sort(first, last, compare);
+			return;
+		}
+
+		// Sort the individual chunks.
+		const auto chunkCount = (count + grainSize - 1) / grainSize;
+		ParallelFor(jobSystem, 0, chunkCount, [first, count, grainSize, &compare](uint64_t chunk)
+			{
+				const auto chunkBegin = chunk * grainSize;
+				const auto chunkEnd = std::min(chunkBegin + grainSize, count);
+				std::sort(first + chunkBegin, first + chunkEnd, compare);
+			}
+		, 1, priority);
+
+		// Merge the sorted chunks pairwise till the whole range is sorted.
+		std::vector<std::iter_value_t<Iterator>> buffer(count);
+		std::vector<uint64_t> leftSplits;
+		bool isInBuffer = false;
+
+		for (auto width = grainSize; width < count; width *= 2)
+		{
+			// Every pair is split into the same number of parts, and each part produces a grain sized block of the output.
+			const auto partsPerMerge = (width * 2 + grainSize - 1) / grainSize;
+			const auto mergeCount = (count + (width * 2) - 1) / (width * 2);
+			const auto partCount = mergeCount * partsPerMerge;
+
+			// Get the range of a single part within it's pair.
+			const auto getPart = [count, width, grainSize, partsPerMerge](uint64_t part)
+				{
+					const auto mergeBegin = (part / partsPerMerge) * width * 2;
+					const auto mergeMiddle = std::min(mergeBegin + width, count);
+					const auto mergeEnd = std::min(mergeBegin + width * 2, count);
+					const auto outputBegin = std::min((part % partsPerMerge) * grainSize, mergeEnd - mergeBegin);
+
+					return std::array<uint64_t, 4>{ mergeBegin, mergeMiddle, mergeEnd, outputBegin };
+				};
+
+			// Find where each part starts in the left range. This is done before merging since the merges move the source elements,
+			// and the searches of the other parts read them.
+			const auto findSplits = [&compare, &getPart, &leftSplits](auto source, uint64_t part)
+				{
+					const auto [mergeBegin, mergeMiddle, mergeEnd, outputBegin] = getPart(part);
+					leftSplits[part] = Detail::FindMergeSplit(outputBegin, source + mergeBegin, mergeMiddle - mergeBegin, source + mergeMiddle, mergeEnd - mergeMiddle, compare);
+				};
+
+			// Merge a single part.
+			const auto merge = [&compare, &getPart, &leftSplits, partsPerMerge, grainSize](auto source, auto destination, uint64_t part)
+				{
+					const auto [mergeBegin, mergeMiddle, mergeEnd, outputBegin] = getPart(part);
+					const auto outputEnd = std::min(outputBegin + grainSize, mergeEnd - mergeBegin);
+					if (outputBegin == outputEnd)
+						return;
+
+					const auto left = source + mergeBegin;
+					const auto right = source + mergeMiddle;
+					const auto leftBegin = leftSplits[part];
+					const auto leftEnd = (part + 1) % partsPerMerge == 0 || outputEnd == mergeEnd - mergeBegin ? mergeMiddle - mergeBegin : leftSplits[part + 1];
+
+					std::merge(
+						std::make_move_iterator(left + leftBegin), std::make_move_iterator(left + leftEnd),
+						std::make_move_iterator(right + (outputBegin - leftBegin)), std::make_move_iterator(right + (outputEnd - leftEnd)),
+						destination + mergeBegin + outputBegin,
+						compare
+					);
+				};
+
+			leftSplits.resize(partCount);
+			if (isInBuffer)
+			{
+				ParallelFor(jobSystem, 0, partCount, [&findSplits, &buffer](uint64_t part) { findSplits(buffer.begin(), part); }, 16, priority);
+				ParallelFor(jobSystem, 0, partCount, [&merge, &buffer, first](uint64_t part) { merge(buffer.begin(), first, part); }, 1, priority);
+			}
+			else
+			{
+				ParallelFor(jobSystem, 0, partCount, [&findSplits, first](uint64_t part) { findSplits(first, part); }, 16, priority);
+				ParallelFor(jobSystem, 0, partCount, [&merge, &buffer, first](uint64_t part) { merge(first, buffer.begin(), part); }, 1, priority);
+			}
+
+			isInBuffer = !isInBuffer;
+		}
+
+		// Move the result back to the range if the last merge wrote to the buffer.
+		if (isInBuffer)
+		{
+			ParallelFor(jobSystem, 0, chunkCount, [first, count, grainSize, &buffer](uint64_t chunk)
+				{
+					const auto chunkBegin = chunk * grainSize;
+					const auto chunkEnd = std::min(chunkBegin + grainSize, count);
+					std::move(buffer.begin() + chunkBegin, buffer.begin() + chunkEnd, first + chunkBegin);
+				}
+			, 1, priority);
+		}
+	}
+}
@@ -0,0 +1,188 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "LockStatistics.hpp"
+
+#include <shared_mutex>
+
+namespace Xenon
+{
+	/**
+	 * Reader-writer mutex class.
+	 * This is like Mutex<Type, MutexType>, but any number of threads can read the data at once, while writing is exclusive. Use this for
+	 * read-mostly data (like caches) where the readers would otherwise serialize on each other.
+	 *
+	 * If XENON_ENABLE_LOCK_STATISTICS is defined, every lock acquisition is recorded so that contended mutexes can be found using
+	 * LockCounters::GetAllStatistics().
+	 *
+	 * @tparam Type The data type to synchronize.
+	 * @tparam MutexType The mutex type to use. This must satisfy the SharedMutex requirements. Default is std::shared_mutex.
+	 */
+	template<class Type, class MutexType = std::shared_mutex>
+	class RWMutex final
+	{
+	public:
+		/**
+		 * Default constructor.
+		 */
+		RWMutex() = default;
+
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param data The data to initialize.
+		 */
+		explicit RWMutex(const Type& data) : m_Data(data) {}
+
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param data The data to initialize.
+		 */
+		explicit RWMutex(Type&& data) : m_Data(std::move(data)) {}
+
+		XENON_DISABLE_COPY(RWMutex);
+		XENON_DISABLE_MOVE(RWMutex);
+
+		/**
+		 * Set the name of the mutex.
+		 * This is used to report the lock statistics, and does nothing if they are disabled.
+		 *
+		 * @param name The name to set.
+		 */
+		void setName(XENON_MAYBE_UNUSED std::string_view name)
+		{
+			XENON_LOCK_STATISTICS(m_Counters.setName(name));
+		}
+
+		/**
+		 * Read the internally stored data while holding a shared lock.
+		 * The function can have a return and optional arguments can be passed to it. But make sure that the first argument is always the
+		 * required variable to access (as a const reference).
+		 *
+		 * @tparam Function The function type.
+		 * @tparam Arguments The argument types.
+		 * @param function The function which can safely read the variable.
+		 * @param arguments The arguments to forward to the function.
+		 * @return The function's return.
+		 */
+		template<class Function, class... Arguments>
+		decltype(auto) read(Function&& function, Arguments&&... arguments) const
+		{
+			const auto lock = acquireShared();
+			return function(m_Data, std::forward<Arguments>(arguments)...);
+		}
+
+		/**
+		 * Write to the internally stored data while holding an exclusive lock.
+		 * The function can have a return and optional arguments can be passed to it. But make sure that the first argument is always the
+		 * required variable to access.
+		 *
+		 * @tparam Function The function type.
+		 * @tparam Arguments The argument types.
+		 * @param function The function which can safely access the variable.
+		 * @param arguments The arguments to forward to the function.
+		 * @return The function's return.
+		 */
+		template<class Function, class... Arguments>
+		decltype(auto) write(Function&& function, Arguments&&... arguments)
+		{
+			const auto lock = acquire();
+			return function(m_Data, std::forward<Arguments>(arguments)...);
+		}
+
+		/**
+		 * Set the data.
+		 *
+		 * @param data The data to set.
+		 */
+		void set(const Type& data)
+		{
+			const auto lock = acquire();
+			m_Data = data;
+		}
+
+		/**
+		 * Set the data.
+		 *
+		 * @param data The data to set.
+		 */
+		void set(Type&& data)
+		{
+			const auto lock = acquire();
+			m_Data = std::move(data);
+		}
+
+		/**
+		 * Get a copy from the internally stored data safely.
+		 *
+		 * @return The data copy.
+		 */
+		XENON_NODISCARD Type get() const
+		{
+			const auto lock = acquireShared();
+			return m_Data;
+		}
+
+		/**
+		 * Get the data reference.
+		 * Note that this operation is unsafe.
+		 * Use this if you are sure that there wont be any race conditions.
+		 *
+		 * @return The data reference.
+		 */
+		XENON_NODISCARD Type& getUnsafe() { return m_Data; }
+
+		/**
+		 * Get the data reference.
+		 * Note that this operation is unsafe.
+		 * Use this if you are sure that there wont be any race conditions.
+		 *
+		 * @return The data reference.
+		 */
+		XENON_NODISCARD const Type& getUnsafe() const { return m_Data; }
+
+	private:
+		/**
+		 * Lock the mutex exclusively.
+		 * This records the acquisition if the lock statistics are enabled.
+		 *
+		 * @return The lock.
+		 */
+		XENON_NODISCARD std::unique_lock<MutexType> acquire()
+		{
+#ifdef XENON_ENABLE_LOCK_STATISTICS
+			return m_Counters.lock(m_Mutex);
+
+#else
+			return std::unique_lock(m_Mutex);
+
+#endif
+		}
+
+		/**
+		 * Lock the mutex in shared mode.
+		 * This records the acquisition if the lock statistics are enabled.
+		 *
+		 * @return The lock.
+		 */
+		XENON_NODISCARD std::shared_lock<MutexType> acquireShared() const
+		{
+#ifdef XENON_ENABLE_LOCK_STATISTICS
+			return m_Counters.lockShared(m_Mutex);
+
+#else
+			return std::shared_lock(m_Mutex);
+
+#endif
+		}
+
+	private:
+		Type m_Data;
+		mutable MutexType m_Mutex;
+
+		XENON_LOCK_STATISTICS(mutable LockCounters m_Counters;)
+	};
+}
@@ -0,0 +1,264 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <cstdint>
+
+namespace Xenon
+{
+	/**
+	 * Single producer single consumer queue class.
+	 * This is a bounded, lock-free ring buffer which can be used to pass objects from one thread to another. The producer and consumer
+	 * indexes are kept in separate cache lines, and each side caches the other side's index so that it only has to touch the other
+	 * cache line when the queue looks full (or empty).
+	 *
+	 * Note that only one thread can push at a time, and only one thread can pop at a time. The blocking functions park the calling thread
+	 * on the other side's index instead of spinning. Each side records the index value it's parked on, so that the other side only pays for
+	 * the notify when there's someone to wake up (and only once per wait).
+	 *
+	 * @tparam Type The stored type.
+	 */
+	template<class Type>
+	class SPSCQueue final
+	{
+		/**
+		 * Slot structure.
+		 * This contains the storage of a single entry.
+		 */
+		struct Slot final
+		{
+			alignas(Type) std::byte m_Storage[sizeof(Type)];
+		};
+
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param capacity The minimum capacity of the queue. This is rounded up to the next power of 2.
+		 */
+		explicit SPSCQueue(uint64_t capacity)
+			: m_pSlots(std::make_unique<Slot[]>(std::bit_ceil(std::max<uint64_t>(capacity, 2))))
+			, m_Mask(std::bit_ceil(std::max<uint64_t>(capacity, 2)) - 1)
+		{
+		}
+
+		/**
+		 * Destructor.
+		 */
+		~SPSCQueue()
+		{
+			while (tryPop().has_value());
+		}
+
+		XENON_DISABLE_COPY(SPSCQueue);
+		XENON_DISABLE_MOVE(SPSCQueue);
+
+		/**
+		 * Try and construct a new entry at the end of the queue.
+		 *
+		 * @tparam Arguments The constructor argument types.
+		 * @param arguments The constructor arguments.
+		 * @return True if the entry was pushed.
+		 * @return False if the queue is full.
+		 */
+		template<class... Arguments>
+		XENON_NODISCARD bool tryEmplace(Arguments&&... arguments)
+		{
+			const auto tail = m_Tail.load(std::memory_order_relaxed);
+			if (tail - m_CachedHead > m_Mask)
+			{
+				m_CachedHead = m_Head.load(std::memory_order_acquire);
+				if (tail - m_CachedHead > m_Mask)
+					return false;
+			}
+
+			new(m_pSlots[tail & m_Mask].m_Storage) Type(std::forward<Arguments>(arguments)...);
+			publish(m_Tail, tail + 1, m_ConsumerWaitValue);
+
+			return true;
+		}
+
+		/**
+		 * Try and push a new entry to the end of the queue.
+		 *
+		 * @param entry The entry to push.
+		 * @return True if the entry was pushed.
+		 * @return False if the queue is full.
+		 */
+		XENON_NODISCARD bool tryPush(Type&& entry) { return tryEmplace(std::move(entry)); }
+
+		/**
+		 * Try and push a new entry to the end of the queue.
+		 *
+		 * @param entry The entry to push.
+		 * @return True if the entry was pushed.
+		 * @return False if the queue is full.
+		 */
+		XENON_NODISCARD bool tryPush(const Type& entry) { return tryEmplace(entry); }
+
+		/**
+		 * Construct a new entry at the end of the queue.
+		 * This will block the calling thread until there's space in the queue.
+		 *
+		 * @tparam Arguments The constructor argument types.
+		 * @param arguments The constructor arguments.
+		 */
+		template<class... Arguments>
+		void emplace(Arguments&&... arguments)
+		{
+			const auto tail = m_Tail.load(std::memory_order_relaxed);
+			while (tail - m_CachedHead > m_Mask)
+			{
+				wait(m_Head, m_CachedHead, m_ProducerWaitValue);
+				m_CachedHead = m_Head.load(std::memory_order_acquire);
+			}
+
+			new(m_pSlots[tail & m_Mask].m_Storage) Type(std::forward<Arguments>(arguments)...);
+			publish(m_Tail, tail + 1, m_ConsumerWaitValue);
+		}
+
+		/**
+		 * Push a new entry to the end of the queue.
+		 * This will block the calling thread until there's space in the queue.
+		 *
+		 * @param entry The entry to push.
+		 */
+		void push(Type&& entry) { emplace(std::move(entry)); }
+
+		/**
+		 * Push a new entry to the end of the queue.
+		 * This will block the calling thread until there's space in the queue.
+		 *
+		 * @param entry The entry to push.
+		 */
+		void push(const Type& entry) { emplace(entry); }
+
+		/**
+		 * Try and pop the entry at the front of the queue.
+		 *
+		 * @return The entry if the queue was not empty.
+		 */
+		XENON_NODISCARD std::optional<Type> tryPop()
+		{
+			const auto head = m_Head.load(std::memory_order_relaxed);
+			if (head == m_CachedTail)
+			{
+				m_CachedTail = m_Tail.load(std::memory_order_acquire);
+				if (head == m_CachedTail)
+					return std::nullopt;
+			}
+
+			return take(head);
+		}
+
+		/**
+		 * Pop the entry at the front of the queue.
+		 * This will block the calling thread until there's an entry in the queue.
+		 *
+		 * @return The entry.
+		 */
+		XENON_NODISCARD Type pop()
+		{
+			const auto head = m_Head.load(std::memory_order_relaxed);
+			while (head == m_CachedTail)
+			{
+				wait(m_Tail, m_CachedTail, m_ConsumerWaitValue);
+				m_CachedTail = m_Tail.load(std::memory_order_acquire);
+			}
+
+			return take(head);
+		}
+
+		/**
+		 * Check if the queue is empty.
+		 * Note that the result might be outdated by the time it's used, if the other thread is active.
+		 *
+		 * @return True if the queue is empty.
+		 * @return False if the queue is not empty.
+		 */
+		XENON_NODISCARD bool empty() const noexcept { return m_Head.load(std::memory_order_acquire) == m_Tail.load(std::memory_order_acquire); }
+
+		/**
+		 * Get the capacity of the queue.
+		 *
+		 * @return The capacity.
+		 */
+		XENON_NODISCARD uint64_t getCapacity() const noexcept { return m_Mask + 1; }
+
+	private:
+		/**
+		 * Move the entry out of a slot and release the slot to the producer.
+		 *
+		 * @param head The head index.
+		 * @return The entry.
+		 */
+		XENON_NODISCARD Type take(uint64_t head)
+		{
+			auto pEntry = std::launder(reinterpret_cast<Type*>(m_pSlots[head & m_Mask].m_Storage));
+			auto entry = std::move(*pEntry);
+			pEntry->~Type();
+
+			publish(m_Head, head + 1, m_ProducerWaitValue);
+
+			return entry;
+		}
+
+		/**
+		 * Park the calling thread until an index changes from a value.
+		 * The wait value is recorded before the index is checked (both sequentially consistent), so that the other side either sees it and
+		 * notifies, or this sees the new index and does not wait.
+		 *
+		 * @param index The index to wait on.
+		 * @param value The value to wait for the index to change from.
+		 * @param waitValue The calling side's wait value. This is the value plus one while parked, and 0 otherwise.
+		 */
+		static void wait(const std::atomic_uint64_t& index, uint64_t value, std::atomic_uint64_t& waitValue)
+		{
+			waitValue.store(value + 1, std::memory_order_seq_cst);
+
+			if (index.load(std::memory_order_seq_cst) == value)
+				index.wait(value, std::memory_order_acquire);
+
+			waitValue.store(0, std::memory_order_relaxed);
+		}
+
+		/**
+		 * Update an index and wake up the other side if it's waiting on it.
+		 * The wait value is cleared when notifying, so that the other side is only notified once even if it takes a while to wake up. An
+		 * update which stored the value the other side is about to wait on (which happens if it read the index right after this stored
+		 * it) must not clear it, otherwise the next update would not notify.
+		 *
+		 * @param index The index to update.
+		 * @param value The new value of the index.
+		 * @param waitValue The other side's wait value.
+		 */
+		static void publish(std::atomic_uint64_t& index, uint64_t value, std::atomic_uint64_t& waitValue)
+		{
+			index.store(value, std::memory_order_seq_cst);
+
+			auto expected = waitValue.load(std::memory_order_seq_cst);
+			if (expected != 0 && expected != value + 1 && waitValue.compare_exchange_strong(expected, 0, std::memory_order_relaxed))
+				index.notify_one();
+		}
+
+	private:
+		std::unique_ptr<Slot[]> m_pSlots;
+		const uint64_t m_Mask;
+
+		// Consumer side.
+		alignas(64) std::atomic_uint64_t m_Head = 0;
+		uint64_t m_CachedTail = 0;
+		std::atomic_uint64_t m_ConsumerWaitValue = 0;
+
+		// Producer side.
+		alignas(64) std::atomic_uint64_t m_Tail = 0;
+		uint64_t m_CachedHead = 0;
+		std::atomic_uint64_t m_ProducerWaitValue = 0;
+	};
+}
@@ -0,0 +1,547 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+#include <initializer_list>
+
+namespace Xenon
+{
+	/**
+	 * Small vector class.
+	 * This is a vector which stores up to InlineCapacity elements inside the object itself, and only allocates heap memory when it grows
+	 * beyond that. Use this for short lists which are created often (like per-draw or per-pass temporaries), where a std::vector would
+	 * allocate every time.
+	 *
+	 * Note that unlike std::vector, moving a small vector which uses the inline storage moves the elements one by one, so iterators and
+	 * pointers to the elements are invalidated.
+	 *
+	 * Growing gives the same guarantees as std::vector: the elements are moved to the new allocation only if that cannot throw (otherwise
+	 * they're copied), so if growing throws the vector is left unchanged. The new element is constructed before the existing ones are
+	 * moved, so it's safe to add a copy of an existing element (ie: vector.push_back(vector[0])).
+	 *
+	 * @tparam Type The element type.
+	 * @tparam InlineCapacity The number of elements which can be stored without allocating.
+	 */
+	template<class Type, uint32_t InlineCapacity>
+	class SmallVector final
+	{
+		static_assert(InlineCapacity > 0, "The inline capacity of a small vector must be greater than 0!");
+
+	public:
+		using value_type = Type;
+		using size_type = uint64_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = Type&;
+		using const_reference = const Type&;
+		using pointer = Type*;
+		using const_pointer = const Type*;
+		using iterator = Type*;
+		using const_iterator = const Type*;
+
+	public:
+		/**
+		 * Default constructor.
+		 */
+		SmallVector() = default;
+
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param size The number of default constructed elements to create.
+		 */
+		explicit SmallVector(size_type size) { resize(size); }
+
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param size The number of elements to create.
+		 * @param value The value to copy to all the elements.
+		 */
+		explicit SmallVector(size_type size, const Type& value) { resize(size, value); }
+
+		/**
+		 * Initializer list constructor.
+		 *
+		 * @param list The elements to copy.
+		 */
+		SmallVector(std::initializer_list<Type> list)
+		{
+			reserve(list.size());
+			std::uninitialized_copy(list.begin(), list.end(), m_pData);
+			m_Size = list.size();
+		}
+
+		/**
+		 * Copy constructor.
+		 *
+		 * @param other The other small vector.
+		 */
+		SmallVector(const SmallVector& other)
+		{
+			reserve(other.m_Size);
+			std::uninitialized_copy(other.begin(), other.end(), m_pData);
+			m_Size = other.m_Size;
+		}
+
+		/**
+		 * Move constructor.
+		 *
+		 * @param other The other small vector.
+		 */
+		SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<Type>)
+		{
+			moveFrom(std::move(other));
+		}
+
+		/**
+		 * Destructor.
+		 */
+		~SmallVector()
+		{
+			std::destroy(begin(), end());
+			deallocate();
+		}
+
+		/**
+		 * Add a new element to the end of the vector.
+		 *
+		 * @tparam Arguments The constructor argument types.
+		 * @param arguments The constructor arguments.
+		 * @return The element reference.
+		 */
+		template<class... Arguments>
+		Type& emplace_back(Arguments&&... arguments)
+		{
+			if (m_Size == m_Capacity)
+				return emplaceAndGrow(std::forward<Arguments>(arguments)...);
+
+			auto pElement = std::construct_at(m_pData + m_Size, std::forward<Arguments>(arguments)...);
+			m_Size++;
+
+			return *pElement;
+		}
+
+		/**
+		 * Add a new element to the end of the vector.
+		 *
+		 * @param value The value to copy.
+		 */
+		void push_back(const Type& value) { emplace_back(value); }
+
+		/**
+		 * Add a new element to the end of the vector.
+		 *
+		 * @param value The value to move.
+		 */
+		void push_back(Type&& value) { emplace_back(std::move(value)); }
+
+		/**
+		 * Remove the last element.
+		 */
+		void pop_back()
+		{
+			m_Size--;
+			std::destroy_at(m_pData + m_Size);
+		}
+
+		/**
+		 * Erase an element.
+		 * The following elements are moved back by one to fill the gap.
+		 *
+		 * @param position The position of the element to erase.
+		 * @return The iterator to the element which followed the erased one.
+		 */
+		iterator erase(const_iterator position)
+		{
+			const auto pPosition = m_pData + (position - m_pData);
+			std::move(pPosition + 1, end(), pPosition);
+			pop_back();
+
+			return pPosition;
+		}
+
+		/**
+		 * Resize the vector.
+		 * New elements are default constructed.
+		 *
+		 * @param size The new size.
+		 */
+		void resize(size_type size)
+		{
+			if (size < m_Size)
+			{
+				std::destroy(m_pData + size, end());
+			}
+			else
+			{
+				reserve(size);
+				std::uninitialized_value_construct(end(), m_pData + size);
+			}
+
+			m_Size = size;
+		}
+
+		/**
+		 * Resize the vector.
+		 *
+		 * @param size The new size.
+		 * @param value The value to copy to the new elements.
+		 */
+		void resize(size_type size, const Type& value)
+		{
+			if (size < m_Size)
+			{
+				std::destroy(m_pData + size, end());
+			}
+			else if (size > m_Capacity)
+			{
+				// The value might be one of the elements, so copy it before they are moved.
+				const auto copy = value;
+				grow(size);
+				std::uninitialized_fill(end(), m_pData + size, copy);
+			}
+			else
+			{
+				std::uninitialized_fill(end(), m_pData + size, value);
+			}
+
+			m_Size = size;
+		}
+
+		/**
+		 * Make sure that the vector can store a number of elements without allocating.
+		 *
+		 * @param capacity The required capacity.
+		 */
+		void reserve(size_type capacity)
+		{
+			if (capacity > m_Capacity)
+				grow(capacity);
+		}
+
+		/**
+		 * Destroy all the elements.
+		 * This will keep the allocated memory.
+		 */
+		void clear() noexcept
+		{
+			std::destroy(begin(), end());
+			m_Size = 0;
+		}
+
+		/**
+		 * Copy assignment operator.
+		 *
+		 * @param other The other small vector.
+		 * @return The small vector reference.
+		 */
+		SmallVector& operator=(const SmallVector& other)
+		{
+			if (this != &other)
+			{
+				clear();
+				reserve(other.m_Size);
+				std::uninitialized_copy(other.begin(), other.end(), m_pData);
+				m_Size = other.m_Size;
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Move assignment operator.
+		 *
+		 * @param other The other small vector.
+		 * @return The small vector reference.
+		 */
+		SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<Type>)
+		{
+			if (this != &other)
+			{
+				clear();
+				deallocate();
+				moveFrom(std::move(other));
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Access an element.
+		 *
+		 * @param index The index of the element.
+		 * @return The element reference.
+		 */
+		XENON_NODISCARD Type& operator[](size_type index) noexcept { return m_pData[index]; }
+
+		/**
+		 * Access an element.
+		 *
+		 * @param index The index of the element.
+		 * @return The element reference.
+		 */
+		XENON_NODISCARD const Type& operator[](size_type index) const noexcept { return m_pData[index]; }
+
+		/**
+		 * Get the first element.
+		 *
+		 * @return The element reference.
+		 */
+		XENON_NODISCARD Type& front() noexcept { return m_pData[0]; }
+
+		/**
+		 * Get the first element.
+		 *
+		 * @return The element reference.
+		 */
+		XENON_NODISCARD const Type& front() const noexcept { return m_pData[0]; }
+
+		/**
+		 * Get the last element.
+		 *
+		 * @return The element reference.
+		 */
+		XENON_NODISCARD Type& back() noexcept { return m_pData[m_Size - 1]; }
+
+		/**
+		 * Get the last element.
+		 *
+		 * @return The element reference.
+		 */
+		XENON_NODISCARD const Type& back() const noexcept { return m_pData[m_Size - 1]; }
+
+		/**
+		 * Get the element data pointer.
+		 *
+		 * @return The data pointer.
+		 */
+		XENON_NODISCARD Type* data() noexcept { return m_pData; }
+
+		/**
+		 * Get the element data pointer.
+		 *
+		 * @return The data pointer.
+		 */
+		XENON_NODISCARD const Type* data() const noexcept { return m_pData; }
+
+		/**
+		 * Get the number of elements.
+		 *
+		 * @return The size.
+		 */
+		XENON_NODISCARD size_type size() const noexcept { return m_Size; }
+
+		/**
+		 * Get the number of elements which can be stored without allocating.
+		 *
+		 * @return The capacity.
+		 */
+		XENON_NODISCARD size_type capacity() const noexcept { return m_Capacity; }
+
+		/**
+		 * Check if the vector is empty.
+		 *
+		 * @return True if there are no elements.
+		 * @return False if there are elements.
+		 */
+		XENON_NODISCARD bool empty() const noexcept { return m_Size == 0; }
+
+		/**
+		 * Check if the elements are stored in the inline storage.
+		 *
+		 * @return True if the inline storage is used.
+		 * @return False if the elements are stored in the heap.
+		 */
+		XENON_NODISCARD bool isInline() const noexcept { return m_pData == getInlineData(); }
+
+		/**
+		 * Get the begin iterator.
+		 *
+		 * @return The iterator.
+		 */
+		XENON_NODISCARD iterator begin() noexcept { return m_pData; }
+
+		/**
+		 * Get the begin iterator.
+		 *
+		 * @return The iterator.
+		 */
+		XENON_NODISCARD const_iterator begin() const noexcept { return m_pData; }
+
+		/**
+		 * Get the end iterator.
+		 *
+		 * @return The iterator.
+		 */
+		XENON_NODISCARD iterator end() noexcept { return m_pData + m_Size; }
+
+		/**
+		 * Get the end iterator.
+		 *
+		 * @return The iterator.
+		 */
+		XENON_NODISCARD const_iterator end() const noexcept { return m_pData + m_Size; }
+
+	private:
+		/**
+		 * Get the inline storage pointer.
+		 *
+		 * @return The pointer.
+		 */
+		XENON_NODISCARD Type* getInlineData() noexcept { return reinterpret_cast<Type*>(m_InlineStorage); }
+
+		/**
+		 * Get the inline storage pointer.
+		 *
+		 * @return The pointer.
+		 */
+		XENON_NODISCARD const Type* getInlineData() const noexcept { return reinterpret_cast<const Type*>(m_InlineStorage); }
+
+		/**
+		 * Move the elements to a new heap allocation.
+		 * The vector is left unchanged if this throws.
+		 *
+		 * @param capacity The new capacity.
+		 */
+		void grow(size_type capacity)
+		{
+			auto pNewData = std::allocator<Type>().allocate(capacity);
+
+			try
+			{
+				relocateTo(pNewData);
+			}
+			catch (...)
+			{
+				std::allocator<Type>().deallocate(pNewData, capacity);
+				throw;
+			}
+
+			replaceData(pNewData, capacity);
+		}
+
+		/**
+		 * Add a new element to the end of a new heap allocation, and move the elements to it.
+		 * The new element is constructed first since the arguments might refer to the existing elements. The vector is left unchanged if
+		 * this throws.
+		 *
+		 * @tparam Arguments The constructor argument types.
+		 * @param arguments The constructor arguments.
+		 * @return The element reference.
+		 */
+		template<class... Arguments>
+		Type& emplaceAndGrow(Arguments&&... arguments)
+		{
+			const auto capacity = m_Capacity * 2;
+			auto pNewData = std::allocator<Type>().allocate(capacity);
+			Type* pElement = nullptr;
+
+			try
+			{
+				pElement = std::construct_at(pNewData + m_Size, std::forward<Arguments>(arguments)...);
+				relocateTo(pNewData);
+			}
+			catch (...)
+			{
+				if (pElement)
+					std::destroy_at(pElement);
+
+				std::allocator<Type>().deallocate(pNewData, capacity);
+				throw;
+			}
+
+			replaceData(pNewData, capacity);
+			m_Size++;
+
+			return *pElement;
+		}
+
+		/**
+		 * Move (or copy, if moving might throw) the elements to new uninitialized memory.
+		 * The existing elements are not destroyed. If this throws, the elements which were constructed in the new memory are destroyed.
+		 *
+		 * @param pNewData The new memory.
+		 */
+		void relocateTo(Type* pNewData)
+		{
+			if constexpr (std::is_nothrow_move_constructible_v<Type> || !std::is_copy_constructible_v<Type>)
+			{
+				std::uninitialized_move(begin(), end(), pNewData);
+			}
+			else
+			{
+				std::uninitialized_copy(begin(), end(), pNewData);
+			}
+		}
+
+		/**
+		 * Destroy the existing elements and use a new heap allocation which contains the relocated elements.
+		 *
+		 * @param pNewData The new allocation.
+		 * @param capacity The capacity of the new allocation.
+		 */
+		void replaceData(Type* pNewData, size_type capacity) noexcept
+		{
+			std::destroy(begin(), end());
+			deallocate();
+
+			m_pData = pNewData;
+			m_Capacity = capacity;
+		}
+
+		/**
+		 * Deallocate the heap allocation if we have one.
+		 * The elements must be destroyed before calling this.
+		 */
+		void deallocate() noexcept
+		{
+			if (!isInline())
+				std::allocator<Type>().deallocate(m_pData, m_Capacity);
+
+			m_pData = getInlineData();
+			m_Capacity = InlineCapacity;
+		}
+
+		/**
+		 * Take the elements of another small vector.
+		 * This vector must be empty and must be using the inline storage.
+		 *
+		 * @param other The other small vector.
+		 */
+		void moveFrom(SmallVector&& other)
+		{
+			// We can simply steal the heap allocation, but the inline elements need to be moved one by one.
+			if (other.isInline())
+			{
+				std::uninitialized_move(other.begin(), other.end(), m_pData);
+				m_Size = other.m_Size;
+				other.clear();
+			}
+			else
+			{
+				m_pData = other.m_pData;
+				m_Size = other.m_Size;
+				m_Capacity = other.m_Capacity;
+
+				other.m_pData = other.getInlineData();
+				other.m_Size = 0;
+				other.m_Capacity = InlineCapacity;
+			}
+		}
+
+	private:
+		Type* m_pData = getInlineData();
+		size_type m_Size = 0;
+		size_type m_Capacity = InlineCapacity;
+
+		alignas(Type) std::byte m_InlineStorage[sizeof(Type) * InlineCapacity];
+	};
+}
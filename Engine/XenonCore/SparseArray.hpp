@@ -3,22 +3,27 @@
 
 #pragma once
 
+#include "Common.hpp"
+
 #include <vector>
 #include <cstdint>
+#include <limits>
 
 namespace Xenon
 {
 	/**
 	 * Sparse array class.
 	 * Sparse arrays contain three internal vectors.
-	 * 1. Dense array: This contains the actual data that's been stored.
-	 * 2. Sparse array: This contains the index map.
-	 * 3. Availability map: This contains the information about which sparse array indexes are valid and which are false.
+	 * 1. Dense array: This contains the actual data that's been stored, tightly packed.
+	 * 2. Sparse array: This contains the index of each entry in the dense array, and the entry's generation.
+	 * 3. Dense to sparse array: This contains the sparse index of each dense element (the back pointer).
+	 *
+	 * Entries are accessed using handles, which contain the sparse index and the generation of the entry. Removing an entry moves
+	 * the last dense element into it's place (so removal is O(1) and the dense array stays packed for iteration), increments the
+	 * entry's generation and adds the sparse slot to a free list so that it can be reused by the next insertion. Since the generation
+	 * changes, handles to removed entries can be detected using contains().
 	 *
-	 * This class works by storing the actual data in the dense array, and storing the index of that entry in the sparse array.
-	 * Later the index of the sparse array can be used to index the sparse array, which gives the index of the dense array
-	 * where the required value is stored in. The availability map represents an efficient way of storing information about
-	 * which sparse array entries are valid, and can be used to delete unwanted memory.
+	 * Note that removing an entry changes the order of the dense array, so pointers and dense indexes are not stable across removals.
 	 *
 	 * @tparam Type The value type.
 	 * @tparam IndexType The index type.
@@ -26,7 +31,34 @@ namespace Xenon
 	template<class Type, class IndexType = uint64_t>
 	class SparseArray final
 	{
+		/**
+		 * Sparse entry structure.
+		 * If the entry is free, the dense index contains the index of the next free entry.
+		 */
+		struct SparseEntry final
+		{
+			IndexType m_DenseIndex = 0;
+			IndexType m_Generation = 0;
+		};
+
+		/**
+		 * The index used to mark the end of the free list.
+		 */
+		static constexpr IndexType InvalidIndex = std::numeric_limits<IndexType>::max();
+
 	public:
+		/**
+		 * Handle structure.
+		 * This is used to refer to a single entry in the sparse array.
+		 */
+		struct Handle final
+		{
+			XENON_NODISCARD bool operator==(const Handle&) const = default;
+
+			IndexType m_Index = InvalidIndex;
+			IndexType m_Generation = 0;
+		};
+
 		using value_type = typename std::vector<Type>::value_type;
 		using allocator_type = typename std::vector<Type>::allocator_type;
 		using size_type = typename std::vector<Type>::size_type;
@@ -47,20 +79,51 @@ namespace Xenon
 		SparseArray() = default;
 
 		/**
-		 * Get the element stored at a given index.
+		 * Get the element of a given handle.
+		 * Make sure that the handle is valid before calling this.
 		 *
-		 * @param index The index of the element.
+		 * @param handle The handle of the element.
 		 * @return The value reference.
 		 */
-		XENON_NODISCARD Type& at(uint64_t index) { return m_DenseArray[m_SparseArray[index]]; }
+		XENON_NODISCARD Type& at(Handle handle) { return m_DenseArray[m_SparseArray[handle.m_Index].m_DenseIndex]; }
 
 		/**
-		 * Get the element stored at a given index.
+		 * Get the element of a given handle.
+		 * Make sure that the handle is valid before calling this.
 		 *
-		 * @param index The index of the element.
+		 * @param handle The handle of the element.
 		 * @return The const value reference.
 		 */
-		XENON_NODISCARD const Type& at(uint64_t index) const { return m_DenseArray[m_SparseArray[index]]; }
+		XENON_NODISCARD const Type& at(Handle handle) const { return m_DenseArray[m_SparseArray[handle.m_Index].m_DenseIndex]; }
+
+		/**
+		 * Get the element of a given handle if the handle is valid.
+		 *
+		 * @param handle The handle of the element.
+		 * @return The value pointer. This will be nullptr if the handle is stale or invalid.
+		 */
+		XENON_NODISCARD Type* get(Handle handle) { return contains(handle) ? &at(handle) : nullptr; }
+
+		/**
+		 * Get the element of a given handle if the handle is valid.
+		 *
+		 * @param handle The handle of the element.
+		 * @return The const value pointer. This will be nullptr if the handle is stale or invalid.
+		 */
+		XENON_NODISCARD const Type* get(Handle handle) const { return contains(handle) ? &at(handle) : nullptr; }
+
+		/**
+		 * Get the handle of an element in the dense array.
+		 * This can be used to get the handle of an element while iterating.
+		 *
+		 * @param denseIndex The index of the element in the dense array.
+		 * @return The handle.
+		 */
+		XENON_NODISCARD Handle getHandle(uint64_t denseIndex) const
+		{
+			const auto index = m_DenseToSparse[denseIndex];
+			return Handle{ index, m_SparseArray[index].m_Generation };
+		}
 
 		/**
 		 * Get the front element in the storage.
@@ -133,6 +196,13 @@ namespace Xenon
 		 */
 		XENON_NODISCARD decltype(auto) end() { return m_DenseArray.end(); }
 
+		/**
+		 * Get the end pointer.
+		 *
+		 * @return The end pointer.
+		 */
+		XENON_NODISCARD decltype(auto) end() const { return m_DenseArray.end(); }
+
 		/**
 		 * Get the end pointer.
 		 *
@@ -166,7 +236,7 @@ namespace Xenon
 		 *
 		 * @return The reverse begin pointer.
 		 */
-		XENON_NODISCARD decltype(auto) rcbegin() { return m_DenseArray.rcbegin(); }
+		XENON_NODISCARD decltype(auto) rcbegin() { return m_DenseArray.crbegin(); }
 
 		/**
 		 * Get the reverse end pointer.
@@ -180,14 +250,14 @@ namespace Xenon
 		 *
 		 * @return The reverse end pointer.
 		 */
-		XENON_NODISCARD decltype(auto) rcend() const { return m_DenseArray.rcend(); }
+		XENON_NODISCARD decltype(auto) rcend() const { return m_DenseArray.crend(); }
 
 		/**
 		 * Get the reverse end pointer.
 		 *
 		 * @return The reverse end pointer.
 		 */
-		XENON_NODISCARD decltype(auto) rcend() { return m_DenseArray.rcend(); }
+		XENON_NODISCARD decltype(auto) rcend() { return m_DenseArray.crend(); }
 
 	public:
 		/**
@@ -205,85 +275,141 @@ namespace Xenon
 		 */
 		XENON_NODISCARD uint64_t size() const { return m_DenseArray.size(); }
 
+		/**
+		 * Check if a handle refers to an element in the array.
+		 *
+		 * @param handle The handle to check.
+		 * @return True if the handle is valid.
+		 * @return False if the handle is invalid, or the element has been removed.
+		 */
+		XENON_NODISCARD bool contains(Handle handle) const
+		{
+			return handle.m_Index < m_SparseArray.size() && m_SparseArray[handle.m_Index].m_Generation == handle.m_Generation;
+		}
+
+		/**
+		 * Reserve memory for a number of elements.
+		 *
+		 * @param capacity The number of elements to reserve.
+		 */
+		void reserve(uint64_t capacity)
+		{
+			m_DenseArray.reserve(capacity);
+			m_DenseToSparse.reserve(capacity);
+			m_SparseArray.reserve(capacity);
+		}
+
 	public:
 		/**
 		 * Insert a new entry to the sparse array.
+		 * This will reuse a free sparse entry if there are any.
 		 *
 		 * @tparam Arguments The argument types.
 		 * @param arguments The arguments.
-		 * @return The index and the value pointer pair.
+		 * @return The handle and the value pointer pair.
 		 */
 		template<class...Arguments>
-		XENON_NODISCARD std::pair<IndexType, Type*> insert(Arguments&&... arguments)
+		XENON_NODISCARD std::pair<Handle, Type*> insert(Arguments&&... arguments)
 		{
-			const auto index = m_SparseArray.size();
-			m_SparseArray.emplace_back(m_DenseArray.size());
-			m_AvailabilityMap.emplace_back(true);
-
 			auto& value = m_DenseArray.emplace_back(std::forward<Arguments>(arguments)...);
-			return std::make_pair(index, &value);
+			const auto denseIndex = static_cast<IndexType>(m_DenseArray.size() - 1);
+
+			// Get a free entry from the free list, or create a new one.
+			auto index = m_FreeIndex;
+			if (index == InvalidIndex)
+			{
+				index = static_cast<IndexType>(m_SparseArray.size());
+				m_SparseArray.emplace_back();
+			}
+			else
+			{
+				m_FreeIndex = m_SparseArray[index].m_DenseIndex;
+			}
+
+			auto& entry = m_SparseArray[index];
+			entry.m_DenseIndex = denseIndex;
+			m_DenseToSparse.emplace_back(index);
+
+			return std::make_pair(Handle{ index, entry.m_Generation }, &value);
 		}
 
 		/**
-		 * Remove the element at the given index.
-		 * It will also try and clear the sparse array if required. This operation might be a little costly.
+		 * Remove the element of the given handle.
+		 * The last element of the dense array is moved into the removed element's place.
 		 *
-		 * @param index The index to remove the element from.
-		 * @param shouldClear Whether we should clean the array. Default is true.
+		 * @param handle The handle of the element to remove.
+		 * @return True if the element was removed.
+		 * @return False if the handle was invalid.
 		 */
-		void remove(uint64_t index, bool shouldClear = true)
+		bool remove(Handle handle)
 		{
-			m_DenseArray.erase(m_DenseArray.begin() + m_SparseArray[index]);
-			m_AvailabilityMap[index] = false;
+			if (!contains(handle))
+				return false;
+
+			auto& entry = m_SparseArray[handle.m_Index];
+			const auto denseIndex = entry.m_DenseIndex;
+
+			// Move the last element to the removed element's place and update it's sparse entry.
+			if (denseIndex != m_DenseArray.size() - 1)
+			{
+				m_DenseArray[denseIndex] = std::move(m_DenseArray.back());
+				m_DenseToSparse[denseIndex] = m_DenseToSparse.back();
+				m_SparseArray[m_DenseToSparse[denseIndex]].m_DenseIndex = denseIndex;
+			}
+
+			m_DenseArray.pop_back();
+			m_DenseToSparse.pop_back();
 
-			if (shouldClear)
-				clean();
+			// Invalidate the existing handles and add the entry to the free list.
+			entry.m_Generation++;
+			entry.m_DenseIndex = m_FreeIndex;
+			m_FreeIndex = handle.m_Index;
+
+			return true;
 		}
 
-	private:
 		/**
-		 * Clean the sparse array and availability map if the last entries are free.
+		 * Remove all the elements.
+		 * All the existing handles are invalidated.
 		 */
-		void clean()
+		void clear()
 		{
-			const auto finalIndex = m_SparseArray.size() - 1;
-
-			// Find the last free index in the availability map.
-			uint64_t lastFreeIndex = finalIndex;
-			for (uint64_t index = 0; index < m_SparseArray.size(); index++)
+			for (const auto index : m_DenseToSparse)
 			{
-				if (!m_AvailabilityMap[index])
-					lastFreeIndex = index;
+				auto& entry = m_SparseArray[index];
+				entry.m_Generation++;
+				entry.m_DenseIndex = m_FreeIndex;
+				m_FreeIndex = index;
 			}
 
-			// If the last free index is less than the last element index, let's remove it.
-			if (lastFreeIndex < finalIndex)
-			{
-				m_SparseArray.erase(m_SparseArray.begin() + lastFreeIndex, m_SparseArray.end());
-				m_AvailabilityMap.erase(m_AvailabilityMap.begin() + lastFreeIndex, m_AvailabilityMap.end());
-			}
+			m_DenseArray.clear();
+			m_DenseToSparse.clear();
 		}
 
 	public:
 		/**
-		 * Get the element stored at a given index.
+		 * Get the element of a given handle.
+		 * Make sure that the handle is valid before calling this.
 		 *
-		 * @param index The index of the element.
+		 * @param handle The handle of the element.
 		 * @return The value reference.
 		 */
-		XENON_NODISCARD Type& operator[](uint64_t index) { return m_DenseArray[m_SparseArray[index]]; }
+		XENON_NODISCARD Type& operator[](Handle handle) { return at(handle); }
 
 		/**
-		 * Get the element stored at a given index.
+		 * Get the element of a given handle.
+		 * Make sure that the handle is valid before calling this.
 		 *
-		 * @param index The index of the element.
+		 * @param handle The handle of the element.
 		 * @return The const value reference.
 		 */
-		XENON_NODISCARD const Type& operator[](uint64_t index) const { return m_DenseArray[m_SparseArray[index]]; }
+		XENON_NODISCARD const Type& operator[](Handle handle) const { return at(handle); }
 
 	private:
 		std::vector<Type> m_DenseArray;
-		std::vector<IndexType> m_SparseArray;
-		std::vector<bool> m_AvailabilityMap;
+		std::vector<IndexType> m_DenseToSparse;
+		std::vector<SparseEntry> m_SparseArray;
+
+		IndexType m_FreeIndex = InvalidIndex;
 	};
-}
\ No newline at end of file
+}
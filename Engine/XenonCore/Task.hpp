@@ -0,0 +1,548 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "JobSystem.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <variant>
+#include <vector>
+
+namespace Xenon
+{
+	template<class Type = void>
+	class Task;
+
+	namespace Detail
+	{
+		/**
+		 * Task promise base class.
+		 * This contains the continuation logic which is shared by all the task promises.
+		 */
+		class TaskPromiseBase
+		{
+			/**
+			 * Final awaitable structure.
+			 * This transfers the execution to the awaiting coroutine (if any) once the task completes.
+			 */
+			struct FinalAwaitable final
+			{
+				XENON_NODISCARD bool await_ready() const noexcept { return false; }
+
+				template<class Promise>
+				XENON_NODISCARD std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+				{
+					if (handle.promise().m_Continuation)
+						return handle.promise().m_Continuation;
+
+					return std::noop_coroutine();
+				}
+
+				void await_resume() const noexcept {}
+			};
+
+		public:
+			/**
+			 * Tasks are lazy; they don't start till they are awaited.
+			 *
+			 * @return The awaitable.
+			 */
+			XENON_NODISCARD std::suspend_always initial_suspend() const noexcept { return {}; }
+
+			/**
+			 * Resume the awaiting coroutine after completion.
+			 *
+			 * @return The awaitable.
+			 */
+			XENON_NODISCARD FinalAwaitable final_suspend() const noexcept { return {}; }
+
+			/**
+			 * Set the coroutine to resume after completion.
+			 *
+			 * @param continuation The continuation handle.
+			 */
+			void setContinuation(std::coroutine_handle<> continuation) noexcept { m_Continuation = continuation; }
+
+		private:
+			std::coroutine_handle<> m_Continuation = nullptr;
+		};
+
+		/**
+		 * Task promise class.
+		 *
+		 * @tparam Type The return type.
+		 */
+		template<class Type>
+		class TaskPromise final : public TaskPromiseBase
+		{
+		public:
+			/**
+			 * Get the return object.
+			 *
+			 * @return The task.
+			 */
+			XENON_NODISCARD Task<Type> get_return_object() noexcept;
+
+			/**
+			 * Store the returned value.
+			 *
+			 * @tparam Value The value type.
+			 * @param value The value to store.
+			 */
+			template<class Value>
+			void return_value(Value&& value) { m_Result.template emplace<1>(std::forward<Value>(value)); }
+
+			/**
+			 * Store the unhandled exception to be rethrown when the result is accessed.
+			 */
+			void unhandled_exception() noexcept { m_Result.template emplace<2>(std::current_exception()); }
+
+			/**
+			 * Get the result.
+			 * This will rethrow the exception if the task threw one.
+			 *
+			 * @return The result reference.
+			 */
+			XENON_NODISCARD Type& getResult()
+			{
+				if (m_Result.index() == 2)
+					std::rethrow_exception(std::get<2>(m_Result));
+
+				return std::get<1>(m_Result);
+			}
+
+		private:
+			std::variant<std::monostate, Type, std::exception_ptr> m_Result;
+		};
+
+		/**
+		 * Task promise class specialization for void.
+		 */
+		template<>
+		class TaskPromise<void> final : public TaskPromiseBase
+		{
+		public:
+			/**
+			 * Get the return object.
+			 *
+			 * @return The task.
+			 */
+			XENON_NODISCARD Task<void> get_return_object() noexcept;
+
+			/**
+			 * Mark the completion of the task.
+			 */
+			void return_void() const noexcept {}
+
+			/**
+			 * Store the unhandled exception to be rethrown when the result is accessed.
+			 */
+			void unhandled_exception() noexcept { m_pException = std::current_exception(); }
+
+			/**
+			 * Get the result.
+			 * This will rethrow the exception if the task threw one.
+			 */
+			void getResult() const
+			{
+				if (m_pException)
+					std::rethrow_exception(m_pException);
+			}
+
+		private:
+			std::exception_ptr m_pException = nullptr;
+		};
+
+		/**
+		 * Completion counter structure.
+		 * This is shared between the helper coroutines of a single WhenAll or SyncWait call.
+		 */
+		struct CompletionCounter final
+		{
+			/**
+			 * Decrement the counter.
+			 *
+			 * @return True if this was the last arrival.
+			 * @return False if there are more arrivals pending.
+			 */
+			XENON_NODISCARD bool arrive() noexcept { return m_Count.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+
+			std::atomic_uint64_t m_Count = 0;
+			std::coroutine_handle<> m_Awaiting = nullptr;
+
+			// This is set by the last arrival after it's done notifying the count, when there isn't an awaiting coroutine to resume.
+			// Threads blocked on the count must wait for this before destroying the counter.
+			std::atomic_bool m_IsNotified = false;
+		};
+
+		/**
+		 * Completion task class.
+		 * This is a helper coroutine which awaits a single task and arrives on a completion counter afterwards. The coroutine which
+		 * arrives last resumes the awaiting coroutine (if any).
+		 */
+		class CompletionTask final
+		{
+		public:
+			/**
+			 * Promise type structure.
+			 */
+			struct promise_type final
+			{
+				/**
+				 * Final awaitable structure.
+				 * This arrives on the counter and resumes the awaiting coroutine if this was the last arrival.
+				 */
+				struct FinalAwaitable final
+				{
+					XENON_NODISCARD bool await_ready() const noexcept { return false; }
+
+					XENON_NODISCARD std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) const noexcept
+					{
+						// The counter might be destroyed as soon as we arrive, so the awaiting handle is read first.
+						const auto pCounter = handle.promise().m_pCounter;
+						const auto awaiting = pCounter->m_Awaiting;
+						if (pCounter->arrive())
+						{
+							if (awaiting)
+								return awaiting;
+
+							// Setting the flag must be the last access to the counter.
+							pCounter->m_Count.notify_all();
+							pCounter->m_IsNotified.store(true, std::memory_order_release);
+						}
+
+						return std::noop_coroutine();
+					}
+
+					void await_resume() const noexcept {}
+				};
+
+				XENON_NODISCARD CompletionTask get_return_object() noexcept { return CompletionTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+				XENON_NODISCARD std::suspend_always initial_suspend() const noexcept { return {}; }
+				XENON_NODISCARD FinalAwaitable final_suspend() const noexcept { return {}; }
+				void return_void() const noexcept {}
+
+				// The exception is kept by the awaited task, and is rethrown when it's result is accessed.
+				void unhandled_exception() const noexcept {}
+
+				CompletionCounter* m_pCounter = nullptr;
+			};
+
+		public:
+			/**
+			 * Explicit constructor.
+			 *
+			 * @param handle The coroutine handle.
+			 */
+			explicit CompletionTask(std::coroutine_handle<promise_type> handle) noexcept : m_Handle(handle) {}
+
+			/**
+			 * Move constructor.
+			 *
+			 * @param other The other task.
+			 */
+			CompletionTask(CompletionTask&& other) noexcept : m_Handle(std::exchange(other.m_Handle, nullptr)) {}
+
+			/**
+			 * Destructor.
+			 */
+			~CompletionTask() { if (m_Handle) m_Handle.destroy(); }
+
+			XENON_DISABLE_COPY(CompletionTask);
+
+			CompletionTask& operator=(CompletionTask&&) = delete;
+
+			/**
+			 * Start the task.
+			 *
+			 * @param counter The counter to arrive on after completion.
+			 */
+			void start(CompletionCounter& counter)
+			{
+				m_Handle.promise().m_pCounter = &counter;
+				m_Handle.resume();
+			}
+
+		private:
+			std::coroutine_handle<promise_type> m_Handle = nullptr;
+		};
+
+		/**
+		 * Create a completion task for a task.
+		 *
+		 * @tparam Type The task's return type.
+		 * @param task The task to await.
+		 * @return The completion task.
+		 */
+		template<class Type>
+		XENON_NODISCARD CompletionTask MakeCompletionTask(Task<Type>& task)
+		{
+			co_await task.whenReady();
+		}
+
+		/**
+		 * When all awaitable class.
+		 * This starts all the tasks when awaited and resumes the awaiting coroutine once all of them have completed.
+		 */
+		class WhenAllAwaitable final
+		{
+		public:
+			/**
+			 * Explicit constructor.
+			 *
+			 * @param tasks The completion tasks.
+			 */
+			explicit WhenAllAwaitable(std::vector<CompletionTask>&& tasks) : m_Tasks(std::move(tasks)) {}
+
+			XENON_NODISCARD bool await_ready() const noexcept { return m_Tasks.empty(); }
+
+			XENON_NODISCARD bool await_suspend(std::coroutine_handle<> handle)
+			{
+				// The extra count is for this thread, so that the awaiting coroutine is not resumed before all the tasks are started.
+				m_Counter.m_Count = m_Tasks.size() + 1;
+				m_Counter.m_Awaiting = handle;
+
+				for (auto& task : m_Tasks)
+					task.start(m_Counter);
+
+				return !m_Counter.arrive();
+			}
+
+			void await_resume() const noexcept {}
+
+		private:
+			std::vector<CompletionTask> m_Tasks;
+			CompletionCounter m_Counter;
+		};
+	}
+
+	/**
+	 * Task class.
+	 * This is a lazily started coroutine which produces a single value. The task starts when it's awaited, and the awaiting coroutine
+	 * is resumed on the thread which completes the task. Use co_await jobSystem.schedule(); within a task to move the rest of it to a
+	 * job system worker, which allows multiple tasks to run in parallel when awaited using WhenAll().
+	 *
+	 * Awaiting a completed task returns the stored result without suspending.
+	 *
+	 * @tparam Type The return type. Default is void.
+	 */
+	template<class Type /*= void*/>
+	class Task final
+	{
+	public:
+		using promise_type = Detail::TaskPromise<Type>;
+		using HandleType = std::coroutine_handle<promise_type>;
+
+	private:
+		/**
+		 * Awaitable base structure.
+		 * This starts the task and sets the awaiting coroutine as the continuation.
+		 */
+		struct AwaitableBase
+		{
+			XENON_NODISCARD bool await_ready() const noexcept { return !m_Handle || m_Handle.done(); }
+
+			XENON_NODISCARD std::coroutine_handle<> await_suspend(std::coroutine_handle<> handle) noexcept
+			{
+				m_Handle.promise().setContinuation(handle);
+				return m_Handle;
+			}
+
+			HandleType m_Handle;
+		};
+
+	public:
+		/**
+		 * Default constructor.
+		 */
+		Task() = default;
+
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param handle The coroutine handle.
+		 */
+		explicit Task(HandleType handle) noexcept : m_Handle(handle) {}
+
+		/**
+		 * Move constructor.
+		 *
+		 * @param other The other task.
+		 */
+		Task(Task&& other) noexcept : m_Handle(std::exchange(other.m_Handle, nullptr)) {}
+
+		/**
+		 * Destructor.
+		 */
+		~Task() { if (m_Handle) m_Handle.destroy(); }
+
+		XENON_DISABLE_COPY(Task);
+
+		/**
+		 * Check if the task has completed.
+		 *
+		 * @return True if the task has completed.
+		 * @return False if the task has not started or is still running.
+		 */
+		XENON_NODISCARD bool isReady() const noexcept { return !m_Handle || m_Handle.done(); }
+
+		/**
+		 * Await the task without retrieving the result.
+		 * The exception thrown by the task (if any) is not rethrown.
+		 *
+		 * @return The awaitable.
+		 */
+		XENON_NODISCARD auto whenReady() noexcept
+		{
+			struct Awaitable final : AwaitableBase
+			{
+				void await_resume() const noexcept {}
+			};
+
+			return Awaitable{ m_Handle };
+		}
+
+		/**
+		 * Await the task and get a reference to the result.
+		 *
+		 * @return The awaitable.
+		 */
+		XENON_NODISCARD auto operator co_await() & noexcept
+		{
+			struct Awaitable final : AwaitableBase
+			{
+				decltype(auto) await_resume() { return this->m_Handle.promise().getResult(); }
+			};
+
+			return Awaitable{ m_Handle };
+		}
+
+		/**
+		 * Await the task and move the result out of it.
+		 *
+		 * @return The awaitable.
+		 */
+		XENON_NODISCARD auto operator co_await() && noexcept
+		{
+			struct Awaitable final : AwaitableBase
+			{
+				decltype(auto) await_resume()
+				{
+					if constexpr (std::is_void_v<Type>)
+						this->m_Handle.promise().getResult();
+
+					else
+						return std::move(this->m_Handle.promise().getResult());
+				}
+			};
+
+			return Awaitable{ m_Handle };
+		}
+
+		/**
+		 * Move assignment operator.
+		 *
+		 * @param other The other task.
+		 * @return The task reference.
+		 */
+		Task& operator=(Task&& other) noexcept
+		{
+			if (this != &other)
+			{
+				if (m_Handle)
+					m_Handle.destroy();
+
+				m_Handle = std::exchange(other.m_Handle, nullptr);
+			}
+
+			return *this;
+		}
+
+	private:
+		HandleType m_Handle = nullptr;
+	};
+
+	namespace Detail
+	{
+		template<class Type>
+		Task<Type> TaskPromise<Type>::get_return_object() noexcept { return Task<Type>(std::coroutine_handle<TaskPromise<Type>>::from_promise(*this)); }
+
+		inline Task<void> TaskPromise<void>::get_return_object() noexcept { return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this)); }
+	}
+
+	/**
+	 * Await multiple tasks at once.
+	 * All the tasks are started when the returned object is awaited, and the awaiting coroutine is resumed once all of them have completed.
+	 * The results can be retrieved by awaiting the individual tasks afterwards, which will not suspend.
+	 *
+	 * @tparam Types The task return types.
+	 * @param tasks The tasks to await.
+	 * @return The awaitable.
+	 */
+	template<class... Types>
+	XENON_NODISCARD Detail::WhenAllAwaitable WhenAll(Task<Types>&... tasks)
+	{
+		std::vector<Detail::CompletionTask> completionTasks;
+		completionTasks.reserve(sizeof...(tasks));
+		(completionTasks.emplace_back(Detail::MakeCompletionTask(tasks)), ...);
+
+		return Detail::WhenAllAwaitable(std::move(completionTasks));
+	}
+
+	/**
+	 * Await a range of tasks at once.
+	 * All the tasks are started when the returned object is awaited, and the awaiting coroutine is resumed once all of them have completed.
+	 * The results can be retrieved by awaiting the individual tasks afterwards, which will not suspend.
+	 *
+	 * @tparam Type The task return type.
+	 * @param tasks The tasks to await.
+	 * @return The awaitable.
+	 */
+	template<class Type>
+	XENON_NODISCARD Detail::WhenAllAwaitable WhenAll(std::vector<Task<Type>>& tasks)
+	{
+		std::vector<Detail::CompletionTask> completionTasks;
+		completionTasks.reserve(tasks.size());
+		for (auto& task : tasks)
+			completionTasks.emplace_back(Detail::MakeCompletionTask(task));
+
+		return Detail::WhenAllAwaitable(std::move(completionTasks));
+	}
+
+	/**
+	 * Run a task from non-coroutine code and wait till it completes.
+	 * The calling thread will execute pending jobs while waiting, and will block if there's nothing to execute.
+	 *
+	 * @tparam Type The task return type.
+	 * @param jobSystem The job system to help.
+	 * @param task The task to run.
+	 * @return The task's result.
+	 */
+	template<class Type>
+	Type SyncWait(JobSystem& jobSystem, Task<Type>& task)
+	{
+		if (!task.isReady())
+		{
+			Detail::CompletionCounter counter;
+			counter.m_Count = 1;
+
+			auto completionTask = Detail::MakeCompletionTask(task);
+			completionTask.start(counter);
+
+			for (auto value = counter.m_Count.load(); value > 0; value = counter.m_Count.load())
+			{
+				if (!jobSystem.executeOne())
+					counter.m_Count.wait(value);
+			}
+
+			// The completing thread might still be notifying the counter (and is still inside the completion task), so wait till it's done.
+			while (!counter.m_IsNotified.load(std::memory_order_acquire))
+				std::this_thread::yield();
+		}
+
+		// The task is complete, so awaiting it does not suspend and just returns the result.
+		return std::move(task).operator co_await().await_resume();
+	}
+}
@@ -10,6 +10,7 @@ namespace Xenon
 	/**
 	 * Task graph class.
 	 * This class contains all the logic to manage an active task graph.
+	 * All the tasks created by the graph are inserted to the graph's job group, so that the graph can be completed independently.
 	 */
 	class TaskGraph final
 	{
@@ -35,7 +36,7 @@ namespace Xenon
 		XENON_NODISCARD std::shared_ptr<TaskNode> create(Function&& function, const std::shared_ptr<TaskNodes>&... pTasks)
 		{
 			constexpr auto parentCount = sizeof...(pTasks);
-			auto pChild = std::make_shared<TaskNode>(m_JobSystem, std::forward<Function>(function), parentCount);
+			auto pChild = std::allocate_shared<TaskNode>(ObjectPoolAllocator<TaskNode>(), m_JobSystem, std::forward<Function>(function), parentCount, &m_JobGroup);
 
 			if constexpr (parentCount > 0)
 				(pTasks->addDependency(pChild), ...);
@@ -55,7 +56,7 @@ namespace Xenon
 		template<class Function>
 		XENON_NODISCARD std::shared_ptr<TaskNode> create(Function&& function, const std::vector<std::shared_ptr<TaskNode>>& pTasks)
 		{
-			auto pChild = std::make_shared<TaskNode>(m_JobSystem, std::forward<Function>(function), pTasks.size());
+			auto pChild = std::allocate_shared<TaskNode>(ObjectPoolAllocator<TaskNode>(), m_JobSystem, std::forward<Function>(function), pTasks.size(), &m_JobGroup);
 			for (const auto& pTask : pTasks)
 				pTask->addDependency(pChild);
 
@@ -63,11 +64,13 @@ namespace Xenon
 		}
 
 		/**
-		 * Wait till all the tasks have been completed.
+		 * Wait till all the tasks of this graph have been completed.
+		 * This will not wait for the other jobs in the job system.
 		 */
-		void complete() { m_JobSystem.wait(); }
+		void complete() { m_JobSystem.wait(m_JobGroup); }
 
 	private:
 		JobSystem& m_JobSystem;
+		JobGroup m_JobGroup;
 	};
 }
\ No newline at end of file
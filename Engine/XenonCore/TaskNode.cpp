@@ -23,7 +23,11 @@ namespace Xenon
 
 	void TaskNode::insertThis()
 	{
-		m_JobSystem.insert([pThis = shared_from_this()] { pThis->run(); });
+		if (m_pJobGroup)
+			m_JobSystem.insertDetached(*m_pJobGroup, [pThis = shared_from_this()] { pThis->run(); });
+
+		else
+			m_JobSystem.insertDetached([pThis = shared_from_this()] { pThis->run(); });
 	}
 
 	void TaskNode::addDependency(const std::shared_ptr<TaskNode>& pNode)
@@ -72,10 +76,15 @@ namespace Xenon
 		signalChildren();
 
 		m_Completed = true;
+		m_Completed.notify_all();
 	}
 
 	void TaskNode::wait() const
 	{
-		while (!isComplete());
+		while (!isComplete())
+		{
+			if (!m_JobSystem.executeOne())
+				m_Completed.wait(false);
+		}
 	}
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "JobSystem.hpp"
+#include "ObjectPool.hpp"
 
 namespace Xenon
 {
@@ -23,10 +24,12 @@ namespace Xenon
 		 * @param jobSystem The job system.
 		 * @param function The function to run.
 		 * @param waitCount The number of parent tasks to wait on.
+		 * @param pJobGroup The job group to insert the task to. Default is nullptr.
 		 */
 		template<class Function>
-		explicit TaskNode(JobSystem& jobSystem, Function&& function, uint64_t waitCount)
+		explicit TaskNode(JobSystem& jobSystem, Function&& function, uint64_t waitCount, JobGroup* pJobGroup = nullptr)
 			: m_JobSystem(jobSystem)
+			, m_pJobGroup(pJobGroup)
 			, m_Task(std::forward<Function>(function))
 			, m_WaitCount(waitCount)
 		{
@@ -48,7 +51,7 @@ namespace Xenon
 		template<class Function>
 		XENON_NODISCARD std::shared_ptr<TaskNode> then(Function&& function)
 		{
-			auto pChild = std::make_shared<TaskNode>(m_JobSystem, std::forward<Function>(function), 1);
+			auto pChild = std::allocate_shared<TaskNode>(ObjectPoolAllocator<TaskNode>(), m_JobSystem, std::forward<Function>(function), 1, m_pJobGroup);
 			addDependency(pChild);
 
 			return pChild;
@@ -92,6 +95,7 @@ namespace Xenon
 
 		/**
 		 * Wait till the node has been executed.
+		 * The calling thread will execute pending jobs while waiting, and will block if there's nothing to execute.
 		 * Make sure to call start before calling this method!
 		 */
 		void wait() const;
@@ -132,6 +136,7 @@ namespace Xenon
 
 	private:
 		JobSystem& m_JobSystem;
+		JobGroup* m_pJobGroup = nullptr;
 
 		std::vector<std::shared_ptr<TaskNode>> m_pChildren;
 
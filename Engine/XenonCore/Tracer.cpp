@@ -0,0 +1,407 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Tracer.hpp"
+#include "Logging.hpp"
+
+#include <mutex>
+#include <vector>
+#include <fstream>
+#include <limits>
+#include <unordered_map>
+
+namespace /* anonymous */
+{
+	/**
+	 * Tracer state structure.
+	 * This is intentionally leaked so that threads can keep recording while the static objects are destroyed.
+	 */
+	struct TracerState final
+	{
+		/**
+		 * Default constructor.
+		 * This records the first calibration point which is used to convert the time stamps to time.
+		 */
+		TracerState()
+			: m_CalibrationTimestamp(Xenon::Tracer::GetTimestamp())
+			, m_CalibrationTime(std::chrono::steady_clock::now())
+		{
+		}
+
+		std::mutex m_Mutex;
+		std::vector<std::unique_ptr<Xenon::Detail::TraceBuffer>> m_pBuffers;
+
+		// The first name is the invalid scope's, so that the IDs can be used as indexes.
+		std::vector<const char*> m_pScopeNames = { "" };
+		std::unordered_map<const char*, Xenon::TraceScopeID> m_ScopeIDs;
+
+		std::filesystem::path m_CaptureFile;
+		uint32_t m_CaptureFramesLeft = 0;
+		bool m_IsCapturing = false;
+
+		uint64_t m_CalibrationTimestamp = 0;
+		std::chrono::steady_clock::time_point m_CalibrationTime;
+
+		uint64_t m_StartTimestamp = 0;
+		uint64_t m_StopTimestamp = std::numeric_limits<uint64_t>::max();
+
+		std::atomic_bool m_HasPendingCapture = false;
+	};
+
+	/**
+	 * Get the tracer state.
+	 *
+	 * @return The state reference.
+	 */
+	TracerState& GetState()
+	{
+		static auto pState = new TracerState();
+		return *pState;
+	}
+
+	/**
+	 * Plain trace event structure.
+	 * This is a copy of a trace event which was taken while dumping.
+	 */
+	struct CopiedEvent final
+	{
+		uint64_t m_Begin = 0;
+		uint64_t m_End = 0;
+		Xenon::TraceScopeID m_ScopeID = Xenon::Tracer::InvalidScope;
+	};
+
+	/**
+	 * Copy the events of a trace buffer.
+	 * The owning thread might be writing to the buffer at the same time, so the events which could have been overwritten while copying
+	 * are discarded.
+	 *
+	 * @param buffer The buffer to copy from.
+	 * @param events The vector to copy the events to.
+	 */
+	void CopyEvents(const Xenon::Detail::TraceBuffer& buffer, std::vector<CopiedEvent>& events)
+	{
+		const auto capacity = buffer.m_Mask + 1;
+		const auto count = buffer.m_Count.load(std::memory_order_acquire);
+		const auto first = count > capacity ? count - capacity : 0;
+		const auto offset = events.size();
+
+		for (auto i = first; i < count; i++)
+		{
+			const auto& event = buffer.m_pEvents[i & buffer.m_Mask];
+			events.emplace_back(event.m_Begin.load(std::memory_order_relaxed), event.m_End.load(std::memory_order_relaxed), event.m_ScopeID.load(std::memory_order_relaxed));
+		}
+
+		// Event i is overwritten by the write to event i + capacity, which might have been in progress while we copied.
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const auto newCount = buffer.m_Count.load(std::memory_order_relaxed);
+		if (newCount >= first + capacity)
+		{
+			const auto overwritten = std::min(newCount - capacity + 1, count) - first;
+			events.erase(events.begin() + offset, events.begin() + offset + overwritten);
+		}
+	}
+
+	/**
+	 * Get a readable name from a function name.
+	 * GCC and Clang use the full signature as the function name, so the return type and the parameters are removed from it.
+	 *
+	 * @param name The name to clean.
+	 * @return The cleaned name.
+	 */
+	std::string_view CleanFunctionName(std::string_view name)
+	{
+#ifdef _MSC_VER
+		return name;
+
+#else
+		// Names which were given to the scopes don't need to be cleaned.
+		if (name.find('(') == std::string_view::npos)
+			return name;
+
+		constexpr auto anonymousNamespace = std::string_view("(anonymous namespace)");
+		int32_t templateDepth = 0;
+		uint64_t nameBegin = 0;
+
+		for (uint64_t i = 0; i < name.size(); i++)
+		{
+			const auto character = name[i];
+			if (character == '<')
+			{
+				templateDepth++;
+			}
+			else if (character == '>')
+			{
+				templateDepth--;
+			}
+			else if (templateDepth == 0 && character == ' ')
+			{
+				nameBegin = i + 1;
+			}
+			else if (templateDepth == 0 && name.substr(i).starts_with(anonymousNamespace))
+			{
+				i += anonymousNamespace.size() - 1;
+			}
+			else if (templateDepth == 0 && character == '(')
+			{
+				// Lambdas are named like "Class::function()::<lambda()>", so keep the parameters if this is not the last scope.
+				const auto parameterEnd = name.find(')', i);
+				if (parameterEnd != std::string_view::npos && name.substr(parameterEnd + 1).starts_with("::"))
+				{
+					i = parameterEnd;
+					continue;
+				}
+
+				return name.substr(nameBegin, i - nameBegin);
+			}
+		}
+
+		return name.substr(nameBegin);
+
+#endif
+	}
+
+	/**
+	 * Append a JSON string to the buffer.
+	 *
+	 * @param buffer The buffer to append to.
+	 * @param string The string to append.
+	 */
+	void AppendJsonString(fmt::memory_buffer& buffer, std::string_view string)
+	{
+		buffer.push_back('"');
+		for (const auto character : string)
+		{
+			if (character == '"' || character == '\\')
+			{
+				buffer.push_back('\\');
+				buffer.push_back(character);
+			}
+			else if (static_cast<unsigned char>(character) < 0x20)
+			{
+				fmt::format_to(fmt::appender(buffer), "\\u{:04x}", static_cast<uint32_t>(character));
+			}
+			else
+			{
+				buffer.push_back(character);
+			}
+		}
+
+		buffer.push_back('"');
+	}
+
+	/**
+	 * Start recording.
+	 * The state mutex must be locked when calling this.
+	 *
+	 * @param state The tracer state.
+	 */
+	void StartRecording(TracerState& state)
+	{
+		state.m_StartTimestamp = Xenon::Tracer::GetTimestamp();
+		state.m_StopTimestamp = std::numeric_limits<uint64_t>::max();
+		Xenon::Detail::g_IsTracing.store(true, std::memory_order_relaxed);
+	}
+
+	/**
+	 * Stop recording.
+	 * The state mutex must be locked when calling this.
+	 *
+	 * @param state The tracer state.
+	 */
+	void StopRecording(TracerState& state)
+	{
+		Xenon::Detail::g_IsTracing.store(false, std::memory_order_relaxed);
+		state.m_StopTimestamp = Xenon::Tracer::GetTimestamp();
+	}
+
+	/**
+	 * Write the recorded events to a file.
+	 * The state mutex must be locked when calling this.
+	 *
+	 * @param state The tracer state.
+	 * @param file The file to write to.
+	 * @return True if the file was written.
+	 * @return False if the file could not be opened.
+	 */
+	bool WriteTrace(TracerState& state, const std::filesystem::path& file)
+	{
+		auto outputFile = std::ofstream(file, std::ios::out | std::ios::binary);
+		if (!outputFile.is_open())
+		{
+			XENON_LOG_ERROR("Failed to open the trace file {}!", file.string());
+			return false;
+		}
+
+		// Convert the ticks to microseconds using the time elapsed since the first calibration point.
+		const auto timestamp = Xenon::Tracer::GetTimestamp();
+		const auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - state.m_CalibrationTime).count();
+		const auto ticksToMicroseconds = timestamp > state.m_CalibrationTimestamp ? elapsed / static_cast<double>(timestamp - state.m_CalibrationTimestamp) : 0.0;
+		const auto stopTimestamp = std::min(state.m_StopTimestamp, timestamp);
+
+		// The names are only cleaned for the scopes which are written.
+		std::vector<std::string_view> names(state.m_pScopeNames.size());
+		std::vector<CopiedEvent> events;
+		events.reserve(Xenon::Tracer::EventsPerThread);
+
+		auto buffer = fmt::memory_buffer();
+		fmt::format_to(fmt::appender(buffer), "{{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+		bool isFirst = true;
+		const auto beginEvent = [&buffer, &isFirst]
+		{
+			if (!isFirst)
+				buffer.push_back(',');
+
+			buffer.append(std::string_view("\n"));
+			isFirst = false;
+		};
+
+		for (const auto& pBuffer : state.m_pBuffers)
+		{
+			beginEvent();
+			fmt::format_to(fmt::appender(buffer), "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":", pBuffer->m_ThreadID);
+			AppendJsonString(buffer, pBuffer->m_ThreadName.empty() ? fmt::format("Thread {}", pBuffer->m_ThreadID) : pBuffer->m_ThreadName);
+			buffer.append(std::string_view("}}"));
+
+			events.clear();
+			CopyEvents(*pBuffer, events);
+
+			for (const auto& event : events)
+			{
+				if (event.m_Begin < state.m_StartTimestamp || event.m_End > stopTimestamp || event.m_ScopeID >= names.size())
+					continue;
+
+				auto& name = names[event.m_ScopeID];
+				if (name.empty())
+					name = CleanFunctionName(state.m_pScopeNames[event.m_ScopeID]);
+
+				beginEvent();
+				buffer.append(std::string_view("{\"name\":"));
+				AppendJsonString(buffer, name);
+				fmt::format_to(fmt::appender(buffer), ",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+					pBuffer->m_ThreadID,
+					static_cast<double>(event.m_Begin - state.m_StartTimestamp) * ticksToMicroseconds,
+					static_cast<double>(event.m_End - event.m_Begin) * ticksToMicroseconds);
+			}
+
+			// Write the buffer in chunks so that we don't keep the whole trace in memory.
+			outputFile.write(buffer.data(), buffer.size());
+			buffer.clear();
+		}
+
+		buffer.append(std::string_view("\n]}\n"));
+		outputFile.write(buffer.data(), buffer.size());
+
+		XENON_LOG_INFORMATION("The trace was written to {}.", file.string());
+		return true;
+	}
+}
+
+namespace Xenon
+{
+	void Tracer::Start()
+	{
+		auto& state = GetState();
+		const auto lock = std::scoped_lock(state.m_Mutex);
+		StartRecording(state);
+	}
+
+	void Tracer::Stop()
+	{
+		auto& state = GetState();
+		const auto lock = std::scoped_lock(state.m_Mutex);
+		StopRecording(state);
+	}
+
+	bool Tracer::Dump(const std::filesystem::path& file)
+	{
+		auto& state = GetState();
+		const auto lock = std::scoped_lock(state.m_Mutex);
+		return WriteTrace(state, file);
+	}
+
+	void Tracer::CaptureFrames(uint32_t frameCount, const std::filesystem::path& file)
+	{
+		auto& state = GetState();
+		const auto lock = std::scoped_lock(state.m_Mutex);
+
+		if (state.m_HasPendingCapture.load(std::memory_order_relaxed))
+		{
+			XENON_LOG_WARNING("A frame capture is already in progress!");
+			return;
+		}
+
+		state.m_CaptureFile = file;
+		state.m_CaptureFramesLeft = std::max(frameCount, 1u);
+		state.m_IsCapturing = false;
+		state.m_HasPendingCapture.store(true, std::memory_order_relaxed);
+	}
+
+	bool Tracer::IsCapturingFrames() noexcept
+	{
+		return GetState().m_HasPendingCapture.load(std::memory_order_relaxed);
+	}
+
+	void Tracer::MarkFrame()
+	{
+		auto& state = GetState();
+		if (!state.m_HasPendingCapture.load(std::memory_order_relaxed))
+			return;
+
+		const auto lock = std::scoped_lock(state.m_Mutex);
+
+		// Start recording at the first frame marker after the capture was requested.
+		if (!state.m_IsCapturing)
+		{
+			StartRecording(state);
+			state.m_IsCapturing = true;
+			return;
+		}
+
+		if (--state.m_CaptureFramesLeft == 0)
+		{
+			StopRecording(state);
+			WriteTrace(state, state.m_CaptureFile);
+
+			state.m_IsCapturing = false;
+			state.m_HasPendingCapture.store(false, std::memory_order_relaxed);
+		}
+	}
+
+	void Tracer::SetThreadName(std::string_view name)
+	{
+		auto pBuffer = Detail::g_pTraceBuffer;
+		if (!pBuffer)
+			pBuffer = CreateThreadBuffer();
+
+		auto& state = GetState();
+		const auto lock = std::scoped_lock(state.m_Mutex);
+		pBuffer->m_ThreadName = name;
+	}
+
+	TraceScopeID Tracer::RegisterScope(const char* pName)
+	{
+		auto& state = GetState();
+		const auto lock = std::scoped_lock(state.m_Mutex);
+
+		const auto [itr, isInserted] = state.m_ScopeIDs.try_emplace(pName, static_cast<TraceScopeID>(state.m_pScopeNames.size()));
+		if (isInserted)
+			state.m_pScopeNames.emplace_back(pName);
+
+		return itr->second;
+	}
+
+	Detail::TraceBuffer* Tracer::CreateThreadBuffer()
+	{
+		auto& state = GetState();
+		const auto lock = std::scoped_lock(state.m_Mutex);
+
+		// The buffers are kept after the threads exit so that their events can still be written. The threads which are not named
+		// are named when the trace is written.
+		const auto threadID = static_cast<uint32_t>(state.m_pBuffers.size());
+		auto& pBuffer = state.m_pBuffers.emplace_back(std::make_unique<Detail::TraceBuffer>(EventsPerThread, threadID));
+
+		Detail::g_pTraceBuffer = pBuffer.get();
+		return pBuffer.get();
+	}
+}
@@ -0,0 +1,362 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <optick.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <chrono>
+#include <filesystem>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+
+#endif
+
+namespace Xenon
+{
+	/**
+	 * Trace scope ID type.
+	 * Every scope name is registered once and the events only store it's ID. The names are resolved when the trace is written.
+	 */
+	using TraceScopeID = uint32_t;
+
+	/**
+	 * Trace event structure.
+	 * This contains a single completed scope, as the raw time stamps and the scope ID. The members are atomic so that the events can be
+	 * read while the owning thread is overwriting the ring buffer, but they are only accessed using relaxed operations which are plain
+	 * loads and stores.
+	 */
+	struct TraceEvent final
+	{
+		std::atomic_uint64_t m_Begin = 0;
+		std::atomic_uint64_t m_End = 0;
+		std::atomic<TraceScopeID> m_ScopeID = 0;
+	};
+
+	namespace Detail
+	{
+		/**
+		 * Trace buffer structure.
+		 * This is a ring buffer which contains the events of a single thread. Once it's full, the oldest events are overwritten.
+		 * The events don't store the thread, since it's known from the buffer when the trace is written.
+		 */
+		struct TraceBuffer final
+		{
+			/**
+			 * Explicit constructor.
+			 *
+			 * @param capacity The number of events the buffer can hold. This must be a power of 2.
+			 * @param threadID The ID of the owning thread.
+			 */
+			explicit TraceBuffer(uint64_t capacity, uint32_t threadID) : m_pEvents(std::make_unique<TraceEvent[]>(capacity)), m_Mask(capacity - 1), m_ThreadID(threadID) {}
+
+			std::unique_ptr<TraceEvent[]> m_pEvents;
+			std::string m_ThreadName;
+
+			uint64_t m_Mask = 0;
+			uint32_t m_ThreadID = 0;
+
+			std::atomic_uint64_t m_Count = 0;
+		};
+
+		/**
+		 * Whether the tracer is recording.
+		 */
+		inline std::atomic_bool g_IsTracing = false;
+
+		/**
+		 * The calling thread's trace buffer.
+		 */
+		inline thread_local TraceBuffer* g_pTraceBuffer = nullptr;
+
+		/**
+		 * The name and the ID of the last dynamic scope the calling thread recorded.
+		 * Dynamic scopes usually repeat (like the job system's scope), so this skips the registration for them.
+		 */
+		inline thread_local const char* g_pLastDynamicScopeName = nullptr;
+		inline thread_local TraceScopeID g_LastDynamicScopeID = 0;
+
+		/**
+		 * Get the name of a trace scope.
+		 * The scope macros pass the name as "" __VA_ARGS__, so an empty name means that the function name should be used.
+		 *
+		 * @param pFunction The function name.
+		 * @param pName The scope name.
+		 * @return The name to use.
+		 */
+		XENON_NODISCARD constexpr const char* GetTraceScopeName(const char* pFunction, const char* pName) noexcept
+		{
+			return pName[0] == '\0' ? pFunction : pName;
+		}
+	}
+
+	/**
+	 * Tracer class.
+	 * This is a lightweight CPU timeline recorder which works without attaching the Optick GUI (for example on headless machines). Every
+	 * XENON_TRACE_* scope is recorded as a Chrome trace event into the calling thread's ring buffer, and the events can be written to a
+	 * JSON file on demand or for a fixed number of frames. The file can be opened using chrome://tracing or the Perfetto UI.
+	 *
+	 * Each scope's name is registered once (by the first call at that site), so recording a scope takes two time stamp counter reads and
+	 * storing them along with the scope ID to a thread local buffer. The names are cleaned up and the threads are named when the trace
+	 * is written. When the tracer is not recording, a scope costs a single relaxed load.
+	 */
+	class Tracer final
+	{
+	public:
+		/**
+		 * The number of events each thread's ring buffer can hold.
+		 */
+		static constexpr uint64_t EventsPerThread = 1 << 16;
+
+		/**
+		 * The scope ID which is never registered.
+		 */
+		static constexpr TraceScopeID InvalidScope = 0;
+
+		/**
+		 * Start recording.
+		 * Only the events which begin after this are written to the trace.
+		 */
+		static void Start();
+
+		/**
+		 * Stop recording.
+		 * Only the events which end before this are written to the trace.
+		 */
+		static void Stop();
+
+		/**
+		 * Check if the tracer is recording.
+		 *
+		 * @return True if the tracer is recording.
+		 * @return False if the tracer is not recording.
+		 */
+		XENON_NODISCARD static bool IsRecording() noexcept { return Detail::g_IsTracing.load(std::memory_order_relaxed); }
+
+		/**
+		 * Write the recorded events to a Chrome trace JSON file.
+		 * This can be called while recording, in which case the events which ended so far are written.
+		 * Note that if a thread recorded more than EventsPerThread events, only the latest ones are available.
+		 *
+		 * @param file The file to write to.
+		 * @return True if the file was written.
+		 * @return False if the file could not be opened.
+		 */
+		static bool Dump(const std::filesystem::path& file);
+
+		/**
+		 * Record a number of frames and write them to a file.
+		 * Recording starts at the next frame marker and the file is written (by the thread which marks the frames) once the frames are
+		 * recorded.
+		 *
+		 * @param frameCount The number of frames to record.
+		 * @param file The file to write to.
+		 */
+		static void CaptureFrames(uint32_t frameCount, const std::filesystem::path& file);
+
+		/**
+		 * Check if a frame capture is pending or in progress.
+		 *
+		 * @return True if a frame capture is active.
+		 * @return False if no frames are being captured.
+		 */
+		XENON_NODISCARD static bool IsCapturingFrames() noexcept;
+
+		/**
+		 * Mark the beginning of a new frame.
+		 * This is called by XENON_TRACE_FRAME.
+		 */
+		static void MarkFrame();
+
+		/**
+		 * Set the name of the calling thread.
+		 * This is called by XENON_TRACE_THREAD. Threads which are not named are written as "Thread <index>".
+		 *
+		 * @param name The thread name.
+		 */
+		static void SetThreadName(std::string_view name);
+
+		/**
+		 * Register a scope name.
+		 * This is called once per scope site by XENON_TRACE_SCOPE and XENON_TRACE_FRAME. Registering the same pointer again returns the
+		 * same ID.
+		 *
+		 * @param pName The scope name. This must outlive the trace (like a string literal).
+		 * @return The scope ID.
+		 */
+		static TraceScopeID RegisterScope(const char* pName);
+
+		/**
+		 * Get the ID of a dynamic scope name.
+		 * This is used by XENON_TRACE_SCOPE_DYNAMIC, and only registers the name if it's not the calling thread's last dynamic scope.
+		 *
+		 * @param pName The scope name. This must outlive the trace.
+		 * @return The scope ID.
+		 */
+		XENON_NODISCARD static TraceScopeID GetDynamicScopeID(const char* pName)
+		{
+			if (Detail::g_pLastDynamicScopeName != pName)
+			{
+				Detail::g_LastDynamicScopeID = RegisterScope(pName);
+				Detail::g_pLastDynamicScopeName = pName;
+			}
+
+			return Detail::g_LastDynamicScopeID;
+		}
+
+		/**
+		 * Get the current time stamp.
+		 * This uses the processor's time stamp counter where available, and the steady clock (in nanoseconds) otherwise. The ticks are
+		 * converted to time when the events are written.
+		 *
+		 * @return The time stamp in ticks.
+		 */
+		XENON_NODISCARD static uint64_t GetTimestamp() noexcept
+		{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+			return __rdtsc();
+
+#else
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+#endif
+		}
+
+		/**
+		 * Record a completed scope to the calling thread's buffer.
+		 *
+		 * @param scopeID The scope ID.
+		 * @param begin The begin time stamp.
+		 * @param end The end time stamp.
+		 */
+		static void Record(TraceScopeID scopeID, uint64_t begin, uint64_t end)
+		{
+			auto pBuffer = Detail::g_pTraceBuffer;
+			if (!pBuffer)
+				pBuffer = CreateThreadBuffer();
+
+			const auto index = pBuffer->m_Count.load(std::memory_order_relaxed);
+			auto& event = pBuffer->m_pEvents[index & pBuffer->m_Mask];
+			event.m_Begin.store(begin, std::memory_order_relaxed);
+			event.m_End.store(end, std::memory_order_relaxed);
+			event.m_ScopeID.store(scopeID, std::memory_order_relaxed);
+
+			pBuffer->m_Count.store(index + 1, std::memory_order_release);
+		}
+
+	private:
+		/**
+		 * Create the calling thread's buffer.
+		 *
+		 * @return The buffer pointer.
+		 */
+		static Detail::TraceBuffer* CreateThreadBuffer();
+	};
+
+	/**
+	 * Trace scope class.
+	 * This records the time between it's construction and destruction if the tracer is recording.
+	 */
+	class TraceScope final
+	{
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param scopeID The registered scope ID.
+		 */
+		explicit TraceScope(TraceScopeID scopeID) noexcept
+		{
+			if (Tracer::IsRecording())
+			{
+				m_ScopeID = scopeID;
+				m_Begin = Tracer::GetTimestamp();
+			}
+		}
+
+		/**
+		 * Explicit constructor.
+		 * This is used for the dynamic scopes, which are registered when they are recorded.
+		 *
+		 * @param pName The scope name. This must outlive the trace.
+		 */
+		explicit TraceScope(const char* pName)
+		{
+			if (Tracer::IsRecording())
+			{
+				m_ScopeID = Tracer::GetDynamicScopeID(pName);
+				m_Begin = Tracer::GetTimestamp();
+			}
+		}
+
+		/**
+		 * Destructor.
+		 */
+		~TraceScope()
+		{
+			if (m_ScopeID != Tracer::InvalidScope)
+				Tracer::Record(m_ScopeID, m_Begin, Tracer::GetTimestamp());
+		}
+
+		XENON_DISABLE_COPY(TraceScope);
+		XENON_DISABLE_MOVE(TraceScope);
+
+	private:
+		uint64_t m_Begin = 0;
+		TraceScopeID m_ScopeID = Tracer::InvalidScope;
+	};
+}
+
+#ifdef _MSC_VER
+#	define XENON_TRACE_FUNCTION_NAME									__FUNCTION__
+
+#else
+#	define XENON_TRACE_FUNCTION_NAME									__PRETTY_FUNCTION__
+
+#endif
+
+#define XENON_TRACE_CONCATENATE_IMPLEMENTATION(first, second)			first##second
+#define XENON_TRACE_CONCATENATE(first, second)							XENON_TRACE_CONCATENATE_IMPLEMENTATION(first, second)
+
+/**
+ * Trace the current scope using Optick and the built-in tracer.
+ * The optional name must be a string literal. If it's not provided, the function name is used.
+ */
+#define XENON_TRACE_SCOPE(...)																											\
+	OPTICK_EVENT(__VA_ARGS__);																											\
+	static const auto XENON_TRACE_CONCATENATE(xenonTraceScopeID, __LINE__) = ::Xenon::Tracer::RegisterScope(::Xenon::Detail::GetTraceScopeName(XENON_TRACE_FUNCTION_NAME, "" __VA_ARGS__));	\
+	const ::Xenon::TraceScope XENON_TRACE_CONCATENATE(xenonTraceScope, __LINE__)(XENON_TRACE_CONCATENATE(xenonTraceScopeID, __LINE__))
+
+/**
+ * Trace the current scope using an Optick dynamic event and the built-in tracer.
+ * The built-in tracer registers the name pointer when the scope is recorded, so the name must outlive the trace.
+ */
+#define XENON_TRACE_SCOPE_DYNAMIC(name)																									\
+	OPTICK_EVENT_DYNAMIC(name);																											\
+	const ::Xenon::TraceScope XENON_TRACE_CONCATENATE(xenonTraceScope, __LINE__)(name)
+
+/**
+ * Name the current thread in Optick and the built-in tracer.
+ */
+#define XENON_TRACE_THREAD(name)																										\
+	OPTICK_THREAD(name);																												\
+	::Xenon::Tracer::SetThreadName(name)
+
+/**
+ * Mark the beginning of a new frame and trace the rest of the scope as the frame.
+ * The name must be a string literal.
+ */
+#define XENON_TRACE_FRAME(name)																											\
+	OPTICK_FRAME(name);																													\
+	::Xenon::Tracer::MarkFrame();																										\
+	static const auto XENON_TRACE_CONCATENATE(xenonTraceScopeID, __LINE__) = ::Xenon::Tracer::RegisterScope(name);						\
+	const ::Xenon::TraceScope XENON_TRACE_CONCATENATE(xenonTraceScope, __LINE__)(XENON_TRACE_CONCATENATE(xenonTraceScopeID, __LINE__))
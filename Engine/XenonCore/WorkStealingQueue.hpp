@@ -0,0 +1,204 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Common.hpp"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <optional>
+#include <cstdint>
+
+namespace Xenon
+{
+	/**
+	 * Work stealing queue class.
+	 * This is a lock-free Chase-Lev deque. The owning thread pushes and pops from the bottom (LIFO) while any other thread can
+	 * steal from the top (FIFO). The queue grows when it's full and the old buffers are retained until the queue is destroyed,
+	 * so that a concurrent thief never reads from freed memory.
+	 *
+	 * Note that push() and pop() must only be called by the owning thread.
+	 *
+	 * @tparam Type The stored type. This must be trivially copyable (usually a pointer).
+	 */
+	template<class Type>
+	class WorkStealingQueue final
+	{
+		static_assert(std::is_trivially_copyable_v<Type>, "The work stealing queue type must be trivially copyable!");
+
+		/**
+		 * Ring buffer structure.
+		 * This contains the actual storage of the queue.
+		 */
+		struct RingBuffer final
+		{
+			/**
+			 * Explicit constructor.
+			 *
+			 * @param capacity The buffer capacity. This must be a power of 2.
+			 */
+			explicit RingBuffer(int64_t capacity) : m_Capacity(capacity), m_Mask(capacity - 1), m_pEntries(std::make_unique<std::atomic<Type>[]>(capacity)) {}
+
+			/**
+			 * Store an entry at a given index.
+			 *
+			 * @param index The index to store at.
+			 * @param entry The entry to store.
+			 */
+			void store(int64_t index, Type entry) noexcept { m_pEntries[index & m_Mask].store(entry, std::memory_order_relaxed); }
+
+			/**
+			 * Load an entry from a given index.
+			 *
+			 * @param index The index to load from.
+			 * @return The entry.
+			 */
+			XENON_NODISCARD Type load(int64_t index) const noexcept { return m_pEntries[index & m_Mask].load(std::memory_order_relaxed); }
+
+			const int64_t m_Capacity;
+			const int64_t m_Mask;
+			std::unique_ptr<std::atomic<Type>[]> m_pEntries;
+		};
+
+	public:
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param capacity The initial capacity of the queue. This must be a power of 2. Default is 1024.
+		 */
+		explicit WorkStealingQueue(int64_t capacity = 1024)
+		{
+			m_pBuffers.emplace_back(std::make_unique<RingBuffer>(capacity));
+			m_pBuffer.store(m_pBuffers.back().get(), std::memory_order_relaxed);
+		}
+
+		/**
+		 * Push a new entry to the bottom of the queue.
+		 * This must only be called by the owning thread.
+		 *
+		 * @param entry The entry to push.
+		 */
+		void push(Type entry)
+		{
+			const auto bottom = m_Bottom.load(std::memory_order_relaxed);
+			const auto top = m_Top.load(std::memory_order_acquire);
+			auto pBuffer = m_pBuffer.load(std::memory_order_relaxed);
+
+			// Grow the buffer if we're full.
+			if (bottom - top > pBuffer->m_Capacity - 1)
+				pBuffer = grow(pBuffer, top, bottom);
+
+			pBuffer->store(bottom, entry);
+			std::atomic_thread_fence(std::memory_order_release);
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		/**
+		 * Pop an entry from the bottom of the queue.
+		 * This must only be called by the owning thread.
+		 *
+		 * @return The popped entry if the queue was not empty.
+		 */
+		XENON_NODISCARD std::optional<Type> pop()
+		{
+			const auto bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+			const auto pBuffer = m_pBuffer.load(std::memory_order_relaxed);
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			auto top = m_Top.load(std::memory_order_relaxed);
+
+			// The queue is empty, restore the bottom.
+			if (top > bottom)
+			{
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return std::nullopt;
+			}
+
+			std::optional<Type> entry = pBuffer->load(bottom);
+
+			// If this is the last entry, we need to race against the thieves for it.
+			if (top == bottom)
+			{
+				if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					entry = std::nullopt;
+
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			return entry;
+		}
+
+		/**
+		 * Steal an entry from the top of the queue.
+		 * This can be called by any thread.
+		 *
+		 * @return The stolen entry if the queue was not empty and we won the race.
+		 */
+		XENON_NODISCARD std::optional<Type> steal()
+		{
+			auto top = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const auto bottom = m_Bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+				return std::nullopt;
+
+			const auto entry = m_pBuffer.load(std::memory_order_acquire)->load(top);
+			if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return std::nullopt;
+
+			return entry;
+		}
+
+		/**
+		 * Check if the queue is empty.
+		 * Note that the result could be outdated by the time it's used if other threads are accessing the queue.
+		 *
+		 * @return True if the queue is empty.
+		 * @return False if the queue is not empty.
+		 */
+		XENON_NODISCARD bool empty() const noexcept { return size() == 0; }
+
+		/**
+		 * Get the approximate number of entries in the queue.
+		 *
+		 * @return The entry count.
+		 */
+		XENON_NODISCARD uint64_t size() const noexcept
+		{
+			const auto bottom = m_Bottom.load(std::memory_order_relaxed);
+			const auto top = m_Top.load(std::memory_order_relaxed);
+			return bottom > top ? static_cast<uint64_t>(bottom - top) : 0;
+		}
+
+	private:
+		/**
+		 * Grow the ring buffer to twice it's size.
+		 * The old buffer is kept alive since a thief might still be reading from it.
+		 *
+		 * @param pBuffer The current buffer pointer.
+		 * @param top The top index.
+		 * @param bottom The bottom index.
+		 * @return The new buffer pointer.
+		 */
+		XENON_NODISCARD RingBuffer* grow(RingBuffer* pBuffer, int64_t top, int64_t bottom)
+		{
+			auto& pNewBuffer = m_pBuffers.emplace_back(std::make_unique<RingBuffer>(pBuffer->m_Capacity * 2));
+			for (auto i = top; i < bottom; i++)
+				pNewBuffer->store(i, pBuffer->load(i));
+
+			m_pBuffer.store(pNewBuffer.get(), std::memory_order_release);
+			return pNewBuffer.get();
+		}
+
+	private:
+		alignas(64) std::atomic<int64_t> m_Top = 0;
+		alignas(64) std::atomic<int64_t> m_Bottom = 0;
+		alignas(64) std::atomic<RingBuffer*> m_pBuffer = nullptr;
+
+		std::vector<std::unique_ptr<RingBuffer>> m_pBuffers;
+	};
+}
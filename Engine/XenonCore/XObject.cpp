@@ -7,7 +7,13 @@ namespace Xenon
 {
 	Xenon::JobSystem& XObject::GetJobSystem()
 	{
-		static auto jobSystem = JobSystem(std::thread::hardware_concurrency() - 1);	// We leave one here for the parent thread..
+		static auto jobSystem = JobSystem(JobSystemConfiguration());
 		return jobSystem;
 	}
+
+	Xenon::FrameArena& XObject::GetFrameArena()
+	{
+		static FrameArena frameArena;
+		return frameArena;
+	}
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "JobSystem.hpp"
+#include "FrameArena.hpp"
 
 namespace Xenon
 {
@@ -31,5 +32,13 @@ namespace Xenon
 		 * @return The job system reference.
 		 */
 		XENON_NODISCARD static JobSystem& GetJobSystem();
+
+		/**
+		 * Get the internal global frame arena.
+		 * This is reset by the renderer at the start of every frame.
+		 *
+		 * @return The frame arena reference.
+		 */
+		XENON_NODISCARD static FrameArena& GetFrameArena();
 	};
 }
\ No newline at end of file
@@ -4,8 +4,7 @@
 #include "DX12Buffer.hpp"
 #include "DX12Macros.hpp"
 #include "DX12CommandRecorder.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -108,7 +107,7 @@ namespace Xenon
 
 		void DX12Buffer::copy(Buffer* pBuffer, uint64_t size, uint64_t srcOffset /*= 0*/, uint64_t dstOffset /*= 0*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Begin the command list.
 			XENON_DX12_ASSERT(m_CommandAllocator->Reset(), "Failed to reset the current command allocator!");
@@ -147,7 +146,7 @@ namespace Xenon
 
 		void DX12Buffer::write(const std::byte* pData, uint64_t size, uint64_t offset /*= 0*/, CommandRecorder* pCommandRecorder /*= nullptr*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// If we are made to copy, just copy.
 			if (m_HeapType == D3D12_HEAP_TYPE_UPLOAD && m_CurrentState == D3D12_RESOURCE_STATE_GENERIC_READ)
@@ -191,21 +190,21 @@ namespace Xenon
 
 		const std::byte* DX12Buffer::beginRead()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			return map();
 		}
 
 		void DX12Buffer::endRead()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			unmap();
 		}
 
 		const std::byte* DX12Buffer::map()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Create the temporary buffer if it's null.
 			if (m_pTemporaryReadBuffer == nullptr)
@@ -222,14 +221,14 @@ namespace Xenon
 
 		void DX12Buffer::unmap()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pTemporaryReadBuffer->getResource()->Unmap(0, nullptr);
 		}
 
 		void DX12Buffer::performCopy(ID3D12GraphicsCommandList* pCommandlist, Buffer* pBuffer, uint64_t size, uint64_t srcOffset /*= 0*/, uint64_t dstOffset /*= 0*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto pSourceBuffer = pBuffer->as<DX12Buffer>();
 
@@ -12,8 +12,8 @@
 #include "DX12RayTracingPipeline.hpp"
 #include "DX12ShaderBindingTable.hpp"
 #include "DX12ComputePipeline.hpp"
+#include "../XenonCore/Tracer.hpp"
 
-#include <optick.h>
 #include <glm/gtc/type_ptr.hpp>
 
 #ifdef XENON_PLATFORM_WINDOWS
@@ -43,7 +43,7 @@ namespace /* anonymous */
 		UINT depthDescriptorIncrementSize,
 		Xenon::Backend::AttachmentType attachmentTypes)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		auto itr = clearValues.begin();
 		auto colorDescriptorHandle = CD3DX12_CPU_DESCRIPTOR_HANDLE(colorDescriptorStart);
@@ -332,7 +332,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::begin()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			wait();
 
@@ -343,7 +343,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::begin(CommandRecorder* pParent)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			begin();
 			m_pParentCommandRecorder = pParent->as<DX12CommandRecorder>();
@@ -351,14 +351,14 @@ namespace Xenon
 
 		void DX12CommandRecorder::copy(Buffer* pSource, uint64_t srcOffset, Buffer* pDestination, uint64_t dstOffset, uint64_t size)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pCurrentCommandList->CopyBufferRegion(pDestination->as<DX12Buffer>()->getResource(), dstOffset, pSource->as<DX12Buffer>()->getResource(), srcOffset, size);
 		}
 
 		void DX12CommandRecorder::copy(Image* pSource, Swapchain* pDestination)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto pDxSource = pSource->as<DX12Image>();
 			auto pDxSwapchin = pDestination->as<DX12Swapchain>();
@@ -426,7 +426,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::copy(Buffer* pSource, uint64_t bufferOffset, Image* pImage, glm::vec3 imageSize, glm::vec3 imageOffset /*= glm::vec3(0)*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			const auto pDxImage = pImage->as<DX12Image>();
 			const auto pDxBuffer = pSource->as<DX12Buffer>();
@@ -487,7 +487,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::copy(Image* pSource, const glm::vec3& sourceOffset, Image* pDestination, const glm::vec3& destinationOffset)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			const auto pDxSourceImage = pSource->as<DX12Image>();
 			const auto pDxDestinationImage = pDestination->as<DX12Image>();
@@ -544,7 +544,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::copyImageLayer(Image* pSource, uint32_t sourceLayer, const glm::vec3& sourceOffset, Image* pDestination, uint32_t destinationLayer, const glm::vec3& destinationOffset)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 			XENON_TODO_NOW("Make sure DX12 is cool with cubemaps");
 
 			const auto pDxSourceImage = pSource->as<DX12Image>();
@@ -602,12 +602,12 @@ namespace Xenon
 
 		void DX12CommandRecorder::resetQuery(OcclusionQuery* pOcclusionQuery)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 		}
 
 		void DX12CommandRecorder::bind(Rasterizer* pRasterizer, const std::vector<Rasterizer::ClearValueType>& clearValues, bool usingSecondaryCommandRecorders /*= false*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			const auto pDxRasterizer = pRasterizer->as<DX12Rasterizer>();
 			const auto hasDepthAttachment = pDxRasterizer->hasTarget(AttachmentType::Depth | AttachmentType::Stencil);
@@ -632,7 +632,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::bind(RasterizingPipeline* pPipeline, const VertexSpecification& vertexSpecification)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			const auto pDxPipeline = pPipeline->as<DX12RasterizingPipeline>();
 			m_pCurrentCommandList->SetGraphicsRootSignature(pDxPipeline->getRootSignature());
@@ -644,7 +644,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::bind(RasterizingPipeline* pPipeline, Descriptor* pUserDefinedDescriptor, Descriptor* pMaterialDescriptor, Descriptor* pPerGeometryDescriptor, Descriptor* pSceneDescriptor)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			const auto& heaps = pPipeline->as<DX12RasterizingPipeline>()->getDescriptorHeapStorage();
 
@@ -704,7 +704,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::bind(Buffer* pVertexBuffer, uint32_t vertexStride)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			D3D12_VERTEX_BUFFER_VIEW vertexView = {};
 			vertexView.BufferLocation = pVertexBuffer->as<DX12Buffer>()->getResource()->GetGPUVirtualAddress();
@@ -716,7 +716,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::bind(Buffer* pIndexBuffer, IndexBufferStride indexStride)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			D3D12_INDEX_BUFFER_VIEW indexView = {};
 			indexView.BufferLocation = pIndexBuffer->as<DX12Buffer>()->getResource()->GetGPUVirtualAddress();
@@ -737,7 +737,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::bind(RayTracingPipeline* pPipeline)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			const auto pDxPipeline = pPipeline->as<DX12RayTracingPipeline>();
 			m_pCurrentCommandList->SetPipelineState1(pDxPipeline->getStateObject());
@@ -748,7 +748,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::bind(RayTracingPipeline* pPipeline, Descriptor* pUserDefinedDescriptor, Descriptor* pMaterialDescriptor, Descriptor* pPerGeometryDescriptor, Descriptor* pSceneDescriptor)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			const auto& heaps = pPipeline->as<DX12RayTracingPipeline>()->getDescriptorHeapStorage();
 
@@ -808,7 +808,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::bind(ComputePipeline* pPipeline)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			const auto pDxPipeline = pPipeline->as<DX12ComputePipeline>();
 			m_pCurrentCommandList->SetComputeRootSignature(pDxPipeline->getRootSignature());
@@ -820,7 +820,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::bind(ComputePipeline* pPipeline, Descriptor* pUserDefinedDescriptor)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 			const auto& heaps = pPipeline->as<DX12ComputePipeline>()->getDescriptorHeapStorage();
 
 			if (pUserDefinedDescriptor)
@@ -839,7 +839,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::setViewport(float x, float y, float width, float height, float minDepth, float maxDepth)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto lock = std::scoped_lock(m_Mutex);
 			if (m_Usage & CommandRecorderUsage::Graphics && !m_pParentCommandRecorder)
@@ -851,7 +851,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::setViewportNatural(float x, float y, float width, float height, float minDepth, float maxDepth)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto lock = std::scoped_lock(m_Mutex);
 			if (m_Usage & CommandRecorderUsage::Graphics && !m_pParentCommandRecorder)
@@ -863,7 +863,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::setScissor(int32_t x, int32_t y, uint32_t width, uint32_t height)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto lock = std::scoped_lock(m_Mutex);
 			if (m_Usage & CommandRecorderUsage::Graphics && !m_pParentCommandRecorder)
@@ -875,14 +875,14 @@ namespace Xenon
 
 		void DX12CommandRecorder::beginQuery(OcclusionQuery* pOcclusionQuery, uint32_t index)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pCurrentCommandList->BeginQuery(pOcclusionQuery->as<DX12OcclusionQuery>()->getHeap(), D3D12_QUERY_TYPE_BINARY_OCCLUSION, index);
 		}
 
 		void DX12CommandRecorder::drawVertices(uint64_t vertexOffset, uint64_t veretxCount, uint32_t instanceCount /*= 1*/, uint32_t firstInstance /*= 0*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pCurrentCommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 			m_pCurrentCommandList->DrawInstanced(static_cast<UINT>(veretxCount), instanceCount, static_cast<UINT>(vertexOffset), firstInstance);
@@ -890,7 +890,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::drawIndexed(uint64_t vertexOffset, uint64_t indexOffset, uint64_t indexCount, uint32_t instanceCount /*= 1*/, uint32_t firstInstance /*= 0*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pCurrentCommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 			m_pCurrentCommandList->DrawIndexedInstanced(static_cast<UINT>(indexCount), instanceCount, static_cast<UINT>(indexOffset), static_cast<UINT>(vertexOffset), firstInstance);
@@ -898,7 +898,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::drawRayTraced(RayTracer* pRayTracer, ShaderBindingTable* pShaderBindingTable)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 			auto pDxBindingTable = pShaderBindingTable->as<DX12ShaderBindingTable>();
 
 			D3D12_DISPATCH_RAYS_DESC desc = {};
@@ -915,20 +915,20 @@ namespace Xenon
 
 		void DX12CommandRecorder::compute(uint32_t width, uint32_t height, uint32_t depth)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 			m_pCurrentCommandList->Dispatch(width, height, depth);
 		}
 
 		void DX12CommandRecorder::endQuery(OcclusionQuery* pOcclusionQuery, uint32_t index)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pCurrentCommandList->EndQuery(pOcclusionQuery->as<DX12OcclusionQuery>()->getHeap(), D3D12_QUERY_TYPE_BINARY_OCCLUSION, index);
 		}
 
 		void DX12CommandRecorder::executeChild(CommandRecorder* pChildRecorder, RasterizingPipeline* pActivePipeline)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto lock = std::scoped_lock(m_Mutex);
 
@@ -943,7 +943,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::executeChild(CommandRecorder* pChildRecorder, RayTracingPipeline* pActivePipeline)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			const auto& heaps = pActivePipeline->as<DX12RayTracingPipeline>()->getDescriptorHeapStorage();
 			m_pCurrentCommandList->SetDescriptorHeaps(static_cast<UINT>(heaps.size()), heaps.data());
@@ -953,12 +953,12 @@ namespace Xenon
 
 		void DX12CommandRecorder::getQueryResults(OcclusionQuery* pOcclusionQuery)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto pDxOcclusionQuery = pOcclusionQuery->as<DX12OcclusionQuery>();
 
 			{
-				OPTICK_EVENT_DYNAMIC("Resolve Query Data");
+				XENON_TRACE_SCOPE_DYNAMIC("Resolve Query Data");
 
 				// Copy the occlusion data from the queue to the buffer.
 				m_pCurrentCommandList->ResolveQueryData(pDxOcclusionQuery->getHeap(), D3D12_QUERY_TYPE_BINARY_OCCLUSION, 0, static_cast<UINT>(pOcclusionQuery->getSampleCount()), pDxOcclusionQuery->getBuffer(), 0);
@@ -967,14 +967,14 @@ namespace Xenon
 
 		void DX12CommandRecorder::buildAccelerationStructure(const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC& desc)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pCurrentCommandList->BuildRaytracingAccelerationStructure(&desc, 0, nullptr);
 		}
 
 		void DX12CommandRecorder::end()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			XENON_DX12_ASSERT(m_pCurrentCommandList->Close(), "Failed to stop the current command list!");
 			m_IsRecording = false;
@@ -982,7 +982,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::next()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			const auto index = incrementIndex();
 			m_pCurrentCommandList = m_pCommandLists[index].Get();
@@ -991,7 +991,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::submit(Swapchain* pSawpchain /*= nullptr*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			ID3D12CommandQueue* pQueue = m_pDevice->getDirectQueue();
 			if (m_Usage & CommandRecorderUsage::Secondary)
@@ -1007,7 +1007,7 @@ namespace Xenon
 
 		void DX12CommandRecorder::wait(uint64_t timeout /*= UINT64_MAX*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			const auto nextFence = m_pCurrentCommandListFence->GetCompletedValue() + 1;
 
@@ -4,8 +4,7 @@
 #include "DX12CommandSubmitter.hpp"
 #include "DX12Macros.hpp"
 #include "DX12CommandRecorder.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -33,7 +32,7 @@ namespace Xenon
 
 		void DX12CommandSubmitter::submit(const std::vector<std::vector<Backend::CommandRecorder*>>& pCommandRecorders, Swapchain* pSwapchain /*= nullptr*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_Fence->Signal(0);
 			for (UINT i = 0; i < static_cast<UINT>(pCommandRecorders.size()); i++)
@@ -55,7 +54,7 @@ namespace Xenon
 
 		void DX12CommandSubmitter::wait(std::chrono::milliseconds timeout /*= std::chrono::milliseconds(UINT64_MAX)*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (m_bIsWaiting)
 			{
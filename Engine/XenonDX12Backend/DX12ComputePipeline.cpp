@@ -4,8 +4,7 @@
 #include "DX12ComputePipeline.hpp"
 #include "DX12Macros.hpp"
 #include "DX12Descriptor.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 // This magic number is used by the rasterizing pipeline to uniquely identify it's pipeline caches.
 constexpr auto g_MagicNumber = 0b0111100101110000101100010000110010100010001110011100010100011001;
@@ -66,7 +65,7 @@ namespace Xenon
 			SetupShaderData(computeShader, m_BindingInfos, m_BindingOffsets, descriptorRanges);
 
 			// Generate the pipeline hash.
-			m_PipelineHash = GenerateHash(ToBytes(computeShader.getDXIL().getBinary().data()), computeShader.getDXIL().getBinary().size() * sizeof(uint64_t));
+			m_PipelineHash = Hasher().combine(computeShader.getDXIL()).getHash();
 
 			// Setup the descriptor heap manager.
 			setupDescriptorHeapManager({ { DescriptorType::UserDefined, m_BindingInfos } });
@@ -80,7 +79,7 @@ namespace Xenon
 
 		std::unique_ptr<Xenon::Backend::Descriptor> DX12ComputePipeline::createDescriptor(DescriptorType type)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			return std::make_unique<DX12Descriptor>(m_pDevice, m_BindingInfos, DescriptorType::UserDefined, m_BindingOffsets, this);
 		}
@@ -111,7 +110,7 @@ namespace Xenon
 
 		std::vector<std::byte> DX12ComputePipeline::loadPipelineSateCache() const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (m_pCacheHandler)
 				return m_pCacheHandler->load(m_PipelineHash ^ g_MagicNumber);
@@ -122,7 +121,7 @@ namespace Xenon
 
 		void DX12ComputePipeline::storePipelineStateCache() const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (m_pCacheHandler)
 			{
@@ -6,8 +6,7 @@
 #include "DX12Buffer.hpp"
 #include "DX12ImageView.hpp"
 #include "DX12ImageSampler.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace /* anonymous */
 {
@@ -84,7 +83,7 @@ namespace Xenon
 
 		void DX12Descriptor::attach(uint32_t binding, Buffer* pBuffer)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Return if we don't have the binding. Might be because of shader optimizations.
 			if (!m_BindingInformation.contains(binding))
@@ -125,7 +124,7 @@ namespace Xenon
 
 		void DX12Descriptor::attach(uint32_t binding, Image* pImage, ImageView* pView, ImageSampler* pSampler, ImageUsage usage)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Return if we don't have the binding. Might be because of shader optimizations.
 			if (!m_BindingInformation.contains(binding))
@@ -3,8 +3,7 @@
 
 #include "DX12DescriptorHeapManager.hpp"
 #include "DX12Macros.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace /* anonymous */
 {
@@ -84,7 +83,7 @@ namespace Xenon
 
 		Xenon::Backend::DX12PipelineDescriptorHeapStorage& DX12DescriptorHeapManager::getDescriptorHeapStorage()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 			auto lock = std::scoped_lock(m_Mutex);
 
 			if (m_IsUpdated)
@@ -142,7 +141,7 @@ namespace Xenon
 
 		std::pair<UINT, UINT> DX12DescriptorHeapManager::setupDescriptor(DescriptorType type)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 			auto lock = std::scoped_lock(m_Mutex);
 
 			// Return from an existing range rather than making a new one.
@@ -180,7 +179,7 @@ namespace Xenon
 
 		UINT DX12DescriptorHeapManager::getNextSize(UINT newSize, UINT oldSize) const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			const auto nextSize = oldSize + oldSize / 2;
 			if (nextSize < newSize)
@@ -191,7 +190,7 @@ namespace Xenon
 
 		void DX12DescriptorHeapManager::incrementHeaps()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
 			heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
@@ -3,8 +3,7 @@
 
 #include "DX12Device.hpp"
 #include "DX12Macros.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -34,7 +33,7 @@ namespace Xenon
 
 		void DX12Device::waitIdle()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Wait for the direct queue.
 			{
@@ -4,8 +4,7 @@
 #include "DX12Image.hpp"
 #include "DX12Macros.hpp"
 #include "DX12Buffer.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace /* anonymous */
 {
@@ -212,7 +211,7 @@ namespace Xenon
 
 		void DX12Image::copyFrom(Buffer* pSrcBuffer, CommandRecorder* pCommandRecorder /*= nullptr*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto pSourceBuffer = pSrcBuffer->as<DX12Buffer>();
 
@@ -307,7 +306,7 @@ namespace Xenon
 
 		void DX12Image::copyFrom(Image* pSrcImage, CommandRecorder* pCommandRecorder /*= nullptr*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto pSourceImage = pSrcImage->as<DX12Image>();
 
@@ -403,7 +402,7 @@ namespace Xenon
 
 		void DX12Image::generateMipMaps(CommandRecorder* pCommandRecorder /*= nullptr*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 		}
 
 		Xenon::Backend::DX12Image& DX12Image::operator=(DX12Image&& other) noexcept
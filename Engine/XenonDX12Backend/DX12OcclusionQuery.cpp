@@ -3,8 +3,7 @@
 
 #include "DX12OcclusionQuery.hpp"
 #include "DX12Macros.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 #ifdef XENON_PLATFORM_WINDOWS
 #include <execution> 
@@ -49,7 +48,7 @@ namespace Xenon
 
 		std::vector<uint64_t> DX12OcclusionQuery::getSamples()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Copy the available data.
 			const D3D12_RANGE mapRange = CD3DX12_RANGE(1, 0);
@@ -3,8 +3,7 @@
 
 #include "DX12Rasterizer.hpp"
 #include "DX12Macros.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -103,7 +102,7 @@ namespace Xenon
 
 		Xenon::Backend::Image* DX12Rasterizer::getImageAttachment(AttachmentType type)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			const auto index = getAttachmentIndex(type);
 			if (index < m_RenderTargets.size())
@@ -115,35 +114,35 @@ namespace Xenon
 
 		D3D12_CPU_DESCRIPTOR_HANDLE DX12Rasterizer::getColorTargetHeapStartCPU() const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			return CD3DX12_CPU_DESCRIPTOR_HANDLE(m_ColorTargetHeap->GetCPUDescriptorHandleForHeapStart(), static_cast<UINT>(m_FrameIndex * getColorTargetCount()), m_ColorHeapSize);
 		}
 
 		D3D12_CPU_DESCRIPTOR_HANDLE DX12Rasterizer::getColorTargetHeapStartCPU()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			return CD3DX12_CPU_DESCRIPTOR_HANDLE(m_ColorTargetHeap->GetCPUDescriptorHandleForHeapStart(), static_cast<UINT>(m_FrameIndex * getColorTargetCount()), m_ColorHeapSize);
 		}
 
 		D3D12_CPU_DESCRIPTOR_HANDLE DX12Rasterizer::getDepthTargetHeapStartCPU()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			return CD3DX12_CPU_DESCRIPTOR_HANDLE(m_DepthTargetHeap->GetCPUDescriptorHandleForHeapStart(), m_FrameIndex, m_DepthHeapSize);
 		}
 
 		D3D12_CPU_DESCRIPTOR_HANDLE DX12Rasterizer::getDepthTargetHeapStartCPU() const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			return CD3DX12_CPU_DESCRIPTOR_HANDLE(m_DepthTargetHeap->GetCPUDescriptorHandleForHeapStart(), m_FrameIndex, m_DepthHeapSize);
 		}
 
 		uint8_t DX12Rasterizer::getAttachmentIndex(AttachmentType type) const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (m_AttachmentTypes & type)
 			{
@@ -4,8 +4,7 @@
 #include "DX12RasterizingPipeline.hpp"
 #include "DX12Macros.hpp"
 #include "DX12Descriptor.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 // This magic number is used by the rasterizing pipeline to uniquely identify it's pipeline caches.
 constexpr uint64_t g_MagicNumber = 0b0011111000011111001000001010110101101110111001101000110000110001;
@@ -657,14 +656,14 @@ namespace Xenon
 
 		std::unique_ptr<Xenon::Backend::Descriptor> DX12RasterizingPipeline::createDescriptor(DescriptorType type)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			return std::make_unique<DX12Descriptor>(m_pDevice, m_BindingMap[type], type, m_BindingOffsets[type], this);
 		}
 
 		const Xenon::Backend::DX12RasterizingPipeline::PipelineStorage& DX12RasterizingPipeline::getPipeline(const VertexSpecification& vertexSpecification)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto lock = std::scoped_lock(m_Mutex);
 
@@ -833,7 +832,7 @@ namespace Xenon
 
 		std::vector<std::byte> DX12RasterizingPipeline::loadPipelineStateCache(uint64_t hash) const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (m_pCacheHandler)
 				return m_pCacheHandler->load(hash ^ g_MagicNumber);
@@ -844,7 +843,7 @@ namespace Xenon
 
 		void DX12RasterizingPipeline::storePipelineStateCache(uint64_t hash, const PipelineStorage& pipeline) const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (m_pCacheHandler)
 			{
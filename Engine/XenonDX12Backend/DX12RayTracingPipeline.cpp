@@ -5,9 +5,9 @@
 #include "DX12Macros.hpp"
 #include "DX12Descriptor.hpp"
 #include "DX12ShaderBindingTable.hpp"
+#include "../XenonCore/Tracer.hpp"
 
 #include <spdlog/fmt/xchar.h>
-#include <optick.h>
 
 #include <algorithm>
 
@@ -89,7 +89,7 @@ namespace Xenon
 			: RayTracingPipeline(pDevice, std::move(pCacheHandler), specification)
 			, DX12DescriptorHeapManager(pDevice)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto rayTracingPipeline = CD3DX12_STATE_OBJECT_DESC(D3D12_STATE_OBJECT_TYPE_RAYTRACING_PIPELINE);
 
@@ -241,14 +241,14 @@ namespace Xenon
 
 		std::unique_ptr<Xenon::Backend::Descriptor> DX12RayTracingPipeline::createDescriptor(DescriptorType type)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			return std::make_unique<DX12Descriptor>(m_pDevice, m_BindingMap[type], type, m_BindingOffsets[type], this);
 		}
 
 		std::unique_ptr<ShaderBindingTable> DX12RayTracingPipeline::createShaderBindingTable(const std::vector<BindingGroup>& bindingGroups)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			return std::make_unique<DX12ShaderBindingTable>(m_pDevice, this, bindingGroups);
 		}
@@ -297,7 +297,7 @@ namespace Xenon
 
 		void DX12RayTracingPipeline::createDXILLibrary(CD3DX12_STATE_OBJECT_DESC& stateObject, D3D12_SHADER_BYTECODE shader, const std::wstring_view& newExport) const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto pLibrary = stateObject.CreateSubobject<CD3DX12_DXIL_LIBRARY_SUBOBJECT>();
 			pLibrary->SetDXILLibrary(&shader);
@@ -306,7 +306,7 @@ namespace Xenon
 
 		ID3D12RootSignature* DX12RayTracingPipeline::createLocalRootSignature(std::vector<std::pair<uint8_t, std::vector<CD3DX12_DESCRIPTOR_RANGE1>>>&& rangePairs)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			std::vector<CD3DX12_ROOT_PARAMETER1> rootParameters;
 			for (const auto& [set, ranges] : rangePairs)
@@ -336,7 +336,7 @@ namespace Xenon
 
 		void DX12RayTracingPipeline::createGlobalRootSignature(std::vector<std::pair<uint8_t, std::vector<CD3DX12_DESCRIPTOR_RANGE1>>>&& rangePairs)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			std::vector<CD3DX12_ROOT_PARAMETER1> rootParameters;
 			for (const auto& [set, ranges] : rangePairs)
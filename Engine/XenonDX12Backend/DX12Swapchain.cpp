@@ -10,8 +10,8 @@
 
 #include "../XenonShaderBank/Internal/DX12SwapchainCopy/DX12SwapchainCopy.vert.hpp"
 #include "../XenonShaderBank/Internal/DX12SwapchainCopy/DX12SwapchainCopy.frag.hpp"
+#include "../XenonCore/Tracer.hpp"
 
-#include <optick.h>
 #include <glm/vec2.hpp>
 
 namespace Xenon
@@ -89,14 +89,14 @@ namespace Xenon
 
 		uint32_t DX12Swapchain::prepare()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			return m_ImageIndex;
 		}
 
 		void DX12Swapchain::present()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Present the swapchain.
 			DXGI_PRESENT_PARAMETERS parameters = { 0 };
@@ -131,14 +131,14 @@ namespace Xenon
 
 		D3D12_CPU_DESCRIPTOR_HANDLE DX12Swapchain::getCPUDescriptorHandle() const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			return CD3DX12_CPU_DESCRIPTOR_HANDLE(m_SwapchainImageHeap->GetCPUDescriptorHandleForHeapStart(), m_ImageIndex, m_SwapchainImageHeapDescriptorSize);
 		}
 
 		void DX12Swapchain::prepareDescriptorForImageCopy(DX12Image* pImage)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Skip if we have already created the required resource view for the image.
 			if (m_ImageCopyContainer.m_pPreviousColorImage == pImage)
@@ -4,12 +4,11 @@
 #include "LinuxWindow.hpp"
 
 #include "../XenonCore/Logging.hpp"
+#include "../XenonCore/Tracer.hpp"
 
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_vulkan.h>
 
-#include <optick.h>
-
 namespace Xenon
 {
 	namespace Platform
@@ -38,7 +37,7 @@ namespace Xenon
 
 		void LinuxWindow::update()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_Keyboard.m_Character = 0;
 			m_Mouse.m_VScroll = 0.0f;
@@ -4,8 +4,8 @@
 #include "WindowsWindow.hpp"
 
 #include "../XenonCore/Logging.hpp"
+#include "../XenonCore/Tracer.hpp"
 
-#include <optick.h>
 #include <windowsx.h>
 
 constexpr const auto* g_ClassName = TEXT("Xenon Windows Window Class");
@@ -128,7 +128,7 @@ namespace Xenon
 
 		void WindowsWindow::update()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_Keyboard.m_Character = 0;
 			m_Mouse.m_VScroll = 0.0f;
@@ -149,7 +149,7 @@ namespace Xenon
 
 		LRESULT WindowsWindow::handleEvent(UINT uMsg, WPARAM wParam, LPARAM lParam)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			switch (uMsg)
 			{
@@ -285,7 +285,7 @@ namespace Xenon
 
 		LRESULT WindowsWindow::handleKeyInput(WPARAM wParam, bool state)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			switch (wParam)
 			{
@@ -0,0 +1,108 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/AdaptiveMutex.hpp"
+#include "../XenonCore/Mutex.hpp"
+
+#include <chrono>
+#include <thread>
+
+XENON_TEST(AdaptiveMutex, TryLockFailsWhileLocked)
+{
+	auto mutex = Xenon::AdaptiveMutex();
+	XENON_EXPECT(mutex.try_lock());
+
+	bool isLocked = true;
+	std::jthread([&mutex, &isLocked] { isLocked = mutex.try_lock(); }).join();
+	XENON_EXPECT(!isLocked);
+
+	mutex.unlock();
+	XENON_EXPECT(mutex.try_lock());
+	mutex.unlock();
+}
+
+XENON_TEST(AdaptiveMutex, ExcludesEveryThread)
+{
+	constexpr uint32_t threadCount = 8;
+	constexpr uint64_t incrementsPerThread = 1 << 14;
+
+	auto mutex = Xenon::AdaptiveMutex();
+	uint64_t counter = 0;
+
+	{
+		std::vector<std::jthread> threads;
+		for (uint32_t i = 0; i < threadCount; i++)
+		{
+			threads.emplace_back([&mutex, &counter]
+				{
+					for (uint64_t j = 0; j < incrementsPerThread; j++)
+					{
+						const auto lock = std::scoped_lock(mutex);
+
+						// Read and write separately, so that a missed exclusion loses increments.
+						const auto value = counter;
+						if (j % 64 == 0)
+							std::this_thread::yield();
+
+						counter = value + 1;
+					}
+				});
+		}
+	}
+
+	XENON_EXPECT(counter == threadCount * incrementsPerThread);
+}
+
+XENON_TEST(AdaptiveMutex, ParkedThreadsAreWokenUp)
+{
+	constexpr uint32_t threadCount = 4;
+
+	auto mutex = Xenon::AdaptiveMutex();
+	auto acquiredCount = std::atomic_uint32_t(0);
+
+	// Hold the lock for much longer than the spin limit, so that the waiters have to park.
+	mutex.lock();
+
+	{
+		std::vector<std::jthread> threads;
+		for (uint32_t i = 0; i < threadCount; i++)
+		{
+			threads.emplace_back([&mutex, &acquiredCount]
+				{
+					const auto lock = std::scoped_lock(mutex);
+					acquiredCount++;
+				});
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		XENON_EXPECT(acquiredCount == 0);
+
+		mutex.unlock();
+	}
+
+	XENON_EXPECT(acquiredCount == threadCount);
+}
+
+XENON_TEST(AdaptiveMutex, WorksAsTheMutexType)
+{
+	constexpr uint32_t threadCount = 4;
+	constexpr uint64_t incrementsPerThread = 1 << 14;
+
+	auto mutex = Xenon::Mutex<uint64_t, Xenon::AdaptiveMutex>(0);
+
+	{
+		std::vector<std::jthread> threads;
+		for (uint32_t i = 0; i < threadCount; i++)
+		{
+			threads.emplace_back([&mutex]
+				{
+					for (uint64_t j = 0; j < incrementsPerThread; j++)
+						mutex.access([](uint64_t& value) { value++; });
+				});
+		}
+	}
+
+	XENON_EXPECT(mutex.get() == threadCount * incrementsPerThread);
+}
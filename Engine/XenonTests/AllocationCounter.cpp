@@ -0,0 +1,99 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace /* anonymous */
+{
+	std::atomic_uint64_t g_AllocationCount = 0;
+
+	/**
+	 * Allocate memory and count the allocation.
+	 *
+	 * @param size The size to allocate.
+	 * @param alignment The alignment of the allocation.
+	 * @return The allocated memory. This is nullptr if the allocation failed.
+	 */
+	void* Allocate(std::size_t size, std::size_t alignment) noexcept
+	{
+		g_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+		if (size == 0)
+			size = 1;
+
+		if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+			return std::malloc(size);
+
+#ifdef _MSC_VER
+		return _aligned_malloc(size, alignment);
+
+#else
+		return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+
+#endif
+	}
+
+	/**
+	 * Deallocate memory allocated using Allocate().
+	 *
+	 * @param pMemory The memory to deallocate.
+	 * @param alignment The alignment of the allocation.
+	 */
+	void Deallocate(void* pMemory, [[maybe_unused]] std::size_t alignment) noexcept
+	{
+#ifdef _MSC_VER
+		if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+			return _aligned_free(pMemory);
+
+#endif
+
+		std::free(pMemory);
+	}
+
+	/**
+	 * Allocate memory and throw std::bad_alloc if the allocation failed.
+	 *
+	 * @param size The size to allocate.
+	 * @param alignment The alignment of the allocation.
+	 * @return The allocated memory.
+	 */
+	void* AllocateOrThrow(std::size_t size, std::size_t alignment)
+	{
+		const auto pMemory = Allocate(size, alignment);
+		if (pMemory == nullptr)
+			throw std::bad_alloc();
+
+		return pMemory;
+	}
+}
+
+void* operator new(std::size_t size) { return AllocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](std::size_t size) { return AllocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return AllocateOrThrow(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return AllocateOrThrow(size, static_cast<std::size_t>(alignment)); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+
+void operator delete(void* pMemory) noexcept { Deallocate(pMemory, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete[](void* pMemory) noexcept { Deallocate(pMemory, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete(void* pMemory, std::size_t) noexcept { Deallocate(pMemory, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete[](void* pMemory, std::size_t) noexcept { Deallocate(pMemory, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete(void* pMemory, std::align_val_t alignment) noexcept { Deallocate(pMemory, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* pMemory, std::align_val_t alignment) noexcept { Deallocate(pMemory, static_cast<std::size_t>(alignment)); }
+void operator delete(void* pMemory, std::size_t, std::align_val_t alignment) noexcept { Deallocate(pMemory, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* pMemory, std::size_t, std::align_val_t alignment) noexcept { Deallocate(pMemory, static_cast<std::size_t>(alignment)); }
+
+namespace Xenon
+{
+	namespace Testing
+	{
+		uint64_t GetAllocationCount() noexcept
+		{
+			return g_AllocationCount.load(std::memory_order_relaxed);
+		}
+	}
+}
@@ -0,0 +1,20 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+namespace Xenon
+{
+	namespace Testing
+	{
+		/**
+		 * Get the number of times the global operator new was called since the program started.
+		 * This counts the allocations from every thread.
+		 *
+		 * @return The allocation count.
+		 */
+		[[nodiscard]] uint64_t GetAllocationCount() noexcept;
+	}
+}
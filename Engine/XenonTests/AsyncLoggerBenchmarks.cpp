@@ -0,0 +1,83 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/AsyncLogger.hpp"
+
+#include <spdlog/sinks/basic_file_sink.h>
+
+#include <fmt/format.h>
+
+#include <filesystem>
+
+namespace /* anonymous */
+{
+	/**
+	 * The number of messages logged in a single burst (frame).
+	 * This fits in a thread's log buffer, so the caller never has to wait for the background thread.
+	 */
+	constexpr uint64_t BurstSize = 256;
+
+	/**
+	 * Log a number of messages in bursts and report the time each call takes on the calling thread.
+	 * The messages have the argument mix of a typical engine log (integers, a float and a string). The logger is flushed between the
+	 * bursts, which is not measured.
+	 *
+	 * @param label The metric label.
+	 * @param burstCount The number of bursts to log.
+	 */
+	void MeasureLatency(std::string_view label, uint64_t burstCount)
+	{
+		std::vector<std::chrono::nanoseconds> latencies;
+		latencies.reserve(burstCount * BurstSize);
+
+		for (uint64_t burst = 0; burst < burstCount; burst++)
+		{
+			for (uint64_t i = 0; i < BurstSize; i++)
+			{
+				const auto start = std::chrono::steady_clock::now();
+				Xenon::AsyncLogger::Log(spdlog::level::info, "Frame {} recorded {} draws in {} ms for the \"{}\" pass.", burst, i, 0.25f, "Default Rasterizing Layer");
+				latencies.emplace_back(std::chrono::steady_clock::now() - start);
+			}
+
+			Xenon::AsyncLogger::Flush();
+		}
+
+		std::sort(latencies.begin(), latencies.end());
+
+		auto total = std::chrono::nanoseconds(0);
+		for (const auto latency : latencies)
+			total += latency;
+
+		const auto getPercentile = [&latencies](double percentile) { return static_cast<double>(latencies[static_cast<uint64_t>(percentile * static_cast<double>(latencies.size() - 1))].count()); };
+		Xenon::Testing::ReportMetric(fmt::format("{} (mean)", label), static_cast<double>(total.count()) / static_cast<double>(latencies.size()), "ns/call");
+		Xenon::Testing::ReportMetric(fmt::format("{} (p50)", label), getPercentile(0.5), "ns/call");
+		Xenon::Testing::ReportMetric(fmt::format("{} (p99)", label), getPercentile(0.99), "ns/call");
+		Xenon::Testing::ReportMetric(fmt::format("{} (max)", label), getPercentile(1.0), "ns/call");
+	}
+}
+
+XENON_BENCHMARK(AsyncLogger, CallerLatency)
+{
+	const uint64_t burstCount = Xenon::Testing::IsQuickRun() ? 16 : 1024;
+
+	// Write to a file instead of the console so that the synchronous path pays for the same I/O it would in the engine.
+	const auto path = std::filesystem::temp_directory_path() / "XenonAsyncLoggerBenchmark.log";
+	const auto pPreviousLogger = spdlog::default_logger();
+	spdlog::set_default_logger(spdlog::basic_logger_mt("XenonAsyncLoggerBenchmark", path.string(), true));
+
+	MeasureLatency("synchronous", burstCount);
+
+	// Block instead of dropping when the buffer is full, so that the dropped messages don't make the async logger look faster.
+	auto configuration = Xenon::AsyncLoggerConfiguration();
+	configuration.m_OverflowPolicy = Xenon::LogOverflowPolicy::Block;
+
+	Xenon::AsyncLogger::Start(configuration);
+	MeasureLatency("asynchronous", burstCount);
+	Xenon::AsyncLogger::Stop();
+
+	spdlog::set_default_logger(pPreviousLogger);
+	spdlog::drop("XenonAsyncLoggerBenchmark");
+	std::filesystem::remove(path);
+}
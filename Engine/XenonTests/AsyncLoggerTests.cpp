@@ -0,0 +1,328 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/AsyncLogger.hpp"
+
+#include <spdlog/sinks/base_sink.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace /* anonymous */
+{
+	/**
+	 * The number of messages logged in the overflow tests.
+	 * This is more than the capacity of any thread buffer the tests create, since buffers are reused by the threads which come after.
+	 */
+	constexpr uint32_t OverflowMessageCount = 4096;
+
+	/**
+	 * Capture sink class.
+	 * This stores the messages which are written to it, and can hold the thread which writes to it at a gate to keep the background
+	 * thread from draining the buffers.
+	 */
+	class CaptureSink final : public spdlog::sinks::base_sink<std::mutex>
+	{
+	public:
+		/**
+		 * Get the messages which were written so far.
+		 *
+		 * @return The messages.
+		 */
+		[[nodiscard]] std::vector<std::string> getMessages()
+		{
+			auto lock = std::scoped_lock(m_MessageMutex);
+			return m_Messages;
+		}
+
+		/**
+		 * Close the gate.
+		 * The next thread which writes a message waits until the gate is opened.
+		 */
+		void closeGate() noexcept { m_IsGateClosed.store(true); }
+
+		/**
+		 * Wait till a thread is waiting at the gate.
+		 */
+		void waitForGate() noexcept
+		{
+			while (!m_IsWaitingAtGate.load())
+				std::this_thread::yield();
+		}
+
+		/**
+		 * Open the gate and release the waiting thread.
+		 */
+		void openGate() noexcept
+		{
+			m_IsGateClosed.store(false);
+			m_IsGateClosed.notify_all();
+		}
+
+	protected:
+		/**
+		 * Store a message.
+		 *
+		 * @param message The message to store.
+		 */
+		void sink_it_(const spdlog::details::log_msg& message) override
+		{
+			if (m_IsGateClosed.load())
+			{
+				m_IsWaitingAtGate.store(true);
+				m_IsGateClosed.wait(true);
+				m_IsWaitingAtGate.store(false);
+			}
+
+			auto lock = std::scoped_lock(m_MessageMutex);
+			m_Messages.emplace_back(message.payload.data(), message.payload.size());
+		}
+
+		/**
+		 * Flush the sink.
+		 * The messages are already stored, so there's nothing to do.
+		 */
+		void flush_() override {}
+
+	private:
+		std::mutex m_MessageMutex;
+		std::vector<std::string> m_Messages;
+
+		std::atomic_bool m_IsGateClosed = false;
+		std::atomic_bool m_IsWaitingAtGate = false;
+	};
+
+	/**
+	 * Scoped capture structure.
+	 * This replaces the default logger with one which writes to a capture sink, and puts the previous logger back (after stopping the
+	 * async logger) when it goes out of scope.
+	 */
+	struct ScopedCapture final
+	{
+		/**
+		 * Default constructor.
+		 */
+		ScopedCapture() : m_pPreviousLogger(spdlog::default_logger())
+		{
+			auto pLogger = std::make_shared<spdlog::logger>("XenonAsyncLoggerTests", m_pSink);
+			pLogger->set_pattern("%v");
+			pLogger->set_level(spdlog::level::trace);
+
+			spdlog::set_default_logger(std::move(pLogger));
+		}
+
+		/**
+		 * Destructor.
+		 */
+		~ScopedCapture()
+		{
+			Xenon::AsyncLogger::Stop();
+
+			spdlog::set_default_logger(m_pPreviousLogger);
+			spdlog::drop("XenonAsyncLoggerTests");
+		}
+
+		std::shared_ptr<CaptureSink> m_pSink = std::make_shared<CaptureSink>();
+		std::shared_ptr<spdlog::logger> m_pPreviousLogger;
+	};
+
+	/**
+	 * Get the values of the "<thread> <value>" messages of each thread, in the order they were written.
+	 * Any other message is skipped.
+	 *
+	 * @param messages The messages.
+	 * @param threadCount The number of threads.
+	 * @return The values of each thread.
+	 */
+	std::vector<std::vector<uint32_t>> GetThreadValues(const std::vector<std::string>& messages, uint32_t threadCount)
+	{
+		std::vector<std::vector<uint32_t>> values(threadCount);
+		for (const auto& message : messages)
+		{
+			uint32_t thread = 0;
+			uint32_t value = 0;
+			if (std::sscanf(message.c_str(), "%u %u", &thread, &value) == 2 && thread < threadCount)
+				values[thread].emplace_back(value);
+		}
+
+		return values;
+	}
+
+	/**
+	 * Get the values from zero up to a count.
+	 *
+	 * @param count The number of values.
+	 * @return The values.
+	 */
+	std::vector<uint32_t> GetSequence(uint32_t count)
+	{
+		std::vector<uint32_t> values(count);
+		std::iota(values.begin(), values.end(), 0);
+		return values;
+	}
+}
+
+XENON_TEST(AsyncLogger, KeepsTheOrderOfEachThread)
+{
+	constexpr uint32_t threadCount = 4;
+	constexpr uint32_t messageCount = 2048;
+
+	auto capture = ScopedCapture();
+
+	// Block so that the order is checked on every message.
+	auto configuration = Xenon::AsyncLoggerConfiguration();
+	configuration.m_OverflowPolicy = Xenon::LogOverflowPolicy::Block;
+	Xenon::AsyncLogger::Start(configuration);
+
+	{
+		std::vector<std::jthread> threads;
+		for (uint32_t thread = 0; thread < threadCount; thread++)
+		{
+			threads.emplace_back([thread]
+				{
+					for (uint32_t i = 0; i < messageCount; i++)
+						Xenon::AsyncLogger::Log(spdlog::level::info, "{} {}", thread, i);
+				}
+			);
+		}
+	}
+
+	Xenon::AsyncLogger::Stop();
+
+	for (const auto& values : GetThreadValues(capture.m_pSink->getMessages(), threadCount))
+		XENON_EXPECT(values == GetSequence(messageCount));
+}
+
+XENON_TEST(AsyncLogger, DropPolicyDropsTheNewestMessages)
+{
+	auto capture = ScopedCapture();
+
+	auto configuration = Xenon::AsyncLoggerConfiguration();
+	configuration.m_ThreadBufferCapacity = 64;
+	configuration.m_OverflowPolicy = Xenon::LogOverflowPolicy::Drop;
+	Xenon::AsyncLogger::Start(configuration);
+
+	// Hold the background thread in the sink, so that nothing is taken from the buffer while it's being filled.
+	capture.m_pSink->closeGate();
+	Xenon::AsyncLogger::Log(spdlog::level::info, "gate");
+	capture.m_pSink->waitForGate();
+
+	const auto previousDroppedCount = Xenon::AsyncLogger::GetDroppedCount();
+	for (uint32_t i = 0; i < OverflowMessageCount; i++)
+		Xenon::AsyncLogger::Log(spdlog::level::info, "{} {}", 0, i);
+
+	const auto droppedCount = Xenon::AsyncLogger::GetDroppedCount() - previousDroppedCount;
+	XENON_EXPECT(droppedCount > 0 && droppedCount < OverflowMessageCount);
+
+	capture.m_pSink->openGate();
+	Xenon::AsyncLogger::Stop();
+
+	// The buffer keeps what it had room for, which are the first messages.
+	const auto messages = capture.m_pSink->getMessages();
+	XENON_EXPECT(GetThreadValues(messages, 1).front() == GetSequence(OverflowMessageCount - static_cast<uint32_t>(droppedCount)));
+	XENON_EXPECT(std::ranges::any_of(messages, [droppedCount](const std::string& message) { return message.find(fmt::format("dropped {} log message(s)", droppedCount)) != std::string::npos; }));
+}
+
+XENON_TEST(AsyncLogger, BlockPolicyWaitsForRoom)
+{
+	auto capture = ScopedCapture();
+
+	auto configuration = Xenon::AsyncLoggerConfiguration();
+	configuration.m_ThreadBufferCapacity = 64;
+	configuration.m_OverflowPolicy = Xenon::LogOverflowPolicy::Block;
+	Xenon::AsyncLogger::Start(configuration);
+
+	capture.m_pSink->closeGate();
+	Xenon::AsyncLogger::Log(spdlog::level::info, "gate");
+	capture.m_pSink->waitForGate();
+
+	const auto previousDroppedCount = Xenon::AsyncLogger::GetDroppedCount();
+	auto isDone = std::atomic_bool(false);
+	auto thread = std::jthread([&isDone]
+		{
+			for (uint32_t i = 0; i < OverflowMessageCount; i++)
+				Xenon::AsyncLogger::Log(spdlog::level::info, "{} {}", 0, i);
+
+			isDone.store(true);
+		}
+	);
+
+	// The thread can't get through all the messages while the background thread is held.
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	XENON_EXPECT(!isDone.load());
+
+	capture.m_pSink->openGate();
+	thread.join();
+	Xenon::AsyncLogger::Stop();
+
+	XENON_EXPECT(isDone.load());
+	XENON_EXPECT(Xenon::AsyncLogger::GetDroppedCount() == previousDroppedCount);
+	XENON_EXPECT(GetThreadValues(capture.m_pSink->getMessages(), 1).front() == GetSequence(OverflowMessageCount));
+}
+
+XENON_TEST(AsyncLogger, FlushWritesThePendingMessages)
+{
+	auto capture = ScopedCapture();
+
+	// The background thread only wakes up on it's own once an hour, so the messages can only be written by the flush.
+	auto configuration = Xenon::AsyncLoggerConfiguration();
+	configuration.m_FlushInterval = std::chrono::hours(1);
+	Xenon::AsyncLogger::Start(configuration);
+
+	for (uint32_t i = 0; i < 16; i++)
+	{
+		Xenon::AsyncLogger::Log(spdlog::level::info, "{} {}", 0, i);
+		Xenon::AsyncLogger::Flush();
+
+		XENON_EXPECT(GetThreadValues(capture.m_pSink->getMessages(), 1).front() == GetSequence(i + 1));
+	}
+}
+
+XENON_TEST(AsyncLogger, StopDoesNotLoseMessages)
+{
+	constexpr uint32_t roundCount = 8;
+	constexpr uint32_t threadCount = 4;
+	constexpr uint32_t messageCount = 4096;
+
+	auto capture = ScopedCapture();
+	for (uint32_t round = 0; round < roundCount; round++)
+	{
+		auto configuration = Xenon::AsyncLoggerConfiguration();
+		configuration.m_OverflowPolicy = Xenon::LogOverflowPolicy::Block;
+		Xenon::AsyncLogger::Start(configuration);
+
+		{
+			// Stop while the threads are logging. The messages which are logged after that are written synchronously.
+			std::vector<std::jthread> threads;
+			for (uint32_t thread = 0; thread < threadCount; thread++)
+			{
+				threads.emplace_back([thread, round]
+					{
+						for (uint32_t i = 0; i < messageCount; i++)
+							Xenon::AsyncLogger::Log(spdlog::level::info, "{} {}", round * threadCount + thread, i);
+					}
+				);
+			}
+
+			std::this_thread::sleep_for(std::chrono::microseconds(100 * round));
+			Xenon::AsyncLogger::Stop();
+		}
+	}
+
+	// Every message must be written exactly once. The synchronous messages can overtake the ones which were pushed before the stop,
+	// so the order is not checked.
+	for (auto& values : GetThreadValues(capture.m_pSink->getMessages(), roundCount * threadCount))
+	{
+		std::ranges::sort(values);
+		XENON_EXPECT(values == GetSequence(messageCount));
+	}
+}
@@ -0,0 +1,225 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/BitSet.hpp"
+
+#include <array>
+#include <memory>
+#include <random>
+
+namespace /* anonymous */
+{
+	/**
+	 * Legacy bit set class.
+	 * This is the bit set which was used before the word based one, which stored eight 1-bit bit fields per byte and accessed them
+	 * using a switch. It had no bulk operations, so they are done bit by bit here. It's only kept here to compare the two.
+	 *
+	 * @tparam Bits The number of bits.
+	 */
+	template<uint32_t Bits>
+	class LegacyBitSet final
+	{
+		struct BitField final
+		{
+			union
+			{
+				struct
+				{
+					bool m_A : 1;
+					bool m_B : 1;
+					bool m_C : 1;
+					bool m_D : 1;
+					bool m_E : 1;
+					bool m_F : 1;
+					bool m_G : 1;
+					bool m_H : 1;
+				};
+
+				std::byte m_Value;
+			};
+		};
+
+	public:
+		bool test(const uint64_t pos) const
+		{
+			const auto field = m_Bytes[pos / 8];
+			switch (pos % 8)
+			{
+			case 1:
+				return field.m_B;
+
+			case 2:
+				return field.m_C;
+
+			case 3:
+				return field.m_D;
+
+			case 4:
+				return field.m_E;
+
+			case 5:
+				return field.m_F;
+
+			case 6:
+				return field.m_G;
+
+			case 7:
+				return field.m_H;
+
+			default:
+				return field.m_A;
+			}
+		}
+
+		void toggle(const uint64_t pos, const bool value)
+		{
+			const auto index = pos / 8;
+			switch (pos % 8)
+			{
+			case 1:
+				m_Bytes[index].m_B = value;
+				break;
+
+			case 2:
+				m_Bytes[index].m_C = value;
+				break;
+
+			case 3:
+				m_Bytes[index].m_D = value;
+				break;
+
+			case 4:
+				m_Bytes[index].m_E = value;
+				break;
+
+			case 5:
+				m_Bytes[index].m_F = value;
+				break;
+
+			case 6:
+				m_Bytes[index].m_G = value;
+				break;
+
+			case 7:
+				m_Bytes[index].m_H = value;
+				break;
+
+			default:
+				m_Bytes[index].m_A = value;
+				break;
+			}
+		}
+
+	private:
+		std::array<BitField, (Bits + 7) / 8> m_Bytes = {};
+	};
+
+	/**
+	 * The number of bits in the benchmarked sets.
+	 */
+	constexpr uint32_t BitCount = 1 << 20;
+
+	/**
+	 * Get random bit positions.
+	 *
+	 * @param count The number of positions.
+	 * @return The positions.
+	 */
+	std::vector<uint64_t> GetRandomPositions(uint64_t count)
+	{
+		auto engine = std::mt19937_64(42);
+
+		std::vector<uint64_t> positions(count);
+		for (auto& position : positions)
+			position = engine() % BitCount;
+
+		return positions;
+	}
+}
+
+XENON_BENCHMARK(BitSet, Compare)
+{
+	// Set about one in eight bits, so that the scans have something to find without every word being full.
+	const auto positions = GetRandomPositions(BitCount / 8);
+
+	auto pLegacyLhs = std::make_unique<LegacyBitSet<BitCount>>();
+	auto pLegacyRhs = std::make_unique<LegacyBitSet<BitCount>>();
+	auto pLegacyResult = std::make_unique<LegacyBitSet<BitCount>>();
+	auto lhs = Xenon::BitSet(BitCount);
+	auto rhs = Xenon::BitSet(BitCount);
+
+	Xenon::Testing::Measure("Legacy toggle", positions.size(), [&] { for (const auto position : positions) pLegacyLhs->toggle(position, true); });
+	Xenon::Testing::Measure("BitSet toggle", positions.size(), [&] { for (const auto position : positions) lhs.toggleTrue(position); });
+
+	for (const auto position : GetRandomPositions(BitCount / 7))
+	{
+		pLegacyRhs->toggle(position, true);
+		rhs.toggleTrue(position);
+	}
+
+	Xenon::Testing::Measure("Legacy test", positions.size(), [&]
+		{
+			uint64_t count = 0;
+			for (const auto position : positions)
+				count += pLegacyRhs->test(position);
+
+			Xenon::Testing::DoNotOptimize(count);
+		});
+
+	Xenon::Testing::Measure("BitSet test", positions.size(), [&]
+		{
+			uint64_t count = 0;
+			for (const auto position : positions)
+				count += rhs.test(position);
+
+			Xenon::Testing::DoNotOptimize(count);
+		});
+
+	// The bulk operations are reported per bit.
+	Xenon::Testing::Measure("Legacy count", BitCount, [&]
+		{
+			uint64_t count = 0;
+			for (uint64_t i = 0; i < BitCount; i++)
+				count += pLegacyLhs->test(i);
+
+			Xenon::Testing::DoNotOptimize(count);
+		});
+
+	Xenon::Testing::Measure("BitSet count", BitCount, [&] { Xenon::Testing::DoNotOptimize(lhs.count()); });
+
+	Xenon::Testing::Measure("Legacy iterate set bits", BitCount, [&]
+		{
+			uint64_t sum = 0;
+			for (uint64_t i = 0; i < BitCount; i++)
+			{
+				if (pLegacyLhs->test(i))
+					sum += i;
+			}
+
+			Xenon::Testing::DoNotOptimize(sum);
+		});
+
+	Xenon::Testing::Measure("BitSet iterate set bits", BitCount, [&]
+		{
+			uint64_t sum = 0;
+			lhs.forEachSet([&sum](uint64_t position) { sum += position; });
+			Xenon::Testing::DoNotOptimize(sum);
+		});
+
+	Xenon::Testing::Measure("Legacy AND", BitCount, [&]
+		{
+			for (uint64_t i = 0; i < BitCount; i++)
+				pLegacyResult->toggle(i, pLegacyLhs->test(i) && pLegacyRhs->test(i));
+
+			Xenon::Testing::DoNotOptimize(pLegacyResult.get());
+		});
+
+	auto result = lhs;
+	Xenon::Testing::Measure("BitSet AND", BitCount, [&]
+		{
+			result &= rhs;
+			Xenon::Testing::DoNotOptimize(result.getWords().data());
+		});
+}
@@ -0,0 +1,204 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/BitSet.hpp"
+
+#include <random>
+
+namespace /* anonymous */
+{
+	/**
+	 * Create a bit set from a vector of booleans.
+	 *
+	 * @param bits The bits.
+	 * @return The bit set.
+	 */
+	[[nodiscard]] Xenon::BitSet ToBitSet(const std::vector<bool>& bits)
+	{
+		auto bitSet = Xenon::BitSet(bits.size());
+		for (uint64_t i = 0; i < bits.size(); i++)
+			bitSet.toggle(i, bits[i]);
+
+		return bitSet;
+	}
+
+	/**
+	 * Create random bits.
+	 *
+	 * @param engine The random engine.
+	 * @param size The number of bits.
+	 * @return The bits.
+	 */
+	[[nodiscard]] std::vector<bool> CreateBits(std::mt19937_64& engine, uint64_t size)
+	{
+		std::vector<bool> bits(size);
+		for (uint64_t i = 0; i < size; i++)
+			bits[i] = engine() % 3 == 0;
+
+		return bits;
+	}
+
+	/**
+	 * Check if a bit set contains exactly the same bits as the reference.
+	 * This checks the individual bits, the counts, and that every way of iterating the set bits visits the same positions in order.
+	 *
+	 * @param bitSet The bit set to check.
+	 * @param reference The reference bits.
+	 * @return True if the bits are the same.
+	 * @return False if any of the bits or the queries differ.
+	 */
+	[[nodiscard]] bool HasSameBits(const Xenon::BitSet& bitSet, const std::vector<bool>& reference)
+	{
+		if (bitSet.getSize() != reference.size())
+			return false;
+
+		std::vector<uint64_t> setBits;
+		for (uint64_t i = 0; i < reference.size(); i++)
+		{
+			if (bitSet.test(i) != reference[i] || bitSet[i] != reference[i])
+				return false;
+
+			if (reference[i])
+				setBits.emplace_back(i);
+		}
+
+		if (bitSet.count() != setBits.size() || bitSet.any() == setBits.empty() || bitSet.none() != setBits.empty() || bitSet.all() != (setBits.size() == reference.size()))
+			return false;
+
+		std::vector<uint64_t> foundBits;
+		for (auto pos = bitSet.findFirstSet(); pos != Xenon::BitSet::InvalidPosition; pos = bitSet.findNextSet(pos))
+			foundBits.emplace_back(pos);
+
+		std::vector<uint64_t> iteratedBits;
+		for (const auto pos : bitSet.getSetBits())
+			iteratedBits.emplace_back(pos);
+
+		std::vector<uint64_t> visitedBits;
+		bitSet.forEachSet([&visitedBits](uint64_t pos) { visitedBits.emplace_back(pos); });
+
+		// The bits past the size must never be set, or the whole word operations would see them.
+		const auto& words = bitSet.getWords();
+		const auto isTailClear = reference.size() % 64 == 0 || (words.back() >> (reference.size() % 64)) == 0;
+
+		return foundBits == setBits && iteratedBits == setBits && visitedBits == setBits && isTailClear;
+	}
+
+	/**
+	 * Apply a binary operation to every bit of two vectors of booleans.
+	 * The bits past the end of the right hand side are treated as false.
+	 *
+	 * @tparam Function The operation type.
+	 * @param lhs The left hand side.
+	 * @param rhs The right hand side.
+	 * @param function The operation.
+	 * @return The resulting bits, which are the size of the left hand side.
+	 */
+	template<class Function>
+	[[nodiscard]] std::vector<bool> Combine(const std::vector<bool>& lhs, const std::vector<bool>& rhs, Function&& function)
+	{
+		std::vector<bool> bits(lhs.size());
+		for (uint64_t i = 0; i < lhs.size(); i++)
+			bits[i] = function(lhs[i], i < rhs.size() && rhs[i]);
+
+		return bits;
+	}
+}
+
+XENON_TEST(BitSet, MatchesVectorOfBool)
+{
+	auto engine = std::mt19937_64(7);
+
+	// Cover sizes around the word boundaries.
+	for (const uint64_t size : { 0, 1, 63, 64, 65, 127, 128, 129, 1000 })
+	{
+		auto reference = CreateBits(engine, size);
+		auto bitSet = ToBitSet(reference);
+		XENON_EXPECT(HasSameBits(bitSet, reference));
+
+		for (uint64_t i = 0; size > 0 && i < 4 * size; i++)
+		{
+			const auto pos = engine() % size;
+			switch (engine() % 4)
+			{
+			case 0:
+				bitSet.toggleTrue(pos);
+				reference[pos] = true;
+				break;
+
+			case 1:
+				bitSet.toggleFalse(pos);
+				reference[pos] = false;
+				break;
+
+			case 2:
+				bitSet.flip(pos);
+				reference[pos] = !reference[pos];
+				break;
+
+			default:
+				bitSet.toggle(pos, pos % 2 == 0);
+				reference[pos] = pos % 2 == 0;
+				break;
+			}
+		}
+
+		XENON_EXPECT(HasSameBits(bitSet, reference));
+
+		bitSet.fill(true);
+		XENON_EXPECT(HasSameBits(bitSet, std::vector<bool>(size, true)));
+
+		bitSet.fill(false);
+		XENON_EXPECT(HasSameBits(bitSet, std::vector<bool>(size, false)));
+	}
+}
+
+XENON_TEST(BitSet, ResizeKeepsTheBits)
+{
+	auto engine = std::mt19937_64(11);
+
+	auto reference = CreateBits(engine, 70);
+	auto bitSet = ToBitSet(reference);
+
+	// Grow with set bits from the middle of a word, then with clear bits, then shrink into the middle of a word.
+	for (const auto& [size, value] : { std::pair<uint64_t, bool>{ 130, true }, { 200, false }, { 100, false }, { 33, true }, { 64, true }, { 0, false }, { 5, true } })
+	{
+		bitSet.resize(size, value);
+		reference.resize(size, value);
+		XENON_EXPECT(HasSameBits(bitSet, reference));
+	}
+}
+
+XENON_TEST(BitSet, BitwiseOperatorsMatchVectorOfBool)
+{
+	auto engine = std::mt19937_64(13);
+
+	for (const uint64_t size : { 1, 64, 100, 1000 })
+	{
+		const auto lhs = CreateBits(engine, size);
+		const auto rhs = CreateBits(engine, size);
+		const auto lhsSet = ToBitSet(lhs);
+		const auto rhsSet = ToBitSet(rhs);
+
+		XENON_EXPECT(HasSameBits(lhsSet & rhsSet, Combine(lhs, rhs, [](bool a, bool b) { return a && b; })));
+		XENON_EXPECT(HasSameBits(lhsSet | rhsSet, Combine(lhs, rhs, [](bool a, bool b) { return a || b; })));
+		XENON_EXPECT(HasSameBits(lhsSet ^ rhsSet, Combine(lhs, rhs, [](bool a, bool b) { return a != b; })));
+		XENON_EXPECT(HasSameBits(Xenon::BitSet(lhsSet).andNot(rhsSet), Combine(lhs, rhs, [](bool a, bool b) { return a && !b; })));
+		XENON_EXPECT(HasSameBits(~lhsSet, Combine(lhs, lhs, [](bool a, bool) { return !a; })));
+
+		XENON_EXPECT(lhsSet == ToBitSet(lhs));
+		XENON_EXPECT((lhsSet ^ lhsSet).none());
+	}
+
+	// A shorter right hand side acts as if the missing bits were clear.
+	const auto lhs = CreateBits(engine, 300);
+	const auto rhs = CreateBits(engine, 70);
+	const auto lhsSet = ToBitSet(lhs);
+	const auto rhsSet = ToBitSet(rhs);
+
+	XENON_EXPECT(HasSameBits(lhsSet & rhsSet, Combine(lhs, rhs, [](bool a, bool b) { return a && b; })));
+	XENON_EXPECT(HasSameBits(lhsSet | rhsSet, Combine(lhs, rhs, [](bool a, bool b) { return a || b; })));
+	XENON_EXPECT(HasSameBits(lhsSet ^ rhsSet, Combine(lhs, rhs, [](bool a, bool b) { return a != b; })));
+	XENON_EXPECT(HasSameBits(Xenon::BitSet(lhsSet).andNot(rhsSet), Combine(lhs, rhs, [](bool a, bool b) { return a && !b; })));
+}
@@ -0,0 +1,187 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/CompiledTaskGraph.hpp"
+
+#include <thread>
+
+namespace /* anonymous */
+{
+	/**
+	 * Layered graph structure.
+	 * Every task in a layer depends on two tasks of the previous layer, and records the order in which it ran, so that the
+	 * dependencies can be checked after a replay.
+	 */
+	struct LayeredGraph final
+	{
+		/**
+		 * Explicit constructor.
+		 *
+		 * @param graph The graph to create the tasks in.
+		 * @param layerCount The number of layers.
+		 * @param layerWidth The number of tasks in each layer.
+		 */
+		explicit LayeredGraph(Xenon::CompiledTaskGraph& graph, uint32_t layerCount, uint32_t layerWidth)
+			: m_Sequence(layerCount * layerWidth)
+		{
+			for (uint32_t layer = 0; layer < layerCount; layer++)
+			{
+				for (uint32_t i = 0; i < layerWidth; i++)
+				{
+					std::vector<Xenon::CompiledTaskGraph::TaskIndex> dependencies;
+					if (layer > 0)
+					{
+						const auto previousLayer = (layer - 1) * layerWidth;
+						dependencies = { previousLayer + i, previousLayer + (i + 1) % layerWidth };
+					}
+
+					graph.create([this, index = layer * layerWidth + i]
+						{
+							m_Sequence[index] = m_Counter.fetch_add(1, std::memory_order_relaxed);
+						}, dependencies);
+
+					m_Dependencies.emplace_back(std::move(dependencies));
+				}
+			}
+		}
+
+		/**
+		 * Check if every task ran after the tasks it depends on.
+		 *
+		 * @return True if the dependencies were respected.
+		 * @return False if a task ran before one of it's dependencies.
+		 */
+		[[nodiscard]] bool isOrdered() const
+		{
+			for (uint64_t i = 0; i < m_Dependencies.size(); i++)
+			{
+				for (const auto dependency : m_Dependencies[i])
+				{
+					if (m_Sequence[dependency] >= m_Sequence[i])
+						return false;
+				}
+			}
+
+			return true;
+		}
+
+		std::vector<std::vector<Xenon::CompiledTaskGraph::TaskIndex>> m_Dependencies;
+		std::vector<uint64_t> m_Sequence;
+		std::atomic_uint64_t m_Counter = 0;
+	};
+}
+
+XENON_TEST(CompiledTaskGraph, ReplaysOverManyFrames)
+{
+	constexpr uint32_t frameCount = 200;
+	constexpr uint32_t layerCount = 8;
+	constexpr uint32_t layerWidth = 16;
+
+	auto jobSystem = Xenon::JobSystem(4);
+	auto graph = Xenon::CompiledTaskGraph(jobSystem);
+	auto layeredGraph = LayeredGraph(graph, layerCount, layerWidth);
+
+	XENON_EXPECT(graph.getTaskCount() == layerCount * layerWidth);
+	XENON_EXPECT(graph.compile());
+
+	for (uint32_t frame = 0; frame < frameCount; frame++)
+	{
+		graph.execute();
+
+		// Every task runs exactly once per frame.
+		XENON_EXPECT(graph.isComplete());
+		XENON_EXPECT(layeredGraph.m_Counter.load() == (frame + 1) * layerCount * layerWidth);
+		XENON_EXPECT(layeredGraph.isOrdered());
+	}
+
+	// Adding a task invalidates the compiled graph, and the next replay compiles it again.
+	auto isLastTaskExecuted = false;
+	graph.create([&isLastTaskExecuted] { isLastTaskExecuted = true; }, { layerCount * layerWidth - 1 });
+	XENON_EXPECT(!graph.isCompiled());
+
+	graph.execute();
+	XENON_EXPECT(graph.isCompiled());
+	XENON_EXPECT(isLastTaskExecuted);
+	XENON_EXPECT(layeredGraph.m_Counter.load() == (frameCount + 1) * layerCount * layerWidth);
+}
+
+XENON_TEST(CompiledTaskGraph, ReplaysWithoutWorkers)
+{
+	auto jobSystem = Xenon::JobSystem(0);
+	auto graph = Xenon::CompiledTaskGraph(jobSystem);
+	auto layeredGraph = LayeredGraph(graph, 4, 4);
+
+	for (uint32_t frame = 0; frame < 8; frame++)
+	{
+		graph.execute();
+		XENON_EXPECT(layeredGraph.isOrdered());
+	}
+
+	XENON_EXPECT(layeredGraph.m_Counter.load() == 8 * 4 * 4);
+}
+
+XENON_TEST(CompiledTaskGraph, RejectsCycles)
+{
+	auto jobSystem = Xenon::JobSystem(2);
+	auto graph = Xenon::CompiledTaskGraph(jobSystem);
+	auto counter = std::atomic_uint32_t(0);
+
+	const auto first = graph.create([&counter] { counter++; });
+	const auto second = graph.create([&counter] { counter++; }, { first });
+	const auto third = graph.create([&counter] { counter++; }, { second });
+	XENON_EXPECT(graph.compile());
+
+	// Close the cycle. None of the tasks can run, so the replay must not start.
+	graph.addDependency(third, first);
+	XENON_EXPECT(!graph.compile());
+	XENON_EXPECT(!graph.isCompiled());
+
+	graph.execute();
+	XENON_EXPECT(counter.load() == 0);
+
+	// A task which depends on itself is a cycle too.
+	auto selfGraph = Xenon::CompiledTaskGraph(jobSystem);
+	const auto task = selfGraph.create([&counter] { counter++; });
+	selfGraph.addDependency(task, task);
+	XENON_EXPECT(!selfGraph.compile());
+
+	selfGraph.execute();
+	XENON_EXPECT(counter.load() == 0);
+}
+
+XENON_TEST(CompiledTaskGraph, ResolvesTheCriticalPath)
+{
+	constexpr auto longTask = std::chrono::milliseconds(20);
+	constexpr auto shortTask = std::chrono::milliseconds(1);
+
+	// Two chains which start and end at the same tasks. The middle chain takes far longer than the other, so it must be the critical
+	// path regardless of how the tasks are scheduled.
+	auto jobSystem = Xenon::JobSystem(2);
+	auto graph = Xenon::CompiledTaskGraph(jobSystem);
+
+	const auto source = graph.create([shortTask] { std::this_thread::sleep_for(shortTask); });
+	const auto longFirst = graph.create([longTask] { std::this_thread::sleep_for(longTask); }, { source });
+	const auto longSecond = graph.create([longTask] { std::this_thread::sleep_for(longTask); }, { longFirst });
+	const auto shortFirst = graph.create([shortTask] { std::this_thread::sleep_for(shortTask); }, { source });
+	const auto sink = graph.create([shortTask] { std::this_thread::sleep_for(shortTask); }, { longSecond, shortFirst });
+
+	for (uint32_t frame = 0; frame < 3; frame++)
+	{
+		graph.execute();
+
+		const auto expectedPath = std::vector<Xenon::CompiledTaskGraph::TaskIndex>{ source, longFirst, longSecond, sink };
+		XENON_EXPECT(graph.getCriticalPath() == expectedPath);
+
+		// The critical path duration is the sum of it's task durations, and the replay can't be faster than it.
+		auto pathDuration = std::chrono::nanoseconds(0);
+		for (const auto index : expectedPath)
+			pathDuration += graph.getTaskDuration(index);
+
+		XENON_EXPECT(graph.getCriticalPathDuration() == pathDuration);
+		XENON_EXPECT(graph.getCriticalPathDuration() >= longTask * 2 + shortTask * 2);
+		XENON_EXPECT(graph.getReplayDuration() >= graph.getCriticalPathDuration());
+		XENON_EXPECT(graph.getTaskDuration(shortFirst) < graph.getTaskDuration(longFirst));
+	}
+}
@@ -0,0 +1,105 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/CountingFence.hpp"
+#include "../XenonCore/JobSystem.hpp"
+
+namespace /* anonymous */
+{
+	/**
+	 * Detached coroutine structure.
+	 * This is a minimal coroutine type which starts eagerly and destroys itself when it completes.
+	 */
+	struct DetachedCoroutine final
+	{
+		struct promise_type final
+		{
+			DetachedCoroutine get_return_object() noexcept { return {}; }
+			std::suspend_never initial_suspend() noexcept { return {}; }
+			std::suspend_never final_suspend() noexcept { return {}; }
+			void return_void() noexcept {}
+			void unhandled_exception() noexcept { std::terminate(); }
+		};
+	};
+
+	/**
+	 * Await a fence and increment a counter once it completes.
+	 *
+	 * @param fence The fence to await.
+	 * @param counter The counter to increment.
+	 * @return The coroutine.
+	 */
+	DetachedCoroutine AwaitFence(const Xenon::CountingFence& fence, std::atomic_uint64_t& counter)
+	{
+		co_await fence;
+		counter++;
+	}
+}
+
+XENON_TEST(CountingFence, WaitReturnsOnceEveryThreadArrives)
+{
+	constexpr uint32_t threadCount = 8;
+
+	auto fence = Xenon::CountingFence(threadCount);
+	{
+		std::vector<std::jthread> threads;
+		for (uint32_t i = 0; i < threadCount; i++)
+			threads.emplace_back([&fence] { fence.arrive(); });
+
+		fence.waitBlocking();
+		XENON_EXPECT(fence.isComplete());
+	}
+
+	fence.reset(2);
+	XENON_EXPECT(!fence.isComplete());
+
+	fence.arrive(2);
+	fence.waitSpinning();
+	XENON_EXPECT(fence.getValue() == 0);
+}
+
+XENON_TEST(CountingFence, HelpingWaitExecutesJobs)
+{
+	auto jobSystem = Xenon::JobSystem(0);
+	auto fence = Xenon::CountingFence(16);
+
+	for (uint32_t i = 0; i < 16; i++)
+		jobSystem.insertDetached([&fence] { fence.arrive(); });
+
+	// There are no workers, so the waiting thread has to execute all the jobs.
+	fence.wait(jobSystem);
+	XENON_EXPECT(fence.isComplete());
+}
+
+XENON_TEST(CountingFence, ResumesAwaitingCoroutines)
+{
+	auto fence = Xenon::CountingFence(1);
+	auto counter = std::atomic_uint64_t(0);
+
+	for (uint32_t i = 0; i < 4; i++)
+		AwaitFence(fence, counter);
+
+	XENON_EXPECT(counter == 0);
+
+	fence.arrive();
+	XENON_EXPECT(counter == 4);
+
+	// Awaiting a complete fence should not suspend.
+	AwaitFence(fence, counter);
+	XENON_EXPECT(counter == 5);
+}
+
+XENON_TEST(CountingFence, CanBeDestroyedRightAfterWaiting)
+{
+	// The fence is allocated on the heap so that the address sanitizer catches the arriving thread touching it after it's destroyed.
+	for (uint32_t i = 0; i < 2000; i++)
+	{
+		auto pFence = std::make_unique<Xenon::CountingFence>(1);
+		auto thread = std::jthread([pFence = pFence.get()] { pFence->arrive(); });
+
+		pFence->waitBlocking();
+		pFence.reset();
+	}
+}
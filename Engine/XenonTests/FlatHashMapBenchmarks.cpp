@@ -0,0 +1,124 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/FlatHashMap.hpp"
+
+#include <fmt/format.h>
+
+#include <random>
+#include <unordered_map>
+
+namespace /* anonymous */
+{
+	/**
+	 * Get the key counts to benchmark with.
+	 * The small one fits in the cache, and the large one does not.
+	 *
+	 * @return The key counts.
+	 */
+	std::vector<uint64_t> GetKeyCounts()
+	{
+		if (Xenon::Testing::IsQuickRun())
+			return { 1 << 10, 1 << 14 };
+
+		return { 1 << 10, 1 << 20 };
+	}
+
+	/**
+	 * Create random unique keys.
+	 *
+	 * @param count The number of keys.
+	 * @param seed The random seed.
+	 * @return The keys.
+	 */
+	std::vector<uint64_t> CreateKeys(uint64_t count, uint64_t seed)
+	{
+		auto engine = std::mt19937_64(seed);
+
+		std::vector<uint64_t> keys(count);
+		for (auto& key : keys)
+			key = engine() | 1;	// The keys which are looked up but not inserted are even.
+
+		return keys;
+	}
+
+	/**
+	 * Measure the common map operations.
+	 *
+	 * @tparam Map The map type.
+	 * @param label The map label.
+	 * @param keys The keys to insert.
+	 * @param missingKeys The keys which are not in the map.
+	 */
+	template<class Map>
+	void MeasureMap(std::string_view label, const std::vector<uint64_t>& keys, const std::vector<uint64_t>& missingKeys)
+	{
+		const auto keyCount = keys.size();
+
+		Xenon::Testing::Measure(fmt::format("{} insert, {} keys", label, keyCount), keyCount, [&]
+			{
+				auto map = Map();
+				for (const auto key : keys)
+					map.try_emplace(key, key);
+
+				Xenon::Testing::DoNotOptimize(map.size());
+			});
+
+		auto map = Map();
+		for (const auto key : keys)
+			map.try_emplace(key, key);
+
+		Xenon::Testing::Measure(fmt::format("{} find (hit), {} keys", label, keyCount), keyCount, [&]
+			{
+				uint64_t sum = 0;
+				for (const auto key : keys)
+					sum += map.find(key)->second;
+
+				Xenon::Testing::DoNotOptimize(sum);
+			});
+
+		Xenon::Testing::Measure(fmt::format("{} find (miss), {} keys", label, keyCount), keyCount, [&]
+			{
+				uint64_t count = 0;
+				for (const auto key : missingKeys)
+					count += map.find(key) == map.end();
+
+				Xenon::Testing::DoNotOptimize(count);
+			});
+
+		Xenon::Testing::Measure(fmt::format("{} iterate, {} keys", label, keyCount), keyCount, [&]
+			{
+				uint64_t sum = 0;
+				for (const auto& [key, value] : map)
+					sum += value;
+
+				Xenon::Testing::DoNotOptimize(sum);
+			});
+
+		Xenon::Testing::Measure(fmt::format("{} erase and insert, {} keys", label, keyCount), keyCount, [&]
+			{
+				for (const auto key : keys)
+				{
+					map.erase(key);
+					map.try_emplace(key, key);
+				}
+			});
+	}
+}
+
+XENON_BENCHMARK(FlatHashMap, Operations)
+{
+	for (const auto keyCount : GetKeyCounts())
+	{
+		const auto keys = CreateKeys(keyCount, 42);
+
+		auto missingKeys = CreateKeys(keyCount, 7);
+		for (auto& key : missingKeys)
+			key &= ~uint64_t(1);
+
+		MeasureMap<std::unordered_map<uint64_t, uint64_t>>("std::unordered_map", keys, missingKeys);
+		MeasureMap<Xenon::FlatHashMap<uint64_t, uint64_t>>("FlatHashMap", keys, missingKeys);
+	}
+}
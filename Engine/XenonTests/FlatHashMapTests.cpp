@@ -0,0 +1,254 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+#include "AllocationCounter.hpp"
+
+#include "../XenonCore/FlatHashMap.hpp"
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace /* anonymous */
+{
+	/**
+	 * Colliding hash structure.
+	 * This maps every key to one of eight hashes, so that the probe sequences get long and the backward shift deletion has to move
+	 * many buckets.
+	 */
+	struct CollidingHash final
+	{
+		/**
+		 * Hash a key.
+		 *
+		 * @param key The key to hash.
+		 * @return The hash.
+		 */
+		[[nodiscard]] uint64_t operator()(uint64_t key) const noexcept { return key & 7; }
+	};
+
+	/**
+	 * String hash structure.
+	 * This hashes anything which converts to a string view, so that strings can be looked up without constructing a std::string.
+	 */
+	struct StringHash final
+	{
+		using is_transparent = void;
+
+		/**
+		 * Hash a string.
+		 *
+		 * @param string The string to hash.
+		 * @return The hash.
+		 */
+		[[nodiscard]] uint64_t operator()(std::string_view string) const noexcept { return std::hash<std::string_view>()(string); }
+	};
+
+	/**
+	 * Check if a map contains exactly the same entries as the reference map.
+	 *
+	 * @tparam Map The map type.
+	 * @param map The map to check.
+	 * @param reference The reference map.
+	 * @return True if the entries are the same.
+	 * @return False if an entry is missing, has a different value or is visited more than once.
+	 */
+	template<class Map>
+	[[nodiscard]] bool HasSameEntries(const Map& map, const std::unordered_map<uint64_t, uint64_t>& reference)
+	{
+		if (map.size() != reference.size())
+			return false;
+
+		// Every entry must be found through a lookup...
+		for (const auto& [key, value] : reference)
+		{
+			const auto itr = map.find(key);
+			if (itr == map.end() || itr->first != key || itr->second != value)
+				return false;
+		}
+
+		// ...and visited exactly once by the iterators.
+		std::unordered_set<uint64_t> visited;
+		for (const auto& [key, value] : map)
+		{
+			const auto itr = reference.find(key);
+			if (itr == reference.end() || itr->second != value || !visited.insert(key).second)
+				return false;
+		}
+
+		return visited.size() == reference.size();
+	}
+
+	/**
+	 * Run random insertions, erasures and lookups on a map and a std::unordered_map, and check that they always agree.
+	 * The key range is small enough for the keys to be reused, and the map starts empty so that it's rehashed several times.
+	 *
+	 * @tparam Hash The hasher type.
+	 * @param seed The random seed.
+	 */
+	template<class Hash>
+	void CompareWithUnorderedMap(uint64_t seed)
+	{
+		constexpr uint64_t operationCount = 100000;
+		constexpr uint64_t keyRange = 4096;
+
+		auto map = Xenon::FlatHashMap<uint64_t, uint64_t, Hash>();
+		auto reference = std::unordered_map<uint64_t, uint64_t>();
+		auto engine = std::mt19937_64(seed);
+		const auto initialBucketCount = map.bucket_count();
+
+		for (uint64_t i = 0; i < operationCount; i++)
+		{
+			// Insert more often than erase in the first half, and the other way around in the second half, so that the map both grows
+			// and drains.
+			const auto key = engine() % keyRange;
+			const auto operation = engine() % 8;
+			const auto isGrowing = i < operationCount / 2;
+
+			if (operation < (isGrowing ? 4u : 2u))
+			{
+				const auto [itr, isInserted] = map.try_emplace(key, i);
+				const auto [referenceItr, isReferenceInserted] = reference.try_emplace(key, i);
+				XENON_EXPECT(isInserted == isReferenceInserted);
+				XENON_EXPECT(itr->first == key && itr->second == referenceItr->second);
+			}
+			else if (operation == 4)
+			{
+				map.insert_or_assign(key, i);
+				reference.insert_or_assign(key, i);
+			}
+			else if (operation == 5)
+			{
+				map[key] += 1;
+				reference[key] += 1;
+			}
+			else
+			{
+				XENON_EXPECT(map.erase(key) == reference.erase(key));
+			}
+
+			XENON_EXPECT(map.contains(key) == reference.contains(key));
+			XENON_EXPECT(map.size() == reference.size());
+
+			if (i % 4096 == 0)
+				XENON_EXPECT(HasSameEntries(map, reference));
+		}
+
+		XENON_EXPECT(map.bucket_count() > initialBucketCount);
+		XENON_EXPECT(HasSameEntries(map, reference));
+
+		// The keys outside of the range were never inserted.
+		for (uint64_t key = keyRange; key < keyRange * 2; key++)
+			XENON_EXPECT(!map.contains(key) && map.find(key) == map.end());
+
+		map.clear();
+		XENON_EXPECT(map.empty() && map.begin() == map.end());
+		XENON_EXPECT(!map.contains(0));
+	}
+}
+
+XENON_TEST(FlatHashMap, MatchesUnorderedMap)
+{
+	CompareWithUnorderedMap<std::hash<uint64_t>>(1);
+	CompareWithUnorderedMap<std::hash<uint64_t>>(2);
+}
+
+XENON_TEST(FlatHashMap, MatchesUnorderedMapWithCollidingHashes)
+{
+	CompareWithUnorderedMap<CollidingHash>(3);
+}
+
+XENON_TEST(FlatHashMap, IteratesAfterErase)
+{
+	constexpr uint64_t keyCount = 1000;
+
+	auto map = Xenon::FlatHashMap<uint64_t, uint64_t>();
+	auto reference = std::unordered_map<uint64_t, uint64_t>();
+	for (uint64_t key = 0; key < keyCount; key++)
+	{
+		map.try_emplace(key, key * 10);
+		reference.try_emplace(key, key * 10);
+	}
+
+	// Erasing through an iterator moves the last entry into it's place, so the returned iterator must be visited next.
+	for (auto itr = map.begin(); itr != map.end();)
+	{
+		if (itr->first % 3 == 0)
+			itr = map.erase(itr);
+
+		else
+			++itr;
+	}
+
+	std::erase_if(reference, [](const auto& entry) { return entry.first % 3 == 0; });
+	XENON_EXPECT(HasSameEntries(map, reference));
+
+	// Erasing by key keeps the rest of the entries reachable too.
+	for (uint64_t key = 1; key < keyCount; key += 3)
+	{
+		XENON_EXPECT(map.erase(key) == 1);
+		reference.erase(key);
+	}
+
+	XENON_EXPECT(map.erase(0) == 0);
+	XENON_EXPECT(HasSameEntries(map, reference));
+
+	// Erase the remaining entries from the front.
+	while (!map.empty())
+		map.erase(map.begin());
+
+	XENON_EXPECT(map.begin() == map.end());
+	for (uint64_t key = 0; key < keyCount; key++)
+		XENON_EXPECT(!map.contains(key));
+}
+
+XENON_TEST(FlatHashMap, HeterogeneousLookup)
+{
+	// The keys are longer than the small string buffer, so constructing a std::string to look them up would allocate.
+	const auto prefix = std::string(64, 'x');
+
+	auto map = Xenon::FlatHashMap<std::string, uint32_t, StringHash, std::equal_to<>>();
+	for (uint32_t i = 0; i < 256; i++)
+		map.try_emplace(prefix + std::to_string(i), i);
+
+	const auto key = prefix + "42";
+	const auto missingKey = prefix + "missing";
+	const auto keyView = std::string_view(key);
+	const auto missingKeyView = std::string_view(missingKey);
+
+	const auto allocationCount = Xenon::Testing::GetAllocationCount();
+	const auto itr = map.find(keyView);
+	const auto isFound = itr != map.end() && itr->second == 42;
+	const auto isContained = map.contains(keyView) && map.contains(key.c_str());
+	const auto isMissing = !map.contains(missingKeyView) && map.find(missingKeyView) == map.end();
+	XENON_EXPECT(Xenon::Testing::GetAllocationCount() == allocationCount);
+
+	XENON_EXPECT(isFound);
+	XENON_EXPECT(isContained);
+	XENON_EXPECT(isMissing);
+
+	// The lookups through the key type must still work.
+	XENON_EXPECT(map.at(key) == 42);
+	XENON_EXPECT(map.find(key) == itr);
+}
+
+XENON_TEST(FlatHashMap, AtThrowsForMissingKeys)
+{
+	auto map = Xenon::FlatHashMap<uint64_t, uint64_t>({ { 1, 10 }, { 2, 20 } });
+	XENON_EXPECT(map.at(2) == 20);
+
+	bool hasThrown = false;
+	try
+	{
+		static_cast<void>(map.at(3));
+	}
+	catch (const std::out_of_range&)
+	{
+		hasThrown = true;
+	}
+
+	XENON_EXPECT(hasThrown);
+}
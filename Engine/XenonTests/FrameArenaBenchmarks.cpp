@@ -0,0 +1,139 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+#include "AllocationCounter.hpp"
+
+#include "../XenonCore/FrameArena.hpp"
+
+#include <fmt/format.h>
+
+#include <barrier>
+#include <cstdlib>
+#include <numeric>
+
+namespace /* anonymous */
+{
+	/**
+	 * Malloc resource class.
+	 * The benchmarks replace the global operator new to count allocations, which adds a contended atomic to every allocation of the
+	 * new/delete resource, so this is used to show the cost of the default allocator without it.
+	 */
+	class MallocResource final : public std::pmr::memory_resource
+	{
+	private:
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override
+		{
+			if (alignment <= alignof(std::max_align_t))
+				return std::malloc(bytes);
+
+			return std::aligned_alloc(alignment, (bytes + alignment - 1) / alignment * alignment);
+		}
+
+		void do_deallocate(void* pMemory, std::size_t, std::size_t) override { std::free(pMemory); }
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+	};
+
+	/**
+	 * The number of vectors each thread builds in a single frame.
+	 */
+	constexpr uint32_t VectorsPerFrame = 64;
+
+	/**
+	 * Get the thread counts to benchmark with.
+	 *
+	 * @return The thread counts.
+	 */
+	std::vector<uint32_t> GetThreadCounts()
+	{
+		if (Xenon::Testing::IsQuickRun())
+			return { 1, 4 };
+
+		return { 1, 2, 4, 8, 16 };
+	}
+
+	/**
+	 * Build the temporary vectors of a single frame, the way per-frame draw and command lists are built.
+	 * The vectors are grown one element at a time, so each of them allocates a few times.
+	 *
+	 * @param pResource The memory resource to allocate from.
+	 * @param frame The frame number.
+	 */
+	void BuildFrame(std::pmr::memory_resource* pResource, uint32_t frame)
+	{
+		for (uint32_t i = 0; i < VectorsPerFrame; i++)
+		{
+			auto vector = std::pmr::vector<uint64_t>(pResource);
+			for (uint32_t j = 0; j < (i + frame) % 64 + 1; j++)
+				vector.push_back(j);
+
+			Xenon::Testing::DoNotOptimize(std::accumulate(vector.begin(), vector.end(), uint64_t(0)));
+		}
+	}
+
+	/**
+	 * Run a number of frames on a number of threads at once.
+	 * The threads wait for each other at the end of every frame, and the frame end function is called once they all arrive.
+	 *
+	 * @tparam FrameEnd The frame end function type.
+	 * @param threadCount The number of threads.
+	 * @param frameCount The number of frames.
+	 * @param pResource The memory resource to allocate from.
+	 * @param frameEnd The function which is called at the end of every frame.
+	 */
+	template<class FrameEnd>
+	void RunFrames(uint32_t threadCount, uint32_t frameCount, std::pmr::memory_resource* pResource, FrameEnd frameEnd)
+	{
+		auto barrier = std::barrier(threadCount, frameEnd);
+
+		std::vector<std::jthread> threads;
+		threads.reserve(threadCount);
+
+		for (uint32_t i = 0; i < threadCount; i++)
+		{
+			threads.emplace_back([&barrier, frameCount, pResource]
+				{
+					for (uint32_t frame = 0; frame < frameCount; frame++)
+					{
+						BuildFrame(pResource, frame);
+						barrier.arrive_and_wait();
+					}
+				});
+		}
+	}
+
+	/**
+	 * Measure building the per-frame vectors, and report the number of global heap allocations per frame.
+	 *
+	 * @tparam FrameEnd The frame end function type.
+	 * @param label The metric label.
+	 * @param threadCount The number of threads.
+	 * @param pResource The memory resource to allocate from.
+	 * @param frameEnd The function which is called at the end of every frame.
+	 */
+	template<class FrameEnd>
+	void MeasureFrames(std::string_view label, uint32_t threadCount, std::pmr::memory_resource* pResource, FrameEnd frameEnd)
+	{
+		const uint32_t frameCount = Xenon::Testing::IsQuickRun() ? 64 : 1024;
+		const auto operations = static_cast<uint64_t>(frameCount) * threadCount * VectorsPerFrame;
+
+		Xenon::Testing::Measure(fmt::format("{}, {} threads", label, threadCount), operations, [&] { RunFrames(threadCount, frameCount, pResource, frameEnd); }, 3);
+
+		const auto allocationCount = Xenon::Testing::GetAllocationCount();
+		RunFrames(threadCount, frameCount, pResource, frameEnd);
+		Xenon::Testing::ReportMetric(fmt::format("{}, {} threads", label, threadCount), static_cast<double>(Xenon::Testing::GetAllocationCount() - allocationCount) / frameCount, "allocations/frame");
+	}
+}
+
+XENON_BENCHMARK(FrameArena, PerFrameVectors)
+{
+	auto mallocResource = MallocResource();
+	auto arena = Xenon::FrameArena();
+
+	for (const auto threadCount : GetThreadCounts())
+	{
+		MeasureFrames("std::pmr::new_delete_resource", threadCount, std::pmr::new_delete_resource(), []() noexcept {});
+		MeasureFrames("malloc resource", threadCount, &mallocResource, []() noexcept {});
+		MeasureFrames("FrameArena", threadCount, &arena, [&arena]() noexcept { arena.reset(); });
+	}
+}
@@ -0,0 +1,86 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/FrameArena.hpp"
+
+#include <cstring>
+
+XENON_TEST(FrameArena, AllocationsAreAligned)
+{
+	auto arena = Xenon::FrameArena(1024);
+
+	for (const uint64_t alignment : { 1, 2, 8, 16, 64, 256 })
+	{
+		const auto pMemory = arena.allocate(3, alignment);
+		XENON_EXPECT(reinterpret_cast<uintptr_t>(pMemory) % alignment == 0);
+		arena.deallocate(pMemory);
+	}
+
+	// Oversized allocations get a block of their own.
+	const auto pLarge = arena.allocate(4096, 64);
+	XENON_EXPECT(reinterpret_cast<uintptr_t>(pLarge) % 64 == 0);
+	std::memset(pLarge, 0xFF, 4096);
+	arena.deallocate(pLarge);
+}
+
+XENON_TEST(FrameArena, LiveAllocationsSurviveResets)
+{
+	auto arena = Xenon::FrameArena(1024);
+
+	// Hold an allocation across multiple frames while allocating (and freeing) in every frame.
+	const auto pHeld = static_cast<std::byte*>(arena.allocate(256));
+	std::memset(pHeld, 0xAB, 256);
+
+	for (uint32_t frame = 0; frame < 8; frame++)
+	{
+		arena.reset();
+
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			const auto pMemory = static_cast<std::byte*>(arena.allocate(256));
+			XENON_EXPECT(pMemory + 256 <= pHeld || pHeld + 256 <= pMemory);
+
+			std::memset(pMemory, 0xCD, 256);
+			arena.deallocate(pMemory);
+		}
+	}
+
+	bool isIntact = true;
+	for (uint32_t i = 0; i < 256; i++)
+		isIntact &= pHeld[i] == std::byte(0xAB);
+
+	XENON_EXPECT(isIntact);
+	arena.deallocate(pHeld);
+}
+
+XENON_TEST(FrameArena, DoesNotGrowWithoutResets)
+{
+	auto arena = Xenon::FrameArena(4096);
+
+	// Tools which don't have a renderer never reset the arena.
+	for (uint32_t i = 0; i < 100000; i++)
+	{
+		auto values = std::pmr::vector<uint64_t>(&arena);
+		values.resize(64, i);
+	}
+
+	XENON_EXPECT(arena.getReservedSize() == 4096);
+}
+
+XENON_TEST(FrameArena, CanDeallocateFromAnotherThread)
+{
+	auto arena = Xenon::FrameArena(4096);
+
+	for (uint32_t frame = 0; frame < 64; frame++)
+	{
+		auto pValues = std::make_unique<std::pmr::vector<uint32_t>>(1000, frame, &arena);
+		auto thread = std::jthread([pValues = std::move(pValues)] { XENON_EXPECT(pValues->back() == pValues->front()); });
+	}
+
+	// Everything was deallocated, so the next allocation reuses the first block.
+	const auto pMemory = arena.allocate(16);
+	arena.deallocate(pMemory);
+	XENON_EXPECT(arena.getReservedSize() == 4096);
+}
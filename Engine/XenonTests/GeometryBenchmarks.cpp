@@ -0,0 +1,177 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+#include "TestMeshes.hpp"
+
+#include "../XenonCooker/GeometrySource.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+#ifdef XENON_PLATFORM_WINDOWS
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+
+#endif
+
+#ifndef NOMINMAX
+#define NOMINMAX
+
+#endif
+
+#include <Windows.h>
+#include <Psapi.h>
+
+#endif
+
+namespace /* anonymous */
+{
+	/**
+	 * Append a value's bytes to a byte vector.
+	 *
+	 * @tparam Type The value type.
+	 * @param bytes The bytes to append to.
+	 * @param value The value to append.
+	 */
+	template<class Type>
+	void AppendBytes(std::vector<char>& bytes, const Type& value)
+	{
+		const auto pBegin = reinterpret_cast<const char*>(&value);
+		bytes.insert(bytes.end(), pBegin, pBegin + sizeof(Type));
+	}
+
+	/**
+	 * Write a test mesh to a binary glTF (.glb) file.
+	 * The vertices are stored interleaved in a single buffer view, and the indices as 32-bit integers in another.
+	 *
+	 * @param file The file to write to.
+	 * @param mesh The mesh to write.
+	 */
+	void WriteBinaryGltf(const std::filesystem::path& file, const Xenon::Testing::TestMesh& mesh)
+	{
+		constexpr uint32_t stride = sizeof(Xenon::Testing::TestVertex);
+		const auto vertexDataSize = mesh.m_Vertices.size() * stride;
+		const auto indexDataSize = mesh.m_Indices.size() * sizeof(uint32_t);
+
+		// The position accessor must have it's bounds. The sphere is a unit sphere.
+		auto json = fmt::format(
+			R"({{"asset":{{"version":"2.0"}},"scene":0,"scenes":[{{"nodes":[0]}}],"nodes":[{{"mesh":0}}],)"
+			R"("meshes":[{{"name":"Sphere","primitives":[{{"attributes":{{"POSITION":0,"NORMAL":1,"TEXCOORD_0":2}},"indices":3}}]}}],)"
+			R"("buffers":[{{"byteLength":{2}}}],)"
+			R"("bufferViews":[{{"buffer":0,"byteOffset":0,"byteLength":{0},"byteStride":{4},"target":34962}},{{"buffer":0,"byteOffset":{0},"byteLength":{1},"target":34963}}],)"
+			R"("accessors":[)"
+			R"({{"bufferView":0,"byteOffset":0,"componentType":5126,"count":{3},"type":"VEC3","min":[-1,-1,-1],"max":[1,1,1]}},)"
+			R"({{"bufferView":0,"byteOffset":12,"componentType":5126,"count":{3},"type":"VEC3"}},)"
+			R"({{"bufferView":0,"byteOffset":24,"componentType":5126,"count":{3},"type":"VEC2"}},)"
+			R"({{"bufferView":1,"byteOffset":0,"componentType":5125,"count":{5},"type":"SCALAR"}}]}})",
+			vertexDataSize, indexDataSize, vertexDataSize + indexDataSize, mesh.m_Vertices.size(), stride, mesh.m_Indices.size());
+
+		// Both chunks must be 4 byte aligned. The JSON chunk is padded with spaces.
+		json.resize((json.size() + 3) & ~3ull, ' ');
+		const auto binarySize = static_cast<uint32_t>((vertexDataSize + indexDataSize + 3) & ~3ull);
+
+		std::vector<char> bytes;
+		bytes.reserve(28 + json.size() + binarySize);
+
+		AppendBytes(bytes, uint32_t(0x46546C67));	// "glTF"
+		AppendBytes(bytes, uint32_t(2));
+		AppendBytes(bytes, static_cast<uint32_t>(28 + json.size() + binarySize));
+
+		AppendBytes(bytes, static_cast<uint32_t>(json.size()));
+		AppendBytes(bytes, uint32_t(0x4E4F534A));	// "JSON"
+		bytes.insert(bytes.end(), json.begin(), json.end());
+
+		AppendBytes(bytes, binarySize);
+		AppendBytes(bytes, uint32_t(0x004E4942));	// "BIN"
+		const auto binaryOffset = bytes.size();
+		bytes.resize(binaryOffset + binarySize, 0);
+		std::memcpy(bytes.data() + binaryOffset, mesh.m_Vertices.data(), vertexDataSize);
+		std::memcpy(bytes.data() + binaryOffset + vertexDataSize, mesh.m_Indices.data(), indexDataSize);
+
+		auto stream = std::ofstream(file, std::ios::binary);
+		stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+	}
+
+	/**
+	 * Reset the peak resident set size of the process, where the platform supports it.
+	 * Linux resets it when "5" is written to /proc/self/clear_refs. Windows can't, so the peak there includes anything which ran before.
+	 */
+	void ResetPeakResidentSetSize()
+	{
+#ifndef XENON_PLATFORM_WINDOWS
+		auto stream = std::ofstream("/proc/self/clear_refs");
+		stream << "5";
+
+#endif
+	}
+
+	/**
+	 * Get the resident set size of the process.
+	 *
+	 * @param peak Whether to get the peak size instead of the current size.
+	 * @return The size in bytes. This is 0 if it could not be queried.
+	 */
+	uint64_t GetResidentSetSize(bool peak)
+	{
+#ifdef XENON_PLATFORM_WINDOWS
+		PROCESS_MEMORY_COUNTERS counters = {};
+		if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+			return peak ? counters.PeakWorkingSetSize : counters.WorkingSetSize;
+
+#else
+		const std::string_view key = peak ? "VmHWM:" : "VmRSS:";
+
+		auto stream = std::ifstream("/proc/self/status");
+		for (std::string line; std::getline(stream, line);)
+		{
+			if (line.starts_with(key))
+				return std::stoull(line.substr(key.size())) * 1024;
+		}
+
+#endif
+
+		return 0;
+	}
+}
+
+XENON_BENCHMARK(Geometry, LoadBinaryGltf)
+{
+	const auto rings = Xenon::Testing::IsQuickRun() ? 64 : 512;
+	const auto mesh = Xenon::Testing::CreateSphere(rings, rings * 2);
+	const auto triangleCount = mesh.m_Indices.size() / 3;
+
+	const auto directory = std::filesystem::temp_directory_path();
+	const auto sourceFile = directory / "XenonGeometryBenchmark.glb";
+	const auto cookedFile = directory / "XenonGeometryBenchmark.xgeo";
+	WriteBinaryGltf(sourceFile, mesh);
+
+	const auto fileSize = std::filesystem::file_size(sourceFile);
+	Xenon::Testing::ReportMetric("source file size", static_cast<double>(fileSize) / (1024.0 * 1024.0), "MiB");
+
+	// Cooking without the optimizations does what a runtime load of a glTF file does before the GPU resources are created, plus the
+	// cooked file write.
+	Xenon::Testing::Measure(fmt::format("load (cook without optimizing), sphere ({} triangles)", triangleCount), triangleCount, [&sourceFile, &cookedFile]
+		{
+			Xenon::Testing::DoNotOptimize(Xenon::GeometrySource::Cook(sourceFile, cookedFile, false));
+		}, 3);
+
+	// Compare the growth to the source file size to see how many copies of the data are alive at once.
+	const auto residentSetSize = GetResidentSetSize(false);
+	ResetPeakResidentSetSize();
+
+	Xenon::Testing::DoNotOptimize(Xenon::GeometrySource::Cook(sourceFile, cookedFile, false));
+	const auto peakResidentSetSize = GetResidentSetSize(true);
+
+	Xenon::Testing::ReportMetric("peak RSS", static_cast<double>(peakResidentSetSize) / (1024.0 * 1024.0), "MiB");
+	Xenon::Testing::ReportMetric("peak RSS growth while loading", static_cast<double>(peakResidentSetSize - std::min(residentSetSize, peakResidentSetSize)) / (1024.0 * 1024.0), "MiB");
+
+	std::filesystem::remove(sourceFile);
+	std::filesystem::remove(cookedFile);
+}
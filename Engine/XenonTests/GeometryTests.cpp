@@ -0,0 +1,53 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../Xenon/Geometry.hpp"
+
+#include <cstring>
+
+namespace /* anonymous */
+{
+	/**
+	 * Create a sub-mesh with every byte (including the padding) set to a value before the members are set.
+	 *
+	 * @param fill The byte to fill the sub-mesh with.
+	 * @return The sub-mesh.
+	 */
+	Xenon::SubMesh CreateSubMesh(int fill)
+	{
+		Xenon::SubMesh subMesh;
+		std::memset(static_cast<void*>(&subMesh), fill, sizeof(Xenon::SubMesh));
+
+		subMesh.m_BaseColorTexture = {};
+		subMesh.m_RoughnessTexture = {};
+		subMesh.m_NormalTexture = {};
+		subMesh.m_OcclusionTexture = {};
+		subMesh.m_EmissiveTexture = {};
+		subMesh.m_VertexOffset = 10;
+		subMesh.m_VertexCount = 20;
+		subMesh.m_IndexOffset = 30;
+		subMesh.m_IndexCount = 40;
+		subMesh.m_MeshletOffset = 2;
+		subMesh.m_MeshletCount = 1;
+		subMesh.m_Mode = Xenon::PrimitiveMode::Triangles;
+		subMesh.m_IndexSize = 2;
+
+		return subMesh;
+	}
+}
+
+XENON_TEST(Geometry, EqualSubMeshesHaveEqualHashes)
+{
+	// The sub-mesh has padding after the index size, which must not change the hash.
+	const auto lhs = CreateSubMesh(0x00);
+	auto rhs = CreateSubMesh(0xFF);
+
+	XENON_EXPECT(lhs == rhs);
+	XENON_EXPECT(std::hash<Xenon::SubMesh>()(lhs) == std::hash<Xenon::SubMesh>()(rhs));
+
+	rhs.m_IndexSize = 4;
+	XENON_EXPECT(lhs != rhs);
+	XENON_EXPECT(std::hash<Xenon::SubMesh>()(lhs) != std::hash<Xenon::SubMesh>()(rhs));
+}
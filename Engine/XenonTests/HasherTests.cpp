@@ -0,0 +1,164 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/Hasher.hpp"
+
+#define XXH_INLINE_ALL
+#include <xxhash.h>
+
+#include <cstring>
+#include <random>
+
+namespace /* anonymous */
+{
+	/**
+	 * The hasher's internal buffer size, past which it switches to the streaming state.
+	 */
+	constexpr uint64_t HasherBufferSize = 256;
+
+	/**
+	 * Padded structure.
+	 * This has padding after each member, so it has to be hashed using hashValue().
+	 */
+	struct Padded final
+	{
+		uint8_t m_Small = 0;
+		uint64_t m_Large = 0;
+		uint16_t m_Medium = 0;
+
+		void hashValue(Xenon::Hasher& hasher) const { hasher.combine(m_Small, m_Large, m_Medium); }
+	};
+
+	/**
+	 * Pointer structure.
+	 * This has a pointer member, so it hashes the address explicitly.
+	 */
+	struct Pointer final
+	{
+		const int* m_pValue = nullptr;
+
+		void hashValue(Xenon::Hasher& hasher) const { hasher.combine(XENON_BIT_CAST(uintptr_t, m_pValue)); }
+	};
+
+	static_assert(Xenon::IsByteHashable<uint64_t>);
+	static_assert(Xenon::IsByteHashable<Xenon::Hash128>);
+	static_assert(!Xenon::IsByteHashable<const int*>);
+	static_assert(!Xenon::IsByteHashable<int Padded::*>);
+	static_assert(!Xenon::IsByteHashable<Padded>);
+	static_assert(Xenon::HasHashValue<Pointer>);
+
+	/**
+	 * Create a number of random bytes.
+	 *
+	 * @param size The number of bytes.
+	 * @return The bytes.
+	 */
+	std::vector<std::byte> CreateBytes(uint64_t size)
+	{
+		auto engine = std::mt19937(42);
+
+		std::vector<std::byte> bytes(size);
+		for (auto& byte : bytes)
+			byte = static_cast<std::byte>(engine());
+
+		return bytes;
+	}
+
+	/**
+	 * Check the hashes of a hasher against hashing a number of bytes in one go.
+	 *
+	 * @param hasher The hasher to check.
+	 * @param pBytes The bytes which were combined to the hasher.
+	 * @param size The number of bytes.
+	 * @param seed The hash seed.
+	 * @return True if both the 64-bit and the 128-bit hashes match.
+	 * @return False if either of them differ.
+	 */
+	bool MatchesOneShot(const Xenon::Hasher& hasher, const std::byte* pBytes, uint64_t size, uint64_t seed)
+	{
+		const auto hash128 = XXH3_128bits_withSeed(pBytes, size, seed);
+		const auto result128 = hasher.getHash128();
+
+		return hasher.getHash() == XXH3_64bits_withSeed(pBytes, size, seed) && result128.m_Low == hash128.low64 && result128.m_High == hash128.high64;
+	}
+}
+
+XENON_TEST(Hasher, StreamingMatchesOneShot)
+{
+	constexpr uint64_t seed = 1234;
+	const auto bytes = CreateBytes(4096);
+
+	auto engine = std::mt19937(7);
+	auto hasher = Xenon::Hasher(seed);
+	uint64_t size = 0;
+
+	// Combine the bytes in uneven chunks, and check every prefix. This goes from the buffer to the streaming state on the way.
+	while (size < bytes.size())
+	{
+		const auto chunkSize = std::min<uint64_t>(engine() % 97, bytes.size() - size);
+		hasher.combineBytes(bytes.data() + size, chunkSize);
+		size += chunkSize;
+
+		XENON_EXPECT(MatchesOneShot(hasher, bytes.data(), size, seed));
+	}
+}
+
+XENON_TEST(Hasher, SplitsAroundTheBufferSizeAgree)
+{
+	const auto bytes = CreateBytes(HasherBufferSize * 3);
+
+	for (const auto size : { HasherBufferSize - 1, HasherBufferSize, HasherBufferSize + 1, HasherBufferSize * 2, HasherBufferSize * 3 })
+	{
+		for (const auto split : { uint64_t(0), uint64_t(1), HasherBufferSize - 1, HasherBufferSize, HasherBufferSize + 1 })
+		{
+			if (split > size)
+				continue;
+
+			auto hasher = Xenon::Hasher();
+			hasher.combineBytes(bytes.data(), split).combineBytes(bytes.data() + split, size - split);
+
+			XENON_EXPECT(MatchesOneShot(hasher, bytes.data(), size, 0));
+		}
+	}
+}
+
+XENON_TEST(Hasher, CombiningValuesHashesTheirBytes)
+{
+	const auto first = uint32_t(0xDEADBEEF);
+	const auto second = uint64_t(0x0123456789ABCDEF);
+	const auto third = Xenon::Hash128{ 1, 2 };
+
+	std::byte bytes[sizeof(first) + sizeof(second) + sizeof(third)];
+	std::memcpy(bytes, &first, sizeof(first));
+	std::memcpy(bytes + sizeof(first), &second, sizeof(second));
+	std::memcpy(bytes + sizeof(first) + sizeof(second), &third, sizeof(third));
+
+	XENON_EXPECT(MatchesOneShot(Xenon::Hasher(5).combine(first, second, third), bytes, sizeof(bytes), 5));
+}
+
+XENON_TEST(Hasher, SizesSeparateStringsAndRanges)
+{
+	XENON_EXPECT(Xenon::Hasher().combine("ab", "c").getHash() != Xenon::Hasher().combine("a", "bc").getHash());
+	XENON_EXPECT(Xenon::Hasher().combine(std::vector<uint32_t>{ 1, 2 }, std::vector<uint32_t>{ 3 }).getHash() != Xenon::Hasher().combine(std::vector<uint32_t>{ 1 }, std::vector<uint32_t>{ 2, 3 }).getHash());
+}
+
+XENON_TEST(Hasher, PaddingIsNotHashed)
+{
+	// Fill the padding with different garbage.
+	Padded lhs;
+	Padded rhs;
+	std::memset(static_cast<void*>(&lhs), 0x00, sizeof(Padded));
+	std::memset(static_cast<void*>(&rhs), 0xFF, sizeof(Padded));
+
+	lhs.m_Small = rhs.m_Small = 1;
+	lhs.m_Large = rhs.m_Large = 2;
+	lhs.m_Medium = rhs.m_Medium = 3;
+
+	XENON_EXPECT(Xenon::Hasher().combine(lhs).getHash() == Xenon::Hasher().combine(rhs).getHash());
+	XENON_EXPECT(Xenon::Hasher().combine(std::vector<Padded>{ lhs, lhs }).getHash() == Xenon::Hasher().combine(std::vector<Padded>{ rhs, rhs }).getHash());
+
+	rhs.m_Medium = 4;
+	XENON_EXPECT(Xenon::Hasher().combine(lhs).getHash() != Xenon::Hasher().combine(rhs).getHash());
+}
@@ -0,0 +1,115 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/Interleave.hpp"
+#include "../XenonCore/XObject.hpp"
+
+#include <array>
+#include <cstring>
+#include <random>
+
+namespace /* anonymous */
+{
+	/**
+	 * The attribute sizes of a typical vertex: position (vec3), normal (vec3), texture coordinates (vec2) and tangent (vec4).
+	 */
+	constexpr std::array<uint32_t, 4> AttributeSizes = { 12, 12, 8, 16 };
+
+	/**
+	 * The size of a single interleaved vertex.
+	 */
+	constexpr uint64_t VertexSize = 48;
+
+	/**
+	 * Attribute view structure.
+	 * This is how the per-vertex loop which LoadSubMesh used before InterleaveStreams saw an attribute.
+	 */
+	struct AttributeView final
+	{
+		std::vector<unsigned char>::const_iterator m_Begin;
+		uint64_t m_Size = 0;
+		uint32_t m_Stride = 0;
+	};
+
+	/**
+	 * Interleave a single vertex the way LoadSubMesh did before InterleaveStreams.
+	 *
+	 * @param attributes The attribute views.
+	 * @param pDestination The vertex buffer.
+	 * @param index The vertex index.
+	 */
+	void InterleaveVertex(const std::vector<AttributeView>& attributes, unsigned char* pDestination, uint64_t index)
+	{
+		auto vertex = pDestination + (index * VertexSize);
+		for (const auto& attribute : attributes)
+		{
+			const auto offset = index * attribute.m_Stride;
+			if (offset < attribute.m_Size)
+				std::copy_n(attribute.m_Begin + offset, attribute.m_Stride, vertex);
+
+			vertex += attribute.m_Stride;
+		}
+	}
+
+	/**
+	 * Create the tightly packed attribute buffers of a mesh, the usual glTF layout.
+	 *
+	 * @param vertexCount The number of vertices.
+	 * @return The attribute buffers.
+	 */
+	std::vector<std::vector<unsigned char>> CreateAttributeBuffers(uint64_t vertexCount)
+	{
+		auto engine = std::mt19937(42);
+
+		std::vector<std::vector<unsigned char>> buffers;
+		for (const auto size : AttributeSizes)
+		{
+			auto& buffer = buffers.emplace_back(vertexCount * size);
+			for (auto& byte : buffer)
+				byte = static_cast<unsigned char>(engine());
+		}
+
+		return buffers;
+	}
+}
+
+XENON_BENCHMARK(Interleave, VertexAttributes)
+{
+	auto& jobSystem = Xenon::XObject::GetJobSystem();
+	const uint64_t vertexCount = Xenon::Testing::IsQuickRun() ? 1 << 14 : 1 << 20;
+	const auto buffers = CreateAttributeBuffers(vertexCount);
+
+	std::vector<AttributeView> attributes;
+	std::vector<Xenon::InterleaveStream> streams;
+
+	uint32_t offset = 0;
+	for (uint64_t i = 0; i < AttributeSizes.size(); i++)
+	{
+		attributes.emplace_back(buffers[i].begin(), buffers[i].size(), AttributeSizes[i]);
+		streams.emplace_back(Xenon::ToBytes(buffers[i].data()), AttributeSizes[i], AttributeSizes[i], offset);
+		offset += AttributeSizes[i];
+	}
+
+	std::vector<unsigned char> legacyVertices(vertexCount * VertexSize);
+	std::vector<std::byte> vertices(vertexCount * VertexSize);
+
+	Xenon::Testing::Measure("Per-vertex copy_n loop (serial)", vertexCount, [&]
+		{
+			for (uint64_t i = 0; i < vertexCount; i++)
+				InterleaveVertex(attributes, legacyVertices.data(), i);
+		});
+
+	Xenon::Testing::Measure("InterleaveStreams (serial)", vertexCount, [&] { Xenon::InterleaveStreams(streams, vertices.data(), VertexSize, 0, vertexCount); });
+
+	// Both must produce the same vertices.
+	XENON_EXPECT(std::memcmp(legacyVertices.data(), vertices.data(), vertices.size()) == 0);
+
+	Xenon::Testing::Measure("Per-vertex copy_n loop (ParallelFor)", vertexCount, [&]
+		{
+			Xenon::ParallelFor(jobSystem, 0, vertexCount, [&](uint64_t i) { InterleaveVertex(attributes, legacyVertices.data(), i); });
+		});
+
+	Xenon::Testing::Measure("ParallelInterleaveStreams", vertexCount, [&] { Xenon::ParallelInterleaveStreams(jobSystem, streams, vertices.data(), VertexSize, vertexCount); });
+}
@@ -0,0 +1,308 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+#include "AllocationCounter.hpp"
+
+#include "../XenonCore/JobSystem.hpp"
+#include "../XenonCore/CountingFence.hpp"
+
+#include <fmt/format.h>
+
+#include <ctime>
+#include <list>
+#include <latch>
+
+namespace /* anonymous */
+{
+	/**
+	 * Legacy job system class.
+	 * This is the job system which was used before the work stealing scheduler, which pushed every job to a single locked
+	 * list, and made all the workers wait on a single condition variable. It's only kept here to compare the two.
+	 */
+	class LegacyJobSystem final
+	{
+	public:
+		explicit LegacyJobSystem(uint32_t threadCount)
+			: m_WorkerState(threadCount, false)
+		{
+			auto latch = std::latch(threadCount);
+
+			m_Workers.reserve(threadCount);
+			for (uint32_t i = 0; i < threadCount; i++)
+				m_Workers.emplace_back([this, &latch, i] { latch.count_down(); worker(i); });
+
+			latch.wait();
+		}
+
+		~LegacyJobSystem()
+		{
+			m_ShouldRun = false;
+			m_ConditionVariable.notify_all();
+			m_Workers.clear();
+		}
+
+		template<class Function>
+		decltype(auto) insert(Function&& function)
+		{
+			using ReturnType = std::invoke_result_t<Function>;
+
+			auto pPromise = new std::promise<ReturnType>();
+			auto future = pPromise->get_future();
+
+			const auto jobFunction = [pPromise, function = std::forward<Function>(function)]
+			{
+				if constexpr (std::is_void_v<ReturnType>)
+				{
+					function();
+					pPromise->set_value();
+				}
+				else
+				{
+					pPromise->set_value(function());
+				}
+
+				delete pPromise;
+			};
+
+			const auto lock = std::scoped_lock(m_JobMutex);
+			m_JobEntries.emplace_back(std::move(jobFunction));
+
+			m_ConditionVariable.notify_one();
+			return future;
+		}
+
+		void wait()
+		{
+			while (!isComplete());
+		}
+
+		bool isComplete()
+		{
+			const auto lock = std::scoped_lock(m_JobMutex);
+			if (!m_JobEntries.empty())
+				return false;
+
+			for (const auto state : m_WorkerState)
+			{
+				if (state)
+					return false;
+			}
+
+			return true;
+		}
+
+	private:
+		void worker(uint32_t index)
+		{
+			auto locker = std::unique_lock(m_JobMutex);
+
+			do
+			{
+				m_ConditionVariable.wait(locker, [this] { return !m_JobEntries.empty() || m_ShouldRun == false; });
+
+				if (!m_JobEntries.empty())
+					execute(locker, index);
+			} while (m_ShouldRun);
+
+			while (!m_JobEntries.empty())
+				execute(locker, index);
+		}
+
+		void execute(std::unique_lock<std::mutex>& lock, uint32_t index)
+		{
+			m_WorkerState[index] = true;
+
+			const auto jobEntry = m_JobEntries.front();
+			m_JobEntries.pop_front();
+
+			if (lock) lock.unlock();
+
+			jobEntry();
+			m_WorkerState[index] = false;
+
+			lock.lock();
+		}
+
+	private:
+		std::mutex m_JobMutex;
+		std::atomic_bool m_ShouldRun = true;
+		std::condition_variable m_ConditionVariable;
+
+		std::list<std::function<void()>> m_JobEntries;
+		std::vector<std::jthread> m_Workers;
+		std::vector<bool> m_WorkerState;
+	};
+
+	/**
+	 * Measure the CPU time used by the whole process while running a function, and report it as a percentage of the wall time.
+	 * On Windows std::clock() returns the wall time, so this is only meaningful on POSIX platforms.
+	 *
+	 * @tparam Function The function type.
+	 * @param label The metric label.
+	 * @param function The function to run.
+	 */
+	template<class Function>
+	void MeasureCpuUsage(std::string_view label, Function&& function)
+	{
+		const auto cpuStart = std::clock();
+		const auto wallStart = std::chrono::steady_clock::now();
+
+		function();
+
+		const auto cpuSeconds = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+		const auto wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+		Xenon::Testing::ReportMetric(label, cpuSeconds / wallSeconds * 100.0, "% of a core");
+	}
+
+	/**
+	 * Get the thread counts to benchmark.
+	 *
+	 * @return The thread counts.
+	 */
+	std::vector<uint32_t> GetThreadCounts()
+	{
+		if (Xenon::Testing::IsQuickRun())
+			return { 1, 2, 4 };
+
+		return { 1, 2, 4, 8, 16, 32, 64 };
+	}
+
+	/**
+	 * Insert a number of jobs from as many producer threads as there are workers, and wait till all of them complete.
+	 * This contends both the queues (producers inserting while the workers pop) and the waiting.
+	 *
+	 * @tparam Insert The insert function type.
+	 * @tparam Wait The wait function type.
+	 * @param producerCount The number of producer threads.
+	 * @param jobCount The total number of jobs to insert.
+	 * @param insert The function which inserts a single job.
+	 * @param wait The function which waits till all the jobs are complete.
+	 */
+	template<class Insert, class Wait>
+	void RunContended(uint32_t producerCount, uint64_t jobCount, Insert&& insert, Wait&& wait)
+	{
+		{
+			std::vector<std::jthread> producers;
+			producers.reserve(producerCount);
+
+			for (uint32_t i = 0; i < producerCount; i++)
+			{
+				producers.emplace_back([&insert, jobsPerProducer = jobCount / producerCount]
+					{
+						for (uint64_t j = 0; j < jobsPerProducer; j++)
+							insert();
+					});
+			}
+		}
+
+		wait();
+	}
+}
+
+XENON_BENCHMARK(JobSystem, Contention)
+{
+	const uint64_t jobCount = Xenon::Testing::IsQuickRun() ? 4096 : 65536;
+
+	for (const auto threadCount : GetThreadCounts())
+	{
+		auto counter = std::atomic_uint64_t(0);
+		const auto job = [&counter] { counter.fetch_add(1, std::memory_order_relaxed); };
+
+		{
+			auto jobSystem = LegacyJobSystem(threadCount);
+			Xenon::Testing::Measure(fmt::format("Legacy insert, {} threads", threadCount), jobCount, [&]
+				{
+					RunContended(threadCount, jobCount, [&] { static_cast<void>(jobSystem.insert(job)); }, [&] { jobSystem.wait(); });
+				}, 3);
+		}
+
+		{
+			auto jobSystem = Xenon::JobSystem(threadCount);
+			Xenon::Testing::Measure(fmt::format("Work stealing insert, {} threads", threadCount), jobCount, [&]
+				{
+					RunContended(threadCount, jobCount, [&] { static_cast<void>(jobSystem.insert(job)); }, [&] { jobSystem.wait(); });
+				}, 3);
+
+			auto group = Xenon::JobGroup();
+			Xenon::Testing::Measure(fmt::format("Work stealing insertDetached, {} threads", threadCount), jobCount, [&]
+				{
+					RunContended(threadCount, jobCount, [&] { jobSystem.insertDetached(group, job); }, [&] { jobSystem.wait(group); });
+				}, 3);
+		}
+	}
+}
+
+XENON_BENCHMARK(JobSystem, AllocationsPerSubmit)
+{
+	const uint64_t jobCount = Xenon::Testing::IsQuickRun() ? 1024 : 16384;
+
+	auto counter = std::atomic_uint64_t(0);
+	const auto job = [&counter] { counter.fetch_add(1, std::memory_order_relaxed); };
+
+	// Run the same submission pattern twice, and report the second one so that the pools are warm.
+	const auto countAllocations = [jobCount](auto&& submit, auto&& wait)
+		{
+			double allocationsPerJob = 0.0;
+			for (uint32_t run = 0; run < 2; run++)
+			{
+				const auto allocationCount = Xenon::Testing::GetAllocationCount();
+				for (uint64_t i = 0; i < jobCount; i++)
+					submit();
+
+				wait();
+				allocationsPerJob = static_cast<double>(Xenon::Testing::GetAllocationCount() - allocationCount) / static_cast<double>(jobCount);
+			}
+
+			return allocationsPerJob;
+		};
+
+	{
+		auto jobSystem = LegacyJobSystem(2);
+		Xenon::Testing::ReportMetric("Legacy insert", countAllocations([&] { static_cast<void>(jobSystem.insert(job)); }, [&] { jobSystem.wait(); }), "allocations/job");
+	}
+
+	{
+		auto jobSystem = Xenon::JobSystem(2);
+		auto group = Xenon::JobGroup();
+		Xenon::Testing::ReportMetric("Work stealing insert", countAllocations([&] { static_cast<void>(jobSystem.insert(job)); }, [&] { jobSystem.wait(); }), "allocations/job");
+		Xenon::Testing::ReportMetric("Work stealing insertDetached", countAllocations([&] { jobSystem.insertDetached(group, job); }, [&] { jobSystem.wait(group); }), "allocations/job");
+	}
+}
+
+XENON_BENCHMARK(JobSystem, IdleCpuUsage)
+{
+	const auto idleTime = std::chrono::milliseconds(Xenon::Testing::IsQuickRun() ? 50 : 500);
+	const auto longJob = [idleTime] { std::this_thread::sleep_for(idleTime); };
+
+	// The main thread waits on a single long job while the rest of the workers have nothing to do.
+	{
+		auto jobSystem = LegacyJobSystem(4);
+		MeasureCpuUsage("Legacy wait", [&] { static_cast<void>(jobSystem.insert(longJob)); jobSystem.wait(); });
+	}
+
+	{
+		auto jobSystem = Xenon::JobSystem(4);
+		auto group = Xenon::JobGroup();
+		MeasureCpuUsage("Work stealing wait", [&] { jobSystem.insertDetached(group, longJob); jobSystem.wait(group); });
+	}
+
+	// The main thread waits on a fence which another thread signals after a while.
+	{
+		auto counter = std::atomic_uint64_t(1);
+		MeasureCpuUsage("Spinning fence wait", [&]
+			{
+				auto thread = std::jthread([&] { longJob(); counter--; });
+				while (counter > 0);
+			});
+	}
+
+	{
+		auto fence = Xenon::CountingFence(1);
+		MeasureCpuUsage("Counting fence wait", [&]
+			{
+				auto thread = std::jthread([&] { longJob(); fence.arrive(); });
+				fence.wait();
+			});
+	}
+}
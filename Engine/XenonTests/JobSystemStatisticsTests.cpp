@@ -0,0 +1,160 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/JobSystem.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace /* anonymous */
+{
+	/**
+	 * Spin till a condition is met, or till a timeout so that a broken test fails instead of hanging.
+	 *
+	 * @tparam Function The condition type.
+	 * @param condition The condition.
+	 * @return True if the condition was met.
+	 * @return False if the timeout was reached.
+	 */
+	template<class Function>
+	[[nodiscard]] bool SpinUntil(Function&& condition)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		while (!condition())
+		{
+			if (std::chrono::steady_clock::now() - start > std::chrono::seconds(5))
+				return false;
+
+			std::this_thread::yield();
+		}
+
+		return true;
+	}
+}
+
+XENON_TEST(JobSystemStatistics, CountsExecutedJobsAndSteals)
+{
+	constexpr uint32_t injectedJobCount = 100;
+	constexpr uint32_t childJobCount = 200;
+	constexpr uint32_t ioJobCount = 10;
+
+	auto configuration = Xenon::JobSystemConfiguration();
+	configuration.m_WorkerCount = 2;
+	configuration.m_IOWorkerCount = 1;
+
+	auto jobSystem = Xenon::JobSystem(configuration);
+	auto group = Xenon::JobGroup();
+
+	// Hold both workers, so that the next jobs pile up in the injection queue.
+	auto isHeld = std::atomic_bool(true);
+	auto heldWorkers = std::atomic_uint32_t(0);
+	auto parentThread = std::thread::id();
+	auto isChildStolen = std::atomic_bool(false);
+	for (uint32_t i = 0; i < 2; i++)
+	{
+		jobSystem.insertDetached(group, [&, i]
+			{
+				heldWorkers++;
+				static_cast<void>(SpinUntil([&isHeld] { return !isHeld; }));
+
+				// The first worker pushes jobs to it's own queue and keeps busy till the other worker has stolen one of them.
+				if (i == 0)
+				{
+					parentThread = std::this_thread::get_id();
+					for (uint32_t j = 0; j < childJobCount; j++)
+					{
+						jobSystem.insertDetached(group, [&parentThread, &isChildStolen]
+							{
+								if (std::this_thread::get_id() != parentThread)
+									isChildStolen = true;
+							});
+					}
+
+					static_cast<void>(SpinUntil([&isChildStolen] { return isChildStolen.load(); }));
+				}
+			});
+	}
+
+	XENON_EXPECT(SpinUntil([&heldWorkers] { return heldWorkers == 2; }));
+
+	// Start counting from here. The held jobs are counted once they complete.
+	jobSystem.resetStatistics();
+
+	for (uint32_t i = 0; i < injectedJobCount; i++)
+		jobSystem.insertDetached(group, [] {});
+
+	for (uint32_t i = 0; i < ioJobCount; i++)
+		jobSystem.insertIODetached(group, [] {});
+
+	// Don't help, so that the helper counters stay empty.
+	isHeld = false;
+	XENON_EXPECT(SpinUntil([&group] { return group.isComplete(); }));
+	XENON_EXPECT(isChildStolen);
+
+	const auto statistics = jobSystem.getStatistics();
+	const auto total = statistics.getTotal();
+	XENON_EXPECT(statistics.m_Workers.size() == 2);
+
+#ifdef XENON_ENABLE_JOB_STATISTICS
+	uint64_t workerJobCount = 0;
+	for (const auto& worker : statistics.m_Workers)
+	{
+		XENON_EXPECT(worker.m_ExecutedJobs > 0);
+		XENON_EXPECT(worker.m_SuccessfulSteals <= worker.m_StealAttempts);
+		workerJobCount += worker.m_ExecutedJobs;
+	}
+
+	XENON_EXPECT(workerJobCount == 2 + injectedJobCount + childJobCount);
+	XENON_EXPECT(statistics.m_IOWorkers.m_ExecutedJobs == ioJobCount);
+	XENON_EXPECT(statistics.m_Helpers.m_ExecutedJobs == 0);
+	XENON_EXPECT(total.m_ExecutedJobs == 2 + injectedJobCount + childJobCount + ioJobCount);
+
+	// Every injected job was queued at once, and the children were pushed to a single worker's queue faster than they were taken.
+	XENON_EXPECT(statistics.m_InjectionQueueHighWaterMark == injectedJobCount);
+	XENON_EXPECT(total.m_QueueDepthHighWaterMark > 1);
+	XENON_EXPECT(total.m_SuccessfulSteals > 0);
+	XENON_EXPECT(total.m_BusyTime.count() > 0);
+	XENON_EXPECT(total.getAverageLatency().count() > 0);
+
+#else
+	XENON_EXPECT(total.m_ExecutedJobs == 0);
+	XENON_EXPECT(statistics.m_InjectionQueueHighWaterMark == 0);
+
+#endif
+
+	// Everything is 0 after a reset.
+	jobSystem.resetStatistics();
+
+	const auto resetTotal = jobSystem.getStatistics().getTotal();
+	XENON_EXPECT(resetTotal.m_ExecutedJobs == 0);
+	XENON_EXPECT(resetTotal.m_StealAttempts == 0 && resetTotal.m_SuccessfulSteals == 0);
+	XENON_EXPECT(resetTotal.m_QueueDepthHighWaterMark == 0);
+	XENON_EXPECT(resetTotal.m_BusyTime.count() == 0 && resetTotal.m_TotalLatency.count() == 0);
+	XENON_EXPECT(jobSystem.getStatistics().m_InjectionQueueHighWaterMark == 0);
+}
+
+XENON_TEST(JobSystemStatistics, CountsHelpingThreads)
+{
+	// Without workers, every job is executed by the waiting thread.
+	auto jobSystem = Xenon::JobSystem(0);
+	auto group = Xenon::JobGroup();
+
+	for (uint32_t i = 0; i < 50; i++)
+		jobSystem.insertDetached(group, [] {}, static_cast<Xenon::JobPriority>(i % 3));
+
+	jobSystem.wait(group);
+
+	const auto statistics = jobSystem.getStatistics();
+	XENON_EXPECT(statistics.m_Workers.empty());
+
+#ifdef XENON_ENABLE_JOB_STATISTICS
+	XENON_EXPECT(statistics.m_Helpers.m_ExecutedJobs == 50);
+	XENON_EXPECT(statistics.getTotal().m_ExecutedJobs == 50);
+
+#else
+	XENON_EXPECT(statistics.m_Helpers.m_ExecutedJobs == 0);
+
+#endif
+}
@@ -0,0 +1,529 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+#include "AllocationCounter.hpp"
+
+#include "../XenonCore/JobSystem.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+#ifdef XENON_PLATFORM_LINUX
+#	include <sched.h>
+
+#endif
+
+XENON_TEST(JobSystem, InsertReturnsTheResult)
+{
+	auto jobSystem = Xenon::JobSystem(2);
+
+	auto future = jobSystem.insert([] { return 42; });
+	XENON_EXPECT(future.get() == 42);
+}
+
+XENON_TEST(JobSystem, InsertPropagatesExceptions)
+{
+	auto jobSystem = Xenon::JobSystem(2);
+
+	auto future = jobSystem.insert([]() -> int { throw std::runtime_error("Job failed!"); });
+
+	bool hasThrown = false;
+	try
+	{
+		static_cast<void>(future.get());
+	}
+	catch (const std::runtime_error&)
+	{
+		hasThrown = true;
+	}
+
+	XENON_EXPECT(hasThrown);
+}
+
+XENON_TEST(JobSystem, ExecutesJobsInsertedFromManyThreads)
+{
+	constexpr uint32_t producerCount = 8;
+	constexpr uint32_t jobsPerProducer = 2000;
+
+	auto jobSystem = Xenon::JobSystem(4);
+	auto group = Xenon::JobGroup();
+	auto counter = std::atomic_uint64_t(0);
+
+	{
+		std::vector<std::jthread> producers;
+		for (uint32_t i = 0; i < producerCount; i++)
+		{
+			producers.emplace_back([&jobSystem, &group, &counter]
+				{
+					for (uint32_t j = 0; j < jobsPerProducer; j++)
+						jobSystem.insertDetached(group, [&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+				});
+		}
+	}
+
+	jobSystem.wait(group);
+	XENON_EXPECT(counter == producerCount * jobsPerProducer);
+	XENON_EXPECT(group.isComplete());
+}
+
+XENON_TEST(JobSystem, ExecutesJobsInsertedFromWorkers)
+{
+	constexpr uint32_t parentCount = 64;
+	constexpr uint32_t childrenPerParent = 64;
+
+	auto jobSystem = Xenon::JobSystem(4);
+	auto group = Xenon::JobGroup();
+	auto counter = std::atomic_uint64_t(0);
+
+	for (uint32_t i = 0; i < parentCount; i++)
+	{
+		jobSystem.insertDetached(group, [&jobSystem, &group, &counter]
+			{
+				for (uint32_t j = 0; j < childrenPerParent; j++)
+					jobSystem.insertDetached(group, [&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+			});
+	}
+
+	jobSystem.wait(group);
+	XENON_EXPECT(counter == parentCount * childrenPerParent);
+}
+
+XENON_TEST(JobSystem, ExecutesEveryPriority)
+{
+	auto jobSystem = Xenon::JobSystem(2);
+	auto group = Xenon::JobGroup();
+	auto counter = std::atomic_uint64_t(0);
+
+	for (uint32_t i = 0; i < 300; i++)
+		jobSystem.insertDetached(group, [&counter] { counter.fetch_add(1, std::memory_order_relaxed); }, static_cast<Xenon::JobPriority>(i % 3));
+
+	jobSystem.wait(group);
+	XENON_EXPECT(counter == 300);
+}
+
+XENON_TEST(JobSystem, WaitingThreadExecutesJobsWithoutWorkers)
+{
+	auto jobSystem = Xenon::JobSystem(0);
+	auto counter = std::atomic_uint64_t(0);
+
+	for (uint32_t i = 0; i < 100; i++)
+		jobSystem.insertDetached([&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+
+	jobSystem.wait();
+	XENON_EXPECT(counter == 100);
+	XENON_EXPECT(jobSystem.isComplete());
+}
+
+XENON_TEST(JobSystem, ThrowingDetachedJobsDoNotEscapeWaits)
+{
+	// Without workers, the jobs are executed by the waiting thread.
+	auto jobSystem = Xenon::JobSystem(0);
+	auto group = Xenon::JobGroup();
+	auto counter = std::atomic_uint64_t(0);
+
+	for (uint32_t i = 0; i < 100; i++)
+	{
+		jobSystem.insertDetached(group, [&counter, i]
+			{
+				if (i % 2 == 0)
+					throw std::runtime_error("Job failed!");
+
+				counter.fetch_add(1, std::memory_order_relaxed);
+			}, static_cast<Xenon::JobPriority>(i % 3));
+	}
+
+	bool hasThrown = false;
+	try
+	{
+		jobSystem.wait(group);
+	}
+	catch (...)
+	{
+		hasThrown = true;
+	}
+
+	XENON_EXPECT(!hasThrown);
+	XENON_EXPECT(counter == 50);
+	XENON_EXPECT(group.isComplete());
+
+	// The system must not be left waiting on the failed jobs.
+	jobSystem.wait();
+	XENON_EXPECT(jobSystem.isComplete());
+}
+
+XENON_TEST(JobSystem, SetThreadCountKeepsExecuting)
+{
+	auto jobSystem = Xenon::JobSystem(1);
+	jobSystem.setThreadCount(3);
+	XENON_EXPECT(jobSystem.getThreadCount() == 3);
+
+	auto future = jobSystem.insert([] { return 7; });
+	XENON_EXPECT(future.get() == 7);
+}
+
+XENON_TEST(JobSystem, DetachedInsertDoesNotAllocateOnceWarm)
+{
+	constexpr uint32_t jobsPerFrame = 1024;
+
+	auto jobSystem = Xenon::JobSystem(2);
+	auto group = Xenon::JobGroup();
+	auto counter = std::atomic_uint64_t(0);
+
+	// Mimic a frame loop.
+	const auto runFrame = [&]
+		{
+			for (uint32_t i = 0; i < jobsPerFrame; i++)
+				jobSystem.insertDetached(group, [&counter, i] { counter.fetch_add(i, std::memory_order_relaxed); });
+
+			jobSystem.wait(group);
+		};
+
+	// Warm up the job pool. The workers can cache up to 256 free jobs each, so the pool needs to hold that many on top of a frame's
+	// worth of jobs before the frames stop allocating. Keep the workers busy while inserting, so that all of the jobs are allocated
+	// at once instead of being recycled.
+	{
+		auto startedWorkers = std::atomic_uint32_t(0);
+		auto isInserting = std::atomic_bool(true);
+		for (uint32_t i = 0; i < jobSystem.getThreadCount(); i++)
+		{
+			jobSystem.insertDetached(group, [&startedWorkers, &isInserting]
+				{
+					startedWorkers++;
+					while (isInserting)
+						std::this_thread::yield();
+				});
+		}
+
+		while (startedWorkers != jobSystem.getThreadCount())
+			std::this_thread::yield();
+
+		for (uint32_t i = 0; i < jobsPerFrame * 2; i++)
+			jobSystem.insertDetached(group, [&counter, i] { counter.fetch_add(i, std::memory_order_relaxed); });
+
+		isInserting = false;
+		jobSystem.wait(group);
+	}
+
+	const auto allocationCount = Xenon::Testing::GetAllocationCount();
+	for (uint32_t i = 0; i < 32; i++)
+		runFrame();
+
+	XENON_EXPECT(Xenon::Testing::GetAllocationCount() == allocationCount);
+}
+
+XENON_TEST(JobSystem, GroupCanBeDestroyedRightAfterWaiting)
+{
+	auto jobSystem = Xenon::JobSystem(4);
+	auto counter = std::atomic_uint64_t(0);
+
+	// The group is allocated on the heap so that the address sanitizer catches a worker touching it after it's destroyed.
+	for (uint32_t i = 0; i < 2000; i++)
+	{
+		auto pGroup = std::make_unique<Xenon::JobGroup>();
+		for (uint32_t j = 0; j < 4; j++)
+			jobSystem.insertDetached(*pGroup, [&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+
+		jobSystem.wait(*pGroup);
+	}
+
+	XENON_EXPECT(counter == 2000 * 4);
+}
+
+XENON_TEST(JobSystem, GroupWaitDoesNotPickUpUnrelatedBackgroundJobs)
+{
+	constexpr auto timeout = std::chrono::seconds(2);
+
+	// The long jobs run till they're released, or till the timeout if a waiter got stuck with one.
+	auto isReleased = std::atomic_bool(false);
+	auto finishedLongJobs = std::atomic_uint32_t(0);
+	const auto longJob = [&isReleased, &finishedLongJobs, timeout]
+		{
+			const auto start = std::chrono::steady_clock::now();
+			while (!isReleased && std::chrono::steady_clock::now() - start < timeout)
+				std::this_thread::yield();
+
+			finishedLongJobs++;
+		};
+
+	// One worker, which is allowed to run background jobs, and an I/O worker which the waiters can't help with.
+	auto configuration = Xenon::JobSystemConfiguration();
+	configuration.m_WorkerCount = 1;
+	configuration.m_IOWorkerCount = 1;
+
+	auto jobSystem = Xenon::JobSystem(configuration);
+	XENON_EXPECT(jobSystem.getBackgroundWorkerLimit() == 1);
+
+	// A worker waiting on a group, while a background job sits in it's own queue.
+	auto outerGroup = Xenon::JobGroup();
+	auto longJobsFinishedBeforeWait = std::atomic_uint32_t(std::numeric_limits<uint32_t>::max());
+	jobSystem.insertDetached(outerGroup, [&]
+		{
+			jobSystem.insertDetached(longJob, Xenon::JobPriority::Background);
+
+			auto innerGroup = Xenon::JobGroup();
+			jobSystem.insertIODetached(innerGroup, [] { std::this_thread::sleep_for(std::chrono::milliseconds(10)); });
+			jobSystem.wait(innerGroup);
+
+			longJobsFinishedBeforeWait = finishedLongJobs.load();
+		});
+
+	// Don't help, so that the outer job runs on the worker.
+	while (!outerGroup.isComplete())
+		std::this_thread::yield();
+
+	XENON_EXPECT(longJobsFinishedBeforeWait == 0);
+
+	// A non-worker waiting on a group, while the worker is busy with a background job and another one is queued.
+	jobSystem.insertDetached(longJob, Xenon::JobPriority::Background);
+
+	auto group = Xenon::JobGroup();
+	jobSystem.insertIODetached(group, [] { std::this_thread::sleep_for(std::chrono::milliseconds(10)); });
+	jobSystem.wait(group);
+
+	XENON_EXPECT(finishedLongJobs == 0);
+
+	isReleased = true;
+	jobSystem.wait();
+	XENON_EXPECT(finishedLongJobs == 2);
+}
+
+XENON_TEST(JobSystem, GroupWaitRunsBackgroundJobsWithoutWorkers)
+{
+	auto jobSystem = Xenon::JobSystem(0);
+	auto group = Xenon::JobGroup();
+	auto counter = std::atomic_uint64_t(0);
+
+	for (uint32_t i = 0; i < 10; i++)
+		jobSystem.insertDetached(group, [&counter] { counter++; }, Xenon::JobPriority::Background);
+
+	jobSystem.wait(group);
+	XENON_EXPECT(counter == 10);
+}
+
+XENON_TEST(JobSystem, HigherPrioritiesRunFirst)
+{
+	auto jobSystem = Xenon::JobSystem(1);
+	auto group = Xenon::JobGroup();
+
+	// Hold the only worker, so that all of the jobs are queued before any of them run.
+	auto isHeld = std::atomic_bool(true);
+	auto isWorkerHeld = std::atomic_bool(false);
+	jobSystem.insertDetached(group, [&isHeld, &isWorkerHeld]
+		{
+			isWorkerHeld = true;
+			while (isHeld)
+				std::this_thread::yield();
+		});
+
+	while (!isWorkerHeld)
+		std::this_thread::yield();
+
+	// Insert the priorities interleaved, lowest first.
+	std::vector<Xenon::JobPriority> order;
+	for (uint32_t i = 0; i < 30; i++)
+	{
+		const auto priority = static_cast<Xenon::JobPriority>(2 - i % 3);
+		jobSystem.insertDetached(group, [&order, priority] { order.emplace_back(priority); }, priority);
+	}
+
+	// Don't help, so that the order is only decided by the worker.
+	isHeld = false;
+	while (!group.isComplete())
+		std::this_thread::yield();
+
+	XENON_EXPECT(order.size() == 30);
+	XENON_EXPECT(std::ranges::is_sorted(order));
+}
+
+XENON_TEST(JobSystem, GroupWaitsAreIndependent)
+{
+	constexpr auto timeout = std::chrono::seconds(2);
+
+	auto jobSystem = Xenon::JobSystem(2);
+
+	// Occupy both workers with the jobs of one group.
+	auto blockedGroup = Xenon::JobGroup();
+	auto isReleased = std::atomic_bool(false);
+	auto startedJobs = std::atomic_uint32_t(0);
+	auto finishedJobs = std::atomic_uint32_t(0);
+	for (uint32_t i = 0; i < jobSystem.getThreadCount(); i++)
+	{
+		jobSystem.insertDetached(blockedGroup, [&isReleased, &startedJobs, &finishedJobs, timeout]
+			{
+				startedJobs++;
+
+				const auto start = std::chrono::steady_clock::now();
+				while (!isReleased && std::chrono::steady_clock::now() - start < timeout)
+					std::this_thread::yield();
+
+				finishedJobs++;
+			});
+	}
+
+	while (startedJobs != jobSystem.getThreadCount())
+		std::this_thread::yield();
+
+	// The other group can only be completed by the waiting thread, and it must not wait for the blocked one.
+	auto group = Xenon::JobGroup();
+	auto counter = std::atomic_uint64_t(0);
+	for (uint32_t i = 0; i < 100; i++)
+		jobSystem.insertDetached(group, [&counter] { counter++; });
+
+	jobSystem.wait(group);
+	XENON_EXPECT(counter == 100);
+	XENON_EXPECT(finishedJobs == 0);
+	XENON_EXPECT(!blockedGroup.isComplete());
+
+	isReleased = true;
+	jobSystem.wait(blockedGroup);
+	XENON_EXPECT(finishedJobs == jobSystem.getThreadCount());
+}
+
+XENON_TEST(JobSystem, BackgroundJobsAreCapped)
+{
+	auto jobSystem = Xenon::JobSystem(4);
+	XENON_EXPECT(jobSystem.getBackgroundWorkerLimit() == 2);
+
+	// Record the most background jobs which ran at once, for the default limit (half of the workers) and an explicit one.
+	for (const uint32_t limit : { 0, 1, 3 })
+	{
+		jobSystem.setBackgroundWorkerLimit(limit);
+		const auto expectedLimit = limit > 0 ? limit : jobSystem.getThreadCount() / 2;
+		XENON_EXPECT(jobSystem.getBackgroundWorkerLimit() == expectedLimit);
+
+		auto group = Xenon::JobGroup();
+		auto runningJobs = std::atomic_uint32_t(0);
+		auto maxRunningJobs = std::atomic_uint32_t(0);
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			jobSystem.insertDetached(group, [&runningJobs, &maxRunningJobs]
+				{
+					const auto running = ++runningJobs;
+					auto maxRunning = maxRunningJobs.load();
+					while (running > maxRunning && !maxRunningJobs.compare_exchange_weak(maxRunning, running));
+
+					std::this_thread::sleep_for(std::chrono::milliseconds(5));
+					runningJobs--;
+				}, Xenon::JobPriority::Background);
+		}
+
+		// The other workers keep running normal jobs meanwhile.
+		auto normalGroup = Xenon::JobGroup();
+		auto counter = std::atomic_uint64_t(0);
+		for (uint32_t i = 0; i < 100; i++)
+			jobSystem.insertDetached(normalGroup, [&counter] { counter++; });
+
+		jobSystem.wait(normalGroup);
+		XENON_EXPECT(counter == 100);
+
+		jobSystem.wait(group);
+		XENON_EXPECT(maxRunningJobs > 0 && maxRunningJobs <= expectedLimit);
+	}
+}
+
+XENON_TEST(JobSystem, ConfigurationKeepsAtLeastOneWorker)
+{
+	// A worker count of 0 is resolved from the hardware, which leaves none on a single processor machine.
+	auto configuration = Xenon::JobSystemConfiguration();
+	configuration.m_WorkerCount = 0;
+
+	auto jobSystem = Xenon::JobSystem(configuration);
+	const auto hardwareConcurrency = std::thread::hardware_concurrency();
+	XENON_EXPECT(jobSystem.getThreadCount() == std::max(hardwareConcurrency, 2u) - 1);
+	XENON_EXPECT(jobSystem.getIOThreadCount() == configuration.m_IOWorkerCount);
+
+	// Waiting on the future does not help, so the job must run on a worker.
+	auto future = jobSystem.insert([] { return std::this_thread::get_id(); });
+	XENON_EXPECT(future.get() != std::this_thread::get_id());
+}
+
+XENON_TEST(JobSystem, IOJobsRunOnTheIOWorkers)
+{
+	auto configuration = Xenon::JobSystemConfiguration();
+	configuration.m_WorkerCount = 2;
+	configuration.m_IOWorkerCount = 1;
+
+	auto jobSystem = Xenon::JobSystem(configuration);
+	XENON_EXPECT(jobSystem.getIOThreadCount() == 1);
+
+	// Hold every compute worker, so that the I/O job can only complete if it's executed somewhere else.
+	auto group = Xenon::JobGroup();
+	auto isHeld = std::atomic_bool(true);
+	auto workerIds = std::vector<std::thread::id>(jobSystem.getThreadCount());
+	auto heldWorkers = std::atomic_uint32_t(0);
+	for (uint32_t i = 0; i < jobSystem.getThreadCount(); i++)
+	{
+		jobSystem.insertDetached(group, [&isHeld, &workerIds, &heldWorkers]
+			{
+				workerIds[heldWorkers++] = std::this_thread::get_id();
+				while (isHeld)
+					std::this_thread::yield();
+			});
+	}
+
+	while (heldWorkers != jobSystem.getThreadCount())
+		std::this_thread::yield();
+
+	auto future = jobSystem.insertIO([] { return std::this_thread::get_id(); });
+	const auto ioWorkerId = future.get();
+
+	XENON_EXPECT(ioWorkerId != std::this_thread::get_id());
+	XENON_EXPECT(std::ranges::find(workerIds, ioWorkerId) == workerIds.end());
+
+	isHeld = false;
+	jobSystem.wait(group);
+
+	// Without I/O workers, the I/O jobs are executed by the compute workers instead.
+	configuration.m_IOWorkerCount = 0;
+	auto computeOnlySystem = Xenon::JobSystem(configuration);
+	XENON_EXPECT(computeOnlySystem.getIOThreadCount() == 0);
+	XENON_EXPECT(computeOnlySystem.insertIO([] { return 42; }).get() == 42);
+}
+
+XENON_TEST(JobSystem, PinningAndNumaGroupingAreAccepted)
+{
+	// Every combination must execute the jobs, regardless of the number of processors and nodes of the machine.
+	for (const auto& [pinWorkers, groupByNumaNode] : { std::pair{ true, false }, std::pair{ false, true }, std::pair{ true, true } })
+	{
+		auto configuration = Xenon::JobSystemConfiguration();
+		configuration.m_WorkerCount = 4;
+		configuration.m_PinWorkers = pinWorkers;
+		configuration.m_GroupByNumaNode = groupByNumaNode;
+
+		auto jobSystem = Xenon::JobSystem(configuration);
+		XENON_EXPECT(jobSystem.getThreadCount() == 4);
+
+		auto group = Xenon::JobGroup();
+		auto counter = std::atomic_uint64_t(0);
+		auto isPinned = std::atomic_bool(true);
+		for (uint32_t i = 0; i < 1000; i++)
+		{
+			jobSystem.insertDetached(group, [&jobSystem, &group, &counter, &isPinned]
+				{
+#ifdef XENON_PLATFORM_LINUX
+					// Pinned workers can only run on a single processor.
+					cpu_set_t processorSet;
+					CPU_ZERO(&processorSet);
+					if (sched_getaffinity(0, sizeof(processorSet), &processorSet) == 0 && CPU_COUNT(&processorSet) != 1)
+						isPinned = false;
+
+#endif
+
+					// Steal across the workers as well.
+					jobSystem.insertDetached(group, [&counter] { counter++; });
+					counter++;
+				});
+		}
+
+		// Don't help, so that every job runs on a worker.
+		while (!group.isComplete())
+			std::this_thread::yield();
+
+		XENON_EXPECT(counter == 2000);
+		XENON_EXPECT(!pinWorkers || isPinned);
+	}
+}
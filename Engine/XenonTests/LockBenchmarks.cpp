@@ -0,0 +1,121 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/AdaptiveMutex.hpp"
+#include "../XenonCore/Mutex.hpp"
+#include "../XenonCore/RWMutex.hpp"
+
+#include <fmt/format.h>
+
+#include <thread>
+#include <unordered_map>
+
+namespace /* anonymous */
+{
+	/**
+	 * The cache type which is locked, like the pipeline and descriptor caches.
+	 */
+	using Cache = std::unordered_map<uint64_t, uint64_t>;
+
+	/**
+	 * The number of entries in the cache.
+	 */
+	constexpr uint64_t CacheSize = 1024;
+
+	/**
+	 * One in this many operations is a write.
+	 */
+	constexpr uint64_t WriteInterval = 32;
+
+	/**
+	 * Get the thread counts to benchmark with.
+	 *
+	 * @return The thread counts.
+	 */
+	std::vector<uint32_t> GetThreadCounts()
+	{
+		if (Xenon::Testing::IsQuickRun())
+			return { 1, 4 };
+
+		return { 1, 2, 4, 8, 16 };
+	}
+
+	/**
+	 * Create the cache with all of its entries.
+	 *
+	 * @return The cache.
+	 */
+	Cache CreateCache()
+	{
+		Cache cache;
+		for (uint64_t i = 0; i < CacheSize; i++)
+			cache[i] = i;
+
+		return cache;
+	}
+
+	/**
+	 * Run a read-mostly workload on a number of threads, and report the time per operation.
+	 *
+	 * @tparam Read The read function type.
+	 * @tparam Write The write function type.
+	 * @param label The metric label.
+	 * @param threadCount The number of threads.
+	 * @param read The function which looks up a key in the cache.
+	 * @param write The function which updates a key in the cache.
+	 */
+	template<class Read, class Write>
+	void MeasureReadMostly(std::string_view label, uint32_t threadCount, Read read, Write write)
+	{
+		const uint64_t operationsPerThread = Xenon::Testing::IsQuickRun() ? 1 << 12 : 1 << 18;
+
+		Xenon::Testing::Measure(fmt::format("{}, {} threads", label, threadCount), operationsPerThread * threadCount, [&]
+			{
+				std::vector<std::jthread> threads;
+				threads.reserve(threadCount);
+
+				for (uint32_t i = 0; i < threadCount; i++)
+				{
+					threads.emplace_back([&read, &write, operationsPerThread, i]
+						{
+							uint64_t sum = 0;
+							for (uint64_t j = 0; j < operationsPerThread; j++)
+							{
+								const auto key = (j * 0x9E3779B97F4A7C15 + i) % CacheSize;
+								if (j % WriteInterval == 0)
+									write(key, j);
+
+								else
+									sum += read(key);
+							}
+
+							Xenon::Testing::DoNotOptimize(sum);
+						});
+				}
+			}, 3);
+	}
+}
+
+XENON_BENCHMARK(Lock, ReadMostly)
+{
+	auto mutex = Xenon::Mutex<Cache>(CreateCache());
+	auto adaptiveMutex = Xenon::Mutex<Cache, Xenon::AdaptiveMutex>(CreateCache());
+	auto rwMutex = Xenon::RWMutex<Cache>(CreateCache());
+
+	for (const auto threadCount : GetThreadCounts())
+	{
+		MeasureReadMostly("Mutex<std::mutex>", threadCount,
+			[&mutex](uint64_t key) { return mutex.access([key](Cache& cache) { return cache.find(key)->second; }); },
+			[&mutex](uint64_t key, uint64_t value) { mutex.access([key, value](Cache& cache) { cache[key] = value; }); });
+
+		MeasureReadMostly("Mutex<AdaptiveMutex>", threadCount,
+			[&adaptiveMutex](uint64_t key) { return adaptiveMutex.access([key](Cache& cache) { return cache.find(key)->second; }); },
+			[&adaptiveMutex](uint64_t key, uint64_t value) { adaptiveMutex.access([key, value](Cache& cache) { cache[key] = value; }); });
+
+		MeasureReadMostly("RWMutex<std::shared_mutex>", threadCount,
+			[&rwMutex](uint64_t key) { return rwMutex.read([key](const Cache& cache) { return cache.find(key)->second; }); },
+			[&rwMutex](uint64_t key, uint64_t value) { rwMutex.write([key, value](Cache& cache) { cache[key] = value; }); });
+	}
+}
@@ -0,0 +1,149 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+// The lock statistics are disabled by default, so they are enabled for this file only. The mutexes here lock test-local types, so
+// their instantiations don't clash with the ones compiled without the statistics.
+#define XENON_ENABLE_LOCK_STATISTICS
+
+#include "Testing.hpp"
+
+#include "../XenonCore/AdaptiveMutex.hpp"
+#include "../XenonCore/Mutex.hpp"
+#include "../XenonCore/RWMutex.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace /* anonymous */
+{
+	/**
+	 * Counter structure.
+	 */
+	struct Counter final
+	{
+		uint64_t m_Value = 0;
+	};
+
+	/**
+	 * Find the statistics of a lock by its name.
+	 *
+	 * @param name The lock name.
+	 * @return The statistics. The name is empty if the lock was not found.
+	 */
+	Xenon::LockStatistics FindStatistics(std::string_view name)
+	{
+		const auto statistics = Xenon::LockCounters::GetAllStatistics();
+		const auto itr = std::ranges::find(statistics, name, &Xenon::LockStatistics::m_Name);
+
+		return itr != statistics.end() ? *itr : Xenon::LockStatistics();
+	}
+
+	/**
+	 * Hold a lock on another thread while calling a function which acquires it, so that the acquisition is contended.
+	 *
+	 * @tparam Hold The hold function type.
+	 * @tparam Acquire The acquire function type.
+	 * @param hold The function which acquires the lock and calls the function it's given while holding it.
+	 * @param acquire The function which acquires the lock.
+	 */
+	template<class Hold, class Acquire>
+	void AcquireContended(Hold&& hold, Acquire&& acquire)
+	{
+		auto isHolding = std::atomic_bool(false);
+		auto isAcquiring = std::atomic_bool(false);
+
+		auto holder = std::jthread([&hold, &isHolding, &isAcquiring]
+			{
+				hold([&isHolding, &isAcquiring]
+					{
+						isHolding = true;
+						while (!isAcquiring)
+							std::this_thread::yield();
+
+						// Give the other thread the time to find the lock taken.
+						std::this_thread::sleep_for(std::chrono::milliseconds(10));
+					});
+			});
+
+		while (!isHolding)
+			std::this_thread::yield();
+
+		isAcquiring = true;
+		acquire();
+	}
+}
+
+XENON_TEST(LockStatistics, CountsUncontendedAcquisitions)
+{
+	auto mutex = Xenon::Mutex<Counter, Xenon::AdaptiveMutex>();
+	mutex.setName("LockStatisticsTests.Uncontended");
+
+	for (uint32_t i = 0; i < 100; i++)
+		mutex.access([](Counter& counter) { counter.m_Value++; });
+
+	const auto statistics = FindStatistics("LockStatisticsTests.Uncontended");
+	XENON_EXPECT(statistics.m_Name == "LockStatisticsTests.Uncontended");
+	XENON_EXPECT(statistics.m_Acquisitions == 100);
+	XENON_EXPECT(statistics.m_ContendedAcquisitions == 0);
+	XENON_EXPECT(statistics.getContentionRate() == 0.0f);
+}
+
+XENON_TEST(LockStatistics, CountsContendedAcquisitions)
+{
+	auto mutex = Xenon::Mutex<Counter, Xenon::AdaptiveMutex>();
+	mutex.setName("LockStatisticsTests.Contended");
+
+	AcquireContended(
+		[&mutex](auto whileHolding) { mutex.access([&whileHolding](Counter&) { whileHolding(); }); },
+		[&mutex] { mutex.access([](Counter& counter) { counter.m_Value++; }); });
+
+	// The holder's acquisition is uncontended.
+	const auto statistics = FindStatistics("LockStatisticsTests.Contended");
+	XENON_EXPECT(statistics.m_Acquisitions == 2);
+	XENON_EXPECT(statistics.m_ContendedAcquisitions == 1);
+	XENON_EXPECT(statistics.m_WaitTime > std::chrono::nanoseconds(0));
+	XENON_EXPECT(statistics.getContentionRate() == 0.5f);
+}
+
+XENON_TEST(LockStatistics, CountsSharedAcquisitions)
+{
+	auto mutex = Xenon::RWMutex<Counter>();
+	mutex.setName("LockStatisticsTests.Shared");
+
+	AcquireContended(
+		[&mutex](auto whileHolding) { mutex.write([&whileHolding](Counter&) { whileHolding(); }); },
+		[&mutex] { static_cast<void>(mutex.get()); });
+	static_cast<void>(mutex.read([](const Counter& counter) { return counter.m_Value; }));
+
+	const auto statistics = FindStatistics("LockStatisticsTests.Shared");
+	XENON_EXPECT(statistics.m_Acquisitions == 3);
+	XENON_EXPECT(statistics.m_ContendedAcquisitions == 1);
+}
+
+XENON_TEST(LockStatistics, ResetClearsTheCounters)
+{
+	auto mutex = Xenon::Mutex<Counter, Xenon::AdaptiveMutex>();
+	mutex.setName("LockStatisticsTests.Reset");
+
+	mutex.access([](Counter& counter) { counter.m_Value++; });
+	XENON_EXPECT(FindStatistics("LockStatisticsTests.Reset").m_Acquisitions == 1);
+
+	Xenon::LockCounters::ResetAll();
+
+	const auto statistics = FindStatistics("LockStatisticsTests.Reset");
+	XENON_EXPECT(statistics.m_Acquisitions == 0);
+	XENON_EXPECT(statistics.m_ContendedAcquisitions == 0);
+	XENON_EXPECT(statistics.m_WaitTime == std::chrono::nanoseconds(0));
+}
+
+XENON_TEST(LockStatistics, DestroyedLocksAreNotReported)
+{
+	{
+		auto mutex = Xenon::Mutex<Counter, Xenon::AdaptiveMutex>();
+		mutex.setName("LockStatisticsTests.Destroyed");
+		XENON_EXPECT(FindStatistics("LockStatisticsTests.Destroyed").m_Name == "LockStatisticsTests.Destroyed");
+	}
+
+	XENON_EXPECT(FindStatistics("LockStatisticsTests.Destroyed").m_Name.empty());
+}
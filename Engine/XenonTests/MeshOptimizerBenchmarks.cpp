@@ -0,0 +1,90 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+#include "TestMeshes.hpp"
+
+#include "../XenonCore/MeshOptimizer.hpp"
+
+#include <fmt/format.h>
+
+namespace /* anonymous */
+{
+	/**
+	 * Report the vertex cache statistics of a mesh.
+	 *
+	 * @param label The metric label.
+	 * @param mesh The mesh to analyze.
+	 */
+	void ReportVertexCache(std::string_view label, const Xenon::Testing::TestMesh& mesh)
+	{
+		const auto statistics = Xenon::AnalyzeVertexCache(mesh.m_Indices, mesh.m_Vertices.size());
+		Xenon::Testing::ReportMetric(label, statistics.m_ACMR, "ACMR");
+		Xenon::Testing::ReportMetric(label, statistics.m_ATVR, "ATVR");
+	}
+
+	/**
+	 * Optimize a mesh, and report the time it takes along with the vertex cache statistics before and after.
+	 *
+	 * @param label The metric label.
+	 * @param source The mesh to optimize.
+	 */
+	void MeasureOptimizeMesh(std::string_view label, const Xenon::Testing::TestMesh& source)
+	{
+		ReportVertexCache(fmt::format("{}, before", label), source);
+
+		// Every run starts from the source mesh, so the copy is a part of the measured time. It's small compared to the optimization.
+		auto mesh = source;
+		Xenon::Testing::Measure(fmt::format("OptimizeMesh, {}", label), source.m_Indices.size() / 3, [&mesh, &source]
+			{
+				mesh = source;
+				const auto vertexCount = Xenon::OptimizeMesh(Xenon::ToBytes(mesh.m_Vertices.data()), mesh.m_Vertices.size(), sizeof(Xenon::Testing::TestVertex), mesh.m_Indices, 0);
+				Xenon::Testing::DoNotOptimize(vertexCount);
+			}, 3);
+
+		ReportVertexCache(fmt::format("{}, after", label), mesh);
+	}
+}
+
+XENON_BENCHMARK(MeshOptimizer, OptimizeMesh)
+{
+	const auto rings = Xenon::Testing::IsQuickRun() ? 32 : 256;
+	const auto segments = rings * 2;
+
+	// Generators emit the triangles row by row, which is already fairly cache friendly.
+	auto mesh = Xenon::Testing::CreateSphere(rings, segments);
+	MeasureOptimizeMesh(fmt::format("ordered sphere ({} triangles)", mesh.m_Indices.size() / 3), mesh);
+
+	// Edited and re-exported meshes often lose that order.
+	Xenon::Testing::ShuffleMesh(mesh, 42);
+	MeasureOptimizeMesh(fmt::format("shuffled sphere ({} triangles)", mesh.m_Indices.size() / 3), mesh);
+}
+
+XENON_BENCHMARK(MeshOptimizer, BuildMeshlets)
+{
+	const auto rings = Xenon::Testing::IsQuickRun() ? 32 : 256;
+	auto mesh = Xenon::Testing::CreateSphere(rings, rings * 2);
+	const auto triangleCount = mesh.m_Indices.size() / 3;
+
+	// The meshlets are built after the other optimizations when cooking.
+	const auto vertexCount = Xenon::OptimizeMesh(Xenon::ToBytes(mesh.m_Vertices.data()), mesh.m_Vertices.size(), sizeof(Xenon::Testing::TestVertex), mesh.m_Indices, 0);
+	const auto indices = mesh.m_Indices;
+
+	std::vector<Xenon::Meshlet> meshlets;
+	Xenon::Testing::Measure(fmt::format("BuildMeshlets, sphere ({} triangles)", triangleCount), triangleCount, [&]
+		{
+			std::copy(indices.begin(), indices.end(), mesh.m_Indices.begin());
+			meshlets.clear();
+
+			Xenon::BuildMeshlets(meshlets, mesh.m_Indices, Xenon::ToBytes(mesh.m_Vertices.data()), vertexCount, sizeof(Xenon::Testing::TestVertex));
+		}, 3);
+
+	// Report how full the meshlets are, since the mesh shader work groups are sized for the limits.
+	uint64_t meshletVertexCount = 0;
+	for (const auto& meshlet : meshlets)
+		meshletVertexCount += meshlet.m_VertexCount;
+
+	Xenon::Testing::ReportMetric("meshlets", static_cast<double>(meshlets.size()), "meshlets");
+	Xenon::Testing::ReportMetric("average meshlet size", static_cast<double>(triangleCount) / static_cast<double>(meshlets.size()), "triangles/meshlet");
+	Xenon::Testing::ReportMetric("average meshlet size", static_cast<double>(meshletVertexCount) / static_cast<double>(meshlets.size()), "vertices/meshlet");
+}
@@ -0,0 +1,92 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+#include "TestMeshes.hpp"
+
+#include "../XenonCore/MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <unordered_set>
+
+namespace /* anonymous */
+{
+	/**
+	 * Get the number of vertices a mesh uses.
+	 *
+	 * @param mesh The mesh.
+	 * @return The used vertex count.
+	 */
+	uint64_t GetUsedVertexCount(const Xenon::Testing::TestMesh& mesh)
+	{
+		return std::unordered_set<uint32_t>(mesh.m_Indices.begin(), mesh.m_Indices.end()).size();
+	}
+
+	/**
+	 * Optimize a test mesh and check that it draws the same triangles with a better vertex cache hit rate.
+	 *
+	 * @param mesh The mesh to optimize.
+	 */
+	void CheckOptimizeMesh(Xenon::Testing::TestMesh mesh)
+	{
+		const auto triangles = Xenon::Testing::GetSortedTriangles(mesh.m_Vertices, mesh.m_Indices);
+		const auto before = Xenon::AnalyzeVertexCache(mesh.m_Indices, mesh.m_Vertices.size());
+		const auto usedVertexCount = GetUsedVertexCount(mesh);
+
+		const auto vertexCount = Xenon::OptimizeMesh(
+			Xenon::ToBytes(mesh.m_Vertices.data()),
+			mesh.m_Vertices.size(),
+			sizeof(Xenon::Testing::TestVertex),
+			mesh.m_Indices,
+			offsetof(Xenon::Testing::TestVertex, m_Position));
+
+		// Every vertex is unique, so only the unused ones can be removed.
+		XENON_EXPECT(vertexCount == usedVertexCount);
+		XENON_EXPECT(std::ranges::all_of(mesh.m_Indices, [vertexCount](uint32_t index) { return index < vertexCount; }));
+
+		mesh.m_Vertices.resize(vertexCount);
+		XENON_EXPECT(Xenon::Testing::GetSortedTriangles(mesh.m_Vertices, mesh.m_Indices) == triangles);
+
+		const auto after = Xenon::AnalyzeVertexCache(mesh.m_Indices, vertexCount);
+		XENON_EXPECT(after.m_ACMR < before.m_ACMR);
+		XENON_EXPECT(after.m_ATVR < before.m_ATVR);
+	}
+}
+
+XENON_TEST(MeshOptimizer, OptimizeMeshImprovesOrderedMesh)
+{
+	CheckOptimizeMesh(Xenon::Testing::CreateSphere(32, 64));
+}
+
+XENON_TEST(MeshOptimizer, OptimizeMeshImprovesShuffledMesh)
+{
+	auto mesh = Xenon::Testing::CreateSphere(32, 64);
+	Xenon::Testing::ShuffleMesh(mesh, 42);
+
+	CheckOptimizeMesh(std::move(mesh));
+}
+
+XENON_TEST(MeshOptimizer, OptimizeMeshWeldsDuplicateVertices)
+{
+	auto mesh = Xenon::Testing::CreateSphere(8, 16);
+	const auto triangles = Xenon::Testing::GetSortedTriangles(mesh.m_Vertices, mesh.m_Indices);
+	const auto uniqueVertexCount = GetUsedVertexCount(mesh);
+
+	// Give every triangle it's own vertices, like a mesh exported with flat per-face data would have.
+	std::vector<Xenon::Testing::TestVertex> vertices;
+	for (auto& index : mesh.m_Indices)
+	{
+		vertices.emplace_back(mesh.m_Vertices[index]);
+		index = static_cast<uint32_t>(vertices.size() - 1);
+	}
+
+	mesh.m_Vertices = std::move(vertices);
+
+	const auto vertexCount = Xenon::OptimizeMesh(Xenon::ToBytes(mesh.m_Vertices.data()), mesh.m_Vertices.size(), sizeof(Xenon::Testing::TestVertex), mesh.m_Indices, 0);
+	XENON_EXPECT(vertexCount == uniqueVertexCount);
+	XENON_EXPECT(std::ranges::all_of(mesh.m_Indices, [vertexCount](uint32_t index) { return index < vertexCount; }));
+
+	mesh.m_Vertices.resize(vertexCount);
+	XENON_EXPECT(Xenon::Testing::GetSortedTriangles(mesh.m_Vertices, mesh.m_Indices) == triangles);
+}
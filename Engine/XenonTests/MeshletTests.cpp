@@ -0,0 +1,200 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+#include "TestMeshes.hpp"
+
+#include "../XenonCore/MeshOptimizer.hpp"
+
+#include <cmath>
+#include <random>
+#include <span>
+#include <unordered_set>
+
+namespace /* anonymous */
+{
+	/**
+	 * The distance the bounds may be off by because of floating point rounding.
+	 */
+	constexpr float Tolerance = 1e-5f;
+
+	/**
+	 * Build the meshlets of a test mesh.
+	 *
+	 * @param mesh The mesh to split. The indices are reordered.
+	 * @param maxVertices The maximum number of vertices in a meshlet.
+	 * @param maxTriangles The maximum number of triangles in a meshlet.
+	 * @return The meshlets.
+	 */
+	std::vector<Xenon::Meshlet> BuildMeshlets(Xenon::Testing::TestMesh& mesh, uint32_t maxVertices = Xenon::MaxMeshletVertices, uint32_t maxTriangles = Xenon::MaxMeshletTriangles)
+	{
+		std::vector<Xenon::Meshlet> meshlets;
+		const auto meshletCount = Xenon::BuildMeshlets(meshlets, mesh.m_Indices, Xenon::ToBytes(mesh.m_Vertices.data()), mesh.m_Vertices.size(), sizeof(Xenon::Testing::TestVertex), maxVertices, maxTriangles);
+		XENON_EXPECT(meshletCount == meshlets.size());
+
+		return meshlets;
+	}
+
+	/**
+	 * Get the difference of two positions.
+	 *
+	 * @param lhs The left hand side position.
+	 * @param rhs The right hand side position.
+	 * @return The difference.
+	 */
+	std::array<float, 3> Subtract(const std::array<float, 3>& lhs, const std::array<float, 3>& rhs) noexcept
+	{
+		return { lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2] };
+	}
+
+	/**
+	 * Get the dot product of two vectors.
+	 *
+	 * @param lhs The left hand side vector.
+	 * @param rhs The right hand side vector.
+	 * @return The dot product.
+	 */
+	float Dot(const std::array<float, 3>& lhs, const std::array<float, 3>& rhs) noexcept
+	{
+		return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2];
+	}
+
+	/**
+	 * Check if a triangle faces a camera.
+	 * Triangles are front facing when they are counter-clockwise as seen from the camera.
+	 *
+	 * @param mesh The mesh.
+	 * @param triangle The triangle's first index.
+	 * @param cameraPosition The camera position.
+	 * @return True if the triangle faces the camera.
+	 * @return False if it faces away from the camera, or if it's seen edge on.
+	 */
+	bool IsFrontFacing(const Xenon::Testing::TestMesh& mesh, uint64_t triangle, const std::array<float, 3>& cameraPosition) noexcept
+	{
+		const auto& p0 = mesh.m_Vertices[mesh.m_Indices[triangle]].m_Position;
+		const auto e1 = Subtract(mesh.m_Vertices[mesh.m_Indices[triangle + 1]].m_Position, p0);
+		const auto e2 = Subtract(mesh.m_Vertices[mesh.m_Indices[triangle + 2]].m_Position, p0);
+		const auto normal = std::array<float, 3>{ e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+
+		// Ignore the triangles which are (almost) edge on, since rounding can put those on either side.
+		const auto direction = Subtract(cameraPosition, p0);
+		return Dot(normal, direction) > Tolerance * std::sqrt(Dot(normal, normal) * Dot(direction, direction));
+	}
+
+	/**
+	 * Check that the meshlets cover all the indices, are within the limits, and bound their vertices.
+	 *
+	 * @param mesh The mesh the meshlets were built from.
+	 * @param meshlets The meshlets.
+	 * @param maxVertices The maximum number of vertices in a meshlet.
+	 * @param maxTriangles The maximum number of triangles in a meshlet.
+	 */
+	void CheckMeshlets(const Xenon::Testing::TestMesh& mesh, const std::vector<Xenon::Meshlet>& meshlets, uint32_t maxVertices, uint32_t maxTriangles)
+	{
+		uint64_t indexOffset = 0;
+		for (const auto& meshlet : meshlets)
+		{
+			// The meshlets are stored back to back in the index buffer.
+			XENON_EXPECT(meshlet.m_IndexOffset == indexOffset);
+			XENON_EXPECT(meshlet.m_IndexCount > 0 && meshlet.m_IndexCount % 3 == 0);
+			XENON_EXPECT(meshlet.m_IndexCount / 3 <= maxTriangles);
+			indexOffset += meshlet.m_IndexCount;
+
+			if (indexOffset > mesh.m_Indices.size())
+				break;
+
+			const auto indices = std::span<const uint32_t>(mesh.m_Indices).subspan(meshlet.m_IndexOffset, meshlet.m_IndexCount);
+			const auto vertices = std::unordered_set<uint32_t>(indices.begin(), indices.end());
+			XENON_EXPECT(vertices.size() == meshlet.m_VertexCount);
+			XENON_EXPECT(vertices.size() <= maxVertices);
+
+			for (const auto vertex : vertices)
+			{
+				const auto& position = mesh.m_Vertices[vertex].m_Position;
+				for (uint32_t axis = 0; axis < 3; axis++)
+				{
+					XENON_EXPECT(position[axis] >= meshlet.m_Minimum[axis] - Tolerance);
+					XENON_EXPECT(position[axis] <= meshlet.m_Maximum[axis] + Tolerance);
+				}
+
+				const auto offset = Subtract(position, meshlet.m_Center);
+				XENON_EXPECT(std::sqrt(Dot(offset, offset)) <= meshlet.m_Radius + Tolerance);
+			}
+		}
+
+		XENON_EXPECT(indexOffset == mesh.m_Indices.size());
+	}
+
+	/**
+	 * Split a test mesh into meshlets and check that the triangles are kept and that the meshlets are valid.
+	 *
+	 * @param mesh The mesh to split.
+	 * @param maxVertices The maximum number of vertices in a meshlet.
+	 * @param maxTriangles The maximum number of triangles in a meshlet.
+	 */
+	void CheckBuildMeshlets(Xenon::Testing::TestMesh mesh, uint32_t maxVertices, uint32_t maxTriangles)
+	{
+		const auto triangles = Xenon::Testing::GetSortedTriangles(mesh.m_Vertices, mesh.m_Indices);
+		const auto meshlets = BuildMeshlets(mesh, maxVertices, maxTriangles);
+
+		XENON_EXPECT(Xenon::Testing::GetSortedTriangles(mesh.m_Vertices, mesh.m_Indices) == triangles);
+		CheckMeshlets(mesh, meshlets, maxVertices, maxTriangles);
+	}
+}
+
+XENON_TEST(Meshlet, BuildMeshletsKeepsTrianglesWithinLimits)
+{
+	CheckBuildMeshlets(Xenon::Testing::CreateSphere(32, 64), Xenon::MaxMeshletVertices, Xenon::MaxMeshletTriangles);
+}
+
+XENON_TEST(Meshlet, BuildMeshletsKeepsShuffledTrianglesWithinLimits)
+{
+	auto mesh = Xenon::Testing::CreateSphere(32, 64);
+	Xenon::Testing::ShuffleMesh(mesh, 42);
+
+	CheckBuildMeshlets(std::move(mesh), Xenon::MaxMeshletVertices, Xenon::MaxMeshletTriangles);
+}
+
+XENON_TEST(Meshlet, BuildMeshletsKeepsTrianglesWithinCustomLimits)
+{
+	auto mesh = Xenon::Testing::CreateSphere(16, 32);
+	Xenon::Testing::ShuffleMesh(mesh, 7);
+
+	CheckBuildMeshlets(mesh, 32, 32);
+	CheckBuildMeshlets(mesh, 3, 1);
+}
+
+XENON_TEST(Meshlet, BackFacingMeshletsHaveNoFrontFacingTriangles)
+{
+	auto mesh = Xenon::Testing::CreateSphere(32, 64);
+	Xenon::Testing::ShuffleMesh(mesh, 42);
+	const auto meshlets = BuildMeshlets(mesh);
+
+	auto engine = std::mt19937(42);
+	auto distribution = std::uniform_real_distribution<float>(-4.0f, 4.0f);
+
+	uint64_t culledCount = 0;
+	for (uint32_t i = 0; i < 256; i++)
+	{
+		// Include cameras close to the surface, where the cones are the least likely to cull.
+		auto cameraPosition = std::array<float, 3>{ distribution(engine), distribution(engine), distribution(engine) };
+		if (i % 2 == 0)
+		{
+			const auto scale = 1.01f / std::sqrt(Dot(cameraPosition, cameraPosition));
+			cameraPosition = { cameraPosition[0] * scale, cameraPosition[1] * scale, cameraPosition[2] * scale };
+		}
+
+		for (const auto& meshlet : meshlets)
+		{
+			if (!Xenon::IsMeshletBackFacing(meshlet, cameraPosition))
+				continue;
+
+			culledCount++;
+			for (uint64_t triangle = meshlet.m_IndexOffset; triangle < meshlet.m_IndexOffset + meshlet.m_IndexCount; triangle += 3)
+				XENON_EXPECT(!IsFrontFacing(mesh, triangle, cameraPosition));
+		}
+	}
+
+	// Roughly half of a closed mesh faces away from an outside camera, so the cones must cull some of it.
+	XENON_EXPECT(culledCount > 0);
+}
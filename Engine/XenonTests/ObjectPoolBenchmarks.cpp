@@ -0,0 +1,167 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/ObjectPool.hpp"
+
+#include <fmt/format.h>
+
+#include <array>
+#include <cstdlib>
+#include <thread>
+
+namespace /* anonymous */
+{
+	/**
+	 * Pooled object structure.
+	 * This is roughly the size of the small, frequently created engine objects (jobs, commands, etc...) the pool is used for.
+	 */
+	struct PooledObject final
+	{
+		PooledObject() = default;
+		explicit PooledObject(uint64_t value) : m_Values{ value } {}
+
+		std::array<uint64_t, 8> m_Values = {};
+	};
+
+	/**
+	 * Create an object the way the default operator new does.
+	 * The benchmarks replace the global operator new to count allocations, which adds a contended atomic to every allocation, so
+	 * malloc is used directly to keep the comparison fair.
+	 *
+	 * @param value The value to create the object with.
+	 * @return The object pointer.
+	 */
+	PooledObject* CreateWithNew(uint64_t value)
+	{
+		return new(std::malloc(sizeof(PooledObject))) PooledObject(value);
+	}
+
+	/**
+	 * Destroy an object created using CreateWithNew().
+	 *
+	 * @param pObject The object pointer.
+	 */
+	void DestroyWithDelete(PooledObject* pObject)
+	{
+		pObject->~PooledObject();
+		std::free(pObject);
+	}
+
+	/**
+	 * The number of objects each thread keeps alive at once in a batch.
+	 * This is larger than what a thread can cache, so that the global free list is used as well.
+	 */
+	constexpr uint64_t BatchSize = 256;
+
+	/**
+	 * Get the thread counts to benchmark with.
+	 *
+	 * @return The thread counts.
+	 */
+	std::vector<uint32_t> GetThreadCounts()
+	{
+		if (Xenon::Testing::IsQuickRun())
+			return { 1, 2, 4 };
+
+		return { 1, 2, 4, 8, 16, 32, 64 };
+	}
+
+	/**
+	 * Run a function on a number of threads at once, and wait till all of them finish.
+	 *
+	 * @tparam Function The function type.
+	 * @param threadCount The number of threads.
+	 * @param function The function to run on each thread.
+	 */
+	template<class Function>
+	void RunOnThreads(uint32_t threadCount, Function&& function)
+	{
+		std::vector<std::jthread> threads;
+		threads.reserve(threadCount);
+
+		for (uint32_t i = 0; i < threadCount; i++)
+			threads.emplace_back(function);
+	}
+
+	/**
+	 * Create and destroy objects in batches.
+	 *
+	 * @tparam Create The create function type.
+	 * @tparam Destroy The destroy function type.
+	 * @param batchCount The number of batches.
+	 * @param create The function which creates a single object.
+	 * @param destroy The function which destroys a single object.
+	 */
+	template<class Create, class Destroy>
+	void RunBatches(uint64_t batchCount, Create&& create, Destroy&& destroy)
+	{
+		std::array<PooledObject*, BatchSize> pObjects = {};
+		for (uint64_t i = 0; i < batchCount; i++)
+		{
+			for (uint64_t j = 0; j < BatchSize; j++)
+				pObjects[j] = create(j);
+
+			Xenon::Testing::DoNotOptimize(pObjects);
+
+			for (const auto pObject : pObjects)
+				destroy(pObject);
+		}
+	}
+}
+
+XENON_BENCHMARK(ObjectPool, Throughput)
+{
+	const uint64_t objectsPerThread = Xenon::Testing::IsQuickRun() ? 1 << 14 : 1 << 20;
+	auto& pool = Xenon::ObjectPool<PooledObject>::GetGlobal();
+
+	for (const auto threadCount : GetThreadCounts())
+	{
+		const auto operations = objectsPerThread * threadCount;
+
+		// Create an object and destroy it right away. This is the best case for both, as the same memory is reused every time.
+		Xenon::Testing::Measure(fmt::format("new/delete (immediate), {} threads", threadCount), operations, [&]
+			{
+				RunOnThreads(threadCount, [objectsPerThread]
+					{
+						for (uint64_t i = 0; i < objectsPerThread; i++)
+						{
+							auto pObject = CreateWithNew(i);
+							Xenon::Testing::DoNotOptimize(pObject);
+							DestroyWithDelete(pObject);
+						}
+					});
+			}, 3);
+
+		Xenon::Testing::Measure(fmt::format("ObjectPool (immediate), {} threads", threadCount), operations, [&]
+			{
+				RunOnThreads(threadCount, [objectsPerThread, &pool]
+					{
+						for (uint64_t i = 0; i < objectsPerThread; i++)
+						{
+							auto pObject = pool.create(i);
+							Xenon::Testing::DoNotOptimize(pObject);
+							pool.destroy(pObject);
+						}
+					});
+			}, 3);
+
+		// Keep a batch of objects alive before destroying them, which goes through the global free list of the pool.
+		Xenon::Testing::Measure(fmt::format("new/delete (batched), {} threads", threadCount), operations, [&]
+			{
+				RunOnThreads(threadCount, [objectsPerThread]
+					{
+						RunBatches(objectsPerThread / BatchSize, CreateWithNew, DestroyWithDelete);
+					});
+			}, 3);
+
+		Xenon::Testing::Measure(fmt::format("ObjectPool (batched), {} threads", threadCount), operations, [&]
+			{
+				RunOnThreads(threadCount, [objectsPerThread, &pool]
+					{
+						RunBatches(objectsPerThread / BatchSize, [&pool](uint64_t value) { return pool.create(value); }, [&pool](PooledObject* pObject) { pool.destroy(pObject); });
+					});
+			}, 3);
+	}
+}
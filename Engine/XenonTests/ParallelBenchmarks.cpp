@@ -0,0 +1,92 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/Parallel.hpp"
+#include "../XenonCore/XObject.hpp"
+
+#include <cmath>
+#include <numeric>
+#include <random>
+
+#ifdef XENON_HAS_STD_EXECUTION
+#include <execution>
+
+#endif
+
+namespace /* anonymous */
+{
+	/**
+	 * Get the number of elements to benchmark with.
+	 *
+	 * @return The element count.
+	 */
+	uint64_t GetElementCount()
+	{
+		return Xenon::Testing::IsQuickRun() ? 1 << 16 : 1 << 22;
+	}
+
+	/**
+	 * Create a vector of random values.
+	 *
+	 * @param count The number of values.
+	 * @return The values.
+	 */
+	std::vector<float> CreateRandomValues(uint64_t count)
+	{
+		auto engine = std::mt19937(42);
+		auto distribution = std::uniform_real_distribution<float>(-1000.0f, 1000.0f);
+
+		std::vector<float> values(count);
+		for (auto& value : values)
+			value = distribution(engine);
+
+		return values;
+	}
+}
+
+XENON_BENCHMARK(Parallel, For)
+{
+	auto& jobSystem = Xenon::XObject::GetJobSystem();
+	auto values = CreateRandomValues(GetElementCount());
+	const auto transform = [](float& value) { value = std::sqrt(std::abs(value)) * 0.5f; };
+
+	Xenon::Testing::Measure("Serial for", values.size(), [&] { std::for_each(values.begin(), values.end(), transform); });
+	Xenon::Testing::Measure("ParallelFor", values.size(), [&] { Xenon::ParallelFor(jobSystem, 0, values.size(), [&](uint64_t index) { transform(values[index]); }); });
+
+#ifdef XENON_HAS_STD_EXECUTION
+	Xenon::Testing::Measure("std::for_each (std::execution::par)", values.size(), [&] { std::for_each(std::execution::par, values.begin(), values.end(), transform); });
+
+#endif
+}
+
+XENON_BENCHMARK(Parallel, Reduce)
+{
+	auto& jobSystem = Xenon::XObject::GetJobSystem();
+	const auto values = CreateRandomValues(GetElementCount());
+
+	Xenon::Testing::Measure("Serial reduce", values.size(), [&] { Xenon::Testing::DoNotOptimize(std::accumulate(values.begin(), values.end(), 0.0)); });
+	Xenon::Testing::Measure("ParallelReduce", values.size(), [&] { Xenon::Testing::DoNotOptimize(Xenon::ParallelReduce(jobSystem, 0, values.size(), 0.0, [&](uint64_t index) { return static_cast<double>(values[index]); }, std::plus<>())); });
+
+#ifdef XENON_HAS_STD_EXECUTION
+	Xenon::Testing::Measure("std::reduce (std::execution::par)", values.size(), [&] { Xenon::Testing::DoNotOptimize(std::reduce(std::execution::par, values.begin(), values.end(), 0.0)); });
+
+#endif
+}
+
+XENON_BENCHMARK(Parallel, Sort)
+{
+	auto& jobSystem = Xenon::XObject::GetJobSystem();
+	const auto source = CreateRandomValues(GetElementCount());
+
+	// Sort a fresh copy every time; the copy is a small part of the measured time.
+	auto values = source;
+	Xenon::Testing::Measure("std::sort", values.size(), [&] { values = source; std::sort(values.begin(), values.end()); });
+	Xenon::Testing::Measure("ParallelSort", values.size(), [&] { values = source; Xenon::ParallelSort(jobSystem, values.begin(), values.end()); });
+
+#ifdef XENON_HAS_STD_EXECUTION
+	Xenon::Testing::Measure("std::sort (std::execution::par)", values.size(), [&] { values = source; std::sort(std::execution::par, values.begin(), values.end()); });
+
+#endif
+}
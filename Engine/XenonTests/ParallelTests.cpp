@@ -0,0 +1,95 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/Parallel.hpp"
+
+#include <memory>
+#include <random>
+#include <stdexcept>
+
+XENON_TEST(Parallel, ForVisitsEveryIndexOnce)
+{
+	auto jobSystem = Xenon::JobSystem(3);
+
+	std::vector<std::atomic_uint32_t> visits(100000);
+	Xenon::ParallelFor(jobSystem, 0, visits.size(), [&visits](uint64_t index) { visits[index]++; }, 1000);
+
+	XENON_EXPECT(std::all_of(visits.begin(), visits.end(), [](const auto& count) { return count == 1; }));
+}
+
+XENON_TEST(Parallel, ForRethrowsOnTheCallingThread)
+{
+	auto jobSystem = Xenon::JobSystem(3);
+
+	// Throw from a chunk which is executed by a job, and make sure the exception does not end the worker.
+	for (uint32_t attempt = 0; attempt < 8; attempt++)
+	{
+		bool hasThrown = false;
+		try
+		{
+			Xenon::ParallelFor(jobSystem, 0, 10000, [](uint64_t index) { if (index == 9000) throw std::runtime_error("Chunk failed!"); }, 100);
+		}
+		catch (const std::runtime_error&)
+		{
+			hasThrown = true;
+		}
+
+		XENON_EXPECT(hasThrown);
+	}
+
+	auto future = jobSystem.insert([] { return 1; });
+	XENON_EXPECT(future.get() == 1);
+}
+
+XENON_TEST(Parallel, ReduceMatchesSerialReduction)
+{
+	auto jobSystem = Xenon::JobSystem(3);
+
+	const auto sum = Xenon::ParallelReduce(jobSystem, 0, 1000000, uint64_t(0), [](uint64_t index) { return index; }, [](uint64_t lhs, uint64_t rhs) { return lhs + rhs; }, 1000);
+	XENON_EXPECT(sum == 999999ull * 1000000ull / 2);
+
+	const auto empty = Xenon::ParallelReduce(jobSystem, 10, 10, uint64_t(5), [](uint64_t index) { return index; }, [](uint64_t lhs, uint64_t rhs) { return lhs + rhs; });
+	XENON_EXPECT(empty == 5);
+}
+
+XENON_TEST(Parallel, SortMatchesStdSort)
+{
+	auto jobSystem = Xenon::JobSystem(3);
+	auto engine = std::mt19937(42);
+
+	// Use sizes which don't split evenly and small grain sizes so that there are multiple merge passes, and duplicates.
+	for (const auto count : { 1, 17, 1000, 4097, 100003 })
+	{
+		for (const uint64_t grainSize : { 1, 7, 256, 0 })
+		{
+			std::vector<uint32_t> values(count);
+			for (auto& value : values)
+				value = engine() % 1000;
+
+			auto expected = values;
+			std::sort(expected.begin(), expected.end());
+
+			Xenon::ParallelSort(jobSystem, values.begin(), values.end(), std::less<>(), grainSize);
+			XENON_EXPECT(values == expected);
+		}
+	}
+}
+
+XENON_TEST(Parallel, SortMovesValues)
+{
+	auto jobSystem = Xenon::JobSystem(3);
+
+	std::vector<std::unique_ptr<uint32_t>> values;
+	for (uint32_t i = 0; i < 5000; i++)
+		values.emplace_back(std::make_unique<uint32_t>((i * 7919) % 5000));
+
+	Xenon::ParallelSort(jobSystem, values.begin(), values.end(), [](const auto& pLhs, const auto& pRhs) { return *pLhs < *pRhs; }, 100);
+
+	bool isSorted = true;
+	for (uint32_t i = 0; i < values.size(); i++)
+		isSorted &= values[i] && *values[i] == i;
+
+	XENON_EXPECT(isSorted);
+}
@@ -0,0 +1,171 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/SPSCQueue.hpp"
+#include "../XenonCore/MPMCQueue.hpp"
+
+#include <fmt/format.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace /* anonymous */
+{
+	/**
+	 * Locked queue class.
+	 * This is the mutex and container pair the lock-free queues replace. It's only kept here to compare them.
+	 */
+	class LockedQueue final
+	{
+	public:
+		void push(uint64_t value)
+		{
+			{
+				auto lock = std::scoped_lock(m_Mutex);
+				m_Entries.emplace_back(value);
+			}
+
+			m_ConditionVariable.notify_one();
+		}
+
+		uint64_t pop()
+		{
+			auto lock = std::unique_lock(m_Mutex);
+			m_ConditionVariable.wait(lock, [this] { return !m_Entries.empty(); });
+
+			const auto value = m_Entries.front();
+			m_Entries.pop_front();
+			return value;
+		}
+
+	private:
+		std::mutex m_Mutex;
+		std::condition_variable m_ConditionVariable;
+		std::deque<uint64_t> m_Entries;
+	};
+
+	/**
+	 * Get the number of entries to pass through the queues.
+	 *
+	 * @return The entry count.
+	 */
+	uint64_t GetEntryCount()
+	{
+		return Xenon::Testing::IsQuickRun() ? 1 << 14 : 1 << 20;
+	}
+
+	/**
+	 * Get the thread counts to benchmark with. This is the number of producers, and the number of consumers.
+	 *
+	 * @return The thread counts.
+	 */
+	std::vector<uint32_t> GetThreadCounts()
+	{
+		if (Xenon::Testing::IsQuickRun())
+			return { 1, 2 };
+
+		return { 1, 2, 4, 8, 16, 32 };
+	}
+
+	/**
+	 * Pass a number of entries from producer threads to consumer threads.
+	 *
+	 * @tparam Push The push function type.
+	 * @tparam Pop The pop function type.
+	 * @param threadCount The number of producer threads, and the number of consumer threads.
+	 * @param entryCount The total number of entries.
+	 * @param push The function which pushes a single entry.
+	 * @param pop The function which pops a single entry.
+	 */
+	template<class Push, class Pop>
+	void RunProducersAndConsumers(uint32_t threadCount, uint64_t entryCount, Push&& push, Pop&& pop)
+	{
+		std::vector<std::jthread> threads;
+		threads.reserve(threadCount * 2);
+
+		for (uint32_t i = 0; i < threadCount; i++)
+		{
+			threads.emplace_back([&push, entriesPerThread = entryCount / threadCount]
+				{
+					for (uint64_t j = 0; j < entriesPerThread; j++)
+						push(j);
+				});
+
+			threads.emplace_back([&pop, entriesPerThread = entryCount / threadCount]
+				{
+					uint64_t sum = 0;
+					for (uint64_t j = 0; j < entriesPerThread; j++)
+						sum += pop();
+
+					Xenon::Testing::DoNotOptimize(sum);
+				});
+		}
+	}
+}
+
+XENON_BENCHMARK(Queue, SPSCThroughput)
+{
+	const auto entryCount = GetEntryCount();
+
+	auto lockedQueue = LockedQueue();
+	Xenon::Testing::Measure("Locked queue", entryCount, [&]
+		{
+			RunProducersAndConsumers(1, entryCount, [&](uint64_t value) { lockedQueue.push(value); }, [&] { return lockedQueue.pop(); });
+		}, 3);
+
+	auto queue = Xenon::SPSCQueue<uint64_t>(1024);
+	Xenon::Testing::Measure("SPSCQueue", entryCount, [&]
+		{
+			RunProducersAndConsumers(1, entryCount, [&](uint64_t value) { queue.push(value); }, [&] { return queue.pop(); });
+		}, 3);
+}
+
+XENON_BENCHMARK(Queue, SPSCLatency)
+{
+	const auto roundTripCount = GetEntryCount() / 16;
+
+	// Bounce a single entry between two threads, so that each side has to wait for the other every time.
+	auto requests = Xenon::SPSCQueue<uint64_t>(2);
+	auto responses = Xenon::SPSCQueue<uint64_t>(2);
+	Xenon::Testing::Measure("SPSCQueue round trip", roundTripCount, [&]
+		{
+			auto responder = std::jthread([&]
+				{
+					for (uint64_t i = 0; i < roundTripCount; i++)
+						responses.push(requests.pop() + 1);
+				});
+
+			uint64_t value = 0;
+			for (uint64_t i = 0; i < roundTripCount; i++)
+			{
+				requests.push(value);
+				value = responses.pop();
+			}
+
+			Xenon::Testing::DoNotOptimize(value);
+		}, 3);
+}
+
+XENON_BENCHMARK(Queue, MPMCThroughput)
+{
+	const auto entryCount = GetEntryCount();
+
+	for (const auto threadCount : GetThreadCounts())
+	{
+		auto lockedQueue = LockedQueue();
+		Xenon::Testing::Measure(fmt::format("Locked queue, {} producers/consumers", threadCount), entryCount, [&]
+			{
+				RunProducersAndConsumers(threadCount, entryCount, [&](uint64_t value) { lockedQueue.push(value); }, [&] { return lockedQueue.pop(); });
+			}, 3);
+
+		auto queue = Xenon::MPMCQueue<uint64_t>(1024);
+		Xenon::Testing::Measure(fmt::format("MPMCQueue, {} producers/consumers", threadCount), entryCount, [&]
+			{
+				RunProducersAndConsumers(threadCount, entryCount, [&](uint64_t value) { queue.push(value); }, [&] { return queue.pop(); });
+			}, 3);
+	}
+}
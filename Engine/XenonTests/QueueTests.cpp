@@ -0,0 +1,136 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/SPSCQueue.hpp"
+#include "../XenonCore/MPMCQueue.hpp"
+
+#include <memory>
+#include <thread>
+
+// These are stress tests, meant to be run under the thread sanitizer as well (see XENON_ENABLE_THREAD_SANITIZER). The queues are kept
+// small so that both sides keep running into a full or empty queue and have to park.
+
+namespace /* anonymous */
+{
+	/**
+	 * The number of entries pushed through the queues.
+	 */
+	constexpr uint64_t EntryCount = 1 << 16;
+}
+
+XENON_TEST(SPSCQueue, DeliversEveryEntryInOrder)
+{
+	auto queue = Xenon::SPSCQueue<std::unique_ptr<uint64_t>>(8);
+
+	auto producer = std::jthread([&queue]
+		{
+			for (uint64_t i = 0; i < EntryCount; i++)
+			{
+				// Mix the blocking and non-blocking functions.
+				if (i % 2 == 0)
+				{
+					queue.push(std::make_unique<uint64_t>(i));
+				}
+				else
+				{
+					auto pEntry = std::make_unique<uint64_t>(i);
+					while (!queue.tryPush(std::move(pEntry)))
+						std::this_thread::yield();
+				}
+			}
+		});
+
+	bool isInOrder = true;
+	for (uint64_t i = 0; i < EntryCount; i++)
+	{
+		std::unique_ptr<uint64_t> pEntry;
+		if (i % 3 == 0)
+		{
+			pEntry = queue.pop();
+		}
+		else
+		{
+			auto entry = queue.tryPop();
+			for (; !entry.has_value(); entry = queue.tryPop())
+				std::this_thread::yield();
+
+			pEntry = std::move(*entry);
+		}
+
+		isInOrder &= pEntry != nullptr && *pEntry == i;
+	}
+
+	producer.join();
+	XENON_EXPECT(isInOrder);
+	XENON_EXPECT(queue.empty());
+}
+
+XENON_TEST(MPMCQueue, DeliversEveryEntryOnce)
+{
+	constexpr uint32_t ProducerCount = 4;
+	constexpr uint32_t ConsumerCount = 4;
+	constexpr uint64_t EntriesPerProducer = EntryCount / ProducerCount;
+	constexpr uint64_t EntriesPerConsumer = EntryCount / ConsumerCount;
+
+	auto queue = Xenon::MPMCQueue<std::unique_ptr<uint64_t>>(8);
+	std::vector<std::atomic_uint32_t> receivedCounts(EntryCount);
+
+	{
+		std::vector<std::jthread> threads;
+		for (uint32_t i = 0; i < ProducerCount; i++)
+		{
+			threads.emplace_back([&queue, i]
+				{
+					for (uint64_t j = 0; j < EntriesPerProducer; j++)
+					{
+						auto pEntry = std::make_unique<uint64_t>(i * EntriesPerProducer + j);
+
+						// Half of the producers block, and the other half retry.
+						if (i % 2 == 0)
+						{
+							queue.push(std::move(pEntry));
+						}
+						else
+						{
+							while (!queue.tryPush(std::move(pEntry)))
+								std::this_thread::yield();
+						}
+					}
+				});
+		}
+
+		for (uint32_t i = 0; i < ConsumerCount; i++)
+		{
+			threads.emplace_back([&queue, &receivedCounts, i]
+				{
+					for (uint64_t j = 0; j < EntriesPerConsumer; j++)
+					{
+						std::unique_ptr<uint64_t> pEntry;
+						if (i % 2 == 0)
+						{
+							pEntry = queue.pop();
+						}
+						else
+						{
+							auto entry = queue.tryPop();
+							for (; !entry.has_value(); entry = queue.tryPop())
+								std::this_thread::yield();
+
+							pEntry = std::move(*entry);
+						}
+
+						receivedCounts[*pEntry].fetch_add(1, std::memory_order_relaxed);
+					}
+				});
+		}
+	}
+
+	bool isReceivedOnce = true;
+	for (const auto& count : receivedCounts)
+		isReceivedOnce &= count.load(std::memory_order_relaxed) == 1;
+
+	XENON_EXPECT(isReceivedOnce);
+	XENON_EXPECT(queue.getSize() == 0);
+}
@@ -0,0 +1,99 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/RWMutex.hpp"
+
+#include <thread>
+
+namespace /* anonymous */
+{
+	/**
+	 * Pair structure.
+	 * The writer keeps both values equal, so a reader which sees them differ has raced with a write.
+	 */
+	struct Pair final
+	{
+		uint64_t m_First = 0;
+		uint64_t m_Second = 0;
+	};
+}
+
+XENON_TEST(RWMutex, ReadersNeverSeeAPartialWrite)
+{
+	constexpr uint32_t readerCount = 8;
+	constexpr uint64_t readsPerReader = 1 << 13;
+	constexpr uint64_t writeCount = 1 << 13;
+
+	auto mutex = Xenon::RWMutex<Pair>();
+	auto startedCount = std::atomic_uint32_t(0);
+	auto tornReadCount = std::atomic_uint64_t(0);
+
+	// The readers do a fixed number of reads instead of reading till the writer is done, since std::shared_mutex may prefer readers and
+	// starve the writer.
+	{
+		std::vector<std::jthread> readers;
+		for (uint32_t i = 0; i < readerCount; i++)
+		{
+			readers.emplace_back([&mutex, &startedCount, &tornReadCount]
+				{
+					startedCount++;
+					for (uint64_t j = 0; j < readsPerReader; j++)
+					{
+						const auto copy = j % 2 == 0 ? mutex.get() : mutex.read([](const Pair& pair) { return pair; });
+						if (copy.m_First != copy.m_Second)
+							tornReadCount.fetch_add(1, std::memory_order_relaxed);
+					}
+				});
+		}
+
+		while (startedCount != readerCount)
+			std::this_thread::yield();
+
+		for (uint64_t i = 0; i < writeCount; i++)
+		{
+			mutex.write([](Pair& pair)
+				{
+					pair.m_First++;
+					std::this_thread::yield();
+					pair.m_Second++;
+				});
+		}
+	}
+
+	XENON_EXPECT(tornReadCount == 0);
+	XENON_EXPECT(mutex.get().m_First == writeCount);
+	XENON_EXPECT(mutex.get().m_Second == writeCount);
+}
+
+XENON_TEST(RWMutex, ReadersShareTheLock)
+{
+	auto mutex = Xenon::RWMutex<uint64_t>(42);
+	auto insideCount = std::atomic_uint32_t(0);
+
+	// Each reader waits inside the lock for the other one, which can only finish if both of them hold it at once.
+	const auto read = [&mutex, &insideCount]
+		{
+			return mutex.read([&insideCount](const uint64_t& value)
+				{
+					insideCount++;
+					while (insideCount != 2)
+						std::this_thread::yield();
+
+					return value;
+				});
+		};
+
+	auto other = std::jthread([&read] { static_cast<void>(read()); });
+	XENON_EXPECT(read() == 42);
+}
+
+XENON_TEST(RWMutex, WriteReturnsTheResult)
+{
+	auto mutex = Xenon::RWMutex<std::vector<uint64_t>>();
+	XENON_EXPECT(mutex.write([](std::vector<uint64_t>& values, uint64_t value) { values.emplace_back(value); return values.size(); }, 7) == 1);
+
+	mutex.set({ 1, 2, 3 });
+	XENON_EXPECT(mutex.read([](const std::vector<uint64_t>& values) { return values.back(); }) == 3);
+}
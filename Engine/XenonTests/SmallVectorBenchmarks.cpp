@@ -0,0 +1,72 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+#include "AllocationCounter.hpp"
+
+#include "../XenonCore/SmallVector.hpp"
+
+#include <fmt/format.h>
+
+#include <numeric>
+
+namespace /* anonymous */
+{
+	/**
+	 * Get the number of lists to build.
+	 *
+	 * @return The list count.
+	 */
+	uint64_t GetListCount()
+	{
+		return Xenon::Testing::IsQuickRun() ? 1 << 14 : 1 << 20;
+	}
+
+	/**
+	 * Build a number of short lists, the way per-draw and per-pass temporaries are built.
+	 *
+	 * @tparam Vector The vector type.
+	 * @param listCount The number of lists to build.
+	 * @param elementCount The number of elements in each list.
+	 */
+	template<class Vector>
+	void BuildLists(uint64_t listCount, uint32_t elementCount)
+	{
+		for (uint64_t i = 0; i < listCount; i++)
+		{
+			Vector vector;
+			for (uint32_t j = 0; j < elementCount; j++)
+				vector.push_back(i + j);
+
+			Xenon::Testing::DoNotOptimize(std::accumulate(vector.begin(), vector.end(), uint64_t(0)));
+		}
+	}
+
+	/**
+	 * Measure building short lists, and report the number of allocations per list.
+	 *
+	 * @tparam Vector The vector type.
+	 * @param label The metric label.
+	 * @param elementCount The number of elements in each list.
+	 */
+	template<class Vector>
+	void MeasureLists(std::string_view label, uint32_t elementCount)
+	{
+		const auto listCount = GetListCount();
+		Xenon::Testing::Measure(fmt::format("{}, {} elements", label, elementCount), listCount, [&] { BuildLists<Vector>(listCount, elementCount); });
+
+		const auto allocationCount = Xenon::Testing::GetAllocationCount();
+		BuildLists<Vector>(listCount, elementCount);
+		Xenon::Testing::ReportMetric(fmt::format("{}, {} elements", label, elementCount), static_cast<double>(Xenon::Testing::GetAllocationCount() - allocationCount) / static_cast<double>(listCount), "allocations/list");
+	}
+}
+
+XENON_BENCHMARK(SmallVector, ShortLists)
+{
+	// The last size does not fit in the inline storage, to show the cost of spilling to the heap.
+	for (const uint32_t elementCount : { 4, 8, 32 })
+	{
+		MeasureLists<std::vector<uint64_t>>("std::vector", elementCount);
+		MeasureLists<Xenon::SmallVector<uint64_t, 8>>("SmallVector<8>", elementCount);
+	}
+}
@@ -0,0 +1,123 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/SmallVector.hpp"
+
+#include <string>
+#include <stdexcept>
+
+namespace /* anonymous */
+{
+	/**
+	 * Throwing value structure.
+	 * Copying this throws once the copy budget runs out. It has no noexcept move constructor, so the vector has to copy it when growing.
+	 */
+	struct ThrowingValue final
+	{
+		explicit ThrowingValue(uint32_t value) : m_Value(value) {}
+
+		ThrowingValue(const ThrowingValue& other) : m_Value(other.m_Value)
+		{
+			if (s_CopyBudget-- == 0)
+				throw std::runtime_error("Copy failed!");
+		}
+
+		ThrowingValue& operator=(const ThrowingValue&) = default;
+
+		uint32_t m_Value = 0;
+		std::string m_Padding = std::string(64, 'x');	// This makes sure that a use after free is caught by the address sanitizer.
+
+		static inline uint32_t s_CopyBudget = 0;
+	};
+}
+
+XENON_TEST(SmallVector, GrowsAndShrinks)
+{
+	auto vector = Xenon::SmallVector<std::string, 2>();
+	XENON_EXPECT(vector.isInline());
+
+	for (uint32_t i = 0; i < 100; i++)
+		vector.emplace_back(std::to_string(i));
+
+	XENON_EXPECT(!vector.isInline());
+	XENON_EXPECT(vector.size() == 100);
+
+	bool isIntact = true;
+	for (uint32_t i = 0; i < 100; i++)
+		isIntact &= vector[i] == std::to_string(i);
+
+	XENON_EXPECT(isIntact);
+
+	vector.resize(3);
+	XENON_EXPECT(vector.size() == 3 && vector.back() == "2");
+
+	auto moved = std::move(vector);
+	XENON_EXPECT(moved.size() == 3 && vector.empty() && vector.isInline());
+}
+
+XENON_TEST(SmallVector, PushingAnElementWhileFull)
+{
+	auto vector = Xenon::SmallVector<std::string, 2>({ std::string(64, 'a'), std::string(64, 'b') });
+
+	// The argument refers to an element which is moved while growing.
+	vector.push_back(vector[0]);
+	XENON_EXPECT(vector.size() == 3);
+	XENON_EXPECT(vector[2] == std::string(64, 'a'));
+
+	vector.push_back(vector[2]);
+	vector.emplace_back(vector[1]);
+	XENON_EXPECT(vector[3] == std::string(64, 'a'));
+	XENON_EXPECT(vector[4] == std::string(64, 'b'));
+
+	// Same with a resize which has to grow.
+	vector.resize(16, vector[1]);
+	XENON_EXPECT(vector[15] == std::string(64, 'b'));
+}
+
+XENON_TEST(SmallVector, ThrowingGrowLeavesTheVectorUnchanged)
+{
+	auto vector = Xenon::SmallVector<ThrowingValue, 2>();
+	ThrowingValue::s_CopyBudget = 2;
+	vector.emplace_back(1);
+	vector.emplace_back(2);
+
+	// Fail while copying the existing elements.
+	ThrowingValue::s_CopyBudget = 1;
+	bool hasThrown = false;
+
+	try
+	{
+		vector.emplace_back(3);
+	}
+	catch (const std::runtime_error&)
+	{
+		hasThrown = true;
+	}
+
+	XENON_EXPECT(hasThrown);
+	XENON_EXPECT(vector.size() == 2 && vector.isInline());
+	XENON_EXPECT(vector[0].m_Value == 1 && vector[1].m_Value == 2);
+
+	// Fail while constructing the new element.
+	ThrowingValue::s_CopyBudget = 0;
+	hasThrown = false;
+
+	try
+	{
+		vector.push_back(vector[0]);
+	}
+	catch (const std::runtime_error&)
+	{
+		hasThrown = true;
+	}
+
+	XENON_EXPECT(hasThrown);
+	XENON_EXPECT(vector.size() == 2 && vector.isInline());
+
+	// And the vector must still be able to grow.
+	ThrowingValue::s_CopyBudget = 2;
+	vector.emplace_back(3);
+	XENON_EXPECT(vector.size() == 3 && vector[0].m_Value == 1 && vector[2].m_Value == 3);
+}
@@ -0,0 +1,178 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/SparseArray.hpp"
+
+#include <random>
+#include <unordered_map>
+
+namespace /* anonymous */
+{
+	/**
+	 * Legacy sparse array class.
+	 * This is the sparse array which was used before the generational handles, which erased removed elements from the middle of the
+	 * dense array and scanned the whole sparse array to trim it on every removal. It's only kept here to compare the two.
+	 */
+	template<class Type>
+	class LegacySparseArray final
+	{
+	public:
+		template<class...Arguments>
+		std::pair<uint64_t, Type*> insert(Arguments&&... arguments)
+		{
+			const auto index = m_SparseArray.size();
+			m_SparseArray.emplace_back(m_DenseArray.size());
+			m_AvailabilityMap.emplace_back(true);
+
+			auto& value = m_DenseArray.emplace_back(std::forward<Arguments>(arguments)...);
+			return std::make_pair(index, &value);
+		}
+
+		void remove(uint64_t index, bool shouldClear = true)
+		{
+			m_DenseArray.erase(m_DenseArray.begin() + m_SparseArray[index]);
+			m_AvailabilityMap[index] = false;
+
+			if (shouldClear)
+				clean();
+		}
+
+		uint64_t size() const { return m_DenseArray.size(); }
+
+	private:
+		void clean()
+		{
+			const auto finalIndex = m_SparseArray.size() - 1;
+
+			uint64_t lastFreeIndex = finalIndex;
+			for (uint64_t i = 0; i < m_SparseArray.size(); i++)
+			{
+				if (!m_AvailabilityMap[i])
+					lastFreeIndex = i;
+			}
+
+			if (lastFreeIndex < finalIndex)
+			{
+				m_SparseArray.erase(m_SparseArray.begin() + lastFreeIndex, m_SparseArray.end());
+				m_AvailabilityMap.erase(m_AvailabilityMap.begin() + lastFreeIndex, m_AvailabilityMap.end());
+			}
+		}
+
+	private:
+		std::vector<Type> m_DenseArray;
+		std::vector<uint64_t> m_SparseArray;
+		std::vector<bool> m_AvailabilityMap;
+	};
+
+	/**
+	 * Component structure.
+	 * This is roughly the size of a small component stored in a sparse array.
+	 */
+	struct Component final
+	{
+		float m_Position[3] = {};
+		float m_Velocity[3] = {};
+		uint64_t m_Entity = 0;
+	};
+
+	/**
+	 * Get the number of elements which are alive while churning.
+	 *
+	 * @return The element count.
+	 */
+	uint64_t GetElementCount()
+	{
+		return Xenon::Testing::IsQuickRun() ? 1 << 16 : 1 << 20;
+	}
+}
+
+XENON_BENCHMARK(SparseArray, Churn)
+{
+	const auto elementCount = GetElementCount();
+	const auto churnCount = elementCount;
+	auto engine = std::mt19937_64(42);
+
+	// Remove a random element and insert a new one in it's place, so the element count stays the same.
+	{
+		auto sparseArray = Xenon::SparseArray<Component>();
+		std::vector<Xenon::SparseArray<Component>::Handle> handles;
+		handles.reserve(elementCount);
+
+		for (uint64_t i = 0; i < elementCount; i++)
+			handles.emplace_back(sparseArray.insert(Component{ .m_Entity = i }).first);
+
+		Xenon::Testing::Measure("SparseArray (remove + insert)", churnCount, [&]
+			{
+				for (uint64_t i = 0; i < churnCount; i++)
+				{
+					auto& handle = handles[engine() % handles.size()];
+					sparseArray.remove(handle);
+					handle = sparseArray.insert(Component{ .m_Entity = i }).first;
+				}
+			});
+
+		Xenon::Testing::Measure("SparseArray (iterate after churn)", sparseArray.size(), [&]
+			{
+				uint64_t sum = 0;
+				for (const auto& component : sparseArray)
+					sum += component.m_Entity;
+
+				Xenon::Testing::DoNotOptimize(sum);
+			});
+	}
+
+	{
+		auto map = std::unordered_map<uint64_t, Component>();
+		map.reserve(elementCount);
+
+		std::vector<uint64_t> keys;
+		keys.reserve(elementCount);
+
+		uint64_t nextKey = 0;
+		for (uint64_t i = 0; i < elementCount; i++)
+		{
+			map.emplace(nextKey, Component{ .m_Entity = i });
+			keys.emplace_back(nextKey++);
+		}
+
+		Xenon::Testing::Measure("std::unordered_map (remove + insert)", churnCount, [&]
+			{
+				for (uint64_t i = 0; i < churnCount; i++)
+				{
+					auto& key = keys[engine() % keys.size()];
+					map.erase(key);
+					map.emplace(nextKey, Component{ .m_Entity = i });
+					key = nextKey++;
+				}
+			});
+
+		Xenon::Testing::Measure("std::unordered_map (iterate after churn)", map.size(), [&]
+			{
+				uint64_t sum = 0;
+				for (const auto& [key, component] : map)
+					sum += component.m_Entity;
+
+				Xenon::Testing::DoNotOptimize(sum);
+			});
+	}
+
+	// The legacy removal is O(n), so only a few operations are run on it. The sparse array is not cleaned, as cleaning trims it without
+	// regard to the live entries (which quickly leaves only the last element to be removed), and it would only add to the cost.
+	{
+		auto sparseArray = LegacySparseArray<Component>();
+		for (uint64_t i = 0; i < elementCount; i++)
+			static_cast<void>(sparseArray.insert(Component{ .m_Entity = i }));
+
+		const uint64_t legacyChurnCount = Xenon::Testing::IsQuickRun() ? 64 : 256;
+		Xenon::Testing::Measure("Legacy sparse array (remove + insert)", legacyChurnCount, [&]
+			{
+				for (uint64_t i = 0; i < legacyChurnCount; i++)
+				{
+					sparseArray.remove(engine() % (elementCount - 1), false);
+					static_cast<void>(sparseArray.insert(Component{ .m_Entity = i }));
+				}
+			}, 1);
+	}
+}
@@ -0,0 +1,67 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/SparseArray.hpp"
+
+#include <random>
+#include <unordered_map>
+
+XENON_TEST(SparseArray, RemovedHandlesAreDetected)
+{
+	auto sparseArray = Xenon::SparseArray<uint64_t>();
+	const auto [first, pFirst] = sparseArray.insert(1);
+	const auto [second, pSecond] = sparseArray.insert(2);
+
+	XENON_EXPECT(sparseArray.remove(first));
+	XENON_EXPECT(!sparseArray.contains(first));
+	XENON_EXPECT(!sparseArray.remove(first));
+	XENON_EXPECT(sparseArray.get(first) == nullptr);
+
+	// The freed slot is reused, but the old handle must not refer to the new element.
+	const auto [third, pThird] = sparseArray.insert(3);
+	XENON_EXPECT(third.m_Index == first.m_Index);
+	XENON_EXPECT(third != first);
+	XENON_EXPECT(!sparseArray.contains(first));
+	XENON_EXPECT(sparseArray[second] == 2);
+	XENON_EXPECT(sparseArray[third] == 3);
+
+	sparseArray.clear();
+	XENON_EXPECT(sparseArray.empty());
+	XENON_EXPECT(!sparseArray.contains(second));
+	XENON_EXPECT(!sparseArray.contains(third));
+}
+
+XENON_TEST(SparseArray, ChurnKeepsHandlesValid)
+{
+	auto sparseArray = Xenon::SparseArray<uint64_t>();
+	auto expected = std::unordered_map<uint64_t, Xenon::SparseArray<uint64_t>::Handle>();
+	auto engine = std::mt19937_64(7);
+
+	uint64_t nextValue = 0;
+	for (uint32_t i = 0; i < 10000; i++)
+	{
+		if (expected.empty() || engine() % 3 != 0)
+		{
+			const auto value = nextValue++;
+			expected.emplace(value, sparseArray.insert(value).first);
+		}
+		else
+		{
+			auto itr = expected.begin();
+			std::advance(itr, engine() % expected.size());
+
+			XENON_EXPECT(sparseArray.remove(itr->second));
+			expected.erase(itr);
+		}
+	}
+
+	// Every remaining handle must still point to it's value, and the dense array must only contain the remaining values.
+	XENON_EXPECT(sparseArray.size() == expected.size());
+	for (const auto& [value, handle] : expected)
+		XENON_EXPECT(sparseArray.contains(handle) && sparseArray[handle] == value);
+
+	for (uint64_t i = 0; i < sparseArray.size(); i++)
+		XENON_EXPECT(sparseArray[sparseArray.getHandle(i)] == sparseArray.data()[i]);
+}
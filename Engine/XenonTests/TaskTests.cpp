@@ -0,0 +1,106 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/Task.hpp"
+
+#include <stdexcept>
+
+namespace /* anonymous */
+{
+	/**
+	 * Compute a value on a job system worker.
+	 *
+	 * @param jobSystem The job system to use.
+	 * @param value The value to square.
+	 * @return The task.
+	 */
+	Xenon::Task<uint64_t> Square(Xenon::JobSystem& jobSystem, uint64_t value)
+	{
+		co_await jobSystem.schedule();
+		co_return value * value;
+	}
+
+	/**
+	 * Compute the sum of squares using multiple tasks which run in parallel.
+	 *
+	 * @param jobSystem The job system to use.
+	 * @param count The number of squares.
+	 * @return The task.
+	 */
+	Xenon::Task<uint64_t> SumOfSquares(Xenon::JobSystem& jobSystem, uint64_t count)
+	{
+		std::vector<Xenon::Task<uint64_t>> tasks;
+		for (uint64_t i = 0; i < count; i++)
+			tasks.emplace_back(Square(jobSystem, i));
+
+		co_await Xenon::WhenAll(tasks);
+
+		uint64_t sum = 0;
+		for (auto& task : tasks)
+			sum += co_await task;
+
+		co_return sum;
+	}
+
+	/**
+	 * Throw an exception from a worker.
+	 *
+	 * @param jobSystem The job system to use.
+	 * @return The task.
+	 */
+	Xenon::Task<void> Throw(Xenon::JobSystem& jobSystem)
+	{
+		co_await jobSystem.schedule();
+		throw std::runtime_error("Task failed!");
+	}
+}
+
+XENON_TEST(Task, SyncWaitReturnsTheResult)
+{
+	auto jobSystem = Xenon::JobSystem(2);
+
+	auto task = Square(jobSystem, 12);
+	XENON_EXPECT(!task.isReady());
+	XENON_EXPECT(Xenon::SyncWait(jobSystem, task) == 144);
+	XENON_EXPECT(task.isReady());
+}
+
+XENON_TEST(Task, WhenAllAwaitsEveryTask)
+{
+	auto jobSystem = Xenon::JobSystem(3);
+
+	// Repeat it to catch races between the completing workers and the waiting thread.
+	for (uint32_t i = 0; i < 200; i++)
+	{
+		auto task = SumOfSquares(jobSystem, 32);
+		XENON_EXPECT(Xenon::SyncWait(jobSystem, task) == 31 * 32 * 63 / 6);
+	}
+}
+
+XENON_TEST(Task, SyncWaitWorksWithoutWorkers)
+{
+	auto jobSystem = Xenon::JobSystem(0);
+
+	auto task = SumOfSquares(jobSystem, 8);
+	XENON_EXPECT(Xenon::SyncWait(jobSystem, task) == 7 * 8 * 15 / 6);
+}
+
+XENON_TEST(Task, SyncWaitRethrowsExceptions)
+{
+	auto jobSystem = Xenon::JobSystem(2);
+
+	bool hasThrown = false;
+	try
+	{
+		auto task = Throw(jobSystem);
+		Xenon::SyncWait(jobSystem, task);
+	}
+	catch (const std::runtime_error&)
+	{
+		hasThrown = true;
+	}
+
+	XENON_EXPECT(hasThrown);
+}
@@ -0,0 +1,9 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+int main(int argc, char** argv)
+{
+	return Xenon::Testing::RunCases(Xenon::Testing::CaseType::Test, argc, argv);
+}
@@ -0,0 +1,103 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "TestMeshes.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <numeric>
+#include <random>
+
+namespace Xenon
+{
+	namespace Testing
+	{
+		TestMesh CreateSphere(uint32_t rings, uint32_t segments)
+		{
+			TestMesh mesh;
+			mesh.m_Vertices.reserve(static_cast<uint64_t>(rings + 1) * (segments + 1));
+
+			// The seam and the poles have a vertex per segment, since their texture coordinates differ.
+			for (uint32_t ring = 0; ring <= rings; ring++)
+			{
+				const auto theta = std::numbers::pi_v<float> * static_cast<float>(ring) / static_cast<float>(rings);
+				for (uint32_t segment = 0; segment <= segments; segment++)
+				{
+					const auto phi = 2.0f * std::numbers::pi_v<float> * static_cast<float>(segment) / static_cast<float>(segments);
+					const auto normal = std::array<float, 3>{ std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi) };
+
+					auto& vertex = mesh.m_Vertices.emplace_back();
+					vertex.m_Position = normal;
+					vertex.m_Normal = normal;
+					vertex.m_TextureCoordinates = { static_cast<float>(segment) / static_cast<float>(segments), static_cast<float>(ring) / static_cast<float>(rings) };
+				}
+			}
+
+			// The first and the last rings would have a degenerate triangle per segment at the pole, so those are skipped.
+			for (uint32_t ring = 0; ring < rings; ring++)
+			{
+				for (uint32_t segment = 0; segment < segments; segment++)
+				{
+					const auto topLeft = ring * (segments + 1) + segment;
+					const auto topRight = topLeft + 1;
+					const auto bottomLeft = topLeft + segments + 1;
+					const auto bottomRight = bottomLeft + 1;
+
+					if (ring > 0)
+						mesh.m_Indices.insert(mesh.m_Indices.end(), { topLeft, topRight, bottomLeft });
+
+					if (ring < rings - 1)
+						mesh.m_Indices.insert(mesh.m_Indices.end(), { topRight, bottomRight, bottomLeft });
+				}
+			}
+
+			return mesh;
+		}
+
+		void ShuffleMesh(TestMesh& mesh, uint32_t seed)
+		{
+			auto engine = std::mt19937(seed);
+
+			// Shuffle the vertices and remap the indices to them.
+			std::vector<uint32_t> order(mesh.m_Vertices.size());
+			std::iota(order.begin(), order.end(), 0);
+			std::shuffle(order.begin(), order.end(), engine);
+
+			std::vector<TestVertex> vertices(mesh.m_Vertices.size());
+			std::vector<uint32_t> remap(mesh.m_Vertices.size());
+			for (uint32_t i = 0; i < order.size(); i++)
+			{
+				vertices[i] = mesh.m_Vertices[order[i]];
+				remap[order[i]] = i;
+			}
+
+			mesh.m_Vertices = std::move(vertices);
+			for (auto& index : mesh.m_Indices)
+				index = remap[index];
+
+			// Shuffle the triangles.
+			const auto triangleCount = mesh.m_Indices.size() / 3;
+			for (uint64_t i = triangleCount - 1; i > 0; i--)
+			{
+				const auto j = std::uniform_int_distribution<uint64_t>(0, i)(engine);
+				std::swap_ranges(mesh.m_Indices.begin() + i * 3, mesh.m_Indices.begin() + i * 3 + 3, mesh.m_Indices.begin() + j * 3);
+			}
+		}
+
+		std::vector<std::array<TestVertex, 3>> GetSortedTriangles(const std::vector<TestVertex>& vertices, const std::vector<uint32_t>& indices)
+		{
+			std::vector<std::array<TestVertex, 3>> triangles;
+			triangles.reserve(indices.size() / 3);
+
+			for (uint64_t i = 0; i + 2 < indices.size(); i += 3)
+			{
+				auto& triangle = triangles.emplace_back(std::array<TestVertex, 3>{ vertices[indices[i]], vertices[indices[i + 1]], vertices[indices[i + 2]] });
+				std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+			}
+
+			std::sort(triangles.begin(), triangles.end());
+			return triangles;
+		}
+	}
+}
@@ -0,0 +1,76 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <vector>
+
+namespace Xenon
+{
+	namespace Testing
+	{
+		/**
+		 * Test vertex structure.
+		 * This has the layout of a typical interleaved vertex, with the position at the start.
+		 */
+		struct TestVertex final
+		{
+			std::array<float, 3> m_Position = {};
+			std::array<float, 3> m_Normal = {};
+			std::array<float, 2> m_TextureCoordinates = {};
+
+			/**
+			 * Compare two vertices member by member.
+			 *
+			 * @param other The other vertex.
+			 * @return The ordering of the vertices.
+			 */
+			auto operator<=>(const TestVertex& other) const = default;
+		};
+
+		/**
+		 * Test mesh structure.
+		 * This contains an indexed triangle list.
+		 */
+		struct TestMesh final
+		{
+			std::vector<TestVertex> m_Vertices;
+			std::vector<uint32_t> m_Indices;
+		};
+
+		/**
+		 * Create a unit UV sphere.
+		 * The triangles are counter-clockwise when seen from the outside, and are ordered ring by ring like most generators and exporters
+		 * emit them.
+		 *
+		 * @param rings The number of rings from pole to pole. This must be at least 2.
+		 * @param segments The number of segments around the sphere. This must be at least 3.
+		 * @return The sphere mesh.
+		 */
+		[[nodiscard]] TestMesh CreateSphere(uint32_t rings, uint32_t segments);
+
+		/**
+		 * Shuffle the triangles and the vertices of a mesh.
+		 * This mimics meshes which were edited or exported without any care for the triangle order, which is the worst case for the
+		 * vertex cache. The windings are left untouched.
+		 *
+		 * @param mesh The mesh to shuffle.
+		 * @param seed The random seed.
+		 */
+		void ShuffleMesh(TestMesh& mesh, uint32_t seed);
+
+		/**
+		 * Get the triangles of a triangle list as vertex values in a canonical order.
+		 * Each triangle is rotated to start at it's smallest vertex, which keeps the winding, and the triangles are sorted. Two triangle
+		 * lists draw the same triangles if this is equal for both, regardless of the triangle and vertex order.
+		 *
+		 * @param vertices The vertices.
+		 * @param indices The triangle list indices.
+		 * @return The sorted triangles.
+		 */
+		[[nodiscard]] std::vector<std::array<TestVertex, 3>> GetSortedTriangles(const std::vector<TestVertex>& vertices, const std::vector<uint32_t>& indices);
+	}
+}
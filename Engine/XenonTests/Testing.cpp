@@ -0,0 +1,110 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include <cstdio>
+#include <exception>
+#include <string>
+
+namespace /* anonymous */
+{
+	/**
+	 * Get the registered cases.
+	 * This is a function local static so that the cases can be registered from any translation unit's static initializers.
+	 *
+	 * @return The cases.
+	 */
+	std::vector<Xenon::Testing::Case>& GetCases()
+	{
+		static std::vector<Xenon::Testing::Case> cases;
+		return cases;
+	}
+
+	uint64_t g_FailureCount = 0;
+	bool g_IsQuickRun = false;
+}
+
+namespace Xenon
+{
+	namespace Testing
+	{
+		Registrar::Registrar(const char* pSuite, const char* pName, void(*pFunction)(), CaseType type)
+		{
+			GetCases().emplace_back(pSuite, pName, pFunction, type);
+		}
+
+		void ReportFailure(const char* pExpression, const char* pFile, int line)
+		{
+			g_FailureCount++;
+			std::fprintf(stderr, "%s(%d): Expectation failed: %s\n", pFile, line, pExpression);
+		}
+
+		void ReportMetric(std::string_view label, double value, std::string_view unit)
+		{
+			std::printf("    %-56.*s %14.3f %.*s\n", static_cast<int>(label.size()), label.data(), value, static_cast<int>(unit.size()), unit.data());
+			std::fflush(stdout);
+		}
+
+		bool IsQuickRun() noexcept
+		{
+			return g_IsQuickRun;
+		}
+
+		int RunCases(CaseType type, int argc, char** argv)
+		{
+			std::string_view filter;
+			for (int i = 1; i < argc; i++)
+			{
+				const auto argument = std::string_view(argv[i]);
+				if (argument == "--quick")
+					g_IsQuickRun = true;
+
+				else if (!argument.starts_with("--"))
+					filter = argument;
+			}
+
+			uint64_t caseCount = 0;
+			uint64_t failedCaseCount = 0;
+			for (const auto& testCase : GetCases())
+			{
+				if (testCase.m_Type != type)
+					continue;
+
+				const auto name = std::string(testCase.m_pSuite) + "." + testCase.m_pName;
+				if (!filter.empty() && name.find(filter) == std::string::npos)
+					continue;
+
+				std::printf("[ RUN  ] %s\n", name.c_str());
+				std::fflush(stdout);
+
+				const auto previousFailureCount = g_FailureCount;
+				try
+				{
+					testCase.m_pFunction();
+				}
+				catch (const std::exception& exception)
+				{
+					g_FailureCount++;
+					std::fprintf(stderr, "Unhandled exception: %s\n", exception.what());
+				}
+				catch (...)
+				{
+					g_FailureCount++;
+					std::fprintf(stderr, "Unhandled unknown exception.\n");
+				}
+
+				const auto hasFailed = g_FailureCount != previousFailureCount;
+				std::printf("[ %s ] %s\n", hasFailed ? "FAIL" : " OK ", name.c_str());
+				std::fflush(stdout);
+
+				caseCount++;
+				if (hasFailed)
+					failedCaseCount++;
+			}
+
+			std::printf("%llu case(s) run, %llu failed.\n", static_cast<unsigned long long>(caseCount), static_cast<unsigned long long>(failedCaseCount));
+			return failedCaseCount == 0 ? 0 : 1;
+		}
+	}
+}
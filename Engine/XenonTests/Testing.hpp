@@ -0,0 +1,165 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Xenon
+{
+	namespace Testing
+	{
+		/**
+		 * Case type enum.
+		 */
+		enum class CaseType : uint8_t
+		{
+			Test,
+			Benchmark
+		};
+
+		/**
+		 * Case structure.
+		 * This contains information about a single registered test or benchmark.
+		 */
+		struct Case final
+		{
+			const char* m_pSuite = nullptr;
+			const char* m_pName = nullptr;
+			void(*m_pFunction)() = nullptr;
+			CaseType m_Type = CaseType::Test;
+		};
+
+		/**
+		 * Registrar structure.
+		 * Static instances of this are created by the XENON_TEST and XENON_BENCHMARK macros to register the cases.
+		 */
+		struct Registrar final
+		{
+			/**
+			 * Explicit constructor.
+			 *
+			 * @param pSuite The suite name.
+			 * @param pName The case name.
+			 * @param pFunction The case function.
+			 * @param type The case type.
+			 */
+			explicit Registrar(const char* pSuite, const char* pName, void(*pFunction)(), CaseType type);
+		};
+
+		/**
+		 * Report a failed expectation.
+		 * This marks the currently running case as failed, and the case continues to run.
+		 *
+		 * @param pExpression The failed expression.
+		 * @param pFile The file in which the expectation is.
+		 * @param line The line of the expectation.
+		 */
+		void ReportFailure(const char* pExpression, const char* pFile, int line);
+
+		/**
+		 * Report a benchmark metric.
+		 *
+		 * @param label The metric label.
+		 * @param value The metric value.
+		 * @param unit The unit of the value.
+		 */
+		void ReportMetric(std::string_view label, double value, std::string_view unit);
+
+		/**
+		 * Check if the benchmarks should run with a reduced work size.
+		 * This is set by the --quick argument, which is used when the benchmarks are run as a part of the tests.
+		 *
+		 * @return True if the run should be quick.
+		 * @return False if the full work size should be used.
+		 */
+		[[nodiscard]] bool IsQuickRun() noexcept;
+
+		/**
+		 * Run all the registered cases of a type.
+		 * The first argument which does not start with "--" is used as a filter, and only the cases which contain it in their
+		 * "Suite.Name" are run.
+		 *
+		 * @param type The type of the cases to run.
+		 * @param argc The argument count.
+		 * @param argv The arguments.
+		 * @return The process exit code.
+		 */
+		[[nodiscard]] int RunCases(CaseType type, int argc, char** argv);
+
+		/**
+		 * Measure the time taken by a function and report the time per operation.
+		 * The function is run once to warm up, and then a number of times, out of which the fastest run is reported.
+		 *
+		 * @tparam Function The function type.
+		 * @param label The metric label.
+		 * @param operations The number of operations the function performs in a single run.
+		 * @param function The function to measure.
+		 * @param repetitions The number of measured runs. Default is 5.
+		 * @return The nanoseconds taken per operation.
+		 */
+		template<class Function>
+		double Measure(std::string_view label, uint64_t operations, Function&& function, uint32_t repetitions = 5)
+		{
+			function();
+
+			auto best = std::chrono::nanoseconds::max();
+			for (uint32_t i = 0; i < repetitions; i++)
+			{
+				const auto start = std::chrono::steady_clock::now();
+				function();
+				best = std::min<std::chrono::nanoseconds>(best, std::chrono::steady_clock::now() - start);
+			}
+
+			const auto nanoseconds = static_cast<double>(best.count()) / static_cast<double>(operations == 0 ? 1 : operations);
+			ReportMetric(label, nanoseconds, "ns/op");
+			return nanoseconds;
+		}
+
+		/**
+		 * Prevent the compiler from optimizing away a value.
+		 *
+		 * @tparam Type The value type.
+		 * @param value The value to keep.
+		 */
+		template<class Type>
+		void DoNotOptimize(const Type& value)
+		{
+#ifdef _MSC_VER
+			const volatile auto* pSink = &reinterpret_cast<const volatile char&>(value);
+			static_cast<void>(*pSink);
+
+#else
+			asm volatile("" : : "r,m"(value) : "memory");
+
+#endif
+		}
+	}
+}
+
+#define XENON_TESTING_CASE(suite, name, type)																								\
+	static void XenonCase_##suite##_##name();																								\
+	static const ::Xenon::Testing::Registrar g_XenonRegistrar_##suite##_##name(#suite, #name, &XenonCase_##suite##_##name, type);			\
+	static void XenonCase_##suite##_##name()
+
+/**
+ * Define a new test case.
+ * Usage: XENON_TEST(Suite, Name) { XENON_EXPECT(...); }
+ */
+#define XENON_TEST(suite, name)				XENON_TESTING_CASE(suite, name, ::Xenon::Testing::CaseType::Test)
+
+/**
+ * Define a new benchmark case.
+ * Usage: XENON_BENCHMARK(Suite, Name) { ::Xenon::Testing::Measure(...); }
+ */
+#define XENON_BENCHMARK(suite, name)		XENON_TESTING_CASE(suite, name, ::Xenon::Testing::CaseType::Benchmark)
+
+/**
+ * Expect an expression to be true.
+ * The case is marked as failed if it's not, and continues to run.
+ */
+#define XENON_EXPECT(expression)			do { if (!(expression)) ::Xenon::Testing::ReportFailure(#expression, __FILE__, __LINE__); } while (false)
@@ -0,0 +1,88 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/Tracer.hpp"
+
+#ifdef _MSC_VER
+#	define XENON_BENCHMARK_NO_INLINE		__declspec(noinline)
+
+#else
+#	define XENON_BENCHMARK_NO_INLINE		__attribute__((noinline))
+
+#endif
+
+namespace /* anonymous */
+{
+	/**
+	 * A small amount of work without a trace scope.
+	 * This is the baseline which the scopes are compared against.
+	 *
+	 * @param value The input value.
+	 * @return The output value.
+	 */
+	XENON_BENCHMARK_NO_INLINE uint64_t WorkWithoutScope(uint64_t value)
+	{
+		Xenon::Testing::DoNotOptimize(value);
+		return value * 0x9E3779B97F4A7C15;
+	}
+
+	/**
+	 * The same work as WorkWithoutScope() inside a trace scope.
+	 *
+	 * @param value The input value.
+	 * @return The output value.
+	 */
+	XENON_BENCHMARK_NO_INLINE uint64_t WorkWithScope(uint64_t value)
+	{
+		XENON_TRACE_SCOPE("Benchmark Scope");
+
+		Xenon::Testing::DoNotOptimize(value);
+		return value * 0x9E3779B97F4A7C15;
+	}
+
+	/**
+	 * Call a work function a number of times.
+	 *
+	 * @tparam Function The work function type.
+	 * @param count The number of calls.
+	 * @param function The work function.
+	 */
+	template<class Function>
+	void CallRepeatedly(uint64_t count, Function&& function)
+	{
+		uint64_t value = 0;
+		for (uint64_t i = 0; i < count; i++)
+			value += function(i);
+
+		Xenon::Testing::DoNotOptimize(value);
+	}
+}
+
+XENON_BENCHMARK(Tracer, ScopeOverhead)
+{
+	const uint64_t scopeCount = Xenon::Testing::IsQuickRun() ? 1 << 16 : 1 << 22;
+
+	const auto baseline = Xenon::Testing::Measure("no scope", scopeCount, [scopeCount] { CallRepeatedly(scopeCount, WorkWithoutScope); });
+
+	const auto idle = Xenon::Testing::Measure("XENON_TRACE_SCOPE (not recording)", scopeCount, [scopeCount] { CallRepeatedly(scopeCount, WorkWithScope); });
+	Xenon::Testing::ReportMetric("XENON_TRACE_SCOPE (not recording) overhead", idle - baseline, "ns/scope");
+
+	// Recording takes two time stamps, which are much slower in some virtual machines, so their cost is reported separately.
+	Xenon::Testing::Measure("Tracer::GetTimestamp", scopeCount, [scopeCount]
+		{
+			uint64_t sum = 0;
+			for (uint64_t i = 0; i < scopeCount; i++)
+				sum += Xenon::Tracer::GetTimestamp();
+
+			Xenon::Testing::DoNotOptimize(sum);
+		});
+
+	// The ring buffer overwrites the oldest events, so recording more scopes than it can hold measures the steady state.
+	Xenon::Tracer::Start();
+	const auto recording = Xenon::Testing::Measure("XENON_TRACE_SCOPE (recording)", scopeCount, [scopeCount] { CallRepeatedly(scopeCount, WorkWithScope); });
+	Xenon::Tracer::Stop();
+
+	Xenon::Testing::ReportMetric("XENON_TRACE_SCOPE (recording) overhead", recording - baseline, "ns/scope");
+}
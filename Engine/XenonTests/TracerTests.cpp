@@ -0,0 +1,214 @@
+// Copyright 2022-2023 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Testing.hpp"
+
+#include "../XenonCore/Tracer.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace /* anonymous */
+{
+	/**
+	 * A function which is traced by it's name.
+	 */
+	void TracedFunction()
+	{
+		XENON_TRACE_SCOPE();
+	}
+
+	/**
+	 * Read a trace file.
+	 *
+	 * @param file The file to read.
+	 * @return The trace events. This is empty if the file is not a valid trace.
+	 */
+	[[nodiscard]] nlohmann::json ReadTraceEvents(const std::filesystem::path& file)
+	{
+		auto json = nlohmann::json::parse(std::ifstream(file), nullptr, false);
+		if (json.is_discarded() || !json.contains("traceEvents") || !json["traceEvents"].is_array())
+			return nlohmann::json::array();
+
+		return json["traceEvents"];
+	}
+
+	/**
+	 * Get the complete ("X") events with a name from the trace events.
+	 * The function names are cleaned differently by each compiler, so the names are matched by their end.
+	 *
+	 * @param events The trace events.
+	 * @param name The event name.
+	 * @return The matching events.
+	 */
+	[[nodiscard]] std::vector<nlohmann::json> GetEvents(const nlohmann::json& events, std::string_view name)
+	{
+		std::vector<nlohmann::json> matches;
+		for (const auto& event : events)
+		{
+			if (event.value("ph", "") == "X" && event.value("name", "").ends_with(name))
+				matches.emplace_back(event);
+		}
+
+		return matches;
+	}
+
+	/**
+	 * Get the name of a thread from the thread name metadata events.
+	 *
+	 * @param events The trace events.
+	 * @param threadID The thread ID.
+	 * @return The thread name. This is empty if the thread is not named.
+	 */
+	[[nodiscard]] std::string GetThreadName(const nlohmann::json& events, uint64_t threadID)
+	{
+		for (const auto& event : events)
+		{
+			if (event.value("ph", "") == "M" && event.value("name", "") == "thread_name" && event.value("tid", uint64_t(0)) == threadID)
+				return event["args"].value("name", "");
+		}
+
+		return {};
+	}
+}
+
+XENON_TEST(Tracer, WritesChromeTraceJson)
+{
+	static constexpr const char* DynamicNames[] = { "Dynamic Scope A", "Dynamic Scope B" };
+	const auto file = std::filesystem::temp_directory_path() / "XenonTracerTest.json";
+
+	{
+		XENON_TRACE_SCOPE("Before Start");
+	}
+
+	Xenon::Tracer::Start();
+
+	{
+		XENON_TRACE_SCOPE("Outer \"Scope\"");
+
+		{
+			XENON_TRACE_SCOPE("Inner Scope");
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		}
+
+		TracedFunction();
+
+		for (const auto pName : DynamicNames)
+		{
+			XENON_TRACE_SCOPE_DYNAMIC(pName);
+		}
+	}
+
+	std::jthread([]
+		{
+			XENON_TRACE_THREAD("Tracer Test Thread");
+			XENON_TRACE_SCOPE("Thread Scope");
+		}
+	).join();
+
+	Xenon::Tracer::Stop();
+
+	{
+		XENON_TRACE_SCOPE("After Stop");
+	}
+
+	XENON_EXPECT(Xenon::Tracer::Dump(file));
+
+	const auto events = ReadTraceEvents(file);
+	std::filesystem::remove(file);
+	XENON_EXPECT(!events.empty());
+
+	// Only the scopes which were recorded between the start and the stop are written, and the names are escaped.
+	const auto outerEvents = GetEvents(events, "Outer \"Scope\"");
+	const auto innerEvents = GetEvents(events, "Inner Scope");
+	const auto threadEvents = GetEvents(events, "Thread Scope");
+	XENON_EXPECT(outerEvents.size() == 1);
+	XENON_EXPECT(innerEvents.size() == 1);
+	XENON_EXPECT(threadEvents.size() == 1);
+	XENON_EXPECT(GetEvents(events, "Before Start").empty());
+	XENON_EXPECT(GetEvents(events, "After Stop").empty());
+
+	for (const auto pName : DynamicNames)
+		XENON_EXPECT(GetEvents(events, pName).size() == 1);
+
+	// The function name is written without the return type and the parameters.
+	const auto functionEvents = GetEvents(events, "TracedFunction");
+	XENON_EXPECT(functionEvents.size() == 1);
+
+	if (outerEvents.size() == 1 && innerEvents.size() == 1 && threadEvents.size() == 1 && functionEvents.size() == 1)
+	{
+		const auto& outer = outerEvents.front();
+		const auto& inner = innerEvents.front();
+
+		// The inner scope is nested in the outer one. The times are written in microseconds with 3 decimals.
+		constexpr auto epsilon = 0.002;
+		XENON_EXPECT(inner["ts"].get<double>() + epsilon >= outer["ts"].get<double>());
+		XENON_EXPECT(inner["ts"].get<double>() + inner["dur"].get<double>() <= outer["ts"].get<double>() + outer["dur"].get<double>() + epsilon);
+		XENON_EXPECT(inner["dur"].get<double>() >= 1000.0);
+		XENON_EXPECT(functionEvents.front()["name"].get<std::string>().find('(') == std::string::npos);
+
+		// The threads are resolved from the buffers, and named ones keep their name.
+		const auto mainThread = outer["tid"].get<uint64_t>();
+		const auto otherThread = threadEvents.front()["tid"].get<uint64_t>();
+		XENON_EXPECT(inner["tid"].get<uint64_t>() == mainThread);
+		XENON_EXPECT(otherThread != mainThread);
+		XENON_EXPECT(GetThreadName(events, otherThread) == "Tracer Test Thread");
+		XENON_EXPECT(!GetThreadName(events, mainThread).empty());
+	}
+}
+
+XENON_TEST(Tracer, KeepsTheLatestEventsOfEachThread)
+{
+	const auto file = std::filesystem::temp_directory_path() / "XenonTracerOverflowTest.json";
+
+	// Record more scopes than a thread buffer can hold, on a new thread so that the buffer starts empty.
+	Xenon::Tracer::Start();
+	std::jthread([]
+		{
+			for (uint64_t i = 0; i < Xenon::Tracer::EventsPerThread + 100; i++)
+			{
+				XENON_TRACE_SCOPE("Overflow Scope");
+			}
+
+			XENON_TRACE_SCOPE("Last Scope");
+		}
+	).join();
+
+	Xenon::Tracer::Stop();
+	XENON_EXPECT(Xenon::Tracer::Dump(file));
+
+	const auto events = ReadTraceEvents(file);
+	std::filesystem::remove(file);
+
+	// A full buffer's oldest event is the one the owning thread writes next, so it's discarded as well.
+	XENON_EXPECT(GetEvents(events, "Overflow Scope").size() == Xenon::Tracer::EventsPerThread - 2);
+	XENON_EXPECT(GetEvents(events, "Last Scope").size() == 1);
+}
+
+XENON_TEST(Tracer, CapturesFrames)
+{
+	const auto file = std::filesystem::temp_directory_path() / "XenonTracerFrameTest.json";
+	std::filesystem::remove(file);
+
+	// Recording starts at the next frame and the file is written at the frame after the captured ones.
+	Xenon::Tracer::CaptureFrames(2, file);
+	XENON_EXPECT(Xenon::Tracer::IsCapturingFrames());
+
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		XENON_TRACE_FRAME("Test Frame");
+		XENON_TRACE_SCOPE("Frame Work");
+	}
+
+	XENON_EXPECT(!Xenon::Tracer::IsCapturingFrames());
+	XENON_EXPECT(!Xenon::Tracer::IsRecording());
+
+	const auto events = ReadTraceEvents(file);
+	std::filesystem::remove(file);
+
+	XENON_EXPECT(GetEvents(events, "Test Frame").size() == 2);
+	XENON_EXPECT(GetEvents(events, "Frame Work").size() == 2);
+}
@@ -4,8 +4,7 @@
 #include "VulkanBuffer.hpp"
 #include "VulkanMacros.hpp"
 #include "VulkanCommandRecorder.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -134,7 +133,7 @@ namespace Xenon
 
 		void VulkanBuffer::copy(Buffer* pBuffer, uint64_t size, uint64_t srcOffset /*= 0*/, uint64_t dstOffset /*= 0*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto commandBuffers = VulkanCommandRecorder(m_pDevice, CommandRecorderUsage::Transfer);
 			commandBuffers.begin();
@@ -146,7 +145,7 @@ namespace Xenon
 
 		void VulkanBuffer::write(const std::byte* pData, uint64_t size, uint64_t offset /*= 0*/, CommandRecorder* pCommandRecorder /*= nullptr*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Validate the copy size.
 			if (size == 0 || size > getSize())
@@ -175,7 +174,7 @@ namespace Xenon
 
 		const std::byte* VulkanBuffer::beginRead()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// If the buffer is either index of vertex, copy to a staging buffer before reading.
 			if (m_Type == BufferType::Index || m_Type == BufferType::Vertex)
@@ -190,7 +189,7 @@ namespace Xenon
 
 		void VulkanBuffer::endRead()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (m_Type == BufferType::Index || m_Type == BufferType::Vertex)
 				m_pTemporaryBuffer->unmap();
@@ -201,7 +200,7 @@ namespace Xenon
 
 		VkDeviceAddress VulkanBuffer::getDeviceAddress() const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			VkBufferDeviceAddressInfoKHR bufferDeviceAddressInfo = {};
 			bufferDeviceAddressInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
@@ -211,7 +210,7 @@ namespace Xenon
 
 		std::byte* VulkanBuffer::map()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Return if we are mapped already.
 			if (m_IsMapped)
@@ -227,7 +226,7 @@ namespace Xenon
 
 		void VulkanBuffer::unmap()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Return if we are not mapped.
 			if (!m_IsMapped)
@@ -4,8 +4,7 @@
 #include "VulkanCommandBuffer.hpp"
 #include "VulkanMacros.hpp"
 #include "VulkanSwapchain.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -56,7 +55,7 @@ namespace Xenon
 
 		void VulkanCommandBuffer::wait(uint64_t timeout /*= std::numeric_limits<uint64_t>::max()*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (!m_IsFenceFree)
 			{
@@ -68,7 +67,7 @@ namespace Xenon
 
 		void VulkanCommandBuffer::submit(VkPipelineStageFlags pipelineStageFlags, VkQueue queue, VulkanSwapchain* pSwapchain /*= nullptr*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Create the submit info structure.
 			VkSubmitInfo submitInfo = {};
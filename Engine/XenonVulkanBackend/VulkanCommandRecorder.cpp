@@ -13,7 +13,8 @@
 #include "VulkanShaderBindingTable.hpp"
 #include "VulkanComputePipeline.hpp"
 
-#include <optick.h>
+#include "../XenonCore/SmallVector.hpp"
+#include "../XenonCore/Tracer.hpp"
 
 namespace /* anonymous */
 {
@@ -24,13 +25,13 @@ namespace /* anonymous */
 	 * @param clearValues The clear values to clear the rasterizer.
 	 * @return The Vulkan clear values.
 	 */
-	std::vector<VkClearValue> GetClearValues(Xenon::Backend::AttachmentType attachmentTypes, const std::vector<Xenon::Backend::Rasterizer::ClearValueType>& clearValues)
+	Xenon::SmallVector<VkClearValue, 8> GetClearValues(Xenon::Backend::AttachmentType attachmentTypes, const std::vector<Xenon::Backend::Rasterizer::ClearValueType>& clearValues)
 	{
-		OPTICK_EVENT();
+		XENON_TRACE_SCOPE();
 
 		auto itr = clearValues.begin();
 
-		std::vector<VkClearValue> vkClearValues;
+		Xenon::SmallVector<VkClearValue, 8> vkClearValues;
 		if (attachmentTypes & Xenon::Backend::AttachmentType::Color)
 		{
 			try
@@ -361,7 +362,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::begin()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			VkCommandBufferBeginInfo beginInfo = {};
 			beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -375,7 +376,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::begin(CommandRecorder* pParent)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto pVkParent = pParent->as<VulkanCommandRecorder>();
 
@@ -391,7 +392,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::changeImageLayout(VkImage image, VkImageLayout currentLayout, VkImageLayout newLayout, VkImageAspectFlags aspectFlags, uint32_t mipLevels /*= 1*/, uint32_t layer /*= 1*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Unbind the previous render pass if we need to.
 			if (m_IsRenderTargetBound)
@@ -510,7 +511,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::copy(Buffer* pSource, uint64_t srcOffset, Buffer* pDestination, uint64_t dstOffset, uint64_t size)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Unbind a render target if one is already bound.
 			if (m_IsRenderTargetBound)
@@ -535,7 +536,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::copy(Image* pSource, Swapchain* pDestination)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto pVkImage = pSource->as<VulkanImage>();
 			auto pVkSwapchain = pDestination->as<VulkanSwapchain>();
@@ -587,7 +588,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::copy(Image* pSource, const glm::vec3& sourceOffset, Image* pDestination, const glm::vec3& destinationOffset)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto pVkSourceImage = pSource->as<VulkanImage>();
 			auto pVkDestinationImage = pDestination->as<VulkanImage>();
@@ -682,7 +683,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::copy(Buffer* pSource, uint64_t bufferOffset, Image* pImage, glm::vec3 imageSize, glm::vec3 imageOffset /*= glm::vec3(0)*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			VkBufferImageCopy imageCopy = {};
 			imageCopy.bufferOffset = bufferOffset;
@@ -711,7 +712,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::copyImageLayer(Image* pSource, uint32_t sourceLayer, const glm::vec3& sourceOffset, Image* pDestination, uint32_t destinationLayer, const glm::vec3& destinationOffset)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto pVkSourceImage = pSource->as<VulkanImage>();
 			auto pVkDestinationImage = pDestination->as<VulkanImage>();
@@ -806,7 +807,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::resetQuery(OcclusionQuery* pOcclusionQuery)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Unlike dumb ass DirectX 12, we need to reset our query.
 			m_pDevice->getDeviceTable().vkCmdResetQueryPool(*m_pCurrentBuffer, pOcclusionQuery->as<VulkanOcclusionQuery>()->getQueryPool(), 0, static_cast<uint32_t>(pOcclusionQuery->getSamples().size()));
@@ -814,7 +815,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::bind(Rasterizer* pRasterizer, const std::vector<Rasterizer::ClearValueType>& clearValues, bool usingSecondaryCommandRecorders /*= false*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Unbind the previous render pass if we need to.
 			if (m_IsRenderTargetBound)
@@ -848,14 +849,14 @@ namespace Xenon
 
 		void VulkanCommandRecorder::bind(RasterizingPipeline* pPipeline, const VertexSpecification& vertexSpecification)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pDevice->getDeviceTable().vkCmdBindPipeline(*m_pCurrentBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pPipeline->as<VulkanRasterizingPipeline>()->getPipeline(vertexSpecification).m_Pipeline);
 		}
 
 		void VulkanCommandRecorder::bind(RasterizingPipeline* pPipeline, Descriptor* pUserDefinedDescriptor, Descriptor* pMaterialDescriptor, Descriptor* pPerGeometryDescriptor, Descriptor* pSceneDescriptor)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto pVkPipeline = pPipeline->as<VulkanRasterizingPipeline>();
 			if (pUserDefinedDescriptor)
@@ -921,7 +922,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::bind(Buffer* pVertexBuffer, uint32_t vertexStride)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			VkDeviceSize offset = 0;
 			VkBuffer vertexBuffer = pVertexBuffer->as<VulkanBuffer>()->getBuffer();
@@ -930,7 +931,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::bind(Buffer* pIndexBuffer, IndexBufferStride indexStride)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto indexType = VK_INDEX_TYPE_NONE_KHR;
 			if (indexStride == IndexBufferStride::Uint16)
@@ -947,14 +948,14 @@ namespace Xenon
 
 		void VulkanCommandRecorder::bind(RayTracingPipeline* pPipeline)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pDevice->getDeviceTable().vkCmdBindPipeline(*m_pCurrentBuffer, VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, pPipeline->as<VulkanRayTracingPipeline>()->getPipeline());
 		}
 
 		void VulkanCommandRecorder::bind(RayTracingPipeline* pPipeline, Descriptor* pUserDefinedDescriptor, Descriptor* pMaterialDescriptor, Descriptor* pPerGeometryDescriptor, Descriptor* pSceneDescriptor)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto pVkPipeline = pPipeline->as<VulkanRayTracingPipeline>();
 			if (pUserDefinedDescriptor)
@@ -1020,14 +1021,14 @@ namespace Xenon
 
 		void VulkanCommandRecorder::bind(ComputePipeline* pPipeline)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pDevice->getDeviceTable().vkCmdBindPipeline(*m_pCurrentBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pPipeline->as<VulkanComputePipeline>()->getPipeline());
 		}
 
 		void VulkanCommandRecorder::bind(ComputePipeline* pPipeline, Descriptor* pUserDefinedDescriptor)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto pVkPipeline = pPipeline->as<VulkanComputePipeline>();
 			if (pUserDefinedDescriptor)
@@ -1048,7 +1049,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::setViewport(float x, float y, float width, float height, float minDepth, float maxDepth)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			VkViewport viewport = {};
 			viewport.x = x;
@@ -1062,14 +1063,14 @@ namespace Xenon
 
 		void VulkanCommandRecorder::setViewportNatural(float x, float y, float width, float height, float minDepth, float maxDepth)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			setViewport(x, y, width, height, minDepth, maxDepth);
 		}
 
 		void VulkanCommandRecorder::setScissor(int32_t x, int32_t y, uint32_t width, uint32_t height)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			VkRect2D scissorRect = {};
 			scissorRect.offset.x = x;
@@ -1081,14 +1082,14 @@ namespace Xenon
 
 		void VulkanCommandRecorder::beginQuery(OcclusionQuery* pOcclusionQuery, uint32_t index)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pDevice->getDeviceTable().vkCmdBeginQuery(*m_pCurrentBuffer, pOcclusionQuery->as<VulkanOcclusionQuery>()->getQueryPool(), index, 0);
 		}
 
 		void VulkanCommandRecorder::drawVertices(uint64_t vertexOffset, uint64_t veretxCount, uint32_t instanceCount /*= 1*/, uint32_t firstInstance /*= 0*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// m_pDevice->getDeviceTable().vkCmdSetPrimitiveTopology(*m_pCurrentBuffer, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
 			m_pDevice->getDeviceTable().vkCmdDraw(*m_pCurrentBuffer, static_cast<uint32_t>(veretxCount), instanceCount, static_cast<uint32_t>(vertexOffset), firstInstance);
@@ -1096,7 +1097,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::drawIndexed(uint64_t vertexOffset, uint64_t indexOffset, uint64_t indexCount, uint32_t instanceCount /*= 1*/, uint32_t firstInstance /*= 0*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// m_pDevice->getDeviceTable().vkCmdSetPrimitiveTopology(*m_pCurrentBuffer, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
 			m_pDevice->getDeviceTable().vkCmdDrawIndexed(*m_pCurrentBuffer, static_cast<uint32_t>(indexCount), instanceCount, static_cast<uint32_t>(indexOffset), static_cast<uint32_t>(vertexOffset), firstInstance);
@@ -1104,7 +1105,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::drawRayTraced(RayTracer* pRayTracer, ShaderBindingTable* pShaderBindingTable)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto pVkBindngTable = pShaderBindingTable->as<VulkanShaderBindingTable>();
 			const auto raygenEntry = pVkBindngTable->getRayGenerationAddressRegion();
@@ -1117,21 +1118,21 @@ namespace Xenon
 
 		void VulkanCommandRecorder::compute(uint32_t width, uint32_t height, uint32_t depth)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pDevice->getDeviceTable().vkCmdDispatch(*m_pCurrentBuffer, width, height, depth);
 		}
 
 		void VulkanCommandRecorder::endQuery(OcclusionQuery* pOcclusionQuery, uint32_t index)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pDevice->getDeviceTable().vkCmdEndQuery(*m_pCurrentBuffer, pOcclusionQuery->as<VulkanOcclusionQuery>()->getQueryPool(), index);
 		}
 
 		void VulkanCommandRecorder::executeChild(CommandRecorder* pChildRecorder, RasterizingPipeline* pActivePipeline)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto lock = std::scoped_lock(m_Mutex);
 
@@ -1141,7 +1142,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::executeChild(CommandRecorder* pChildRecorder, RayTracingPipeline* pActivePipeline)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			auto lock = std::scoped_lock(m_Mutex);
 
@@ -1151,12 +1152,12 @@ namespace Xenon
 
 		void VulkanCommandRecorder::getQueryResults(OcclusionQuery* pOcclusionQuery)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 		}
 
 		void VulkanCommandRecorder::buildAccelerationStructure(const VkAccelerationStructureBuildGeometryInfoKHR& geometryInfo, const std::vector<VkAccelerationStructureBuildRangeInfoKHR*>& buildRanges)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pDevice->getDeviceTable().vkCmdBuildAccelerationStructuresKHR(
 				*m_pCurrentBuffer,
@@ -1167,7 +1168,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::end()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Unbind the previous render pass if we need to.
 			if (m_IsRenderTargetBound)
@@ -1181,14 +1182,14 @@ namespace Xenon
 
 		void VulkanCommandRecorder::next()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pCurrentBuffer = &m_CommandBuffers[incrementIndex()];
 		}
 
 		void VulkanCommandRecorder::submit(Swapchain* pSwapchain /*= nullptr*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			switch (m_Usage)
 			{
@@ -1216,7 +1217,7 @@ namespace Xenon
 
 		void VulkanCommandRecorder::wait(uint64_t timeout /*= UINT64_MAX*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pCurrentBuffer->wait(timeout);
 		}
@@ -5,8 +5,7 @@
 #include "VulkanMacros.hpp"
 #include "VulkanCommandRecorder.hpp"
 #include "VulkanSwapchain.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -41,13 +40,15 @@ namespace Xenon
 
 		void VulkanCommandSubmitter::submit(const std::vector<std::vector<Backend::CommandRecorder*>>& pCommandRecorders, Swapchain* pSwapchain /*= nullptr*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
-			std::vector<VkSubmitInfo> submitInfos;
-			std::vector<std::vector<VkCommandBuffer>> commandBuffers;
-			std::vector<std::vector<VkPipelineStageFlags>> waitStageFlags;
-			std::vector<std::vector<VkSemaphore>> waitSemaphores;
-			std::vector<std::vector<VkSemaphore>> signalSemaphores;
+			// The nested vectors inherit the frame arena from the outer ones.
+			auto pFrameArena = &GetFrameArena();
+			auto submitInfos = std::pmr::vector<VkSubmitInfo>(pFrameArena);
+			auto commandBuffers = std::pmr::vector<std::pmr::vector<VkCommandBuffer>>(pFrameArena);
+			auto waitStageFlags = std::pmr::vector<std::pmr::vector<VkPipelineStageFlags>>(pFrameArena);
+			auto waitSemaphores = std::pmr::vector<std::pmr::vector<VkSemaphore>>(pFrameArena);
+			auto signalSemaphores = std::pmr::vector<std::pmr::vector<VkSemaphore>>(pFrameArena);
 
 			submitInfos.reserve(pCommandRecorders.size());
 			commandBuffers.reserve(pCommandRecorders.size());
@@ -73,7 +74,7 @@ namespace Xenon
 				auto& batchSignalSemaphores = signalSemaphores.emplace_back();
 				batchSignalSemaphores.reserve(pCommandRecorderBatch.size());
 
-				std::vector<VkPipelineStageFlags> waitFlags;
+				auto waitFlags = std::pmr::vector<VkPipelineStageFlags>(pFrameArena);
 				waitFlags.reserve(pCommandRecorderBatch.size());
 
 				auto& submitInfo = submitInfos.emplace_back();
@@ -123,7 +124,7 @@ namespace Xenon
 
 		void VulkanCommandSubmitter::wait(std::chrono::milliseconds timeout /*= std::chrono::milliseconds(UINT64_MAX)*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (m_bIsWaiting)
 			{
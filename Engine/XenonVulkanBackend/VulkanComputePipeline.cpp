@@ -5,8 +5,7 @@
 #include "VulkanMacros.hpp"
 #include "VulkanDescriptorSetManager.hpp"
 #include "VulkanDescriptor.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 // This magic number is used by the rasterizing pipeline to uniquely identify it's pipeline caches.
 constexpr auto g_MagicNumber = 0b0110010000111101101100100010100110111011101010111010111010000001;
@@ -57,7 +56,7 @@ namespace Xenon
 			GetShaderBindings(computeShader, m_BindingInfos, pushConstants);
 
 			// Generate the pipeline hash.
-			m_PipelineHash = GenerateHash(ToBytes(computeShader.getSPIRV().getBinary().data()), computeShader.getSPIRV().getBinary().size());
+			m_PipelineHash = Hasher().combine(computeShader.getSPIRV()).getHash();
 
 			// Create the pipeline layout.
 			createPipelineLayout(std::move(pushConstants));
@@ -81,7 +80,7 @@ namespace Xenon
 
 		std::unique_ptr<Xenon::Backend::Descriptor> VulkanComputePipeline::createDescriptor(DescriptorType type)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			return std::make_unique<VulkanDescriptor>(m_pDevice, m_BindingInfos, DescriptorType::UserDefined);
 		}
@@ -104,7 +103,7 @@ namespace Xenon
 
 		void VulkanComputePipeline::loadPipelineCache()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			std::vector<std::byte> cacheData;
 			if (m_pCacheHandler)
@@ -125,7 +124,7 @@ namespace Xenon
 
 		void VulkanComputePipeline::storePipelineCache()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (m_pCacheHandler)
 			{
@@ -145,7 +144,7 @@ namespace Xenon
 
 		void VulkanComputePipeline::createPipeline()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Setup the shader module.
 			VkPipelineShaderStageCreateInfo shaderStageCreateInfo = {};
@@ -7,8 +7,7 @@
 #include "VulkanBuffer.hpp"
 #include "VulkanImageView.hpp"
 #include "VulkanImageSampler.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -32,7 +31,7 @@ namespace Xenon
 
 		void VulkanDescriptor::attach(uint32_t binding, Buffer* pBuffer)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Skip if we don't have that binding. Might be because of shader optimizations.
 			if (!m_BindingInformation.contains(binding))
@@ -57,7 +56,7 @@ namespace Xenon
 
 		void VulkanDescriptor::attach(uint32_t binding, Image* pImage, ImageView* pView, ImageSampler* pSampler, ImageUsage usage)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Skip if we don't have that binding. Might be because of shader optimizations.
 			if (!m_BindingInformation.contains(binding))
@@ -3,8 +3,7 @@
 
 #include "VulkanDescriptorSetManager.hpp"
 #include "VulkanMacros.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace /* anonymous */
 {
@@ -83,7 +82,7 @@ namespace Xenon
 
 		VkDescriptorSetLayout VulkanDescriptorSetManager::getDescriptorSetLayout(const std::unordered_map<uint32_t, DescriptorBindingInfo>& bindingInfo)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// If the binding info is empty, return the dummy descriptor set layout.
 			if (bindingInfo.empty())
@@ -149,7 +148,7 @@ namespace Xenon
 
 		std::pair<VkDescriptorPool, VkDescriptorSet> VulkanDescriptorSetManager::createDescriptorSet(const std::unordered_map<uint32_t, DescriptorBindingInfo>& bindingInfo)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// If the binding info is empty, return the dummy descriptor set layout.
 			if (bindingInfo.empty())
@@ -265,7 +264,7 @@ namespace Xenon
 
 		void VulkanDescriptorSetManager::freeDescriptorSet(VkDescriptorPool pool, VkDescriptorSet descriptorSet, const std::unordered_map<uint32_t, DescriptorBindingInfo>& bindingInfo)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Skip if we're talking about the dummy descriptor set.
 			if (descriptorSet == m_DummyDescriptorSet)
@@ -300,8 +299,12 @@ namespace Xenon
 
 		uint64_t VulkanDescriptorSetManager::getBindingInfoHash(const std::unordered_map<uint32_t, DescriptorBindingInfo>& bindingInfo) const
 		{
-			const auto bindingInfoVector = std::vector<std::pair<uint32_t, DescriptorBindingInfo>>(bindingInfo.begin(), bindingInfo.end());
-			return GenerateHash(ToBytes(bindingInfoVector.data()), bindingInfoVector.size() * sizeof(std::pair<uint32_t, DescriptorBindingInfo>));
+			// The iteration order of the map depends on it's insertion history, so the per-binding hashes are combined in an order independent way.
+			uint64_t bindingHashSum = 0;
+			for (const auto& [binding, info] : bindingInfo)
+				bindingHashSum += Hasher().combine(binding, info.m_ApplicableShaders, info.m_Type).getHash();
+
+			return Hasher().combine(static_cast<uint64_t>(bindingInfo.size()), bindingHashSum).getHash();
 		}
 	}
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "VulkanDeviceBoundObject.hpp"
 
+#include "../XenonCore/FlatHashMap.hpp"
+
 #include <unordered_map>
 
 namespace Xenon
@@ -78,7 +80,7 @@ namespace Xenon
 			XENON_NODISCARD uint64_t getBindingInfoHash(const std::unordered_map<uint32_t, DescriptorBindingInfo>& bindingInfo) const;
 
 		private:
-			std::unordered_map<uint64_t, VulkanDescriptorStorage> m_DescriptorSetStorages;
+			FlatHashMap<uint64_t, VulkanDescriptorStorage> m_DescriptorSetStorages;
 
 			VkDescriptorSetLayout m_DummyDescriptorSetLayout = VK_NULL_HANDLE;
 			VkDescriptorPool m_DummyDescriptorPool = VK_NULL_HANDLE;
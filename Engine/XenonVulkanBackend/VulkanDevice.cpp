@@ -4,8 +4,7 @@
 #include "VulkanDevice.hpp"
 #include "VulkanMacros.hpp"
 #include "VulkanDescriptorSetManager.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 #include <set>
 
@@ -202,7 +201,7 @@ namespace Xenon
 
 		void VulkanDevice::waitIdle()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_DeviceTable.vkDeviceWaitIdle(m_LogicalDevice);
 
@@ -576,19 +575,25 @@ namespace Xenon
 			if (computeFamily != static_cast<uint32_t>(-1))
 			{
 				m_ComputeQueueIndex = static_cast<uint8_t>(m_Queues.size());
-				m_Queues.emplace_back().getUnsafe().setFamily(computeFamily);
+				auto& queue = m_Queues.emplace_back();
+				queue.setName("Compute Queue");
+				queue.getUnsafe().setFamily(computeFamily);
 			}
 
 			if (graphicsFamily != static_cast<uint32_t>(-1) && graphicsFamily != computeFamily)
 			{
 				m_GraphicsQueueIndex = static_cast<uint8_t>(m_Queues.size());
-				m_Queues.emplace_back().getUnsafe().setFamily(graphicsFamily);
+				auto& queue = m_Queues.emplace_back();
+				queue.setName("Graphics Queue");
+				queue.getUnsafe().setFamily(graphicsFamily);
 			}
 
 			if (transferFamily != static_cast<uint32_t>(-1) && transferFamily != computeFamily && transferFamily != graphicsFamily)
 			{
 				m_TransferQueueIndex = static_cast<uint8_t>(m_Queues.size());
-				m_Queues.emplace_back().getUnsafe().setFamily(transferFamily);
+				auto& queue = m_Queues.emplace_back();
+				queue.setName("Transfer Queue");
+				queue.getUnsafe().setFamily(transferFamily);
 			}
 		}
 
@@ -712,6 +717,7 @@ namespace Xenon
 
 			// Create the allocator.
 			XENON_VK_ASSERT(vmaCreateAllocator(&createInfo, &m_Allocator.getUnsafe()), "Failed to create the allocator!");
+			m_Allocator.setName("VMA Allocator");
 		}
 	}
 }
\ No newline at end of file
@@ -5,8 +5,7 @@
 #include "VulkanMacros.hpp"
 #include "VulkanCommandRecorder.hpp"
 #include "VulkanBuffer.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -176,7 +175,7 @@ namespace Xenon
 
 		void VulkanImage::copyFrom(Buffer* pSrcBuffer, CommandRecorder* pCommandRecorder /*= nullptr*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (pCommandRecorder)
 			{
@@ -213,7 +212,7 @@ namespace Xenon
 
 		void VulkanImage::copyFrom(Image* pSrcImage, CommandRecorder* pCommandRecorder /*= nullptr*/)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (pCommandRecorder)
 			{
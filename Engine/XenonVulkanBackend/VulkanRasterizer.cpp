@@ -3,8 +3,7 @@
 
 #include "VulkanRasterizer.hpp"
 #include "VulkanMacros.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 namespace Xenon
 {
@@ -39,7 +38,7 @@ namespace Xenon
 
 		Xenon::Backend::Image* VulkanRasterizer::getImageAttachment(AttachmentType type)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (m_AttachmentTypes & type)
 			{
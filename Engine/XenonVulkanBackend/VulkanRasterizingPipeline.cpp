@@ -6,8 +6,7 @@
 #include "VulkanRasterizer.hpp"
 #include "VulkanDescriptorSetManager.hpp"
 #include "VulkanDescriptor.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 #include <algorithm>
 
@@ -872,7 +871,7 @@ namespace Xenon
 			for (const auto& info : m_ShaderStageCreateInfo)
 				m_pDevice->getDeviceTable().vkDestroyShaderModule(m_pDevice->getLogicalDevice(), info.module, nullptr);
 
-			for (const auto& [hash, pipeline] : m_Pipelines)
+			for (const auto& [hash, pipeline] : m_Pipelines.getUnsafe())
 			{
 				m_pDevice->getDeviceTable().vkDestroyPipelineCache(m_pDevice->getLogicalDevice(), pipeline.m_PipelineCache, nullptr);
 				m_pDevice->getDeviceTable().vkDestroyPipeline(m_pDevice->getLogicalDevice(), pipeline.m_Pipeline, nullptr);
@@ -883,75 +882,88 @@ namespace Xenon
 
 		std::unique_ptr<Xenon::Backend::Descriptor> VulkanRasterizingPipeline::createDescriptor(DescriptorType type)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 			return std::make_unique<VulkanDescriptor>(m_pDevice, m_BindingMap[type], type);
 		}
 
 		const VulkanRasterizingPipeline::PipelineStorage& VulkanRasterizingPipeline::getPipeline(const VertexSpecification& vertexSpecification)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			const auto hash = vertexSpecification.generateHash();
 
-			auto lock = std::scoped_lock(m_Mutex);
-			if (!m_Pipelines.contains(hash))
-			{
-				auto& pipeline = m_Pipelines[hash];
-
-				// Load the pipeline cache.
-				loadPipelineCache(hash, pipeline);
+			// Most of the time the pipeline already exists, so look it up using a shared lock first.
+			const auto pExistingPipeline = m_Pipelines.read([hash](const auto& pipelines) -> const PipelineStorage*
+				{
+					const auto itr = pipelines.find(hash);
+					return itr != pipelines.end() ? &itr->second : nullptr;
+				});
 
-				// Setup the inputs.
-				pipeline.m_InputBindingDescriptions = m_VertexInputBindings;
-				pipeline.m_InputAttributeDescriptions = m_VertexInputAttributes;
+			if (pExistingPipeline)
+				return *pExistingPipeline;
 
-				bool hasVertexData = false;
-				for (auto& attribute : pipeline.m_InputAttributeDescriptions)
+			// Else create the pipeline. Someone else might have created it after we checked, so we need to check again.
+			return m_Pipelines.write([this, hash, &vertexSpecification](auto& pipelines) -> const PipelineStorage&
 				{
-					// Continue if we're in instance data.
-					if (attribute.binding == 1)
-						continue;
-
-					const auto element = static_cast<InputElement>(attribute.location);
-					if (vertexSpecification.isAvailable(element))
+					if (!pipelines.contains(hash))
 					{
-						attribute.offset = vertexSpecification.offsetOf(element);
-						attribute.format = GetElementFormat(
-							GetAttributeDataTypeComponentCount(vertexSpecification.getElementAttributeDataType(element)),
-							vertexSpecification.getElementComponentDataType(element)
-						);
-
-						hasVertexData = true;
+						auto& pipeline = pipelines[hash];
+
+						// Load the pipeline cache.
+						loadPipelineCache(hash, pipeline);
+
+						// Setup the inputs.
+						pipeline.m_InputBindingDescriptions = m_VertexInputBindings;
+						pipeline.m_InputAttributeDescriptions = m_VertexInputAttributes;
+
+						bool hasVertexData = false;
+						for (auto& attribute : pipeline.m_InputAttributeDescriptions)
+						{
+							// Continue if we're in instance data.
+							if (attribute.binding == 1)
+								continue;
+
+							const auto element = static_cast<InputElement>(attribute.location);
+							if (vertexSpecification.isAvailable(element))
+							{
+								attribute.offset = vertexSpecification.offsetOf(element);
+								attribute.format = GetElementFormat(
+									GetAttributeDataTypeComponentCount(vertexSpecification.getElementAttributeDataType(element)),
+									vertexSpecification.getElementComponentDataType(element)
+								);
+
+								hasVertexData = true;
+							}
+						}
+
+						// Sort the inputs.
+						XENON_RANGES(sort, pipeline.m_InputAttributeDescriptions, [](const auto& lhs, const auto& rhs) { return lhs.offset < rhs.offset; });
+
+						// Setup the input bindings if we have vertex data (stride is not 0).
+						if (hasVertexData)
+						{
+							auto& binding = pipeline.m_InputBindingDescriptions.emplace_back();
+							binding.binding = 0;
+							binding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+							binding.stride = vertexSpecification.getSize();
+						}
+
+						// Create the pipeline.
+						createPipeline(pipeline);
+
+						// Save the pipeline cache.
+						savePipelineCache(hash, pipeline);
 					}
-				}
-
-				// Sort the inputs.
-				XENON_RANGES(sort, pipeline.m_InputAttributeDescriptions, [](const auto& lhs, const auto& rhs) { return lhs.offset < rhs.offset; });
-
-				// Setup the input bindings if we have vertex data (stride is not 0).
-				if (hasVertexData)
-				{
-					auto& binding = pipeline.m_InputBindingDescriptions.emplace_back();
-					binding.binding = 0;
-					binding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-					binding.stride = vertexSpecification.getSize();
-				}
-
-				// Create the pipeline.
-				createPipeline(pipeline);
-
-				// Save the pipeline cache.
-				savePipelineCache(hash, pipeline);
-			}
 
-			return m_Pipelines[hash];
+					return pipelines[hash];
+				});
 		}
 
 		void VulkanRasterizingPipeline::recreate()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
-			for (auto& [hash, pipeline] : m_Pipelines)
+			for (auto& [hash, pipeline] : m_Pipelines.getUnsafe())
 			{
 				createPipeline(pipeline);
 				savePipelineCache(hash, pipeline);
@@ -960,7 +972,7 @@ namespace Xenon
 
 		void VulkanRasterizingPipeline::createPipelineLayout(const std::array<VkDescriptorSetLayout, 4>& layouts, std::vector<VkPushConstantRange>&& pushConstantRanges)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			VkPipelineLayoutCreateInfo createInfo = {};
 			createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
@@ -976,7 +988,7 @@ namespace Xenon
 
 		void VulkanRasterizingPipeline::loadPipelineCache(uint64_t hash, PipelineStorage& pipeline) const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			std::vector<std::byte> cacheData;
 			if (m_pCacheHandler)
@@ -1012,7 +1024,7 @@ namespace Xenon
 
 		void VulkanRasterizingPipeline::savePipelineCache(uint64_t hash, PipelineStorage& pipeline) const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (m_pCacheHandler)
 			{
@@ -1032,7 +1044,7 @@ namespace Xenon
 
 		void VulkanRasterizingPipeline::setupPipelineInfo()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Input assembly state.
 			m_InputAssemblyStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
@@ -1142,7 +1154,7 @@ namespace Xenon
 
 		void VulkanRasterizingPipeline::createPipeline(PipelineStorage& pipeline) const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (pipeline.m_Pipeline != VK_NULL_HANDLE)
 				m_pDevice->getDeviceTable().vkDestroyPipeline(m_pDevice->getLogicalDevice(), pipeline.m_Pipeline, nullptr);
@@ -7,6 +7,8 @@
 
 #include "VulkanDeviceBoundObject.hpp"
 
+#include "../XenonCore/RWMutex.hpp"
+
 namespace Xenon
 {
 	namespace Backend
@@ -125,10 +127,8 @@ namespace Xenon
 			VkPipelineDepthStencilStateCreateInfo m_DepthStencilStateCreateInfo = {};
 			VkPipelineDynamicStateCreateInfo m_DynamicStateCreateInfo = {};
 
-			std::mutex m_Mutex;
-
 			std::unordered_map<DescriptorType, std::unordered_map<uint32_t, DescriptorBindingInfo>> m_BindingMap;
-			std::unordered_map<uint64_t, PipelineStorage> m_Pipelines;
+			RWMutex<std::unordered_map<uint64_t, PipelineStorage>> m_Pipelines;
 
 			std::vector<VkVertexInputBindingDescription> m_VertexInputBindings;
 			std::vector<VkVertexInputAttributeDescription> m_VertexInputAttributes;
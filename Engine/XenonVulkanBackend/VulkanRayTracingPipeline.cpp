@@ -6,8 +6,7 @@
 #include "VulkanDescriptorSetManager.hpp"
 #include "VulkanDescriptor.hpp"
 #include "VulkanShaderBindingTable.hpp"
-
-#include <optick.h>
+#include "../XenonCore/Tracer.hpp"
 
 // This magic number is used by the ray tracing pipeline to uniquely identify it's pipeline caches.
 constexpr uint64_t g_MagicNumber = 0b0010010010111100111000101101010101000110100101011100011100101000;
@@ -53,7 +52,7 @@ namespace Xenon
 			: RayTracingPipeline(pDevice, std::move(pCacheHandler), specification)
 			, VulkanDeviceBoundObject(pDevice)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Resolve shader groups.
 			uint64_t rayGenCount = 0;
@@ -66,7 +65,8 @@ namespace Xenon
 			std::vector<VkPipelineShaderStageCreateInfo> shaderStages;
 			std::vector<VkRayTracingShaderGroupCreateInfoKHR> vkShaderGroups;
 
-			std::vector<uint64_t> shaderHashes = { specification.m_MaxRayRecursionDepth, specification.m_MaxPayloadSize, specification.m_MaxAttributeSize };
+			Hasher pipelineHasher;
+			pipelineHasher.combine(specification.m_MaxRayRecursionDepth, specification.m_MaxPayloadSize, specification.m_MaxAttributeSize);
 			for (const auto& group : specification.m_ShaderGroups)
 			{
 				auto& vkShaderGroup = vkShaderGroups.emplace_back();
@@ -79,7 +79,7 @@ namespace Xenon
 				if (group.m_RayGenShader.getSPIRV().isValid())
 				{
 					GetShaderBindings(group.m_RayGenShader, m_BindingMap, ShaderType::RayGen);
-					shaderHashes.emplace_back(GenerateHash(ToBytes(group.m_RayGenShader.getSPIRV().getBinaryData()), group.m_RayGenShader.getSPIRV().getBinarySizeInBytes()));
+					pipelineHasher.combine(group.m_RayGenShader.getSPIRV());
 					shaderStages.emplace_back(createShaderStage(group.m_RayGenShader, VK_SHADER_STAGE_RAYGEN_BIT_KHR));
 					vkShaderGroup.type = VK_RAY_TRACING_SHADER_GROUP_TYPE_GENERAL_KHR;
 					vkShaderGroup.generalShader = static_cast<uint32_t>(shaderStages.size()) - 1;
@@ -89,7 +89,7 @@ namespace Xenon
 				if (group.m_IntersectionShader.getSPIRV().isValid())
 				{
 					GetShaderBindings(group.m_IntersectionShader, m_BindingMap, ShaderType::Intersection);
-					shaderHashes.emplace_back(GenerateHash(ToBytes(group.m_IntersectionShader.getSPIRV().getBinaryData()), group.m_IntersectionShader.getSPIRV().getBinarySizeInBytes()));
+					pipelineHasher.combine(group.m_IntersectionShader.getSPIRV());
 					shaderStages.emplace_back(createShaderStage(group.m_IntersectionShader, VK_SHADER_STAGE_INTERSECTION_BIT_KHR));
 					vkShaderGroup.type = VK_RAY_TRACING_SHADER_GROUP_TYPE_PROCEDURAL_HIT_GROUP_KHR;
 					vkShaderGroup.intersectionShader = static_cast<uint32_t>(shaderStages.size()) - 1;
@@ -99,7 +99,7 @@ namespace Xenon
 				if (group.m_AnyHitShader.getSPIRV().isValid())
 				{
 					GetShaderBindings(group.m_AnyHitShader, m_BindingMap, ShaderType::AnyHit);
-					shaderHashes.emplace_back(GenerateHash(ToBytes(group.m_AnyHitShader.getSPIRV().getBinaryData()), group.m_AnyHitShader.getSPIRV().getBinarySizeInBytes()));
+					pipelineHasher.combine(group.m_AnyHitShader.getSPIRV());
 					shaderStages.emplace_back(createShaderStage(group.m_AnyHitShader, VK_SHADER_STAGE_ANY_HIT_BIT_KHR));
 					vkShaderGroup.type = VK_RAY_TRACING_SHADER_GROUP_TYPE_TRIANGLES_HIT_GROUP_KHR;
 					vkShaderGroup.anyHitShader = static_cast<uint32_t>(shaderStages.size()) - 1;
@@ -109,7 +109,7 @@ namespace Xenon
 				if (group.m_ClosestHitShader.getSPIRV().isValid())
 				{
 					GetShaderBindings(group.m_ClosestHitShader, m_BindingMap, ShaderType::ClosestHit);
-					shaderHashes.emplace_back(GenerateHash(ToBytes(group.m_ClosestHitShader.getSPIRV().getBinaryData()), group.m_ClosestHitShader.getSPIRV().getBinarySizeInBytes()));
+					pipelineHasher.combine(group.m_ClosestHitShader.getSPIRV());
 					shaderStages.emplace_back(createShaderStage(group.m_ClosestHitShader, VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR));
 					vkShaderGroup.type = VK_RAY_TRACING_SHADER_GROUP_TYPE_TRIANGLES_HIT_GROUP_KHR;
 					vkShaderGroup.closestHitShader = static_cast<uint32_t>(shaderStages.size()) - 1;
@@ -119,7 +119,7 @@ namespace Xenon
 				if (group.m_MissShader.getSPIRV().isValid())
 				{
 					GetShaderBindings(group.m_MissShader, m_BindingMap, ShaderType::Miss);
-					shaderHashes.emplace_back(GenerateHash(ToBytes(group.m_MissShader.getSPIRV().getBinaryData()), group.m_MissShader.getSPIRV().getBinarySizeInBytes()));
+					pipelineHasher.combine(group.m_MissShader.getSPIRV());
 					shaderStages.emplace_back(createShaderStage(group.m_MissShader, VK_SHADER_STAGE_MISS_BIT_KHR));
 					vkShaderGroup.type = VK_RAY_TRACING_SHADER_GROUP_TYPE_GENERAL_KHR;
 					vkShaderGroup.generalShader = static_cast<uint32_t>(shaderStages.size()) - 1;
@@ -129,7 +129,7 @@ namespace Xenon
 				if (group.m_CallableShader.getSPIRV().isValid())
 				{
 					GetShaderBindings(group.m_CallableShader, m_BindingMap, ShaderType::Callable);
-					shaderHashes.emplace_back(GenerateHash(ToBytes(group.m_CallableShader.getSPIRV().getBinaryData()), group.m_CallableShader.getSPIRV().getBinarySizeInBytes()));
+					pipelineHasher.combine(group.m_CallableShader.getSPIRV());
 					shaderStages.emplace_back(createShaderStage(group.m_CallableShader, VK_SHADER_STAGE_CALLABLE_BIT_KHR));
 					vkShaderGroup.type = VK_RAY_TRACING_SHADER_GROUP_TYPE_GENERAL_KHR;
 					vkShaderGroup.generalShader = static_cast<uint32_t>(shaderStages.size()) - 1;
@@ -138,7 +138,7 @@ namespace Xenon
 			}
 
 			// Get the pipeline hash.
-			m_PipelineHash = GenerateHash(ToBytes(shaderHashes.data()), sizeof(uint64_t) * shaderHashes.size());
+			m_PipelineHash = pipelineHasher.getHash();
 
 			// Get the layouts.
 			const std::array<VkDescriptorSetLayout, 4> layouts = {
@@ -170,13 +170,13 @@ namespace Xenon
 
 		std::unique_ptr<Xenon::Backend::Descriptor> VulkanRayTracingPipeline::createDescriptor(DescriptorType type)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 			return std::make_unique<VulkanDescriptor>(m_pDevice, m_BindingMap[type], type);
 		}
 
 		std::unique_ptr<ShaderBindingTable> VulkanRayTracingPipeline::createShaderBindingTable(const std::vector<BindingGroup>& bindingGroups)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 			return std::make_unique<VulkanShaderBindingTable>(m_pDevice, this, bindingGroups);
 		}
 
@@ -196,7 +196,7 @@ namespace Xenon
 
 		void VulkanRayTracingPipeline::loadPipelineCache()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			std::vector<std::byte> cacheData;
 			if (m_pCacheHandler)
@@ -217,7 +217,7 @@ namespace Xenon
 
 		void VulkanRayTracingPipeline::storePipelineCache()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			if (m_pCacheHandler)
 			{
@@ -237,7 +237,7 @@ namespace Xenon
 
 		VkPipelineShaderStageCreateInfo VulkanRayTracingPipeline::createShaderStage(const Shader& source, VkShaderStageFlagBits shaderStage) const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			VkShaderModuleCreateInfo shaderModuleCreateInfo = {};
 			shaderModuleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
@@ -263,7 +263,7 @@ namespace Xenon
 
 		void VulkanRayTracingPipeline::createPipeline(std::vector<VkPipelineShaderStageCreateInfo>&& shaderStageCreateInfos, std::vector<VkRayTracingShaderGroupCreateInfoKHR>&& shaderGroups)
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			VkRayTracingPipelineCreateInfoKHR createInfo = {};
 			createInfo.sType = VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR;
@@ -11,11 +11,10 @@
 #include <SDL3/SDL_vulkan.h>
 
 #include "../XenonPlatformLinux/LinuxWindow.hpp"
+#include "../XenonCore/Tracer.hpp"
 
 #endif // defined(XENON_PLATFORM_WINDOWS)
 
-#include <optick.h>
-
 namespace Xenon
 {
 	namespace Backend
@@ -47,7 +46,7 @@ namespace Xenon
 
 		uint32_t VulkanSwapchain::prepare()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// If the application is minimized, return the previous image index.
 			if (!isRenderable())
@@ -79,7 +78,7 @@ namespace Xenon
 
 		void VulkanSwapchain::present()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Present if the application isn't minimized.
 			if (isRenderable())
@@ -114,7 +113,7 @@ namespace Xenon
 
 		void VulkanSwapchain::recreate()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			clear();
 
@@ -124,7 +123,7 @@ namespace Xenon
 
 		void VulkanSwapchain::createSurface()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 #if defined(XENON_PLATFORM_WINDOWS)
 			VkWin32SurfaceCreateInfoKHR createInfo = {};
@@ -148,7 +147,7 @@ namespace Xenon
 
 		void VulkanSwapchain::createSwapchain()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			// Get the surface capabilities.
 			const auto surfaceCapabilities = getSurfaceCapabilities();
@@ -270,7 +269,7 @@ namespace Xenon
 
 		void VulkanSwapchain::setupImageViews()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			VkImageViewCreateInfo createInfo = {};
 			createInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
@@ -298,7 +297,7 @@ namespace Xenon
 
 		void VulkanSwapchain::clear()
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			m_pDevice->getDeviceTable().vkDeviceWaitIdle(m_pDevice->getLogicalDevice());
 
@@ -314,7 +313,7 @@ namespace Xenon
 
 		VkSurfaceCapabilitiesKHR VulkanSwapchain::getSurfaceCapabilities() const
 		{
-			OPTICK_EVENT();
+			XENON_TRACE_SCOPE();
 
 			VkSurfaceCapabilitiesKHR capabilities = {};
 			XENON_VK_ASSERT(vkGetPhysicalDeviceSurfaceCapabilitiesKHR(m_pDevice->getPhysicalDevice(), m_Surface, &capabilities), "Failed to get the surface capabilities!");
@@ -12,12 +12,14 @@ void run()
 
 int main()
 {
+	Xenon::AsyncLogger::Start();
 	StudioConfiguration::GetInstance().load("StudioConfig.bin");
 
 	while (!StudioConfiguration::GetInstance().shouldExitApplication())
 		run();
 
 	StudioConfiguration::GetInstance().save("StudioConfig.bin");
+	Xenon::AsyncLogger::Stop();
 
 	return 0;
 }
\ No newline at end of file
@@ -243,7 +243,7 @@ void Studio::render()
 			};
 
 			models++;
-			Xenon::XObject::GetJobSystem().insert(loaderFunction);
+			Xenon::XObject::GetJobSystem().insertIODetached(loaderFunction);
 		}
 
 		// Show and update the light sources.
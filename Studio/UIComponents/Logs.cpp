@@ -7,6 +7,13 @@
 
 void Logs::begin(std::chrono::nanoseconds delta)
 {
+	// Move the messages logged since the last frame.
+	while (auto message = m_PendingMessages.tryPop())
+		m_Messages.emplace_back(std::move(message.value()));
+
+	if (const auto droppedCount = m_DroppedMessageCount.exchange(0, std::memory_order_relaxed); droppedCount > 0)
+		m_Messages.emplace_back(fmt::format("{} log messages were dropped.", droppedCount), spdlog::level::warn);
+
 	if (m_bIsOpen)
 	{
 		if (ImGui::Begin("Logs", &m_bIsOpen))
@@ -50,7 +57,10 @@ void Logs::sink_it_(const spdlog::details::log_msg& msg)
 {
 	spdlog::memory_buf_t formatted;
 	spdlog::sinks::base_sink<std::mutex>::formatter_->format(msg, formatted);
-	m_Messages.emplace_back(fmt::to_string(formatted), msg.level);
+
+	// Drop the message if the UI thread has fallen behind, since blocking here might stall the UI thread itself.
+	if (!m_PendingMessages.tryPush(Message(fmt::to_string(formatted), msg.level)))
+		m_DroppedMessageCount.fetch_add(1, std::memory_order_relaxed);
 }
 
 void Logs::flush_()
@@ -5,6 +5,8 @@
 
 #include "../UIComponent.hpp"
 
+#include "XenonCore/SPSCQueue.hpp"
+
 #include <spdlog/sinks/base_sink.h>
 
 #include <vector>
@@ -12,14 +14,23 @@
 /**
  * Logs class.
  * This UI component displays logs sent using a custom spdlog sink.
+ * The sink can be called from any thread, so the messages are passed to the UI thread through a single producer queue (the sink's
+ * mutex makes sure that only one thread pushes at a time).
  */
 class Logs final : public UIComponent, public spdlog::sinks::base_sink<std::mutex>
 {
+	using Message = std::pair<std::string, spdlog::level::level_enum>;
+
+	/**
+	 * The maximum number of messages which can be logged in between two frames.
+	 */
+	static constexpr uint64_t PendingMessageCapacity = 1024;
+
 public:
 	/**
 	 * Default constructor.
 	 */
-	Logs() = default;
+	Logs() : m_PendingMessages(PendingMessageCapacity) {}
 
 	/**
 	 * Begin the component draw.
@@ -47,5 +58,7 @@ private:
 	void flush_() override;
 
 private:
-	std::vector<std::pair<std::string, spdlog::level::level_enum>> m_Messages;
+	std::vector<Message> m_Messages;
+	Xenon::SPSCQueue<Message> m_PendingMessages;
+	std::atomic_uint64_t m_DroppedMessageCount = 0;
 };
\ No newline at end of file
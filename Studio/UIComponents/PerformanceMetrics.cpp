@@ -3,7 +3,9 @@
 
 #include "PerformanceMetrics.hpp"
 
-#include "XenonCore/Common.hpp"
+#include "XenonCore/XObject.hpp"
+#include "XenonCore/LockStatistics.hpp"
+#include "XenonCore/Tracer.hpp"
 
 #include <imgui.h>
 
@@ -31,6 +33,24 @@ void PerformanceMetrics::begin(std::chrono::nanoseconds delta)
 			ImGui::Text("Total draw call count: %u", m_TotalDrawCount);
 			ImGui::Text("Actual draw call count: %u", m_ActualDrawCount);
 			ImGui::Text("Occluded draw count: %u", m_TotalDrawCount - m_ActualDrawCount);
+			ImGui::Spacing();
+
+			// Show the job system statistics.
+			ImGui::Text("Job System");
+			ImGui::Separator();
+			showJobSystemStatistics();
+			ImGui::Spacing();
+
+			// Show the lock statistics.
+			ImGui::Text("Locks");
+			ImGui::Separator();
+			showLockStatistics();
+			ImGui::Spacing();
+
+			// Show the trace capture controls.
+			ImGui::Text("Trace");
+			ImGui::Separator();
+			showTraceCapture();
 		}
 
 		ImGui::End();
@@ -46,3 +66,114 @@ void PerformanceMetrics::setDrawCallCount(uint64_t totalCount, uint64_t actualCo
 	m_TotalDrawCount = totalCount;
 	m_ActualDrawCount = actualCount;
 }
+
+void PerformanceMetrics::showJobSystemStatistics() const
+{
+#ifdef XENON_ENABLE_JOB_STATISTICS
+	using Count = unsigned long long;
+
+	const auto statistics = Xenon::XObject::GetJobSystem().getStatistics();
+	const auto total = statistics.getTotal();
+
+	ImGui::Text("Executed jobs: %llu", static_cast<Count>(total.m_ExecutedJobs));
+	ImGui::Text("Average job latency: %.3f us", total.getAverageLatency().count() / 1000.0f);
+	ImGui::Text("Successful steals: %llu / %llu", static_cast<Count>(total.m_SuccessfulSteals), static_cast<Count>(total.m_StealAttempts));
+	ImGui::Text("Injection queue high water mark: %llu", static_cast<Count>(statistics.m_InjectionQueueHighWaterMark));
+
+	// Show the per-thread statistics. The first column (the thread name) is set by the caller.
+	const auto showColumns = [](const Xenon::JobWorkerStatistics& worker)
+	{
+		ImGui::TableNextColumn(); ImGui::Text("%llu", static_cast<Count>(worker.m_ExecutedJobs));
+		ImGui::TableNextColumn(); ImGui::Text("%.1f%%", worker.getUtilization() * 100.0f);
+		ImGui::TableNextColumn(); ImGui::Text("%.3f us", worker.getAverageLatency().count() / 1000.0f);
+		ImGui::TableNextColumn(); ImGui::Text("%llu / %llu", static_cast<Count>(worker.m_SuccessfulSteals), static_cast<Count>(worker.m_StealAttempts));
+		ImGui::TableNextColumn(); ImGui::Text("%llu", static_cast<Count>(worker.m_QueueDepthHighWaterMark));
+	};
+
+	if (ImGui::BeginTable("Job Workers", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+	{
+		ImGui::TableSetupColumn("Thread");
+		ImGui::TableSetupColumn("Jobs");
+		ImGui::TableSetupColumn("Utilization");
+		ImGui::TableSetupColumn("Latency");
+		ImGui::TableSetupColumn("Steals");
+		ImGui::TableSetupColumn("Queue Peak");
+		ImGui::TableHeadersRow();
+
+		for (uint64_t i = 0; i < statistics.m_Workers.size(); i++)
+		{
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn(); ImGui::Text("Worker %llu", static_cast<Count>(i));
+			showColumns(statistics.m_Workers[i]);
+		}
+
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn(); ImGui::Text("I/O Workers");
+		showColumns(statistics.m_IOWorkers);
+
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn(); ImGui::Text("Helpers");
+		showColumns(statistics.m_Helpers);
+
+		ImGui::EndTable();
+	}
+
+	if (ImGui::Button("Reset Job Statistics"))
+		Xenon::XObject::GetJobSystem().resetStatistics();
+
+#else
+	ImGui::Text("Job statistics are disabled in this build.");
+
+#endif
+}
+
+void PerformanceMetrics::showLockStatistics() const
+{
+#ifdef XENON_ENABLE_LOCK_STATISTICS
+	using Count = unsigned long long;
+
+	// The statistics are sorted by the wait time, so the most contended locks are shown first.
+	if (ImGui::BeginTable("Locks", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY, ImVec2(0.0f, 200.0f)))
+	{
+		ImGui::TableSetupColumn("Name");
+		ImGui::TableSetupColumn("Acquisitions");
+		ImGui::TableSetupColumn("Contended");
+		ImGui::TableSetupColumn("Contention");
+		ImGui::TableSetupColumn("Wait Time");
+		ImGui::TableHeadersRow();
+
+		for (const auto& lock : Xenon::LockCounters::GetAllStatistics())
+		{
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn(); ImGui::Text("%s", lock.m_Name.c_str());
+			ImGui::TableNextColumn(); ImGui::Text("%llu", static_cast<Count>(lock.m_Acquisitions));
+			ImGui::TableNextColumn(); ImGui::Text("%llu", static_cast<Count>(lock.m_ContendedAcquisitions));
+			ImGui::TableNextColumn(); ImGui::Text("%.1f%%", lock.getContentionRate() * 100.0f);
+			ImGui::TableNextColumn(); ImGui::Text("%.3f ms", lock.m_WaitTime.count() / 1000000.0f);
+		}
+
+		ImGui::EndTable();
+	}
+
+	if (ImGui::Button("Reset Lock Statistics"))
+		Xenon::LockCounters::ResetAll();
+
+#else
+	ImGui::Text("Lock statistics are disabled in this build.");
+
+#endif
+}
+
+void PerformanceMetrics::showTraceCapture()
+{
+	ImGui::SliderInt("Frame count", &m_TraceFrameCount, 1, 120);
+
+	// The trace is written to the working directory once the frames are recorded.
+	if (Xenon::Tracer::IsCapturingFrames())
+		ImGui::Text("Capturing...");
+
+	else if (ImGui::Button("Capture Trace"))
+		Xenon::Tracer::CaptureFrames(static_cast<uint32_t>(m_TraceFrameCount), "XenonStudioTrace.json");
+
+	ImGui::Text("The trace can be opened using chrome://tracing or https://ui.perfetto.dev.");
+}
@@ -39,9 +39,27 @@ public:
 	 */
 	void setDrawCallCount(uint64_t totalCount, uint64_t actualCount);
 
+private:
+	/**
+	 * Show the job system statistics.
+	 */
+	void showJobSystemStatistics() const;
+
+	/**
+	 * Show the lock contention statistics.
+	 */
+	void showLockStatistics() const;
+
+	/**
+	 * Show the trace capture controls.
+	 */
+	void showTraceCapture();
+
 private:
 	std::vector<float> m_FrameRates = std::vector<float>(10);
 
 	uint64_t m_TotalDrawCount = 0;
 	uint64_t m_ActualDrawCount = 0;
+
+	int32_t m_TraceFrameCount = 10;
 };
\ No newline at end of file